@@ -37,6 +37,57 @@ private:
     Slime::UP _data;
 };
 
+namespace {
+
+/**
+ * Process-wide cache of decoded payloads keyed by their xxhash64.
+ * Many subscriptions typically resolve to the same config payload
+ * (same def subscribed by multiple components); sharing the decoded
+ * slime avoids decompressing and JSON-decoding the same bytes once
+ * per subscription during config convergence. Entries are weak so the
+ * cache never extends payload lifetime beyond its subscribers.
+ */
+class PayloadCache {
+public:
+    PayloadPtr find(const vespalib::string &xxhash64) {
+        std::lock_guard guard(_lock);
+        auto it = _entries.find(xxhash64);
+        if (it != _entries.end()) {
+            if (PayloadPtr payload = it->second.lock()) {
+                return payload;
+            }
+            _entries.erase(it);
+        }
+        return {};
+    }
+    void store(const vespalib::string &xxhash64, const PayloadPtr &payload) {
+        std::lock_guard guard(_lock);
+        if (++_stores_since_sweep >= SWEEP_INTERVAL) {
+            sweep();
+        }
+        _entries[xxhash64] = payload;
+    }
+private:
+    static constexpr size_t SWEEP_INTERVAL = 64;
+    void sweep() {
+        for (auto it = _entries.begin(); it != _entries.end();) {
+            if (it->second.expired()) {
+                it = _entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        _stores_since_sweep = 0;
+    }
+    std::mutex _lock;
+    std::map<vespalib::string, std::weak_ptr<const Payload>> _entries;
+    size_t _stores_since_sweep = 0;
+};
+
+PayloadCache payload_cache;
+
+}
+
 const vespalib::string FRTConfigResponseV3::RESPONSE_TYPES = "sx";
 
 FRTConfigResponseV3::FRTConfigResponseV3(FRT_RPCRequest * request)
@@ -54,6 +105,16 @@ ConfigValue
 FRTConfigResponseV3::readConfigValue() const
 {
     vespalib::string xxhash64(_data->get()[RESPONSE_CONFIG_XXHASH64].asString().make_string());
+    // An empty payload means "unchanged"; only non-empty payloads are
+    // eligible for cache lookup since the hash describes the full content.
+    if (((*_returnValues)[1]._data._len > 0)) {
+        if (PayloadPtr cached = payload_cache.find(xxhash64)) {
+            if (LOG_WOULD_LOG(spam)) {
+                LOG(spam, "shared cached config value xxhash64(%s)", xxhash64.c_str());
+            }
+            return ConfigValue(std::move(cached), xxhash64);
+        }
+    }
     CompressionInfo info;
     info.deserialize(_data->get()[RESPONSE_COMPRESSION_INFO]);
     auto slime = std::make_unique<Slime>();
@@ -69,7 +130,11 @@ FRTConfigResponseV3::readConfigValue() const
     if (LOG_WOULD_LOG(spam)) {
         LOG(spam, "read config value xxhash64(%s), payload size: %lu", xxhash64.c_str(), data.memRef.size);
     }
-    return ConfigValue(std::make_shared<V3Payload>(std::move(slime)), xxhash64);
+    auto payload = std::make_shared<V3Payload>(std::move(slime));
+    if (data.memRef.size > 0) {
+        payload_cache.store(xxhash64, payload);
+    }
+    return ConfigValue(std::move(payload), xxhash64);
 }
 
 } // namespace config
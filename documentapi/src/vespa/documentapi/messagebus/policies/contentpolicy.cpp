@@ -77,6 +77,33 @@ string ContentPolicy::init()
 
 ContentPolicy::~ContentPolicy() = default;
 
+namespace {
+
+// Upper bound on table size (2^20 entries * 4 bytes = 4 MiB); clusters with
+// more distribution bits than this fall back to computing per message.
+constexpr uint32_t MAX_CACHED_DISTRIBUTION_BITS = 20;
+
+}
+
+ContentPolicy::IdealDistributorCache::IdealDistributorCache(uint32_t distribution_bits)
+    : _entries(uint64_t(1) << distribution_bits),
+      _mask((uint32_t(1) << distribution_bits) - 1)
+{
+    for (auto& entry : _entries) {
+        entry.store(-1, std::memory_order_relaxed);
+    }
+}
+
+void
+ContentPolicy::reset_ideal_cache_locked()
+{
+    if (_state && _distribution && (_state->getDistributionBitCount() <= MAX_CACHED_DISTRIBUTION_BITS)) {
+        _ideal_cache = std::make_shared<IdealDistributorCache>(_state->getDistributionBitCount());
+    } else {
+        _ideal_cache.reset();
+    }
+}
+
 string
 ContentPolicy::createConfigId(const string & clusterName)
 {
@@ -105,6 +132,7 @@ ContentPolicy::configure(std::unique_ptr<vespa::config::content::StorDistributio
     try {
         std::lock_guard guard(_rw_lock);
         _distribution = std::make_unique<storage::lib::Distribution>(*config);
+        reset_ideal_cache_locked();
     } catch (const std::exception& e) {
         LOG(warning, "Got exception when configuring distribution, config id was %s", _clusterConfigId.c_str());
         throw e;
@@ -117,7 +145,7 @@ ContentPolicy::doSelect(mbus::RoutingContext &context)
     const mbus::Message &msg = context.getMessage();
 
     int distributor = -1;
-    auto [cur_state, cur_distribution] = internal_state_snapshot();
+    auto [cur_state, cur_distribution, ideal_cache] = internal_state_snapshot();
 
     if (cur_state) {
         document::BucketId id;
@@ -171,7 +199,20 @@ ContentPolicy::doSelect(mbus::RoutingContext &context)
         // Pick a distributor using ideal state algorithm
         try {
             assert(cur_distribution);
-            distributor = cur_distribution->getIdealDistributorNode(*cur_state, id);
+            // The cache is only consulted for buckets that are split at least
+            // as much as the distribution bit count; anything less must take
+            // the computing path so it gets the TooFewBucketBits... handling.
+            if (ideal_cache && (id.getUsedBits() >= cur_state->getDistributionBitCount())) {
+                const uint32_t seed = static_cast<uint32_t>(id.getRawId()) & ideal_cache->mask();
+                int32_t cached = ideal_cache->get(seed);
+                if (cached < 0) {
+                    cached = cur_distribution->getIdealDistributorNode(*cur_state, id);
+                    ideal_cache->set(seed, cached);
+                }
+                distributor = cached;
+            } else {
+                distributor = cur_distribution->getIdealDistributorNode(*cur_state, id);
+            }
         } catch (storage::lib::TooFewBucketBitsInUseException& e) {
             auto reply = std::make_unique<WrongDistributionReply>(cur_state->toString());
             reply->addError(mbus::Error(
@@ -245,11 +286,13 @@ ContentPolicy::updateStateFromReply(WrongDistributionReply& wdr)
         }
 
         _state = std::move(newState);
+        reset_ideal_cache_locked();
     } else {
         wdr.getTrace().trace(1, make_string("System state cleared because system state returned had version %d, "
                                             "while old state had version %d. New states should not have a lower version than the old.",
                                             newState->getVersion(), _state->getVersion()));
         _state.reset();
+        _ideal_cache.reset();
     }
 }
 
@@ -257,7 +300,7 @@ ContentPolicy::StateSnapshot
 ContentPolicy::internal_state_snapshot()
 {
     std::shared_lock guard(_rw_lock);
-    return {_state, _distribution};
+    return {_state, _distribution, _ideal_cache};
 }
 
 std::shared_ptr<const storage::lib::ClusterState>
@@ -275,6 +318,7 @@ ContentPolicy::reset_state()
     // as if no state had been cached prior.
     std::lock_guard guard(_rw_lock);
     _state.reset();
+    _ideal_cache.reset();
 }
 
 } // documentapi
@@ -6,7 +6,9 @@
 #include <vespa/vdslib/distribution/distribution.h>
 #include <vespa/document/bucket/bucketidfactory.h>
 #include <vespa/messagebus/routing/hop.h>
+#include <atomic>
 #include <shared_mutex>
+#include <vector>
 
 namespace config {
     class ICallback;
@@ -23,6 +25,31 @@ namespace documentapi {
 class ContentPolicy : public ExternSlobrokPolicy
 {
 private:
+    /**
+     * Lazily filled table of ideal distributor per superbucket. The ideal
+     * distributor for a bucket is a pure function of the bucket's lowest
+     * distribution-bit masked bits for a given (cluster state, distribution)
+     * pair, so the table maps that seed directly to a distributor index.
+     * A new table is installed whenever the cluster state or distribution
+     * config changes; readers racing with an install simply compute without
+     * a cache hit. Entries are -1 until first computed; racing fills write
+     * the same deterministic value, so relaxed atomics suffice.
+     */
+    class IdealDistributorCache {
+    public:
+        explicit IdealDistributorCache(uint32_t distribution_bits);
+        [[nodiscard]] int32_t get(uint32_t seed) const noexcept {
+            return _entries[seed].load(std::memory_order_relaxed);
+        }
+        void set(uint32_t seed, int32_t distributor) noexcept {
+            _entries[seed].store(distributor, std::memory_order_relaxed);
+        }
+        [[nodiscard]] uint32_t mask() const noexcept { return _mask; }
+    private:
+        std::vector<std::atomic<int32_t>> _entries;
+        uint32_t                          _mask;
+    };
+
     document::BucketIdFactory                         _bucketIdFactory;
     mutable std::shared_mutex                         _rw_lock;
     std::shared_ptr<const storage::lib::ClusterState> _state;
@@ -31,9 +58,16 @@ private:
     std::unique_ptr<config::ICallback>                _callBack;
     std::unique_ptr<config::ConfigFetcher>            _configFetcher;
     std::shared_ptr<const storage::lib::Distribution> _distribution;
+    std::shared_ptr<IdealDistributorCache>            _ideal_cache;
+
+    struct StateSnapshot {
+        std::shared_ptr<const storage::lib::ClusterState> state;
+        std::shared_ptr<const storage::lib::Distribution> distribution;
+        std::shared_ptr<IdealDistributorCache>            ideal_cache;
+    };
 
-    using StateSnapshot = std::pair<std::shared_ptr<const storage::lib::ClusterState>,
-                                    std::shared_ptr<const storage::lib::Distribution>>;
+    // Requires _rw_lock to be held for writing
+    void reset_ideal_cache_locked();
 
     // Acquires _lock
     [[nodiscard]] StateSnapshot internal_state_snapshot();
@@ -234,6 +234,56 @@ TEST(OnnxTest, dynamic_onnx_model_can_be_evaluated)
     //-------------------------------------------------------------------------
 }
 
+TEST(OnnxTest, batched_eval_context_can_evaluate_multiple_documents)
+{
+    Onnx model(dynamic_model, Onnx::Optimize::ENABLE);
+    Onnx::WirePlanner planner;
+
+    ValueType query_type = ValueType::from_spec("tensor<float>(a[1],b[4])");
+    EXPECT_TRUE(planner.bind_input_type(query_type, model.inputs()[0]));
+
+    ValueType attribute_type = ValueType::from_spec("tensor<float>(a[4],b[1])");
+    std::vector<float> attribute_values({5.0, 6.0, 7.0, 8.0});
+    DenseValueView attribute(attribute_type, TypedCells(attribute_values));
+    EXPECT_TRUE(planner.bind_input_type(attribute_type, model.inputs()[1]));
+
+    ValueType bias_type = ValueType::from_spec("tensor<float>(a[1],b[2])");
+    EXPECT_TRUE(planner.bind_input_type(bias_type, model.inputs()[2]));
+
+    Onnx::WireInfo wire_info = planner.get_wire_info(model);
+    Onnx::BatchedEvalContext ctx(model, wire_info, 3);
+    ASSERT_EQ(ctx.batch_size(), 3);
+    ASSERT_EQ(ctx.num_params(), 3);
+    ASSERT_EQ(ctx.num_results(), 1);
+    EXPECT_TRUE(ctx.is_batched_param(0));
+    EXPECT_FALSE(ctx.is_batched_param(1));
+    EXPECT_TRUE(ctx.is_batched_param(2));
+    //-------------------------------------------------------------------------
+    ctx.bind_param(0, 1, attribute); // shared across the batch
+    std::vector<std::vector<float>> query_rows({{1.0, 2.0, 3.0, 4.0},
+                                                {2.0, 2.0, 2.0, 2.0},
+                                                {0.0, 1.0, 0.0, 1.0}});
+    std::vector<std::vector<float>> bias_rows({{4.0, 5.0},
+                                               {1.0, 1.0},
+                                               {3.0, 0.0}});
+    for (size_t row = 0; row < 3; ++row) {
+        DenseValueView query(query_type, TypedCells(query_rows[row]));
+        DenseValueView bias(bias_type, TypedCells(bias_rows[row]));
+        ctx.bind_param(row, 0, query);
+        ctx.bind_param(row, 2, bias);
+    }
+    ctx.eval();
+    //-------------------------------------------------------------------------
+    std::vector<float> expect({79.0, 54.0, 17.0});
+    for (size_t row = 0; row < 3; ++row) {
+        auto result = ctx.get_result(row, 0);
+        EXPECT_EQ(result->type().to_spec(), "tensor<float>(d0[1],d1[1])");
+        auto cells = result->cells();
+        ASSERT_EQ(cells.size, 1);
+        EXPECT_EQ(cells.typify<float>()[0], expect[row]);
+    }
+}
+
 TEST(OnnxTest, int_types_onnx_model_can_be_evaluated)
 {
     Onnx model(int_types_model, Onnx::Optimize::ENABLE);
@@ -166,14 +166,6 @@ struct FixedForest : FastForest {
         return mask;
     }
 
-    struct Mask {
-        float value;
-        uint32_t tree;
-        T bits;
-        Mask(float v, uint32_t t, T b) noexcept
-            : value(v), tree(t), bits(b) {}
-    };
-
     struct DMask {
         uint32_t tree;
         T bits;
@@ -181,8 +173,14 @@ struct FixedForest : FastForest {
             : tree(t), bits(b) {}
     };
 
+    // Masks for a feature are stored sorted by threshold, with the
+    // thresholds split out into their own densely packed array. This
+    // lets eval find the cut-off for a feature value with a binary
+    // search over floats only and apply the covered masks without
+    // comparing anything per element.
     std::vector<uint32_t> _mask_sizes;
-    std::vector<Mask>     _masks;
+    std::vector<float>    _mask_values;
+    std::vector<DMask>    _masks;
     std::vector<uint32_t> _default_offsets;
     std::vector<DMask>    _default_masks;
     std::vector<float>    _padded_leafs;
@@ -193,7 +191,6 @@ struct FixedForest : FastForest {
     static FastForest::UP try_build(const State &state, size_t min_fixed, size_t max_fixed);
 
     void init_state(T *ctx_masks) const;
-    static void apply_masks(T *ctx_masks, const Mask *pos, const Mask *end, float limit);
     static void apply_masks(T *ctx_masks, const DMask *pos, const DMask *end);
     double get_result(const T *ctx_masks) const;
 
@@ -205,6 +202,7 @@ struct FixedForest : FastForest {
 template <typename T>
 FixedForest<T>::FixedForest(const State &state)
     : _mask_sizes(),
+      _mask_values(),
       _masks(),
       _default_offsets(),
       _default_masks(),
@@ -216,7 +214,8 @@ FixedForest<T>::FixedForest(const State &state)
         _mask_sizes.emplace_back(cmp_nodes.size());
         _default_offsets.push_back(_default_masks.size());
         for (const CmpNode &cmp_node: cmp_nodes) {
-            _masks.emplace_back(cmp_node.value, cmp_node.tree_id, make_mask(cmp_node));
+            _mask_values.push_back(cmp_node.value);
+            _masks.emplace_back(cmp_node.tree_id, make_mask(cmp_node));
             if (cmp_node.false_is_default) {
                 _default_masks.emplace_back(cmp_node.tree_id, make_mask(cmp_node));
             }
@@ -255,21 +254,6 @@ FixedForest<T>::init_state(T *ctx_masks) const
     memset(ctx_masks, 0xff, _num_trees * sizeof(T));
 }
 
-template <typename T>
-void
-FixedForest<T>::apply_masks(T *ctx_masks, const Mask *pos, const Mask *end, float limit)
-{
-    for (; ((pos+3) < end) && !(limit < pos[3].value); pos += 4) {
-        ctx_masks[pos[0].tree] &= pos[0].bits;
-        ctx_masks[pos[1].tree] &= pos[1].bits;
-        ctx_masks[pos[2].tree] &= pos[2].bits;
-        ctx_masks[pos[3].tree] &= pos[3].bits;
-    }
-    for (; (pos < end) && !(limit < pos->value); ++pos) {
-        ctx_masks[pos->tree] &= pos->bits;
-    }
-}
-
 template <typename T>
 void
 FixedForest<T>::apply_masks(T *ctx_masks, const DMask *pos, const DMask *end)
@@ -319,18 +303,22 @@ FixedForest<T>::eval(Context &context, const float *params) const
 {
     T *ctx_masks = &static_cast<FixedContext<T>&>(context).masks[0];
     init_state(ctx_masks);
-    const Mask *mask_pos = &_masks[0];
+    const DMask *mask_pos = &_masks[0];
+    const float *value_pos = &_mask_values[0];
     const float *param_pos = params;
     for (uint32_t size: _mask_sizes) {
         float feature = *param_pos++;
         if (!std::isnan(feature)) {
-            apply_masks(ctx_masks, mask_pos, mask_pos + size, feature);
+            // masks are sorted by threshold; apply all with threshold <= feature
+            size_t cnt = (std::upper_bound(value_pos, value_pos + size, feature) - value_pos);
+            apply_masks(ctx_masks, mask_pos, mask_pos + cnt);
         } else {
             apply_masks(ctx_masks,
                         &_default_masks[_default_offsets[(param_pos-params)-1]],
                         &_default_masks[_default_offsets[(param_pos-params)]]);
         }
         mask_pos += size;
+        value_pos += size;
     }
     return get_result(ctx_masks);
 }
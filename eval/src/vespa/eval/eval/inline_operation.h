@@ -176,4 +176,29 @@ struct DotProduct<double,double> {
 
 //-----------------------------------------------------------------------------
 
+template <typename CT>
+struct MultiplyAdd {
+    static void apply(CT * dst, CT factor, const CT * src, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] += factor * src[i];
+        }
+    }
+};
+
+template <>
+struct MultiplyAdd<float> {
+    static void apply(float * dst, float factor, const float * src, size_t count) {
+        cblas_saxpy(count, factor, src, 1, dst, 1);
+    }
+};
+
+template <>
+struct MultiplyAdd<double> {
+    static void apply(double * dst, double factor, const double * src, size_t count) {
+        cblas_daxpy(count, factor, src, 1, dst, 1);
+    }
+};
+
+//-----------------------------------------------------------------------------
+
 }
@@ -61,7 +61,9 @@ InterpretedFunction::State::~State() = default;
 void
 InterpretedFunction::State::init(const LazyParams &params_in) {
     params = &params_in;
-    stash.clear();
+    // Keep stash memory across evaluations; intermediate values tend
+    // to have the same shapes for each document ranked by a program.
+    stash.reuse();
     stack.clear();
     program_offset = 0;
     if_cnt = 0;
@@ -1,6 +1,7 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "mapped_lookup.h"
+#include <vespa/eval/eval/inline_operation.h>
 #include <vespa/eval/eval/wrap_param.h>
 #include <vespa/eval/eval/fast_value.hpp>
 #include <vespa/vespalib/util/require.h>
@@ -31,9 +32,7 @@ ConstArrayRef<CT> my_mapped_lookup_fallback(const Value::Index &key_idx, const V
         if (inner->next_result(sparse.second_only_address, sparse.second_subspace)) {
             auto factor = key_cells[sparse.lhs_subspace];
             const CT *match = map_cells + (res_size * sparse.rhs_subspace);
-            for (size_t i = 0; i < result.size(); ++i) {
-                result[i] += factor * match[i];
-            }
+            MultiplyAdd<CT>::apply(result.data(), factor, match, result.size());
         }
     }
     return result;
@@ -45,9 +44,7 @@ struct MappedLookupResult {
     MappedLookupResult(size_t res_size, Stash &stash)
       : value(stash.create_array<CT>(res_size)) {}
     void process_match(CT factor, const CT *match) {
-        for (size_t i = 0; i < value.size(); ++i) {
-            value[i] += factor * match[i];
-        }
+        MultiplyAdd<CT>::apply(value.data(), factor, match, value.size());
     }
 };
 
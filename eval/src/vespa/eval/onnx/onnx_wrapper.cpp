@@ -609,6 +609,144 @@ Onnx::EvalContext::get_result(size_t i) const
 
 //-----------------------------------------------------------------------------
 
+template <typename SRC, typename DST>
+void
+Onnx::BatchedEvalContext::bind_param_row(BatchedEvalContext &self, size_t row, size_t idx, const Value &param)
+{
+    auto cells = param.cells().typify<SRC>();
+    size_t n = self._param_row_cells[idx];
+    assert(cells.size() == n);
+    assert(row < self._batch_size);
+    const SRC *src = cells.data();
+    DST *dst = self._param_values[idx].GetTensorMutableData<DST>();
+    if (self._batched_params[idx]) {
+        dst += (row * n);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = DST(src[i]);
+    }
+}
+
+template <typename SRC, typename DST>
+Value::UP
+Onnx::BatchedEvalContext::extract_result_row(BatchedEvalContext &self, size_t row, size_t idx)
+{
+    assert(row < self._batch_size);
+    size_t n = self._result_row_cells[idx];
+    const SRC *src = self._result_values[idx].GetTensorMutableData<SRC>() + (row * n);
+    const ValueType &type = self._wire_info.vespa_outputs[idx];
+    if constexpr (std::is_same_v<SRC,DST>) {
+        ConstArrayRef<DST> cells(src, n);
+        return std::make_unique<DenseValueView>(type, TypedCells(cells));
+    } else {
+        std::vector<DST> cells(n, DST{});
+        for (size_t i = 0; i < n; ++i) {
+            cells[i] = DST(src[i]);
+        }
+        return std::make_unique<DenseCellsValue<DST>>(type, std::move(cells));
+    }
+}
+
+struct Onnx::BatchedEvalContext::SelectBindParamRow {
+    template <typename ...Ts> static auto invoke() { return bind_param_row<Ts...>; }
+    auto operator()(CellType ct, Onnx::ElementType et) {
+        return typify_invoke<2,MyTypify,SelectBindParamRow>(ct, et);
+    }
+};
+
+struct Onnx::BatchedEvalContext::SelectExtractResultRow {
+    template <typename ...Ts> static auto invoke() { return extract_result_row<Ts...>; }
+    auto operator()(Onnx::ElementType et, CellType ct) {
+        return typify_invoke<2,MyTypify,SelectExtractResultRow>(et, ct);
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+Onnx::BatchedEvalContext::BatchedEvalContext(const Onnx &model, const WireInfo &wire_info, size_t batch_size)
+    : _model(model),
+      _wire_info(wire_info),
+      _batch_size(batch_size),
+      _batched_params(),
+      _param_row_cells(),
+      _result_row_cells(),
+      _param_values(),
+      _result_values(),
+      _param_binders(),
+      _result_extractors()
+{
+    assert(_batch_size > 0);
+    assert(_wire_info.vespa_inputs.size()  == _model.inputs().size());
+    assert(_wire_info.onnx_inputs.size()   == _model.inputs().size());
+    assert(_wire_info.onnx_outputs.size()  == _model.outputs().size());
+    assert(_wire_info.vespa_outputs.size() == _model.outputs().size());
+    _param_values.reserve(_model.inputs().size());
+    _result_values.reserve(_model.outputs().size());
+    for (size_t i = 0; i < _model.inputs().size(); ++i) {
+        const auto &vespa = _wire_info.vespa_inputs[i];
+        const auto &onnx = _wire_info.onnx_inputs[i];
+        const auto &info = _model.inputs()[i];
+        bool batched = (!info.dimensions.empty() && info.dimensions[0].is_symbolic());
+        auto dims = onnx.dimensions;
+        size_t row_cells = 1;
+        for (int64_t dim: dims) {
+            row_cells *= dim;
+        }
+        if (batched) {
+            // the wire plan must describe a single batch element
+            assert(!dims.empty() && (dims[0] == 1));
+            dims[0] = _batch_size;
+        }
+        _batched_params.push_back(batched);
+        _param_row_cells.push_back(row_cells);
+        _param_values.push_back(CreateOnnxTensor()(TensorType(onnx.elements, std::move(dims)), _alloc));
+        _param_binders.push_back(SelectBindParamRow()(vespa.cell_type(), onnx.elements));
+    }
+    for (size_t i = 0; i < _model.outputs().size(); ++i) {
+        const auto &vespa = _wire_info.vespa_outputs[i];
+        const auto &onnx = _wire_info.onnx_outputs[i];
+        const auto &info = _model.outputs()[i];
+        // all outputs must be batched for results to be scattered back
+        assert(!info.dimensions.empty() && info.dimensions[0].is_symbolic());
+        auto dims = onnx.dimensions;
+        assert(!dims.empty() && (dims[0] == 1));
+        size_t row_cells = 1;
+        for (int64_t dim: dims) {
+            row_cells *= dim;
+        }
+        dims[0] = _batch_size;
+        _result_row_cells.push_back(row_cells);
+        _result_values.push_back(CreateOnnxTensor()(TensorType(onnx.elements, std::move(dims)), _alloc));
+        _result_extractors.push_back(SelectExtractResultRow()(onnx.elements, vespa.cell_type()));
+    }
+}
+
+Onnx::BatchedEvalContext::~BatchedEvalContext() = default;
+
+void
+Onnx::BatchedEvalContext::bind_param(size_t row, size_t i, const Value &param)
+{
+    _param_binders[i](*this, row, i, param);
+}
+
+void
+Onnx::BatchedEvalContext::eval()
+{
+    auto &session = const_cast<Ort::Session&>(_model._session);
+    Ort::RunOptions run_opts(nullptr);
+    session.Run(run_opts,
+                _model._input_name_refs.data(), _param_values.data(), _param_values.size(),
+                _model._output_name_refs.data(), _result_values.data(), _result_values.size());
+}
+
+Value::UP
+Onnx::BatchedEvalContext::get_result(size_t row, size_t i)
+{
+    return _result_extractors[i](*this, row, i);
+}
+
+//-----------------------------------------------------------------------------
+
 Ort::AllocatorWithDefaultOptions Onnx::_alloc;
 
 Onnx::Shared::Shared()
@@ -137,6 +137,53 @@ public:
         const Value &get_result(size_t i) const;
     };
 
+    // batched evaluation context; use one per thread and keep model/wire_info alive
+    // collects the inputs of 'batch_size' evaluations along the batch
+    // dimension of the model and runs a single onnxruntime session
+    // call for all of them. model inputs starting with a symbolic
+    // (batch) dimension are bound once per row; other inputs are
+    // shared across the batch and bound once (with row 0). all model
+    // outputs must start with a symbolic dimension. results are
+    // extracted per row after eval; when no cell conversion is needed
+    // the returned value is a view that is only valid until the next
+    // evaluation.
+    class BatchedEvalContext {
+    private:
+        using param_fun_t = void (*)(BatchedEvalContext &, size_t row, size_t i, const Value &);
+        using result_fun_t = Value::UP (*)(BatchedEvalContext &, size_t row, size_t i);
+
+        const Onnx                &_model;
+        const WireInfo            &_wire_info;
+        size_t                     _batch_size;
+        std::vector<bool>          _batched_params;
+        std::vector<size_t>        _param_row_cells;
+        std::vector<size_t>        _result_row_cells;
+        std::vector<Ort::Value>    _param_values;
+        std::vector<Ort::Value>    _result_values;
+        std::vector<param_fun_t>   _param_binders;
+        std::vector<result_fun_t>  _result_extractors;
+
+        template <typename SRC, typename DST>
+        static void bind_param_row(BatchedEvalContext &self, size_t row, size_t idx, const Value &param);
+
+        template <typename SRC, typename DST>
+        static Value::UP extract_result_row(BatchedEvalContext &self, size_t row, size_t idx);
+
+    public:
+        struct SelectBindParamRow;
+        struct SelectExtractResultRow;
+
+        BatchedEvalContext(const Onnx &model, const WireInfo &wire_info, size_t batch_size);
+        ~BatchedEvalContext();
+        size_t batch_size() const { return _batch_size; }
+        size_t num_params() const { return _param_values.size(); }
+        size_t num_results() const { return _result_values.size(); }
+        bool is_batched_param(size_t i) const { return _batched_params[i]; }
+        void bind_param(size_t row, size_t i, const Value &param);
+        void eval();
+        Value::UP get_result(size_t row, size_t i);
+    };
+
 private:
     // common stuff shared between model sessions
     class Shared {
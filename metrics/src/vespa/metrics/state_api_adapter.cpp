@@ -16,6 +16,14 @@ StateApiAdapter::getMetrics(const vespalib::string &consumer, ExpositionFormat f
         return ""; // no configuration or snapshots yet
     }
     const MetricSnapshot& snapshot(_manager.getMetricSnapshot(guard, periods[0]));
+    CacheKey key(consumer, format);
+    {
+        std::lock_guard cache_guard(_cache_lock);
+        auto it = _cache.find(key);
+        if ((it != _cache.end()) && (it->second.snapshot_to_time == snapshot.getToTime())) {
+            return it->second.text;
+        }
+    }
     vespalib::asciistream out;
     // Using `switch` instead of `if` so that we fail with a compiler warning -> error if
     // we add another enum value and forget to add a case for it here.
@@ -35,7 +43,12 @@ StateApiAdapter::getMetrics(const vespalib::string &consumer, ExpositionFormat f
             break;
         }
     }
-    return out.str();
+    vespalib::string text = out.str();
+    {
+        std::lock_guard cache_guard(_cache_lock);
+        _cache[key] = CachedRendering{snapshot.getToTime(), text};
+    }
+    return text;
 }
 
 vespalib::string
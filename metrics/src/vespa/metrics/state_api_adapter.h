@@ -3,6 +3,9 @@
 #pragma once
 
 #include <vespa/vespalib/net/http/metrics_producer.h>
+#include <vespa/vespalib/util/time.h>
+#include <map>
+#include <mutex>
 
 namespace metrics {
 
@@ -12,11 +15,23 @@ class MetricManager;
  * This is an adapter class that implements the metrics producer
  * interface defined by the state api implementation in vespalib by
  * extracting metrics in JSON or Prometheus format from a metric manager.
+ *
+ * Rendered output is cached per (consumer, format) for as long as the
+ * underlying snapshot is unchanged, so concurrent scrapers share one
+ * rendering per snapshot period instead of re-rendering the same data.
  **/
 class StateApiAdapter : public vespalib::MetricsProducer
 {
 private:
+    struct CachedRendering {
+        vespalib::system_time snapshot_to_time;
+        vespalib::string      text;
+    };
+    using CacheKey = std::pair<vespalib::string, ExpositionFormat>;
+
     MetricManager &_manager;
+    std::mutex     _cache_lock;
+    std::map<CacheKey, CachedRendering> _cache;
 
 public:
     explicit StateApiAdapter(MetricManager &manager) : _manager(manager) {}
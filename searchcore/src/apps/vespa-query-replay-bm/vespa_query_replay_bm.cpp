@@ -0,0 +1,425 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/document/config/documenttypes_config_fwd.h>
+#include <vespa/document/repo/configbuilder.h>
+#include <vespa/document/repo/document_type_repo_factory.h>
+#include <vespa/document/repo/documenttyperepo.h>
+#include <vespa/document/datatype/datatype.h>
+#include <vespa/vespalib/util/signalhandler.h>
+#include <vespa/searchcore/bmcluster/avg_sampler.h>
+#include <vespa/searchcore/bmcluster/bm_cluster.h>
+#include <vespa/searchcore/bmcluster/bm_cluster_params.h>
+#include <vespa/searchcore/bmcluster/bm_feed.h>
+#include <vespa/searchcore/bmcluster/bm_feeder.h>
+#include <vespa/searchcore/bmcluster/bm_feed_params.h>
+#include <vespa/searchcore/bmcluster/bm_node.h>
+#include <vespa/searchcore/bmcluster/bm_range.h>
+#include <vespa/searchcore/bmcluster/bucket_selector.h>
+#include <vespa/searchcore/proton/common/doctypename.h>
+#include <vespa/searchcore/proton/matchengine/matchengine.h>
+#include <vespa/searchcore/proton/server/searchhandlerproxy.h>
+#include <vespa/searchlib/engine/searchapi.h>
+#include <vespa/searchlib/index/dummyfileheadercontext.h>
+#include <vespa/searchlib/query/tree/querybuilder.h>
+#include <vespa/searchlib/query/tree/simplequery.h>
+#include <vespa/searchlib/query/tree/stackdumpcreator.h>
+#include <vespa/vespalib/util/stringfmt.h>
+#include <vespa/vespalib/util/threadstackexecutor.h>
+#include <getopt.h>
+#include <cinttypes>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+#include <vespa/log/log.h>
+LOG_SETUP("vespa-query-replay-bm");
+
+using namespace proton;
+using namespace std::chrono_literals;
+
+using document::DocumentTypeRepo;
+using document::DocumentTypeRepoFactory;
+using search::bmcluster::AvgSampler;
+using search::bmcluster::BmClusterParams;
+using search::bmcluster::BmCluster;
+using search::bmcluster::BmFeed;
+using search::bmcluster::BmFeedParams;
+using search::bmcluster::BmFeeder;
+using search::bmcluster::BmNode;
+using search::bmcluster::BmRange;
+using search::bmcluster::BucketSelector;
+using search::engine::SearchReply;
+using search::engine::SearchRequest;
+using search::index::DummyFileHeaderContext;
+using search::query::QueryBuilder;
+using search::query::SimpleQueryNodeTypes;
+using search::query::StackDumpCreator;
+using search::query::Weight;
+
+namespace {
+
+vespalib::string base_dir = "testdb";
+constexpr int base_port = 9017;
+
+std::shared_ptr<DocumenttypesConfig> make_document_types() {
+    using Struct = document::config_builder::Struct;
+    using DataType = document::DataType;
+    document::config_builder::DocumenttypesConfigBuilderHelper builder;
+    builder.document(42, "test", Struct("test.header").addField("int", DataType::T_INT), Struct("test.body"));
+    return std::make_shared<DocumenttypesConfig>(builder.config());
+}
+
+class BMParams : public BmClusterParams,
+                 public BmFeedParams
+{
+    uint32_t         _query_clients;
+    uint32_t         _query_passes;
+    uint32_t         _queries;
+    vespalib::string _query_file;
+public:
+    BMParams()
+        : BmClusterParams(),
+          BmFeedParams(),
+          _query_clients(1),
+          _query_passes(4),
+          _queries(1000),
+          _query_file()
+    {
+    }
+    uint32_t get_query_clients() const { return _query_clients; }
+    uint32_t get_query_passes() const { return _query_passes; }
+    uint32_t get_queries() const { return _queries; }
+    const vespalib::string& get_query_file() const { return _query_file; }
+    void set_query_clients(uint32_t query_clients_in) { _query_clients = query_clients_in; }
+    void set_query_passes(uint32_t query_passes_in) { _query_passes = query_passes_in; }
+    void set_queries(uint32_t queries_in) { _queries = queries_in; }
+    void set_query_file(const vespalib::string& query_file_in) { _query_file = query_file_in; }
+    bool check() const;
+};
+
+bool
+BMParams::check() const
+{
+    if (!BmClusterParams::check()) {
+        return false;
+    }
+    if (!BmFeedParams::check()) {
+        return false;
+    }
+    if (_query_clients < 1) {
+        std::cerr << "Query clients too low: " << _query_clients << std::endl;
+        return false;
+    }
+    if (_query_passes < 1) {
+        std::cerr << "Query passes too low: " << _query_passes << std::endl;
+        return false;
+    }
+    return true;
+}
+
+class NullSearchClient : public search::engine::SearchClient {
+public:
+    void searchDone(SearchReply::UP) override { }
+};
+
+vespalib::string
+make_term_stack_dump(const vespalib::string& field, const vespalib::string& term)
+{
+    QueryBuilder<SimpleQueryNodeTypes> builder;
+    builder.addStringTerm(term, field, 1, Weight(100));
+    return StackDumpCreator::create(*builder.build());
+}
+
+/*
+ * Load recorded queries from file; each line holds "field:term". Lines
+ * that are empty or start with '#' are skipped.
+ */
+std::vector<vespalib::string>
+load_query_stack_dumps(const vespalib::string& query_file)
+{
+    std::vector<vespalib::string> stack_dumps;
+    std::ifstream input(query_file.c_str());
+    std::string line;
+    while (std::getline(input, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        auto split = line.find(':');
+        if (split == std::string::npos || split == 0u) {
+            std::cerr << "Skipping malformed query line: " << line << std::endl;
+            continue;
+        }
+        stack_dumps.emplace_back(make_term_stack_dump(line.substr(0, split), line.substr(split + 1)));
+    }
+    return stack_dumps;
+}
+
+std::vector<vespalib::string>
+make_synthetic_stack_dumps(uint32_t queries, uint32_t documents)
+{
+    std::vector<vespalib::string> stack_dumps;
+    stack_dumps.reserve(queries);
+    for (uint32_t i = 0; i < queries; ++i) {
+        stack_dumps.emplace_back(make_term_stack_dump("int", vespalib::make_string("%u", i % std::max(1u, documents))));
+    }
+    return stack_dumps;
+}
+
+double
+percentile(const std::vector<double>& sorted_latencies, double pct)
+{
+    if (sorted_latencies.empty()) {
+        return 0.0;
+    }
+    size_t idx = std::min(sorted_latencies.size() - 1,
+                          static_cast<size_t>(pct * sorted_latencies.size() / 100.0));
+    return sorted_latencies[idx];
+}
+
+}
+
+class Benchmark {
+    BMParams                                   _params;
+    std::shared_ptr<const DocumenttypesConfig> _document_types;
+    std::shared_ptr<const DocumentTypeRepo>    _repo;
+    std::unique_ptr<BmCluster>                 _cluster;
+    BmFeed                                     _feed;
+
+    void feed_documents();
+    void benchmark_queries(MatchEngine& match_engine, const std::vector<vespalib::string>& stack_dumps);
+public:
+    explicit Benchmark(const BMParams& params);
+    ~Benchmark();
+    void run();
+};
+
+Benchmark::Benchmark(const BMParams& params)
+    : _params(params),
+      _document_types(make_document_types()),
+      _repo(document::DocumentTypeRepoFactory::make(*_document_types)),
+      _cluster(std::make_unique<BmCluster>(base_dir, base_port, _params, _document_types, _repo)),
+      _feed(_repo)
+{
+    _cluster->make_nodes();
+}
+
+Benchmark::~Benchmark() = default;
+
+void
+Benchmark::feed_documents()
+{
+    vespalib::ThreadStackExecutor executor(_params.get_client_threads());
+    BmFeeder feeder(_repo, *_cluster->get_feed_handler(), executor);
+    auto put_feed = _feed.make_feed(executor, _params, [this](BmRange range, BucketSelector bucket_selector) { return _feed.make_put_feed(range, bucket_selector); }, _feed.num_buckets(), "put");
+    int64_t time_bias = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch() - 24h).count();
+    AvgSampler sampler;
+    LOG(info, "putAsync: %u small documents", _params.get_documents());
+    feeder.run_feed_tasks(0, time_bias, put_feed, _params, sampler, "put");
+}
+
+void
+Benchmark::benchmark_queries(MatchEngine& match_engine, const std::vector<vespalib::string>& stack_dumps)
+{
+    uint32_t clients = _params.get_query_clients();
+    uint32_t passes = _params.get_query_passes();
+    LOG(info, "--------------------------------");
+    LOG(info, "search: %zu queries, passes=%u, clients=%u", stack_dumps.size(), passes, clients);
+    NullSearchClient search_client;
+    std::vector<std::vector<double>> client_latencies(clients);
+    std::atomic<uint64_t> failed_queries(0);
+    auto bench_start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    workers.reserve(clients);
+    for (uint32_t client = 0; client < clients; ++client) {
+        workers.emplace_back([&match_engine, &stack_dumps, &search_client, &client_latencies, &failed_queries, passes, client]() {
+            auto& latencies = client_latencies[client];
+            latencies.reserve(passes * stack_dumps.size());
+            for (uint32_t pass = 0; pass < passes; ++pass) {
+                for (const auto& stack_dump : stack_dumps) {
+                    auto request = std::make_unique<SearchRequest>();
+                    request->setTimeout(10s);
+                    request->maxhits = 10;
+                    request->stackDump.assign(stack_dump.data(), stack_dump.data() + stack_dump.size());
+                    auto start = std::chrono::steady_clock::now();
+                    auto reply = match_engine.search(std::move(request), search_client);
+                    auto elapsed = std::chrono::steady_clock::now() - start;
+                    if (!reply) {
+                        ++failed_queries;
+                        continue;
+                    }
+                    latencies.push_back(std::chrono::duration<double, std::milli>(elapsed).count());
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - bench_start).count();
+    std::vector<double> latencies;
+    for (const auto& client_latency : client_latencies) {
+        latencies.insert(latencies.end(), client_latency.begin(), client_latency.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    double sum = 0.0;
+    for (double latency : latencies) {
+        sum += latency;
+    }
+    double avg = latencies.empty() ? 0.0 : sum / latencies.size();
+    LOG(info, "search: %zu queries in %.3f s, %8.2f queries/s, failed=%" PRIu64,
+        latencies.size(), elapsed_s, (elapsed_s > 0.0) ? latencies.size() / elapsed_s : 0.0,
+        failed_queries.load());
+    LOG(info, "search: latency_ms avg=%.3f p50=%.3f p95=%.3f p99=%.3f max=%.3f",
+        avg, percentile(latencies, 50.0), percentile(latencies, 95.0), percentile(latencies, 99.0),
+        latencies.empty() ? 0.0 : latencies.back());
+    LOG(info, "--------------------------------");
+}
+
+void
+Benchmark::run()
+{
+    _cluster->start(_feed);
+    feed_documents();
+    auto stack_dumps = _params.get_query_file().empty()
+                       ? make_synthetic_stack_dumps(_params.get_queries(), _params.get_documents())
+                       : load_query_stack_dumps(_params.get_query_file());
+    if (stack_dumps.empty()) {
+        LOG(error, "No queries to replay");
+    } else {
+        MatchEngine match_engine(_params.get_query_clients(), 1, 0, false);
+        match_engine.setNodeUp(true);
+        auto node = _cluster->get_node(0);
+        match_engine.putSearchHandler(DocTypeName("test"),
+                                      std::make_shared<SearchHandlerProxy>(node->get_document_db()));
+        benchmark_queries(match_engine, stack_dumps);
+        match_engine.close();
+    }
+    _cluster->stop();
+}
+
+class App
+{
+    BMParams _bm_params;
+public:
+    App();
+    ~App();
+    void usage();
+    bool get_options(int argc, char **argv);
+    int main(int argc, char **argv);
+};
+
+App::App()
+    : _bm_params()
+{
+}
+
+App::~App() = default;
+
+void
+App::usage()
+{
+    std::cerr <<
+        "vespa-query-replay-bm version 0.0\n"
+        "\n"
+        "USAGE:\n";
+    std::cerr <<
+        "vespa-query-replay-bm\n"
+        "[--client-threads threads]\n"
+        "[--documents documents]\n"
+        "[--indexing-sequencer [latency,throughput,adaptive]]\n"
+        "[--max-pending max-pending]\n"
+        "[--queries queries]\n"
+        "[--query-clients clients]\n"
+        "[--query-file file]\n"
+        "[--query-passes passes]" << std::endl;
+}
+
+bool
+App::get_options(int argc, char **argv)
+{
+    int c;
+    int long_opt_index = 0;
+    static struct option long_opts[] = {
+        { "client-threads", 1, nullptr, 0 },
+        { "documents", 1, nullptr, 0 },
+        { "indexing-sequencer", 1, nullptr, 0 },
+        { "max-pending", 1, nullptr, 0 },
+        { "queries", 1, nullptr, 0 },
+        { "query-clients", 1, nullptr, 0 },
+        { "query-file", 1, nullptr, 0 },
+        { "query-passes", 1, nullptr, 0 },
+        { nullptr, 0, nullptr, 0 }
+    };
+    enum longopts_enum {
+        LONGOPT_CLIENT_THREADS,
+        LONGOPT_DOCUMENTS,
+        LONGOPT_INDEXING_SEQUENCER,
+        LONGOPT_MAX_PENDING,
+        LONGOPT_QUERIES,
+        LONGOPT_QUERY_CLIENTS,
+        LONGOPT_QUERY_FILE,
+        LONGOPT_QUERY_PASSES
+    };
+    optind = 1;
+    while ((c = getopt_long(argc, argv, "", long_opts, &long_opt_index)) != -1) {
+        switch (c) {
+        case 0:
+            switch(long_opt_index) {
+            case LONGOPT_CLIENT_THREADS:
+                _bm_params.set_client_threads(atoi(optarg));
+                break;
+            case LONGOPT_DOCUMENTS:
+                _bm_params.set_documents(atoi(optarg));
+                break;
+            case LONGOPT_INDEXING_SEQUENCER:
+                _bm_params.set_indexing_sequencer(optarg);
+                break;
+            case LONGOPT_MAX_PENDING:
+                _bm_params.set_max_pending(atoi(optarg));
+                break;
+            case LONGOPT_QUERIES:
+                _bm_params.set_queries(atoi(optarg));
+                break;
+            case LONGOPT_QUERY_CLIENTS:
+                _bm_params.set_query_clients(atoi(optarg));
+                break;
+            case LONGOPT_QUERY_FILE:
+                _bm_params.set_query_file(optarg);
+                break;
+            case LONGOPT_QUERY_PASSES:
+                _bm_params.set_query_passes(atoi(optarg));
+                break;
+            default:
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+    return _bm_params.check();
+}
+
+int
+App::main(int argc, char **argv)
+{
+    if (!get_options(argc, argv)) {
+        usage();
+        return 1;
+    }
+    std::filesystem::remove_all(std::filesystem::path(base_dir));
+    Benchmark bm(_bm_params);
+    bm.run();
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    vespalib::SignalHandler::PIPE.ignore();
+    DummyFileHeaderContext::setCreator("vespa-query-replay-bm");
+    App app;
+    auto exit_value = app.main(argc, argv);
+    std::filesystem::remove_all(std::filesystem::path(base_dir));
+    return exit_value;
+}
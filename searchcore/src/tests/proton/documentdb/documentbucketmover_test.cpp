@@ -130,7 +130,7 @@ ControllerFixtureBase::ControllerFixtureBase(const BlockableMaintenanceJobConfig
       _metrics("test", 1),
       _bmj(BucketMoveJob::create(_calc, RetainGuard(_refCount), _moveHandler, _modifiedHandler, _master, _bucketExecutor, _ready._subDb,
                                  _notReady._subDb, _bucketCreateNotifier, _clusterStateHandler, _bucketHandler,
-                                 _diskMemUsageNotifier, blockableConfig, "test", makeBucketSpace())),
+                                 _diskMemUsageNotifier, blockableConfig, "test", makeBucketSpace(), 1)),
       _runner(*_bmj)
 {
 }
@@ -56,6 +56,20 @@ TEST_F(JobTest, job_returns_false_when_multiple_move_operations_or_compaction_ar
     assertJobContext(4, 7, 3, 7, 1);
 }
 
+TEST_F(JobTest, multiple_move_operations_are_started_per_invocation_in_bulk_mode)
+{
+    init_with_max_docs_to_move_per_invoke(3);
+    setupThreeDocumentsToCompact();
+    EXPECT_FALSE(run()); // all three moves are started by a single invocation
+    sync();
+    // The moves complete in bucket executor order, so only assert order-independent state.
+    EXPECT_EQ(3u, _handler->_handleMoveCnt);
+    EXPECT_EQ(3u, _storer._moveCnt);
+    endScan().compact();
+    EXPECT_EQ(7u, _handler->_wantedLidLimit);
+    EXPECT_EQ(1u, _storer._compactCnt);
+}
+
 TEST_F(JobTest, job_document_is_not_moved_if_meta_has_changed)
 {
     setupThreeDocumentsToCompact();
@@ -45,11 +45,13 @@ JobTestBase::init(uint32_t allowedLidBloat,
           double resourceLimitFactor,
           vespalib::duration interval,
           bool node_retired_or_maintenance,
-          uint32_t maxOutstandingMoveOps)
+          uint32_t maxOutstandingMoveOps,
+          uint32_t maxDocsToMovePerInvoke)
 {
     _handler = std::make_shared<MyHandler>(maxOutstandingMoveOps != MAX_OUTSTANDING_MOVE_OPS, true);
     DocumentDBLidSpaceCompactionConfig compactCfg(interval, allowedLidBloat, allowedLidBloatFactor,
-                                                  REMOVE_BATCH_BLOCK_RATE, REMOVE_BLOCK_RATE, false);
+                                                  REMOVE_BATCH_BLOCK_RATE, REMOVE_BLOCK_RATE, false,
+                                                  maxDocsToMovePerInvoke);
     BlockableMaintenanceJobConfig blockableCfg(resourceLimitFactor, maxOutstandingMoveOps);
 
     _job.reset();
@@ -181,9 +183,11 @@ JobTest::init(uint32_t allowedLidBloat,
               double resourceLimitFactor,
               vespalib::duration interval,
               bool node_retired_or_maintenance,
-              uint32_t maxOutstandingMoveOps)
+              uint32_t maxOutstandingMoveOps,
+              uint32_t maxDocsToMovePerInvoke)
 {
-    JobTestBase::init(allowedLidBloat, allowedLidBloatFactor, resourceLimitFactor, interval, node_retired_or_maintenance, maxOutstandingMoveOps);
+    JobTestBase::init(allowedLidBloat, allowedLidBloatFactor, resourceLimitFactor, interval, node_retired_or_maintenance,
+                      maxOutstandingMoveOps, maxDocsToMovePerInvoke);
     _jobRunner = std::make_unique<MyDirectJobRunner>(*_job);
 }
 
@@ -197,6 +201,12 @@ JobTest::init_with_node_retired(bool retired) {
     init(ALLOWED_LID_BLOAT, ALLOWED_LID_BLOAT_FACTOR, RESOURCE_LIMIT_FACTOR, JOB_DELAY, retired);
 }
 
+void
+JobTest::init_with_max_docs_to_move_per_invoke(uint32_t maxDocsToMovePerInvoke) {
+    init(ALLOWED_LID_BLOAT, ALLOWED_LID_BLOAT_FACTOR, RESOURCE_LIMIT_FACTOR, JOB_DELAY, false,
+         MAX_OUTSTANDING_MOVE_OPS, maxDocsToMovePerInvoke);
+}
+
 
 JobDisabledByRemoveOpsTest::JobDisabledByRemoveOpsTest() : JobTest() {}
 JobDisabledByRemoveOpsTest::~JobDisabledByRemoveOpsTest() = default;
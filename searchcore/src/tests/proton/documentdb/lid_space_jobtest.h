@@ -25,7 +25,8 @@ struct JobTestBase : public ::testing::Test {
               double resourceLimitFactor,
               vespalib::duration interval,
               bool nodeRetired,
-              uint32_t maxOutstandingMoveOps);
+              uint32_t maxOutstandingMoveOps,
+              uint32_t maxDocsToMovePerInvoke = 1);
     JobTestBase &addStats(uint32_t docIdLimit,
                           const LidVector &usedLids,
                           const LidPairVector &usedFreePairs);
@@ -62,9 +63,11 @@ struct JobTest : public JobTestBase {
               double resourceLimitFactor = RESOURCE_LIMIT_FACTOR,
               vespalib::duration interval = JOB_DELAY,
               bool nodeRetired = false,
-              uint32_t maxOutstandingMoveOps = MAX_OUTSTANDING_MOVE_OPS);
+              uint32_t maxOutstandingMoveOps = MAX_OUTSTANDING_MOVE_OPS,
+              uint32_t maxDocsToMovePerInvoke = 1);
     void init_with_interval(vespalib::duration interval);
     void init_with_node_retired(bool retired);
+    void init_with_max_docs_to_move_per_invoke(uint32_t maxDocsToMovePerInvoke);
 };
 
 class JobDisabledByRemoveOpsTest : public JobTest {
@@ -13,6 +13,7 @@
 #include <vespa/searchlib/common/flush_token.h>
 #include <vespa/vespalib/data/slime/slime.h>
 #include <vespa/vespalib/test/insertion_operators.h>
+#include <vespa/vespalib/util/size_literals.h>
 #include <mutex>
 #include <thread>
 #include <vespa/vespalib/testkit/test_kit.h>
@@ -287,6 +288,17 @@ public:
 
 };
 
+class LargeTarget : public SimpleTarget {
+public:
+    LargeTarget(const vespalib::string &name, bool proceed)
+        : SimpleTarget(name, Type::OTHER, 0, proceed)
+    {}
+
+    uint64_t getApproxBytesToWriteToDisk() const override {
+        return 100_Gi;
+    }
+};
+
 class GCTarget : public SimpleTarget {
 public:
     GCTarget(const vespalib::string &name, search::SerialNum flushedSerial)
@@ -501,6 +513,32 @@ TEST_F("require that strategy controls flush target", Fixture(1, IINTERVAL))
     EXPECT_EQUAL("bar", order[1]);
 }
 
+TEST_F("require that small targets can flush while a large flush is in progress", Fixture(2, SHORT_TIMEOUT))
+{
+    auto large1 = std::make_shared<LargeTarget>("large1", false);
+    auto large2 = std::make_shared<LargeTarget>("large2", false);
+    auto small = std::make_shared<SimpleTarget>("small", 0, true);
+    f.addTargetToStrategy(large1);
+    f.addTargetToStrategy(large2);
+    f.addTargetToStrategy(small);
+
+    auto handler = std::make_shared<SimpleHandler>(Targets({large1, large2, small}), "handler", 9);
+    f.putFlushHandler("handler", handler);
+    f.engine.start();
+
+    // The first large flush is started, and the small target uses the
+    // second slot while the second large flush is held back.
+    EXPECT_TRUE(large1->_taskStart.await(LONG_TIMEOUT));
+    EXPECT_TRUE(small->_taskDone.await(LONG_TIMEOUT));
+    EXPECT_FALSE(large2->_taskStart.await(SHORT_TIMEOUT));
+
+    large1->_proceed.countDown();
+    EXPECT_TRUE(large1->_taskDone.await(LONG_TIMEOUT));
+    large2->_proceed.countDown();
+    EXPECT_TRUE(large2->_taskDone.await(LONG_TIMEOUT));
+    EXPECT_TRUE(handler->_done.await(LONG_TIMEOUT));
+}
+
 TEST_F("require that zero handlers does not core", Fixture(2, 50ms))
 {
     f.engine.start();
@@ -287,4 +287,81 @@ TEST_MT_FF("require that the adaptive scheduler handles fewer documents than thr
 
 //-----------------------------------------------------------------------------
 
+TEST("require that the work stealing scheduler hands out chunks from the front of the own shard") {
+    WorkStealingDocidRangeScheduler scheduler(2, 2, 33);
+    EXPECT_EQUAL(scheduler.unassigned_size(), 32u);
+    TEST_DO(verify_range(scheduler.first_range(0), DocidRange(1, 5)));
+    TEST_DO(verify_range(scheduler.first_range(1), DocidRange(17, 21)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange(5, 8)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange(21, 24)));
+    EXPECT_EQUAL(scheduler.total_size(0), 7u);
+    EXPECT_EQUAL(scheduler.total_size(1), 7u);
+    EXPECT_EQUAL(scheduler.unassigned_size(), 18u);
+    EXPECT_EQUAL(scheduler.num_chunks(0), 2u);
+    EXPECT_EQUAL(scheduler.num_steals(0), 0u);
+}
+
+TEST("require that the work stealing scheduler steals from the far end of the richest shard") {
+    WorkStealingDocidRangeScheduler scheduler(2, 2, 33);
+    DocidRange range = scheduler.first_range(1);
+    EXPECT_EQUAL(range.begin, 17u);
+    uint32_t last_end = range.end;
+    while (!range.empty() && (range.begin >= 17)) {
+        last_end = range.end;
+        range = scheduler.next_range(1);
+    }
+    EXPECT_EQUAL(last_end, 33u);
+    // thread 1 stole the upper half of the shard owned by thread 0
+    TEST_DO(verify_range(range, DocidRange(9, 11)));
+    EXPECT_EQUAL(scheduler.num_steals(1), 1u);
+    EXPECT_EQUAL(scheduler.num_steals(0), 0u);
+    // the victim keeps the lower half it is about to process
+    TEST_DO(verify_range(scheduler.first_range(0), DocidRange(1, 3)));
+}
+
+TEST("require that the work stealing scheduler leaves small remainders to their owner") {
+    WorkStealingDocidRangeScheduler scheduler(2, 8, 33);
+    TEST_DO(verify_range(scheduler.first_range(1), DocidRange(17, 25)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange(25, 33)));
+    // steal the upper half of the shard owned by thread 0 in one large chunk
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange(9, 17)));
+    // what is left of the victim shard is below the split threshold
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange()));
+    TEST_DO(verify_range(scheduler.first_range(0), DocidRange(1, 9)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange()));
+    EXPECT_EQUAL(scheduler.total_size(0), 8u);
+    EXPECT_EQUAL(scheduler.total_size(1), 24u);
+    EXPECT_EQUAL(scheduler.unassigned_size(), 0u);
+}
+
+TEST("require that the work stealing scheduler protects against documents underflow") {
+    WorkStealingDocidRangeScheduler scheduler(2, 1, 0);
+    EXPECT_EQUAL(scheduler.total_size(0), 0u);
+    EXPECT_EQUAL(scheduler.total_size(1), 0u);
+    EXPECT_EQUAL(scheduler.unassigned_size(), 0u);
+    TEST_DO(verify_range(scheduler.first_range(0), DocidRange()));
+    TEST_DO(verify_range(scheduler.first_range(1), DocidRange()));
+}
+
+TEST_MT_FF("require that the work stealing scheduler consumes the full docid space",
+           4, WorkStealingDocidRangeScheduler(num_threads, 1, 1001), TimeBomb(60))
+{
+    for (DocidRange range = f1.first_range(thread_id);
+         !range.empty();
+         range = f1.next_range(thread_id))
+    {
+    }
+    TEST_BARRIER();
+    if (thread_id == 0) {
+        EXPECT_EQUAL(f1.unassigned_size(), 0u);
+        size_t total = 0;
+        for (size_t i = 0; i < num_threads; ++i) {
+            total += f1.total_size(i);
+        }
+        EXPECT_EQUAL(total, 1000u);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -0,0 +1,84 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/searchcore/proton/matching/global_filter_cache.h>
+#include <vespa/searchlib/common/bitvector.h>
+#include <vespa/searchlib/queryeval/global_filter.h>
+#include <vespa/vespalib/gtest/gtest.h>
+#include <vespa/vespalib/util/stringfmt.h>
+
+using proton::matching::GlobalFilterCache;
+using search::BitVector;
+using search::queryeval::GlobalFilter;
+
+namespace {
+
+std::shared_ptr<GlobalFilter>
+make_filter(uint32_t docid_limit)
+{
+    auto bv = BitVector::create(docid_limit);
+    bv->setBit(1);
+    return GlobalFilter::create(std::move(bv));
+}
+
+}
+
+TEST(GlobalFilterCacheTest, find_returns_inserted_filter)
+{
+    GlobalFilterCache cache(vespalib::from_s(60.0), 8);
+    auto filter = make_filter(100);
+    cache.insert("key", filter, 100, {});
+    EXPECT_EQ(filter.get(), cache.find("key", 100).get());
+    EXPECT_EQ(1u, cache.size());
+}
+
+TEST(GlobalFilterCacheTest, miss_on_unknown_key_and_docid_limit_mismatch)
+{
+    GlobalFilterCache cache(vespalib::from_s(60.0), 8);
+    cache.insert("key", make_filter(100), 100, {});
+    EXPECT_FALSE(cache.find("other", 100));
+    EXPECT_FALSE(cache.find("key", 200));
+}
+
+TEST(GlobalFilterCacheTest, expired_entries_are_not_served)
+{
+    GlobalFilterCache cache(vespalib::from_s(-1.0), 8);
+    cache.insert("key", make_filter(100), 100, {});
+    EXPECT_FALSE(cache.find("key", 100));
+}
+
+TEST(GlobalFilterCacheTest, find_erases_expired_entries)
+{
+    GlobalFilterCache cache(vespalib::from_s(-1.0), 8);
+    cache.insert("key", make_filter(100), 100, {});
+    EXPECT_EQ(1u, cache.size());
+    EXPECT_FALSE(cache.find("key", 100));
+    EXPECT_EQ(0u, cache.size());
+}
+
+TEST(GlobalFilterCacheTest, insert_sweeps_expired_entries)
+{
+    GlobalFilterCache cache(vespalib::from_s(-1.0), 8);
+    cache.insert("key1", make_filter(100), 100, {});
+    cache.insert("key2", make_filter(100), 100, {});
+    EXPECT_EQ(1u, cache.size());
+}
+
+TEST(GlobalFilterCacheTest, cache_is_bounded)
+{
+    GlobalFilterCache cache(vespalib::from_s(60.0), 4);
+    for (int i = 0; i < 10; ++i) {
+        cache.insert(vespalib::make_string("key%d", i), make_filter(100), 100, {});
+    }
+    EXPECT_LE(cache.size(), 4u);
+}
+
+TEST(GlobalFilterCacheTest, clear_drops_everything)
+{
+    GlobalFilterCache cache(vespalib::from_s(60.0), 8);
+    cache.insert("key", make_filter(100), 100, {});
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_FALSE(cache.find("key", 100));
+}
+
+GTEST_MAIN_RUN_ALL_TESTS()
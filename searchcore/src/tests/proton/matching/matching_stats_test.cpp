@@ -330,6 +330,37 @@ TEST("requireThatFactor is capped at minimum 1%") {
     EXPECT_EQUAL(0.0105, stats.softDoomFactor());
 }
 
+TEST("requireThatFieldStatsAddUp") {
+    MatchingStats stats;
+    EXPECT_TRUE(stats.get_field_stats().empty());
+    MatchingStats::FieldStatsMap sample;
+    sample["title"].queries(1).estimated_hits(100);
+    sample["body"].queries(1).estimated_hits(500);
+    stats.merge_field_stats(sample);
+    stats.merge_field_stats(sample);
+
+    MatchingStats rhs;
+    MatchingStats::FieldStatsMap other;
+    other["title"].queries(1).estimated_hits(50);
+    rhs.merge_field_stats(other);
+    stats.add(rhs);
+
+    EXPECT_EQUAL(2u, stats.get_field_stats().size());
+    EXPECT_EQUAL(3u, stats.get_field_stats().find("title")->second.queries());
+    EXPECT_EQUAL(250u, stats.get_field_stats().find("title")->second.estimated_hits());
+    EXPECT_EQUAL(2u, stats.get_field_stats().find("body")->second.queries());
+    EXPECT_EQUAL(1000u, stats.get_field_stats().find("body")->second.estimated_hits());
+}
+
+TEST("requireThatStandaloneFactorAdjustmentMatchesMemberUpdate") {
+    MatchingStats stats;
+    stats.softDoomFactor(0.5);
+    stats.updatesoftDoomFactor(1000ms, 500ms, 2000ms);
+    EXPECT_EQUAL(stats.softDoomFactor(), MatchingStats::adjust_soft_doom_factor(0.5, 1000ms, 500ms, 2000ms));
+    EXPECT_EQUAL(0.508, MatchingStats::adjust_soft_doom_factor(0.5, 1s, 900ms, 100ms));
+    EXPECT_EQUAL(0.5, MatchingStats::adjust_soft_doom_factor(0.5, 900us, 500ms, 2000ms));
+}
+
 TEST_MAIN() {
     TEST_RUN_ALL();
 }
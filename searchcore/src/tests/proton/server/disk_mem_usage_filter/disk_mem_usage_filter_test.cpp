@@ -130,6 +130,19 @@ TEST_F(DiskMemUsageFilterTest, transient_and_non_transient_disk_usage_tracked_in
     EXPECT_DOUBLE_EQ(0.05, _filter.get_metrics().non_transient_disk_usage());
 }
 
+TEST_F(DiskMemUsageFilterTest, growth_trend_projects_time_to_limit)
+{
+    vespalib::steady_time t = vespalib::steady_clock::now();
+    _filter.set_resource_usage(TransientResourceUsage(), _filter.getMemoryStats(), 20, t);
+    _filter.set_resource_usage(TransientResourceUsage(), _filter.getMemoryStats(), 30, t + 100s);
+    auto disk_trend = _filter.get_disk_trend();
+    // 0.1 usage growth over 100s, halved by smoothing from the initial zero rate
+    EXPECT_DOUBLE_EQ(0.0005, disk_trend.growth_rate());
+    EXPECT_DOUBLE_EQ((1.0 - 0.3) / 0.0005, disk_trend.time_to_limit());
+    // memory usage is flat, so no projected time to limit
+    EXPECT_LT(_filter.get_memory_trend().time_to_limit(), 0.0);
+}
+
 TEST_F(DiskMemUsageFilterTest, transient_and_non_transient_memory_usage_tracked_in_usage_state_and_metrics)
 {
     _filter.set_resource_usage({0, 100}, _filter.getMemoryStats(), _filter.getDiskUsedSize());
@@ -458,6 +458,7 @@ public:
     std::shared_ptr<BmStorageLinkContext> get_storage_link_context(bool distributor) override;
     bool has_storage_layer(bool distributor) const override;
     PersistenceProvider* get_persistence_provider() override;
+    std::shared_ptr<DocumentDB> get_document_db() override { return _document_db; }
     void merge_node_stats(std::vector<BmNodeStats>& node_stats, storage::lib::ClusterState &baseline_state) override;
 };
 
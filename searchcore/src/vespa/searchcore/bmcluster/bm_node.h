@@ -16,6 +16,7 @@ class Field;
 
 };
 
+namespace proton { class DocumentDB; }
 namespace storage::lib { class ClusterState; }
 namespace storage::spi { struct PersistenceProvider; }
 
@@ -49,6 +50,7 @@ public:
     virtual std::shared_ptr<BmStorageLinkContext> get_storage_link_context(bool distributor) = 0;
     virtual bool has_storage_layer(bool distributor) const = 0;
     virtual storage::spi::PersistenceProvider *get_persistence_provider() = 0;
+    virtual std::shared_ptr<proton::DocumentDB> get_document_db() = 0;
     virtual void merge_node_stats(std::vector<BmNodeStats>& node_stats, storage::lib::ClusterState &baseline_state) = 0;
     static unsigned int num_ports();
     static std::unique_ptr<BmNode> create(const vespalib::string &base_dir, int base_port, uint32_t node_idx, BmCluster& cluster, const BmClusterParams& params, std::shared_ptr<DocumenttypesConfig> document_types, int slobrok_port);
@@ -3,13 +3,18 @@
 #include "feedtoken.h"
 #include <vespa/persistence/spi/result.h>
 
+#include <vespa/log/log.h>
+LOG_SETUP(".proton.common.feedtoken");
+
 namespace proton::feedtoken {
 
 State::State(ITransport & transport) :
     _transport(transport),
     _result(std::make_unique<storage::spi::Result>()),
     _documentWasFound(false),
-    _alreadySent(false)
+    _alreadySent(false),
+    _startTime(vespalib::steady_clock::now()),
+    _stageLatencyNs()
 {
 }
 
@@ -18,11 +23,34 @@ State::~State()
     ack();
 }
 
+void
+State::mark_stage_complete(Stage stage) noexcept
+{
+    int64_t latency_ns = vespalib::count_ns(vespalib::steady_clock::now() - _startTime);
+    _stageLatencyNs[static_cast<size_t>(stage)].store(latency_ns, std::memory_order_relaxed);
+}
+
+void
+State::log_stage_latency() const
+{
+    auto stage_ms = [this](Stage stage) {
+        return _stageLatencyNs[static_cast<size_t>(stage)].load(std::memory_order_relaxed) / 1000000.0;
+    };
+    double total_ms = vespalib::count_ns(vespalib::steady_clock::now() - _startTime) / 1000000.0;
+    LOG(debug, "feed operation stage latency: tls_append=%.3fms attribute_apply=%.3fms "
+        "index_apply=%.3fms summary_apply=%.3fms total=%.3fms",
+        stage_ms(Stage::TLS_APPEND), stage_ms(Stage::ATTRIBUTE_APPLY),
+        stage_ms(Stage::INDEX_APPLY), stage_ms(Stage::SUMMARY_APPLY), total_ms);
+}
+
 void
 State::ack()
 {
     bool alreadySent = _alreadySent.exchange(true);
     if ( !alreadySent ) {
+        if (LOG_WOULD_LOG(debug)) {
+            log_stage_latency();
+        }
         _transport.send(std::move(_result), _documentWasFound);
     }
 }
@@ -2,6 +2,8 @@
 #pragma once
 
 #include <vespa/vespalib/util/idestructorcallback.h>
+#include <vespa/vespalib/util/time.h>
+#include <array>
 #include <atomic>
 
 namespace storage::spi { class Result; }
@@ -11,6 +13,18 @@ using ResultUP = std::unique_ptr<storage::spi::Result>;
 
 namespace feedtoken {
 
+/**
+ * The stages a feed operation passes through on its way to being
+ * acked. Used to timestamp progress on the feed token.
+ */
+enum class Stage : uint8_t {
+    TLS_APPEND      = 0, // operation handed to the transaction log
+    ATTRIBUTE_APPLY = 1, // attribute writers done with the operation
+    INDEX_APPLY     = 2, // memory index done with the operation
+    SUMMARY_APPLY   = 3  // document store done with the operation
+};
+constexpr size_t num_stages = 4;
+
 /**
  * This class is used by the FeedEngine to encapsulate the necessary information
  * for an IFeedHandler to perform an async reply to an operation. A unique
@@ -32,6 +46,12 @@ public:
     virtual void fail() = 0;
     virtual void setResult(ResultUP result, bool documentWasFound) = 0;
     virtual const storage::spi::Result &getResult() = 0;
+    /**
+     * Marks that the given stage has completed for this operation.
+     * The default implementation ignores the mark; the regular feed
+     * token records the time passed since the token was created.
+     */
+    virtual void mark_stage_complete(Stage) noexcept {}
 };
 
 
@@ -49,13 +69,21 @@ public:
     void fail() override;
     void setResult(ResultUP result, bool documentWasFound) override;
     const storage::spi::Result &getResult() override { return *_result; }
+    void mark_stage_complete(Stage stage) noexcept override;
 protected:
     void ack();
 private:
+    void log_stage_latency() const;
+
     ITransport           &_transport;
     ResultUP              _result;
     bool                  _documentWasFound;
     std::atomic<bool>     _alreadySent;
+    vespalib::steady_time _startTime;
+    // Time from token creation until each stage completed, in ns,
+    // written by the thread that completed the stage. 0 means that
+    // the stage has not completed (or does not apply).
+    std::array<std::atomic<int64_t>, num_stages> _stageLatencyNs;
 };
 
 /**
@@ -67,6 +67,11 @@ DocsumContext::createSlimeReply()
     IDocsumWriter::ResolveClassInfo rci = _docsumWriter.resolveClassInfo(_docsumState._args.getResultClassName(),
                                                                          _docsumState._args.get_fields());
     _docsumWriter.initState(_attrMgr, _docsumState, rci);
+    if ((rci.res_class != nullptr) && !rci.all_fields_generated && !_request.expired()) {
+        // Phase one: batch read all needed documents from the docsum
+        // store so the rendering loop below is served from memory.
+        _docsumStore.prefetch_documents(_docsumState._docsumbuf);
+    }
     const size_t estimatedChunkSize(std::min(0x200000ul, _docsumState._docsumbuf.size()*0x400ul));
     auto response = std::make_unique<vespalib::Slime>(Slime::Params(estimatedChunkSize));
     Cursor & root = response->setObject();
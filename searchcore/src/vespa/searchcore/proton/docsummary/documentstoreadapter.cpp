@@ -2,6 +2,7 @@
 
 #include "documentstoreadapter.h"
 #include <vespa/searchsummary/docsummary/docsum_store_document.h>
+#include <vespa/searchlib/queryeval/begin_and_end_id.h>
 #include <vespa/document/fieldvalue/document.h>
 #include <vespa/document/fieldvalue/stringfieldvalue.h>
 #include <vespa/eval/eval/value_codec.h>
@@ -16,11 +17,33 @@ using namespace search::docsummary;
 
 namespace proton {
 
+namespace {
+
+class PrefetchVisitor : public search::IDocumentVisitor
+{
+private:
+    vespalib::hash_map<uint32_t, DocumentUP> & _documents;
+
+public:
+    explicit PrefetchVisitor(vespalib::hash_map<uint32_t, DocumentUP> & documents)
+        : _documents(documents)
+    { }
+    void visit(uint32_t lid, DocumentUP doc) override {
+        if (doc) {
+            _documents[lid] = std::move(doc);
+        }
+    }
+    bool allowVisitCaching() const override { return false; }
+};
+
+}
+
 DocumentStoreAdapter::
 DocumentStoreAdapter(const search::IDocumentStore & docStore,
                      const DocumentTypeRepo &repo)
     : _docStore(docStore),
-      _repo(repo)
+      _repo(repo),
+      _prefetched()
 {
 }
 
@@ -29,6 +52,13 @@ DocumentStoreAdapter::~DocumentStoreAdapter() = default;
 std::unique_ptr<const IDocsumStoreDocument>
 DocumentStoreAdapter::get_document(uint32_t docId)
 {
+    auto itr = _prefetched.find(docId);
+    if (itr != _prefetched.end()) {
+        auto document = std::move(itr->second);
+        _prefetched.erase(docId);
+        LOG(spam, "getMappedDocSum(%u): prefetched document={\n%s\n}", docId, document->toString(true).c_str());
+        return std::make_unique<DocsumStoreDocument>(std::move(document));
+    }
     auto document = _docStore.read(docId, _repo);
     if ( ! document) {
         LOG(debug, "Did not find summary document for docId %u. Returning empty docsum", docId);
@@ -38,4 +68,22 @@ DocumentStoreAdapter::get_document(uint32_t docId)
     return std::make_unique<DocsumStoreDocument>(std::move(document));
 }
 
+void
+DocumentStoreAdapter::prefetch_documents(const std::vector<uint32_t> &docids)
+{
+    search::IDocumentStore::LidVector lids;
+    lids.reserve(docids.size());
+    for (uint32_t docid : docids) {
+        if (docid != search::endDocId) {
+            lids.push_back(docid);
+        }
+    }
+    if (lids.size() < 2) {
+        return; // single lookups are better served by the document store cache
+    }
+    _prefetched.clear();
+    PrefetchVisitor visitor(_prefetched);
+    _docStore.visit(lids, _repo, visitor);
+}
+
 } // namespace proton
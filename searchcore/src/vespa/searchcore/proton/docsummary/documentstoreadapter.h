@@ -4,14 +4,18 @@
 
 #include <vespa/searchsummary/docsummary/docsumstore.h>
 #include <vespa/searchlib/docstore/idocumentstore.h>
+#include <vespa/vespalib/stllike/hash_map.h>
 
 namespace proton {
 
 class DocumentStoreAdapter : public search::docsummary::IDocsumStore
 {
 private:
+    using PrefetchedMap = vespalib::hash_map<uint32_t, search::IDocumentStore::DocumentUP>;
+
     const search::IDocumentStore           & _docStore;
     const document::DocumentTypeRepo       & _repo;
+    PrefetchedMap                            _prefetched;
 
 public:
     DocumentStoreAdapter(const search::IDocumentStore &docStore,
@@ -19,6 +23,7 @@ public:
     ~DocumentStoreAdapter() override;
 
     std::unique_ptr<const search::docsummary::IDocsumStoreDocument> get_document(uint32_t docId) override;
+    void prefetch_documents(const std::vector<uint32_t> &docids) override;
 };
 
 } // namespace proton
@@ -23,8 +23,13 @@
 #include <vespa/vespalib/btree/btreenodestore.hpp>
 #include <vespa/vespalib/btree/btreeroot.hpp>
 #include <vespa/vespalib/datastore/buffer_type.hpp>
+#include <vespa/vespalib/util/cpu_usage.h>
 #include <vespa/vespalib/util/exceptions.h>
+#include <vespa/vespalib/util/lambdatask.h>
+#include <vespa/vespalib/util/monitored_refcount.h>
 #include <vespa/vespalib/util/rcuvector.hpp>
+#include <vespa/vespalib/util/retain_guard.h>
+#include <vespa/vespalib/util/size_literals.h>
 #include <vespa/fastos/file.h>
 
 #include <vespa/log/log.h>
@@ -286,8 +291,45 @@ DocumentMetaStore::readNextDoc(documentmetastore::Reader & reader, TreeType::Bui
     return lid;
 }
 
+namespace {
+
+constexpr size_t LOAD_BUCKET_STATES_CHUNK = 256_Ki;
+
+/*
+ * Aggregate bucket states for a chunk of lids (in gid order) and apply
+ * them to the bucket db. A bucket that spans a chunk boundary gets
+ * partial states from both chunks; BucketDB::add merges them.
+ */
+void
+addBucketStates(const RawDocumentMetaData * metaView, bucketdb::BucketDBOwner & bucketDB,
+                SubDbType subDbType, const std::vector<uint32_t> & lids)
+{
+    std::vector<std::pair<BucketId, BucketState>> states;
+    const RawDocumentMetaData * meta = &metaView[lids[0]];
+    BucketId prevId(meta->getBucketId());
+    BucketState state;
+    state.add(meta->getGid(), meta->getTimestamp(), meta->getDocSize(), subDbType);
+    for (size_t i = 1; i < lids.size(); ++i) {
+        meta = &metaView[lids[i]];
+        BucketId bucketId = meta->getBucketId();
+        if (prevId != bucketId) {
+            states.emplace_back(prevId, state);
+            state = BucketState();
+            prevId = bucketId;
+        }
+        state.add(meta->getGid(), meta->getTimestamp(), meta->getDocSize(), subDbType);
+    }
+    states.emplace_back(prevId, state);
+    auto guard = bucketDB.takeGuard();
+    for (const auto & entry : states) {
+        guard->add(entry.first, entry.second);
+    }
+}
+
+}
+
 bool
-DocumentMetaStore::onLoad(vespalib::Executor *)
+DocumentMetaStore::onLoad(vespalib::Executor * executor)
 {
     documentmetastore::Reader reader(LoadUtils::openDAT(*this));
     unload();
@@ -300,23 +342,37 @@ DocumentMetaStore::onLoad(vespalib::Executor *)
 
     // insert gids (already sorted)
     if (numElems > 0) {
-        DocId lid = readNextDoc(reader, treeBuilder);
-        const RawDocumentMetaData * meta = &_metaDataStore[lid];
-        BucketId prevId(meta->getBucketId());
-        BucketState state;
-        state.add(meta->getGid(), meta->getTimestamp(), meta->getDocSize(), _subDbType);
-        for (size_t i = 1; i < numElems; ++i) {
-            lid = readNextDoc(reader, treeBuilder);
-            meta = &_metaDataStore[lid];
-            BucketId bucketId = meta->getBucketId();
-            if (prevId != bucketId) {
-                _bucketDB->takeGuard()->add(prevId, state);
-                state = BucketState();
-                prevId = bucketId;
+        // The btree bulk build must be fed in sorted order by this
+        // thread, but bucket state aggregation only needs the raw meta
+        // data, so it is handed off to the load executor in chunks to
+        // overlap with reading the rest of the file.
+        const RawDocumentMetaData * metaView = get_unbound_meta_data_view();
+        vespalib::MonitoredRefCount pendingStates;
+        auto scheduleChunk = [&](std::vector<DocId> lids) {
+            if (executor != nullptr) {
+                auto task = vespalib::makeLambdaTask(
+                        [this, metaView, lids = std::move(lids), retain = vespalib::RetainGuard(pendingStates)]() {
+                            addBucketStates(metaView, *_bucketDB, _subDbType, lids);
+                        });
+                executor->execute(vespalib::CpuUsage::wrap(std::move(task), vespalib::CpuUsage::Category::SETUP));
+            } else {
+                addBucketStates(metaView, *_bucketDB, _subDbType, lids);
+            }
+        };
+        std::vector<DocId> lids;
+        lids.reserve(std::min(numElems, LOAD_BUCKET_STATES_CHUNK));
+        for (size_t i = 0; i < numElems; ++i) {
+            lids.push_back(readNextDoc(reader, treeBuilder));
+            if (lids.size() == LOAD_BUCKET_STATES_CHUNK) {
+                scheduleChunk(std::move(lids));
+                lids = std::vector<DocId>();
+                lids.reserve(LOAD_BUCKET_STATES_CHUNK);
             }
-            state.add(meta->getGid(), meta->getTimestamp(), meta->getDocSize(), _subDbType);
         }
-        _bucketDB->takeGuard()->add(prevId, state);
+        if (!lids.empty()) {
+            scheduleChunk(std::move(lids));
+        }
+        pendingStates.waitForZeroRefCount();
     }
     _gidToLidMap.assign(treeBuilder);
     _gidToLidMap.getAllocator().freeze(); // create initial frozen tree
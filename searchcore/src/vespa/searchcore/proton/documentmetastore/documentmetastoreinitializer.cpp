@@ -19,11 +19,13 @@ DocumentMetaStoreInitializer::
 DocumentMetaStoreInitializer(const vespalib::string baseDir,
                              const vespalib::string &subDbName,
                              const vespalib::string &docTypeName,
-                             std::shared_ptr<DocumentMetaStore> dms)
+                             std::shared_ptr<DocumentMetaStore> dms,
+                             vespalib::Executor &shared_executor)
     : _baseDir(baseDir),
       _subDbName(subDbName),
       _docTypeName(docTypeName),
-      _dms(std::move(dms))
+      _dms(std::move(dms)),
+      _shared_executor(shared_executor)
 { }
 
 namespace {
@@ -46,7 +48,7 @@ DocumentMetaStoreInitializer::run()
             assert(_dms->hasLoadData());
             vespalib::Timer stopWatch;
             EventLogger::loadDocumentMetaStoreStart(_subDbName);
-            if (!_dms->load()) {
+            if (!_dms->load(&_shared_executor)) {
                 throw IllegalStateException(failedMsg(_docTypeName.c_str()));
             } else {
                 _dms->commit(search::CommitParam(snap.syncToken));
@@ -6,6 +6,8 @@
 #include <vespa/searchcommon/common/growstrategy.h>
 #include <vespa/vespalib/stllike/string.h>
 
+namespace vespalib { class Executor; }
+
 namespace proton { class DocumentMetaStore; }
 namespace proton::documentmetastore {
 
@@ -19,6 +21,7 @@ class DocumentMetaStoreInitializer : public initializer::InitializerTask
     vespalib::string                    _subDbName;
     vespalib::string                    _docTypeName;
     std::shared_ptr<DocumentMetaStore>  _dms;
+    vespalib::Executor                 &_shared_executor;
 
 public:
     using SP = std::shared_ptr<DocumentMetaStoreInitializer>;
@@ -27,7 +30,8 @@ public:
     DocumentMetaStoreInitializer(const vespalib::string baseDir,
                                  const vespalib::string &subDbName,
                                  const vespalib::string &docTypeName,
-                                 std::shared_ptr<DocumentMetaStore> dms);
+                                 std::shared_ptr<DocumentMetaStore> dms,
+                                 vespalib::Executor &shared_executor);
     void run() override;
 };
 
@@ -10,6 +10,7 @@
 #include <vespa/searchcore/proton/common/eventlogger.h>
 #include <vespa/searchlib/common/flush_token.h>
 #include <vespa/vespalib/util/cpu_usage.h>
+#include <vespa/vespalib/util/size_literals.h>
 
 #include <vespa/log/log.h>
 LOG_SETUP(".proton.flushengine.flushengine");
@@ -53,6 +54,18 @@ logTarget(const char * text, const FlushContext & ctx) {
 
 VESPA_THREAD_STACK_TAG(flush_engine_executor)
 
+// A flush expected to write at least this much is considered large. At
+// most one large flush is allowed to run at a time, so that small
+// targets can use the remaining slots instead of queueing up behind a
+// second bandwidth-heavy flush.
+constexpr uint64_t LARGE_FLUSH_BYTES_THRESHOLD = 1_Gi;
+
+bool
+isLargeFlush(const IFlushTarget &target)
+{
+    return target.getApproxBytesToWriteToDisk() >= LARGE_FLUSH_BYTES_THRESHOLD;
+}
+
 }
 
 FlushEngine::FlushMeta::FlushMeta(const vespalib::string& handler_name,
@@ -67,17 +80,20 @@ FlushEngine::FlushMeta::~FlushMeta() = default;
 FlushEngine::FlushInfo::FlushInfo()
     : FlushMeta("", "", 0),
       _target(),
-      _priority_flush_token()
+      _priority_flush_token(),
+      _is_large(false)
 {
 }
 
 FlushEngine::FlushInfo::~FlushInfo() = default;
 
 
-FlushEngine::FlushInfo::FlushInfo(uint32_t taskId, const vespalib::string& handler_name, const IFlushTarget::SP& target, std::shared_ptr<PriorityFlushToken> priority_flush_token)
+FlushEngine::FlushInfo::FlushInfo(uint32_t taskId, const vespalib::string& handler_name, const IFlushTarget::SP& target, bool is_large,
+                                  std::shared_ptr<PriorityFlushToken> priority_flush_token)
     : FlushMeta(handler_name, target->getName(), taskId),
       _target(target),
-      _priority_flush_token(std::move(priority_flush_token))
+      _priority_flush_token(std::move(priority_flush_token)),
+      _is_large(is_large)
 {
 }
 
@@ -350,11 +366,34 @@ FlushEngine::get_flush_token(const FlushContext& ctx)
     }
 }
 
+bool
+FlushEngine::deferLargeFlush(const FlushContext &ctx) const
+{
+    const IFlushTarget &target = *ctx.getTarget();
+    if (target.getPriority() > IFlushTarget::Priority::NORMAL || target.needUrgentFlush()) {
+        return false;
+    }
+    if ( ! isLargeFlush(target)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(_lock);
+    for (const auto & it : _flushing) {
+        if (it.second._is_large) {
+            return true;
+        }
+    }
+    return false;
+}
+
 FlushContext::SP
 FlushEngine::initNextFlush(const FlushContext::List &lst)
 {
     FlushContext::SP ctx;
     for (const FlushContext::SP & it : lst) {
+        if (deferLargeFlush(*it)) {
+            LOG(debug, "Target '%s' is deferred while another large flush is in progress.", it->getName().c_str());
+            continue;
+        }
         if (LOG_WOULD_LOG(event)) {
             EventLogger::flushInit(it->getName());
         }
@@ -497,10 +536,11 @@ uint32_t
 FlushEngine::initFlush(const IFlushHandler::SP &handler, const IFlushTarget::SP &target, std::shared_ptr<PriorityFlushToken> priority_flush_token)
 {
     uint32_t taskId;
+    bool is_large = isLargeFlush(*target);
     {
         std::lock_guard<std::mutex> guard(_lock);
         taskId = _taskId++;
-        FlushInfo flush(taskId, handler->getName(), target, std::move(priority_flush_token));
+        FlushInfo flush(taskId, handler->getName(), target, is_large, std::move(priority_flush_token));
         _flushing[taskId] = flush;
     }
     LOG(debug, "FlushEngine::initFlush(handler='%s', target='%s') => taskId='%d'",
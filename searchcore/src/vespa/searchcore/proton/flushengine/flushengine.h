@@ -44,11 +44,13 @@ private:
     struct FlushInfo : public FlushMeta
     {
         FlushInfo();
-        FlushInfo(uint32_t taskId, const vespalib::string& handler_name, const IFlushTarget::SP &target, std::shared_ptr<PriorityFlushToken> priority_flush_token);
+        FlushInfo(uint32_t taskId, const vespalib::string& handler_name, const IFlushTarget::SP &target, bool is_large,
+                  std::shared_ptr<PriorityFlushToken> priority_flush_token);
         ~FlushInfo();
 
         IFlushTarget::SP  _target;
         std::shared_ptr<PriorityFlushToken> _priority_flush_token;
+        bool              _is_large;
     };
     using FlushMap = std::map<uint32_t, FlushInfo>;
     using FlushHandlerMap = HandlerMap<IFlushHandler>;
@@ -86,6 +88,7 @@ private:
     uint32_t initFlush(const IFlushHandler::SP &handler, const IFlushTarget::SP &target, std::shared_ptr<PriorityFlushToken> priority_flush_token);
     void flushDone(const FlushContext &ctx, uint32_t taskId);
     bool canFlushMore(const std::unique_lock<std::mutex> &guard, IFlushTarget::Priority priority) const;
+    bool deferLargeFlush(const FlushContext &ctx) const;
     void wait_for_slot_or_pending_prune(IFlushTarget::Priority priority);
     void idle_wait(vespalib::duration minimumWaitTimeIfReady);
     bool wait_for_slot(IFlushTarget::Priority priority);
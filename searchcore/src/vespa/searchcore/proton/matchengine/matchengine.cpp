@@ -133,7 +133,9 @@ MatchEngine::doSearch(const SearchRequest & searchRequest) {
     searchRequest.setTraceLevel(trace::Level::lookup(searchRequest.propertiesMap.modelOverrides(),
                                                       searchRequest.trace().getLevel()), 3);
     ISearchHandler::SP searchHandler;
-    auto threadBundle = _threadBundlePool.getBundle();
+    // Obtained lazily; queries that end up matching single-threaded
+    // never reserve a bundle and run directly in this thread.
+    auto threadBundle = _threadBundlePool.getLazyBundle();
     { // try to find the match handler corresponding to the specified search doc type
         DocTypeName docTypeName(searchRequest);
         std::lock_guard<std::mutex> guard(_lock);
@@ -141,7 +143,7 @@ MatchEngine::doSearch(const SearchRequest & searchRequest) {
     }
     std::unique_ptr<SearchReply> ret;
     if (searchHandler) {
-        ret = searchHandler->match(searchRequest, threadBundle.bundle());
+        ret = searchHandler->match(searchRequest, threadBundle);
     } else {
         HandlerMap<ISearchHandler>::Snapshot snapshot;
         {
@@ -149,7 +151,7 @@ MatchEngine::doSearch(const SearchRequest & searchRequest) {
             snapshot = _handlers.snapshot();
         }
         ret = (snapshot.valid())
-                ? snapshot.get()->match(searchRequest, threadBundle.bundle()) // use the first handler
+                ? snapshot.get()->match(searchRequest, threadBundle) // use the first handler
                 :  std::make_unique<SearchReply>();
     }
     if (searchRequest.expired()) {
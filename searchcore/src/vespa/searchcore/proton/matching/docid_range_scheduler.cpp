@@ -164,4 +164,86 @@ AdaptiveDocidRangeScheduler::share_range(size_t thread_id, DocidRange todo)
 
 //-----------------------------------------------------------------------------
 
+DocidRange
+WorkStealingDocidRangeScheduler::take_chunk(const Guard &, size_t thread_id)
+{
+    Shard &shard = _shards[thread_id];
+    // Guided self-scheduling; handing out a quarter of what is left
+    // keeps per-chunk overhead low while most of the shard tail stays
+    // visible to thieves.
+    size_t chunk = std::min(shard.remaining.size(),
+                            std::max(size_t(_min_task), shard.remaining.size() / 4));
+    DocidRange work(shard.remaining.begin, shard.remaining.begin + chunk);
+    shard.remaining.begin = work.end;
+    ++shard.chunks;
+    _assigned[thread_id] += work.size();
+    size_t todo = _unassigned.load(std::memory_order_relaxed);
+    _unassigned.store(clamped_sub(todo, work.size()), std::memory_order_relaxed);
+    return work;
+}
+
+bool
+WorkStealingDocidRangeScheduler::steal(const Guard &, size_t thread_id)
+{
+    size_t victim = thread_id;
+    size_t most = 0;
+    for (size_t i = 0; i < _shards.size(); ++i) {
+        if ((i != thread_id) && (_shards[i].remaining.size() > most)) {
+            most = _shards[i].remaining.size();
+            victim = i;
+        }
+    }
+    if (most < (2 * size_t(_min_task))) {
+        return false;
+    }
+    DocidRange &rich = _shards[victim].remaining;
+    uint32_t split = rich.begin + (rich.size() / 2);
+    _shards[thread_id].remaining = DocidRange(split, rich.end);
+    rich.end = split;
+    ++_shards[thread_id].steals;
+    return true;
+}
+
+WorkStealingDocidRangeScheduler::WorkStealingDocidRangeScheduler(size_t num_threads, uint32_t min_task, uint32_t docid_limit)
+    : _min_task(std::max(1u, min_task)),
+      _lock(),
+      _shards(num_threads),
+      _assigned(num_threads, 0),
+      _unassigned(0)
+{
+    DocidRangeSplitter splitter(DocidRange(1, docid_limit), num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        _shards[i].remaining = splitter.get(i);
+    }
+    _unassigned.store(splitter.full_range().size(), std::memory_order_relaxed);
+}
+
+WorkStealingDocidRangeScheduler::~WorkStealingDocidRangeScheduler() = default;
+
+DocidRange
+WorkStealingDocidRangeScheduler::next_range(size_t thread_id)
+{
+    Guard guard(_lock);
+    if (_shards[thread_id].remaining.empty() && !steal(guard, thread_id)) {
+        return DocidRange();
+    }
+    return take_chunk(guard, thread_id);
+}
+
+size_t
+WorkStealingDocidRangeScheduler::num_chunks(size_t thread_id) const
+{
+    Guard guard(_lock);
+    return _shards[thread_id].chunks;
+}
+
+size_t
+WorkStealingDocidRangeScheduler::num_steals(size_t thread_id) const
+{
+    Guard guard(_lock);
+    return _shards[thread_id].steals;
+}
+
+//-----------------------------------------------------------------------------
+
 }
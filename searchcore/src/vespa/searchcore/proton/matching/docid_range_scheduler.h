@@ -201,4 +201,47 @@ public:
     DocidRange share_range(size_t, DocidRange todo) override;
 };
 
+/**
+ * A work-stealing scheduler where each thread owns a contiguous shard
+ * of the docid space and consumes it from the front in chunks sized
+ * relative to what is left of the shard. A thread that runs dry
+ * steals the upper half of the shard with the most remaining work, so
+ * the victim keeps the part of the docid space it is about to process
+ * and retains attribute cache locality. Shards with less than twice
+ * the minimal task size left are never split; such remainders are
+ * cheaper to finish where the caches are already warm. Per-thread
+ * chunk and steal counts are tracked to make the scheduling behavior
+ * observable.
+ **/
+class WorkStealingDocidRangeScheduler : public DocidRangeScheduler
+{
+private:
+    using Guard = std::lock_guard<std::mutex>;
+    struct Shard {
+        DocidRange remaining;
+        size_t     chunks;
+        size_t     steals;
+        Shard() noexcept : remaining(), chunks(0), steals(0) {}
+    };
+    uint32_t            _min_task;
+    mutable std::mutex  _lock;
+    std::vector<Shard>  _shards;
+    std::vector<size_t> _assigned;
+    std::atomic<size_t> _unassigned;
+
+    VESPA_DLL_LOCAL DocidRange take_chunk(const Guard &guard, size_t thread_id);
+    VESPA_DLL_LOCAL bool steal(const Guard &guard, size_t thread_id);
+public:
+    WorkStealingDocidRangeScheduler(size_t num_threads, uint32_t min_task, uint32_t docid_limit);
+    ~WorkStealingDocidRangeScheduler() override;
+    DocidRange first_range(size_t thread_id) override { return next_range(thread_id); }
+    DocidRange next_range(size_t thread_id) override;
+    size_t total_size(size_t thread_id) const override { return _assigned[thread_id]; }
+    size_t unassigned_size() const override { return _unassigned.load(std::memory_order_relaxed); }
+    IdleObserver make_idle_observer() const override { return IdleObserver(); }
+    DocidRange share_range(size_t, DocidRange todo) override { return todo; }
+    size_t num_chunks(size_t thread_id) const;
+    size_t num_steals(size_t thread_id) const;
+};
+
 }
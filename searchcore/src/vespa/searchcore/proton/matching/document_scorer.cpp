@@ -15,6 +15,9 @@ namespace proton::matching {
 
 namespace {
 
+// how often to check the doom while scoring hits
+constexpr size_t DOOM_CHECK_INTERVAL = 32;
+
 LazyValue
 extractScoreFeature(const RankProgram &rankProgram)
 {
@@ -32,18 +35,24 @@ DocumentScorer::DocumentScorer(RankProgram &rankProgram,
 {
 }
 
-void
-DocumentScorer::score(TaggedHits &hits)
+size_t
+DocumentScorer::score(TaggedHits &hits, const vespalib::Doom &doom)
 {
     if (hits.empty()) {
-        return;
+        return 0;
     }
     auto sort_on_docid = [](const TaggedHit &a, const TaggedHit &b){ return (a.first.first < b.first.first); };
     std::sort(hits.begin(), hits.end(), sort_on_docid);
     _searchItr.initRange(hits.front().first.first, hits.back().first.first + 1);
+    size_t scored = 0;
     for (auto &hit: hits) {
+        if (((scored % DOOM_CHECK_INTERVAL) == 0) && doom.hard_doom()) {
+            break; // remaining hits keep their first phase scores
+        }
         hit.first.second = doScore(hit.first.first);
+        ++scored;
     }
+    return scored;
 }
 
 }
@@ -5,6 +5,7 @@
 #include "i_match_loop_communicator.h"
 #include <vespa/searchlib/fef/featureexecutor.h>
 #include <vespa/searchlib/queryeval/searchiterator.h>
+#include <vespa/vespalib/util/doom.h>
 
 namespace search::fef {
     class RankProgram;
@@ -36,8 +37,11 @@ public:
         return _scoreFeature.as_number(docId);
     }
 
-    // annotate hits with rank score, may change order
-    void score(TaggedHits &hits);
+    // annotate hits with rank score, may change order; checks the
+    // doom at regular intervals and stops early when hard doomed,
+    // leaving the remaining hits with their first phase scores.
+    // returns the number of hits actually scored.
+    size_t score(TaggedHits &hits, const vespalib::Doom &doom);
 };
 
 }
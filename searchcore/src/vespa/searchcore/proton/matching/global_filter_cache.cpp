@@ -0,0 +1,82 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "global_filter_cache.h"
+#include <vespa/searchlib/queryeval/global_filter.h>
+
+namespace proton::matching {
+
+GlobalFilterCache::GlobalFilterCache(vespalib::duration maxAge, size_t maxEntries)
+    : _mutex(),
+      _maxAge(maxAge),
+      _maxEntries(maxEntries),
+      _cache()
+{
+}
+
+GlobalFilterCache::~GlobalFilterCache() = default;
+
+void
+GlobalFilterCache::remove_expired(vespalib::steady_time now)
+{
+    // caller must hold _mutex
+    std::vector<vespalib::string> expired;
+    for (const auto &elem : _cache) {
+        if ((now - elem.second->insertTime) > _maxAge) {
+            expired.push_back(elem.first);
+        }
+    }
+    for (const auto &expired_key : expired) {
+        _cache.erase(expired_key);
+    }
+}
+
+GlobalFilterCache::GlobalFilterSP
+GlobalFilterCache::find(const vespalib::string &key, uint32_t docIdLimit)
+{
+    auto now = vespalib::steady_clock::now();
+    std::lock_guard guard(_mutex);
+    auto itr = _cache.find(key);
+    if (itr == _cache.end()) {
+        return {};
+    }
+    const Entry &entry = *itr->second;
+    if ((entry.docIdLimit != docIdLimit) || ((now - entry.insertTime) > _maxAge)) {
+        // a stale entry pins lid reuse through its read guard and can
+        // never be served again; drop it right away instead of waiting
+        // for capacity pruning
+        _cache.erase(key);
+        return {};
+    }
+    return entry.filter;
+}
+
+void
+GlobalFilterCache::insert(const vespalib::string &key, GlobalFilterSP filter, uint32_t docIdLimit, ReadGuardSP dmsReadGuard)
+{
+    auto now = vespalib::steady_clock::now();
+    auto entry = std::make_shared<Entry>(std::move(dmsReadGuard), std::move(filter), docIdLimit, now);
+    std::lock_guard guard(_mutex);
+    // sweep on every insert so guards held by entries that are never
+    // looked up again do not outlive the maximum age by much
+    remove_expired(now);
+    if (_cache.size() >= _maxEntries) {
+        _cache.clear();
+    }
+    _cache[key] = std::move(entry);
+}
+
+void
+GlobalFilterCache::clear()
+{
+    std::lock_guard guard(_mutex);
+    _cache.clear();
+}
+
+size_t
+GlobalFilterCache::size() const
+{
+    std::lock_guard guard(_mutex);
+    return _cache.size();
+}
+
+}
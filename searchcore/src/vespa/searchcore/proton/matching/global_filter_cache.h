@@ -0,0 +1,82 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/searchcommon/attribute/i_document_meta_store_context.h>
+#include <vespa/vespalib/stllike/hash_map.h>
+#include <vespa/vespalib/stllike/string.h>
+#include <vespa/vespalib/util/time.h>
+#include <memory>
+#include <mutex>
+
+namespace search::queryeval { class GlobalFilter; }
+
+namespace proton::matching {
+
+/**
+ * Cache for materialized global filters, keyed on the serialized query
+ * that produced them. Heavy filter subtrees (tenant restrictions,
+ * language filters and the like) tend to repeat across queries, and
+ * re-executing them per query is wasted work.
+ *
+ * Each entry keeps a document meta store read guard to ensure that no
+ * lids covered by the cached filter are re-used while the entry is
+ * alive, mirroring the discipline used by BitVectorSearchCache for
+ * imported attributes. Attribute values may still change while an
+ * entry is cached, so a served filter can lag attribute updates by up
+ * to a short maximum age; reuse is therefore opt-in per rank profile
+ * via the vespa.matching.global_filter.cache property and off by
+ * default. Stale entries are erased eagerly (on lookup and on every
+ * insert) so their read guards do not pin lid reuse beyond the maximum
+ * age; clear() can be used to drop everything when the caller knows
+ * the underlying data has changed.
+ */
+class GlobalFilterCache {
+public:
+    using GlobalFilterSP = std::shared_ptr<search::queryeval::GlobalFilter>;
+    using ReadGuardSP = search::IDocumentMetaStoreContext::IReadGuard::SP;
+
+    struct Entry {
+        ReadGuardSP    dmsReadGuard;
+        GlobalFilterSP filter;
+        uint32_t       docIdLimit;
+        vespalib::steady_time insertTime;
+        Entry(ReadGuardSP dmsReadGuard_, GlobalFilterSP filter_, uint32_t docIdLimit_,
+              vespalib::steady_time insertTime_) noexcept
+            : dmsReadGuard(std::move(dmsReadGuard_)), filter(std::move(filter_)),
+              docIdLimit(docIdLimit_), insertTime(insertTime_) {}
+    };
+
+private:
+    using Cache = vespalib::hash_map<vespalib::string, std::shared_ptr<Entry>>;
+
+    mutable std::mutex _mutex;
+    vespalib::duration _maxAge;
+    size_t             _maxEntries;
+    Cache              _cache;
+
+    void remove_expired(vespalib::steady_time now);
+
+public:
+    GlobalFilterCache(vespalib::duration maxAge, size_t maxEntries);
+    ~GlobalFilterCache();
+    GlobalFilterSP find(const vespalib::string &key, uint32_t docIdLimit);
+    void insert(const vespalib::string &key, GlobalFilterSP filter, uint32_t docIdLimit, ReadGuardSP dmsReadGuard);
+    void clear();
+    size_t size() const;
+};
+
+/**
+ * Everything needed to look up and populate a GlobalFilterCache from
+ * within query setup. Passed by pointer where caching is optional.
+ */
+struct GlobalFilterCacheContext {
+    GlobalFilterCache              *cache;
+    vespalib::string                key;
+    GlobalFilterCache::ReadGuardSP  dms_read_guard;
+    GlobalFilterCacheContext(GlobalFilterCache *cache_in, vespalib::string key_in,
+                             GlobalFilterCache::ReadGuardSP dms_read_guard_in) noexcept
+        : cache(cache_in), key(std::move(key_in)), dms_read_guard(std::move(dms_read_guard_in)) {}
+};
+
+}
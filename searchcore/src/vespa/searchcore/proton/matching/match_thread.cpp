@@ -15,6 +15,7 @@
 #include <vespa/searchlib/queryeval/profiled_iterator.h>
 #include <vespa/vespalib/data/slime/cursor.h>
 #include <vespa/vespalib/data/slime/inserter.h>
+#include <array>
 #include <limits>
 
 #include <vespa/log/log.h>
@@ -181,6 +182,26 @@ MatchThread::try_share(DocidRange &docid_range, uint32_t next_docid) {
     return false;
 }
 
+uint32_t
+MatchThread::block_match_loop(Context &context, SearchIterator &search, DocidRange &docid_range)
+{
+    constexpr uint32_t BLOCK_SIZE = 256;
+    std::array<uint32_t, BLOCK_SIZE> hits;
+    uint32_t docId = docid_range.begin;
+    while ((docId < docid_range.end) && !context.atSoftDoom()) {
+        uint32_t cnt = search.seek_block(docId, docid_range.end, hits.data(), BLOCK_SIZE);
+        for (uint32_t i = 0; i < cnt; ++i) {
+            context.addHit(hits[i]);
+        }
+        context.matches += cnt;
+        if (cnt < BLOCK_SIZE) {
+            return docid_range.end; // range fully evaluated
+        }
+        docId = hits[cnt - 1] + 1;
+    }
+    return docId;
+}
+
 template <typename Strategy, bool do_rank, bool do_limit, bool do_share_work,
           MatchThread::RankDropLimitE use_rank_drop_limit>
 uint32_t
@@ -188,6 +209,12 @@ MatchThread::inner_match_loop(Context &context, MatchTools &tools, DocidRange &d
 {
     SearchIterator *search = &tools.search();
     search->initRange(docid_range.begin, docid_range.end);
+    if (!do_rank && !do_limit && !do_share_work) {
+        // Plain filter matching touches no per-hit rank state, so hits can
+        // be collected a block at a time instead of one virtual seek
+        // round-trip per document.
+        return block_match_loop(context, *search, docid_range);
+    }
     uint32_t docId = search->seekFirst(docid_range.begin);
     while ((docId < docid_range.end) && !context.atSoftDoom()) {
         if (do_rank) {
@@ -332,12 +359,13 @@ MatchThread::secondPhase(MatchTools & tools, HitCollector & hits) {
     if (tools.getDoom().hard_doom()) {
         my_work.clear();
     }
+    size_t reRanked = 0;
     if (!my_work.empty()) {
         tools.setup_second_phase(second_phase_profiler.get());
         DocumentScorer scorer(tools.rank_program(), tools.search());
-        scorer.score(my_work);
+        reRanked = scorer.score(my_work, tools.getDoom());
     }
-    thread_stats.docsReRanked(my_work.size());
+    thread_stats.docsReRanked(reRanked);
     trace->addEvent(5, "Synchronize before rank scaling");
     WaitTimer complete_second_phase_timer(wait_time_s);
     auto [kept_hits, ranges] = communicator.complete_second_phase(my_work, thread_id);
@@ -1,6 +1,7 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "match_tools.h"
+#include "global_filter_cache.h"
 #include "querynodes.h"
 #include "rangequerylocator.h"
 #include <vespa/searchcorespi/index/indexsearchable.h>
@@ -93,6 +94,7 @@ MatchTools::setup(std::unique_ptr<RankProgram> rank_program, ExecutionProfiler *
     if (!can_reuse_search) {
         recorder.tag_match_data(*_match_data);
         _match_data->set_termwise_limit(termwise_limit);
+        search::queryeval::ExecutionArena::Activation arena(_iterator_arena);
         _search = _query.createSearch(*_match_data);
         _used_handles = std::move(recorder).steal_handles();
         _search_has_changed = false;
@@ -114,6 +116,7 @@ MatchTools::MatchTools(QueryLimiter & queryLimiter,
       _queryEnv(queryEnv),
       _rankSetup(rankSetup),
       _featureOverrides(featureOverrides),
+      _iterator_arena(),
       _match_data(mdl.createMatchData()),
       _rank_program(),
       _search(),
@@ -179,7 +182,8 @@ MatchToolsFactory(QueryLimiter               & queryLimiter,
                   vespalib::ThreadBundle     & thread_bundle,
                   const search::IDocumentMetaStoreContext::IReadGuard::SP * metaStoreReadGuard,
                   uint32_t                     maxNumHits,
-                  bool                         is_search)
+                  bool                         is_search,
+                  GlobalFilterCache          * global_filter_cache)
     : _queryLimiter(queryLimiter),
       _attribute_blueprint_params(extract_attribute_blueprint_params(rankSetup, rankProperties, metaStore.getNumActiveLids(), searchContext.getDocIdLimit())),
       _query(),
@@ -217,9 +221,22 @@ MatchToolsFactory(QueryLimiter               & queryLimiter,
         trace.addEvent(4, "Perform dictionary lookups and posting lists initialization");
         _query.fetchPostings(ExecuteInfo::create(in_flow.rate(), _requestContext.getDoom(), thread_bundle));
         if (is_search) {
+            std::unique_ptr<GlobalFilterCacheContext> cache_ctx;
+            // caching is opt-in per rank profile; a cached filter can lag
+            // attribute updates by up to the cache max age
+            if (CacheGlobalFilter::check(_queryEnv.getProperties()) &&
+                (global_filter_cache != nullptr) && (metaStoreReadGuard != nullptr) && *metaStoreReadGuard) {
+                // the serialized query identifies the filter produced from it
+                vespalib::string cache_key(queryStack.data(), queryStack.size());
+                cache_key += '\n';
+                cache_key += location;
+                cache_ctx = std::make_unique<GlobalFilterCacheContext>(global_filter_cache, std::move(cache_key),
+                                                                       *metaStoreReadGuard);
+            }
             _query.handle_global_filter(_requestContext, searchContext.getDocIdLimit(),
                                         _attribute_blueprint_params.global_filter_lower_limit,
-                                        _attribute_blueprint_params.global_filter_upper_limit, trace, sort_by_cost);
+                                        _attribute_blueprint_params.global_filter_upper_limit, trace, sort_by_cost,
+                                        cache_ctx.get());
         }
         _query.freeze();
         trace.addEvent(5, "Prepare shared state for multi-threaded rank executors");
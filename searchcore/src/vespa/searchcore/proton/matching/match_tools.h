@@ -30,6 +30,8 @@ namespace search::fef {
 
 namespace proton::matching {
 
+class GlobalFilterCache;
+
 class MatchTools
 {
 private:
@@ -48,6 +50,9 @@ private:
     const QueryEnvironment          &_queryEnv;
     const RankSetup                 &_rankSetup;
     const Properties                &_featureOverrides;
+    // per-thread arena backing the iterator tree; declared before
+    // _search so it outlives the iterators allocated from it
+    search::queryeval::ExecutionArena _iterator_arena;
     std::unique_ptr<MatchData>       _match_data;
     std::unique_ptr<RankProgram>     _rank_program;
     std::unique_ptr<SearchIterator>  _search;
@@ -158,7 +163,8 @@ public:
                       vespalib::ThreadBundle &thread_bundle,
                       const search::IDocumentMetaStoreContext::IReadGuard::SP * metaStoreReadGuard,
                       uint32_t maxNumHits,
-                      bool is_search);
+                      bool is_search,
+                      GlobalFilterCache * global_filter_cache = nullptr);
     ~MatchToolsFactory();
     bool valid() const { return _valid; }
     const MaybeMatchPhaseLimiter &match_limiter() const { return *_match_limiter; }
@@ -1,6 +1,7 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "matcher.h"
+#include "global_filter_cache.h"
 #include "isearchcontext.h"
 #include "match_master.h"
 #include "match_context.h"
@@ -17,6 +18,7 @@
 #include <vespa/searchlib/fef/ranksetup.h>
 #include <vespa/searchlib/fef/test/plugin/setup.h>
 #include <vespa/searchlib/common/allocatedbitvector.h>
+#include <vespa/searchlib/parsequery/stackdumpiterator.h>
 #include <vespa/vespalib/data/slime/inserter.h>
 #include <vespa/vespalib/util/limited_thread_bundle_wrapper.h>
 #include <cinttypes>
@@ -53,6 +55,30 @@ namespace {
 
 constexpr vespalib::duration TIME_BEFORE_ALLOWING_SOFT_TIMEOUT_FACTOR_ADJUSTMENT = 60s;
 
+// samples which fields a query uses and how many hits the leaf
+// blueprints estimate for them, keyed by field name
+void
+collectFieldStats(const Blueprint &blueprint, const search::fef::IIndexEnvironment &indexEnv,
+                  MatchingStats::FieldStatsMap &fieldStats)
+{
+    const auto *intermediate = blueprint.asIntermediate();
+    if (intermediate != nullptr) {
+        for (size_t i = 0; i < intermediate->childCnt(); ++i) {
+            collectFieldStats(intermediate->getChild(i), indexEnv, fieldStats);
+        }
+        return;
+    }
+    const Blueprint::State &state = blueprint.getState();
+    for (size_t i = 0; i < state.numFields(); ++i) {
+        const search::fef::FieldInfo *field = indexEnv.getField(state.field(i).getFieldId());
+        if (field != nullptr) {
+            auto &entry = fieldStats[field->name()];
+            entry.queries(1);
+            entry.estimated_hits(entry.estimated_hits() + state.estimate().estHits);
+        }
+    }
+}
+
 // used to give out empty whitelist blueprints
 struct StupidMetaStore : search::IDocumentMetaStore {
     static const search::AllocatedBitVector _dummy;
@@ -113,8 +139,13 @@ Matcher::Matcher(const search::index::Schema &schema, Properties props, const st
     _startTime(my_clock::now()),
     _now_ref(now_ref),
     _queryLimiter(queryLimiter),
-    _distributionKey(distributionKey)
+    _distributionKey(distributionKey),
+    _globalFilterCache(std::make_unique<GlobalFilterCache>(vespalib::from_s(0.5), 32)),
+    _softDoomFactorByClass()
 {
+    for (auto &factor : _softDoomFactorByClass) {
+        factor.store_relaxed(-1.0); // unset; falls back to the global factor
+    }
     search::features::setup_search_features(_blueprintFactory);
     search::fef::test::setup_fef_test_plugin(_blueprintFactory);
     _rankSetup = std::make_shared<search::fef::RankSetup>(_blueprintFactory, _indexEnv);
@@ -127,6 +158,32 @@ Matcher::Matcher(const search::index::Schema &schema, Properties props, const st
 
 Matcher::~Matcher() = default;
 
+uint32_t
+Matcher::classify_query(std::string_view stackDump) noexcept
+{
+    // Cheap structural hash (FNV-1a) over the serialized query stack;
+    // item types, arities and field names are mixed in while term
+    // values are ignored, so queries with the same shape share a class.
+    uint64_t hash = 0xcbf29ce484222325ul;
+    auto mix = [&hash](uint64_t value) { hash = (hash ^ value) * 0x100000001b3ul; };
+    search::SimpleQueryStackDumpIterator iterator(stackDump);
+    while (iterator.next()) {
+        mix(static_cast<uint64_t>(iterator.getType()));
+        mix(iterator.getArity());
+        for (char c : iterator.index_as_view()) {
+            mix(static_cast<uint8_t>(c));
+        }
+    }
+    return hash % NUM_QUERY_CLASSES;
+}
+
+double
+Matcher::get_class_soft_doom_factor(uint32_t query_class) const
+{
+    double factor = _softDoomFactorByClass[query_class % NUM_QUERY_CLASSES].load_relaxed();
+    return (factor < 0) ? _stats.softDoomFactor() : factor;
+}
+
 MatchingStats
 Matcher::getStats()
 {
@@ -146,23 +203,24 @@ Matcher::create_match_tools_factory(const search::engine::Request &request, ISea
     const Properties & rankProperties = request.propertiesMap.rankProperties();
     bool softTimeoutEnabled = softtimeout::Enabled::lookup(rankProperties, _rankSetup->getSoftTimeoutEnabled());
     bool hasFactorOverride = softtimeout::Factor::isPresent(rankProperties);
+    uint32_t queryClass = classify_query(request.getStackRef());
     double factor = softTimeoutEnabled
                     ? ( hasFactorOverride
                         ? softtimeout::Factor::lookup(rankProperties, _stats.softDoomFactor())
-                        : _stats.softDoomFactor())
+                        : get_class_soft_doom_factor(queryClass))
                     : 0.95;
     vespalib::duration safeLeft = std::chrono::duration_cast<vespalib::duration>(request.getTimeLeft() * factor);
     vespalib::steady_time safeDoom(_now_ref.load(std::memory_order_relaxed) + safeLeft);
     if (softTimeoutEnabled) {
-        LOG(debug, "Soft-timeout computed factor=%1.3f, used factor=%1.3f, userSupplied=%d, softTimeout=%" PRId64,
-                   _stats.softDoomFactor(), factor, hasFactorOverride, vespalib::count_ns(safeLeft));
+        LOG(debug, "Soft-timeout computed factor=%1.3f, used factor=%1.3f, queryClass=%u, userSupplied=%d, softTimeout=%" PRId64,
+                   _stats.softDoomFactor(), factor, queryClass, hasFactorOverride, vespalib::count_ns(safeLeft));
     }
     vespalib::Doom doom(_now_ref, safeDoom, request.getTimeOfDoom(), hasFactorOverride);
     return std::make_unique<MatchToolsFactory>(_queryLimiter, doom, searchContext, attrContext,
                                                request.trace(), request.getStackRef(), request.location,
                                                _viewResolver, metaStore, _indexEnv, *_rankSetup,
                                                rankProperties, feature_overrides, thread_bundle,
-                                               metaStoreReadGuard, maxHits, is_search);
+                                               metaStoreReadGuard, maxHits, is_search, _globalFilterCache.get());
 }
 
 size_t
@@ -296,6 +354,11 @@ Matcher::match(const SearchRequest &request, vespalib::ThreadBundle &threadBundl
         ResultProcessor::Result::UP result = master.match(request.trace(), params, limitedThreadBundle, *mtf, rp,
                                                           _distributionKey, numParts);
         my_stats = MatchMaster::getStats(std::move(master));
+        if (const Blueprint *root = mtf->query().peekRoot()) {
+            MatchingStats::FieldStatsMap fieldStats;
+            collectFieldStats(*root, _indexEnv, fieldStats);
+            my_stats.merge_field_stats(fieldStats);
+        }
         reply = std::move(result->_reply);
         Coverage & coverage = reply->coverage;
         updateCoverage(coverage, mtf->match_limiter(), my_stats, metaStore, bucketdb);
@@ -332,20 +395,28 @@ Matcher::updateStats(const MatchingStats & my_stats, const search::engine::Reque
         }
         bool allowedSoftTimeoutFactorAdjustment = ((my_clock::now() - _startTime) > TIME_BEFORE_ALLOWING_SOFT_TIMEOUT_FACTOR_ADJUSTMENT)
                                                   && ! isDoomExplicit;
+        uint32_t queryClass = classify_query(request.getStackRef());
         if (allowedSoftTimeoutFactorAdjustment) {
             _stats.updatesoftDoomFactor(request.getTimeout(), overtimeLimit, adjustedDuration);
+            double classFactor = _softDoomFactorByClass[queryClass].load_relaxed();
+            if (classFactor < 0) {
+                classFactor = old; // seed from the global factor on first observation
+            }
+            _softDoomFactorByClass[queryClass].store_relaxed(
+                    MatchingStats::adjust_soft_doom_factor(classFactor, request.getTimeout(),
+                                                           overtimeLimit, adjustedDuration));
         }
         if ((_stats.softDoomed() < 10) || (_stats.softDoomed()%100 == 0)) {
             LOG(info,
                 "Triggered softtimeout %s count: %zu. Coverage = %" PRIu64 " of %" PRIu64 " documents. request=%1.3f,"
-                " doomOvertime=%1.3f, overtime_limit=%1.3f and duration=%1.3f, rankprofile=%s"
-                ", factor %s adjusted from %1.3f to %1.3f",
+                " doomOvertime=%1.3f, overtime_limit=%1.3f and duration=%1.3f, rankprofile=%s, queryClass=%u"
+                ", factor %s adjusted from %1.3f to %1.3f (class factor %1.3f)",
                 isDoomExplicit ? "with query override" : "factor adjustment",
                 _stats.softDoomed(), coverage.getCovered(), coverage.getActive(),
                 vespalib::to_s(request.getTimeout()), vespalib::to_s(my_stats.doomOvertime()),
                 vespalib::to_s(overtimeLimit), vespalib::to_s(duration),
-                request.ranking.c_str(), (allowedSoftTimeoutFactorAdjustment ? "" : "NOT "), old,
-                _stats.softDoomFactor());
+                request.ranking.c_str(), queryClass, (allowedSoftTimeoutFactorAdjustment ? "" : "NOT "), old,
+                _stats.softDoomFactor(), _softDoomFactorByClass[queryClass].load_relaxed());
         }
     }
 }
@@ -18,6 +18,7 @@
 #include <vespa/searchlib/query/base.h>
 #include <vespa/vespalib/util/featureset.h>
 #include <vespa/vespalib/util/thread_bundle.h>
+#include <array>
 #include <mutex>
 
 namespace search::grouping {
@@ -41,6 +42,7 @@ namespace proton::matching {
 class ISearchContext;
 class SessionManager;
 class MatchToolsFactory;
+class GlobalFilterCache;
 
 /**
  * The Matcher is responsible for performing searches.
@@ -59,6 +61,9 @@ private:
     using MatchingElements = search::MatchingElements;
     using MatchingElementsFields = search::MatchingElementsFields;
     using steady_time = vespalib::steady_time;
+public:
+    static constexpr size_t NUM_QUERY_CLASSES = 32;
+private:
     IndexEnvironment                _indexEnv;
     search::fef::BlueprintFactory   _blueprintFactory;
     std::shared_ptr<RankSetup>      _rankSetup;
@@ -69,6 +74,12 @@ private:
     const std::atomic<steady_time> &_now_ref;
     QueryLimiter                   &_queryLimiter;
     uint32_t                        _distributionKey;
+    std::unique_ptr<GlobalFilterCache> _globalFilterCache;
+    // Soft doom factors learned separately per query class, so slow and
+    // fast query shapes get individual soft timeouts instead of a single
+    // shared one. Unset entries (negative) fall back to the global factor.
+    using ClassSoftDoomFactor = vespalib::datastore::AtomicValueWrapper<double>;
+    std::array<ClassSoftDoomFactor, NUM_QUERY_CLASSES> _softDoomFactorByClass;
 
     size_t computeNumThreadsPerSearch(search::queryeval::Blueprint::HitEstimate hits,
                                       const Properties & rankProperties) const;
@@ -96,6 +107,19 @@ public:
 
     const search::fef::IIndexEnvironment &get_index_env() const { return _indexEnv; }
 
+    /**
+     * Map a serialized query stack onto one of NUM_QUERY_CLASSES query
+     * classes based on its shape (item types, arities and field names);
+     * term values are ignored.
+     **/
+    static uint32_t classify_query(std::string_view stackDump) noexcept;
+
+    /**
+     * Observe the soft doom factor learned for the given query class.
+     * Falls back to the global factor for classes without observations.
+     **/
+    double get_class_soft_doom_factor(uint32_t query_class) const;
+
     /**
      * Observe and reset stats for this object.
      *
@@ -34,11 +34,21 @@ MatchingStats::MatchingStats(double prev_soft_doom_factor) noexcept
       _matchTime(),
       _groupingTime(),
       _rerankTime(),
-      _partitions()
+      _partitions(),
+      _field_stats()
 { }
 
 MatchingStats::~MatchingStats() = default;
 
+MatchingStats &
+MatchingStats::merge_field_stats(const FieldStatsMap &rhs)
+{
+    for (const auto &entry : rhs) {
+        _field_stats[entry.first].add(entry.second);
+    }
+    return *this;
+}
+
 MatchingStats &
 MatchingStats::merge_partition(const Partition &partition, size_t id)
 {
@@ -77,17 +87,24 @@ MatchingStats::add(const MatchingStats &rhs) noexcept
     for (size_t id = 0; id < rhs.getNumPartitions(); ++id) {
         get_writable_partition(_partitions, id).add(rhs.getPartition(id));
     }
+    merge_field_stats(rhs._field_stats);
     return *this;
 }
 
 MatchingStats &
 MatchingStats::updatesoftDoomFactor(vespalib::duration hardLimit, vespalib::duration softLimit, vespalib::duration duration) {
+    softDoomFactor(adjust_soft_doom_factor(softDoomFactor(), hardLimit, softLimit, duration));
+    return *this;
+}
+
+double
+MatchingStats::adjust_soft_doom_factor(double factor, vespalib::duration hardLimit,
+                                       vespalib::duration softLimit, vespalib::duration duration) {
     // The safety capping here should normally not be necessary as all input numbers
     // will normally be within reasonable values.
     // It is merely a safety measure to avoid overflow on bad input as can happen with time senstive stuff
     // in any soft real time system.
     if ((hardLimit >= MIN_TIMEOUT) && (softLimit >= MIN_TIMEOUT)) {
-        double factor = softDoomFactor();
         double diff = vespalib::to_s(softLimit - duration)/vespalib::to_s(hardLimit);
         if (duration < softLimit) {
             // Since softdoom factor can become very small, allow a minimum change of some size
@@ -98,9 +115,8 @@ MatchingStats::updatesoftDoomFactor(vespalib::duration hardLimit, vespalib::dura
             factor += 0.02*diff;
         }
         factor = std::max(factor, 0.01); // Never go below 1%
-        softDoomFactor(factor);
     }
-    return *this;
+    return factor;
 }
 
 }
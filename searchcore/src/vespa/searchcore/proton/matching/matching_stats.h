@@ -2,8 +2,10 @@
 
 #pragma once
 
+#include <map>
 #include <vector>
 #include <cstddef>
+#include <vespa/vespalib/stllike/string.h>
 #include <vespa/vespalib/util/time.h>
 #include <vespa/vespalib/datastore/atomic_value_wrapper.h>
 
@@ -116,6 +118,28 @@ public:
         }
     };
 
+    /**
+     * Per-field query cost statistics, sampled from the optimized
+     * blueprint tree when a query has been set up. Tracked per field
+     * name used by leaf blueprints (attribute or index field).
+     **/
+    class FieldStats {
+        size_t _queries;
+        size_t _estimated_hits;
+    public:
+        FieldStats() noexcept : _queries(0), _estimated_hits(0) { }
+        FieldStats &queries(size_t value) noexcept { _queries = value; return *this; }
+        size_t queries() const noexcept { return _queries; }
+        FieldStats &estimated_hits(size_t value) noexcept { _estimated_hits = value; return *this; }
+        size_t estimated_hits() const noexcept { return _estimated_hits; }
+        FieldStats &add(const FieldStats &rhs) noexcept {
+            _queries += rhs._queries;
+            _estimated_hits += rhs._estimated_hits;
+            return *this;
+        }
+    };
+    using FieldStatsMap = std::map<vespalib::string, FieldStats>;
+
 private:
     size_t                 _queries;
     size_t                 _limited_queries;
@@ -133,6 +157,7 @@ private:
     Avg                    _groupingTime;
     Avg                    _rerankTime;
     std::vector<Partition> _partitions;
+    FieldStatsMap          _field_stats;
 
 public:
     static constexpr double INITIAL_SOFT_DOOM_FACTOR = 0.5;
@@ -170,6 +195,8 @@ public:
     MatchingStats &softDoomFactor(double value) { _softDoomFactor.store_relaxed(value); return *this; }
     double softDoomFactor() const { return _softDoomFactor.load_relaxed(); }
     MatchingStats &updatesoftDoomFactor(vespalib::duration hardLimit, vespalib::duration softLimit, vespalib::duration duration);
+    static double adjust_soft_doom_factor(double factor, vespalib::duration hardLimit,
+                                          vespalib::duration softLimit, vespalib::duration duration);
 
     MatchingStats &querySetupTime(double time_s) { _querySetupTime.set(time_s); return *this; }
     double querySetupTimeAvg() const { return _querySetupTime.avg(); }
@@ -201,6 +228,10 @@ public:
     double rerankTimeMin() const { return _rerankTime.min(); }
     double rerankTimeMax() const { return _rerankTime.max(); }
 
+    // used to merge in per-field stats sampled from a single query
+    MatchingStats &merge_field_stats(const FieldStatsMap &rhs);
+    const FieldStatsMap &get_field_stats() const { return _field_stats; }
+
     // used to merge in stats from each match thread
     MatchingStats &merge_partition(const Partition &partition, size_t id);
     size_t getNumPartitions() const { return _partitions.size(); }
@@ -2,6 +2,7 @@
 
 #include "query.h"
 #include "blueprintbuilder.h"
+#include "global_filter_cache.h"
 #include "matchdatareservevisitor.h"
 #include "resolveviewvisitor.h"
 #include "sameelementmodifier.h"
@@ -194,6 +195,7 @@ Query::reserveHandles(const IRequestContext & requestContext, ISearchContext &co
     MatchDataReserveVisitor reserve_visitor(mdl);
     _query_tree->accept(reserve_visitor);
 
+    ExecutionArena::Activation arena(_arena);
     _blueprint = BlueprintBuilder::build(requestContext, *_query_tree, std::move(_whiteListBlueprint), context);
     LOG(debug, "original blueprint:\n%s\n", _blueprint->asString().c_str());
 }
@@ -209,6 +211,7 @@ Query::optimize(InFlow in_flow, bool sort_by_cost)
 {
     _in_flow = in_flow;
     auto opts = Blueprint::Options().sort_by_cost(sort_by_cost).allow_force_strict(sort_by_cost);
+    ExecutionArena::Activation arena(_arena);
     _blueprint = Blueprint::optimize_and_sort(std::move(_blueprint), in_flow, opts);
     LOG(debug, "optimized blueprint:\n%s\n", _blueprint->asString().c_str());
 }
@@ -222,10 +225,12 @@ Query::fetchPostings(const ExecuteInfo & executeInfo)
 void
 Query::handle_global_filter(const IRequestContext & requestContext, uint32_t docid_limit,
                             double global_filter_lower_limit, double global_filter_upper_limit,
-                            search::engine::Trace& trace, bool sort_by_cost)
+                            search::engine::Trace& trace, bool sort_by_cost,
+                            const GlobalFilterCacheContext *cache_ctx)
 {
+    ExecutionArena::Activation arena(_arena);
     if (!handle_global_filter(*_blueprint, docid_limit, global_filter_lower_limit, global_filter_upper_limit,
-                              requestContext.thread_bundle(), &trace))
+                              requestContext.thread_bundle(), &trace, cache_ctx))
     {
         return;
     }
@@ -241,7 +246,8 @@ Query::handle_global_filter(const IRequestContext & requestContext, uint32_t doc
 bool
 Query::handle_global_filter(Blueprint& blueprint, uint32_t docid_limit,
                             double global_filter_lower_limit, double global_filter_upper_limit,
-                            vespalib::ThreadBundle &thread_bundle, search::engine::Trace* trace)
+                            vespalib::ThreadBundle &thread_bundle, search::engine::Trace* trace,
+                            const GlobalFilterCacheContext *cache_ctx)
 {
     using search::queryeval::GlobalFilter;
     double estimated_hit_ratio = blueprint.getState().hit_ratio(docid_limit);
@@ -263,7 +269,18 @@ Query::handle_global_filter(Blueprint& blueprint, uint32_t docid_limit,
             trace->addEvent(5, vespalib::make_string("Calculate global filter (estimated_hit_ratio (%f) <= upper_limit (%f))",
                                                      estimated_hit_ratio, global_filter_upper_limit));
         }
-        global_filter = GlobalFilter::create(blueprint, docid_limit, thread_bundle, trace);
+        if ((cache_ctx != nullptr) && (cache_ctx->cache != nullptr)) {
+            global_filter = cache_ctx->cache->find(cache_ctx->key, docid_limit);
+            if (global_filter && trace && trace->shouldTrace(5)) {
+                trace->addEvent(5, "Reuse cached global filter");
+            }
+        }
+        if (!global_filter) {
+            global_filter = GlobalFilter::create(blueprint, docid_limit, thread_bundle, trace);
+            if ((cache_ctx != nullptr) && (cache_ctx->cache != nullptr) && cache_ctx->dms_read_guard) {
+                cache_ctx->cache->insert(cache_ctx->key, global_filter, docid_limit, cache_ctx->dms_read_guard);
+            }
+        }
         if (!global_filter->is_active() && trace && trace->shouldTrace(5)) {
             trace->addEvent(5, "Global filter matches everything");
         }
@@ -8,6 +8,7 @@
 #include <vespa/searchlib/fef/iindexenvironment.h>
 #include <vespa/searchlib/query/tree/node.h>
 #include <vespa/searchlib/queryeval/blueprint.h>
+#include <vespa/searchlib/queryeval/execution_arena.h>
 #include <vespa/searchlib/queryeval/irequestcontext.h>
 
 namespace vespalib { struct ThreadBundle; }
@@ -17,6 +18,7 @@ namespace proton::matching {
 
 class ViewResolver;
 class ISearchContext;
+struct GlobalFilterCacheContext;
 
 class Query
 {
@@ -27,6 +29,10 @@ private:
     using IRequestContext = search::queryeval::IRequestContext;
     using GeoLocationSpec = search::common::GeoLocationSpec;
     using InFlow = search::queryeval::InFlow;
+    using ExecutionArena = search::queryeval::ExecutionArena;
+    // per-query arena backing the blueprint tree; declared first so it
+    // outlives the tree allocated from it
+    ExecutionArena               _arena;
     search::query::Node::UP      _query_tree;
     InFlow                       _in_flow = InFlow(true);
     Blueprint::UP                _blueprint;
@@ -112,7 +118,8 @@ public:
 
     void handle_global_filter(const IRequestContext & requestContext, uint32_t docid_limit,
                               double global_filter_lower_limit, double global_filter_upper_limit,
-                              search::engine::Trace& trace, bool sort_by_cost);
+                              search::engine::Trace& trace, bool sort_by_cost,
+                              const GlobalFilterCacheContext *cache_ctx = nullptr);
 
     /**
      * Calculates and handles the global filter if needed by the blueprint tree.
@@ -129,7 +136,20 @@ public:
      */
     static bool handle_global_filter(Blueprint& blueprint, uint32_t docid_limit,
                                      double global_filter_lower_limit, double global_filter_upper_limit,
-                                     vespalib::ThreadBundle &thread_bundle, search::engine::Trace* trace);
+                                     vespalib::ThreadBundle &thread_bundle, search::engine::Trace* trace) {
+        return handle_global_filter(blueprint, docid_limit, global_filter_lower_limit, global_filter_upper_limit,
+                                    thread_bundle, trace, nullptr);
+    }
+
+    /**
+     * Variant that consults the given global filter cache (when
+     * non-null) before calculating the filter, and populates it with
+     * freshly calculated filters.
+     */
+    static bool handle_global_filter(Blueprint& blueprint, uint32_t docid_limit,
+                                     double global_filter_lower_limit, double global_filter_upper_limit,
+                                     vespalib::ThreadBundle &thread_bundle, search::engine::Trace* trace,
+                                     const GlobalFilterCacheContext *cache_ctx);
 
     void freeze();
     void set_matching_phase(search::queryeval::MatchingPhase matching_phase) const noexcept;
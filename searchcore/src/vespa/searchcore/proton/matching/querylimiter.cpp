@@ -4,10 +4,18 @@
 
 namespace proton:: matching {
 
-QueryLimiter::LimitedToken::LimitedToken(const Doom & doom, QueryLimiter & limiter) :
+namespace {
+
+// A limited query whose hit count is at least this factor above the
+// limiting threshold is considered large and yields to smaller ones.
+constexpr uint64_t large_cost_factor = 10;
+
+}
+
+QueryLimiter::LimitedToken::LimitedToken(const Doom & doom, QueryLimiter & limiter, CostClass cost_class) :
     _limiter(limiter)
 {
-    _limiter.grabToken(doom);
+    _limiter.grabToken(doom, cost_class);
 }
 
 QueryLimiter::LimitedToken::~LimitedToken()
@@ -15,17 +23,44 @@ QueryLimiter::LimitedToken::~LimitedToken()
     _limiter.releaseToken();
 }
 
+bool
+QueryLimiter::is_my_turn(uint64_t ticket) const
+{
+    // The first small waiter is admitted before any large one; within
+    // a cost class waiters are admitted in arrival order.
+    for (const auto & waiter : _waiters) {
+        if (waiter.cost_class == CostClass::SMALL) {
+            return waiter.ticket == ticket;
+        }
+    }
+    return !_waiters.empty() && (_waiters.front().ticket == ticket);
+}
+
 void
-QueryLimiter::grabToken(const Doom & doom)
+QueryLimiter::grabToken(const Doom & doom, CostClass cost_class)
 {
     std::unique_lock<std::mutex> guard(_lock);
-    for (auto max_threads = get_max_threads(); (max_threads > 0) && (_activeThreads >= max_threads) && !doom.hard_doom(); max_threads = get_max_threads()) {
+    uint64_t ticket = _nextTicket++;
+    _waiters.push_back(Waiter{ticket, cost_class});
+    for (auto max_threads = get_max_threads();
+         (max_threads > 0) && ((_activeThreads >= max_threads) || !is_my_turn(ticket)) && !doom.hard_doom();
+         max_threads = get_max_threads())
+    {
         vespalib::duration left = doom.hard_left();
         if (left > vespalib::duration::zero()) {
             _cond.wait_for(guard, left);
         }
     }
+    for (auto itr = _waiters.begin(); itr != _waiters.end(); ++itr) {
+        if (itr->ticket == ticket) {
+            _waiters.erase(itr);
+            break;
+        }
+    }
     _activeThreads++;
+    // The next waiter in line might be eligible now (e.g. when we
+    // stopped waiting due to the doom).
+    _cond.notify_all();
 }
 
 void
@@ -33,13 +68,15 @@ QueryLimiter::releaseToken()
 {
     std::lock_guard<std::mutex> guard(_lock);
     _activeThreads--;
-    _cond.notify_one();
+    _cond.notify_all();
 }
 
 QueryLimiter::QueryLimiter() :
     _lock(),
     _cond(),
     _activeThreads(0),
+    _waiters(),
+    _nextTicket(0),
     _maxThreads(-1),
     _coverage(1.0),
     _minHits(std::numeric_limits<uint32_t>::max())
@@ -63,7 +100,10 @@ QueryLimiter::getToken(const Doom & doom, uint32_t numDocs, uint32_t numHits, bo
         if (hasSorting || hasGrouping) {
             if (numHits > get_min_hits()) {
                 if (numDocs * get_coverage() < numHits) {
-                    return std::make_unique<LimitedToken>(doom, *this);
+                    CostClass cost_class = (uint64_t(numHits) >= large_cost_factor * get_min_hits())
+                                           ? CostClass::LARGE
+                                           : CostClass::SMALL;
+                    return std::make_unique<LimitedToken>(doom, *this, cost_class);
                 }
             }
         }
@@ -4,8 +4,9 @@
 
 #include <memory>
 #include <vespa/vespalib/util/doom.h>
-#include <mutex>
 #include <condition_variable>
+#include <deque>
+#include <mutex>
 
 namespace proton::matching {
 
@@ -24,22 +25,33 @@ public:
     void configure(int maxThreads, double coverage, uint32_t minHits);
     Token::UP getToken(const Doom & doom, uint32_t numDocs, uint32_t numHits, bool hasSorting, bool hasGrouping);
 private:
+    // Limited queries are split into two cost classes based on the
+    // number of hits they will process; small ones are admitted ahead
+    // of large ones so they never queue behind them.
+    enum class CostClass : uint8_t { SMALL = 0, LARGE = 1 };
+    struct Waiter {
+        uint64_t  ticket;
+        CostClass cost_class;
+    };
     class NoLimitToken : public Token {
     };
     class LimitedToken : public Token {
     private:
         QueryLimiter & _limiter;
     public:
-        LimitedToken(const Doom & doom, QueryLimiter & limiter);
+        LimitedToken(const Doom & doom, QueryLimiter & limiter, CostClass cost_class);
         LimitedToken(const NoLimitToken &) = delete;
         LimitedToken & operator =(const NoLimitToken &) = delete;
         ~LimitedToken() override;
     };
-    void grabToken(const Doom & doom);
+    void grabToken(const Doom & doom, CostClass cost_class);
     void releaseToken();
+    bool is_my_turn(uint64_t ticket) const; // called with _lock held
     std::mutex              _lock;
     std::condition_variable _cond;
     int _activeThreads;
+    std::deque<Waiter>      _waiters; // in arrival order
+    uint64_t                _nextTicket;
 
     // These are updated asynchronously at reconfig.
     std::atomic<int>      _maxThreads;
@@ -110,7 +110,7 @@ DocumentDBTaggedMetrics::IndexMetrics::IndexMetrics(MetricSet *parent)
 DocumentDBTaggedMetrics::IndexMetrics::~IndexMetrics() = default;
 
 void
-DocumentDBTaggedMetrics::MatchingMetrics::update(const MatchingStats &stats)
+DocumentDBTaggedMetrics::MatchingMetrics::update(const metrics::MetricLockGuard &, const MatchingStats &stats)
 {
     docsMatched.inc(stats.docsMatched());
     docsRanked.inc(stats.docsRanked());
@@ -121,6 +121,16 @@ DocumentDBTaggedMetrics::MatchingMetrics::update(const MatchingStats &stats)
                                       stats.querySetupTimeMin(), stats.querySetupTimeMax());
     queryLatency.addValueBatch(stats.queryLatencyAvg(), stats.queryLatencyCount(),
                                stats.queryLatencyMin(), stats.queryLatencyMax());
+    for (const auto &fieldStats : stats.get_field_stats()) {
+        auto itr = fields.find(fieldStats.first);
+        if (itr == fields.end()) {
+            // Fields are discovered as queries use them; the metric
+            // lock is held by the caller, making registration safe.
+            itr = fields.insert(std::make_pair(fieldStats.first,
+                                               std::make_unique<FieldMetrics>(fieldStats.first, this))).first;
+        }
+        itr->second->update(fieldStats.second);
+    }
 }
 
 DocumentDBTaggedMetrics::MatchingMetrics::MatchingMetrics(MetricSet *parent)
@@ -137,6 +147,22 @@ DocumentDBTaggedMetrics::MatchingMetrics::MatchingMetrics(MetricSet *parent)
 
 DocumentDBTaggedMetrics::MatchingMetrics::~MatchingMetrics() = default;
 
+DocumentDBTaggedMetrics::MatchingMetrics::FieldMetrics::FieldMetrics(const vespalib::string &name, MetricSet *parent)
+    : MetricSet("field", {{"field", name}}, "Per-field query cost metrics", parent),
+      queries("queries", {}, "Number of queries using this field", this),
+      estimatedHits("estimated_hits", {}, "Number of hits estimated by the leaf blueprints for this field", this)
+{
+}
+
+DocumentDBTaggedMetrics::MatchingMetrics::FieldMetrics::~FieldMetrics() = default;
+
+void
+DocumentDBTaggedMetrics::MatchingMetrics::FieldMetrics::update(const MatchingStats::FieldStats &stats)
+{
+    queries.inc(stats.queries());
+    estimatedHits.inc(stats.estimated_hits());
+}
+
 DocumentDBTaggedMetrics::MatchingMetrics::RankProfileMetrics::RankProfileMetrics(const vespalib::string &name,
                                                                                  size_t numDocIdPartitions,
                                                                                  MetricSet *parent)
@@ -156,10 +156,22 @@ struct DocumentDBTaggedMetrics : metrics::MetricSet
             void update(const metrics::MetricLockGuard & guard, const matching::MatchingStats &stats);
 
         };
+        struct FieldMetrics : metrics::MetricSet {
+            using UP = std::unique_ptr<FieldMetrics>;
+
+            metrics::LongCountMetric queries;
+            metrics::LongCountMetric estimatedHits;
+
+            FieldMetrics(const vespalib::string &name, metrics::MetricSet *parent);
+            ~FieldMetrics() override;
+            void update(const matching::MatchingStats::FieldStats &stats);
+        };
         using  RankProfileMap = std::map<vespalib::string, RankProfileMetrics::UP>;
+        using  FieldMap = std::map<vespalib::string, FieldMetrics::UP>;
         RankProfileMap rank_profiles;
+        FieldMap fields;
 
-        void update(const matching::MatchingStats &stats);
+        void update(const metrics::MetricLockGuard &guard, const matching::MatchingStats &stats);
         MatchingMetrics(metrics::MetricSet *parent);
         ~MatchingMetrics() override;
     };
@@ -68,7 +68,8 @@ BucketMoveJob::BucketMoveJob(std::shared_ptr<IBucketStateCalculator> calc,
                              IDiskMemUsageNotifier &diskMemUsageNotifier,
                              const BlockableMaintenanceJobConfig &blockableConfig,
                              const vespalib::string &docTypeName,
-                             document::BucketSpace bucketSpace)
+                             document::BucketSpace bucketSpace,
+                             uint32_t maxDocsToMovePerBucket)
     : BlockableMaintenanceJob("move_buckets." + docTypeName, vespalib::duration::zero(), vespalib::duration::zero(), blockableConfig),
       IClusterStateChangedHandler(),
       bucketdb::IBucketCreateListener(),
@@ -84,6 +85,7 @@ BucketMoveJob::BucketMoveJob(std::shared_ptr<IBucketStateCalculator> calc,
       _ready(ready),
       _notReady(notReady),
       _bucketSpace(bucketSpace),
+      _maxDocsToMovePerBucket(std::max(1u, maxDocsToMovePerBucket)),
       _iterateCount(0),
       _movers(),
       _bucketsInFlight(),
@@ -129,11 +131,12 @@ BucketMoveJob::create(std::shared_ptr<IBucketStateCalculator> calc,
                       IDiskMemUsageNotifier &diskMemUsageNotifier,
                       const BlockableMaintenanceJobConfig &blockableConfig,
                       const vespalib::string &docTypeName,
-                      document::BucketSpace bucketSpace)
+                      document::BucketSpace bucketSpace,
+                      uint32_t maxDocsToMovePerBucket)
 {
     return {new BucketMoveJob(std::move(calc), std::move(dbRetainer), moveHandler, modifiedHandler, master, bucketExecutor, ready, notReady,
                               bucketCreateNotifier, clusterStateChangedNotifier, bucketStateChangedNotifier,
-                              diskMemUsageNotifier, blockableConfig, docTypeName, bucketSpace),
+                              diskMemUsageNotifier, blockableConfig, docTypeName, bucketSpace, maxDocsToMovePerBucket),
             [&master](auto job) {
                 auto failed = master.execute(makeLambdaTask([job]() { delete job; }));
                 assert(!failed);
@@ -389,7 +392,7 @@ BucketMoveJob::run()
     }
     /// Returning false here will immediately post the job back on the executor. This will give a busy loop,
     /// but this is considered fine as it is very rare and it will be intermingled with multiple feed operations.
-    if ( ! scanAndMove(1, 1) ) {
+    if ( ! scanAndMove(1, _maxDocsToMovePerBucket) ) {
         return false;
     }
 
@@ -66,6 +66,7 @@ private:
     const MaintenanceDocumentSubDB            _ready;
     const MaintenanceDocumentSubDB            _notReady;
     const document::BucketSpace               _bucketSpace;
+    const uint32_t                            _maxDocsToMovePerBucket;
     size_t                                    _iterateCount;
     Movers                                    _movers;
     Bucket2Mover                              _bucketsInFlight;
@@ -103,7 +104,8 @@ private:
                   IDiskMemUsageNotifier &diskMemUsageNotifier,
                   const BlockableMaintenanceJobConfig &blockableConfig,
                   const vespalib::string &docTypeName,
-                  document::BucketSpace bucketSpace);
+                  document::BucketSpace bucketSpace,
+                  uint32_t maxDocsToMovePerBucket);
 
     void startMove(BucketMover & mover, size_t maxDocsToMove);
     static void prepareMove(std::shared_ptr<BucketMoveJob> job, BucketMover::MoveKeys keys, IDestructorCallbackSP context);
@@ -138,7 +140,8 @@ public:
            IDiskMemUsageNotifier &diskMemUsageNotifier,
            const BlockableMaintenanceJobConfig &blockableConfig,
            const vespalib::string &docTypeName,
-           document::BucketSpace bucketSpace);
+           document::BucketSpace bucketSpace,
+           uint32_t maxDocsToMovePerBucket);
 
     ~BucketMoveJob() override;
 
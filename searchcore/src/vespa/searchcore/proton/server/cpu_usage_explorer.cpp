@@ -0,0 +1,33 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "cpu_usage_explorer.h"
+#include <vespa/vespalib/data/slime/cursor.h>
+#include <vespa/vespalib/util/cpu_usage.h>
+
+using vespalib::CpuUsage;
+
+namespace proton {
+
+void
+CpuUsageExplorer::get_state(const vespalib::slime::Inserter& inserter, bool full) const
+{
+    auto& object = inserter.insertObject();
+    auto[sample_time, sample] = CpuUsage::sample();
+    (void) sample_time;
+    double categorized_s = 0.0;
+    auto& categories = object.setObject("categories");
+    for (size_t i = 0; i < sample.size(); ++i) {
+        double used_s = vespalib::to_s(sample[i]);
+        categorized_s += used_s;
+        categories.setDouble(CpuUsage::name_of(CpuUsage::Category(i)), used_s);
+    }
+    double total_s = vespalib::to_s(vespalib::cpu_usage::total_cpu_usage());
+    object.setDouble("total", total_s);
+    if (full) {
+        // CPU used by threads that do not declare a usage category is
+        // not part of any bucket above.
+        object.setDouble("uncategorized", std::max(total_s - categorized_s, 0.0));
+    }
+}
+
+}
@@ -0,0 +1,20 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/vespalib/net/http/state_explorer.h>
+
+namespace proton {
+
+/**
+ * Class used to explore how much CPU proton has spent in each work
+ * category (setup/read/write/compact/other) along with the total CPU
+ * usage of the process.
+ */
+class CpuUsageExplorer : public vespalib::StateExplorer
+{
+public:
+    void get_state(const vespalib::slime::Inserter& inserter, bool full) const override;
+};
+
+}
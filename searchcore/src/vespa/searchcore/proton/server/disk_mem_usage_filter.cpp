@@ -69,6 +69,20 @@ makeDiskLimitMessage(std::ostream &os,
     os << "}";
 }
 
+void
+makeApproachingLimitMessage(std::ostream &os,
+                            const char *resource,
+                            double used,
+                            double limit,
+                            const DiskMemUsageFilter::UsageTrend &trend)
+{
+    os << resource << "LimitApproaching: { ";
+    os << "used: " << used << ", ";
+    os << "limit: " << limit << ", ";
+    os << "growthRatePerSec: " << trend.growth_rate() << ", ";
+    os << "timeToLimitSec: " << trend.time_to_limit() << "}";
+}
+
 vespalib::string
 makeUnblockingMessage(double memoryUsed,
                       double memoryLimit,
@@ -88,6 +102,25 @@ makeUnblockingMessage(double memoryUsed,
     return os.str();
 }
 
+// Smoothing factor for new growth rate samples (exponential moving average).
+constexpr double trend_smoothing = 0.5;
+
+// Warn when the projected time until a resource limit is reached drops
+// below this window (while writes are still accepted).
+constexpr double approach_warn_window_sec = 3600.0;
+
+DiskMemUsageFilter::UsageTrend
+makeTrend(const DiskMemUsageFilter::UsageTrend &prev, double sampleRate, double used, double limit)
+{
+    double rate = trend_smoothing * sampleRate + (1.0 - trend_smoothing) * prev.growth_rate();
+    double headroom = limit - used;
+    double timeToLimit = -1.0;
+    if (rate > 0.0) {
+        timeToLimit = (headroom > 0.0) ? (headroom / rate) : 0.0;
+    }
+    return DiskMemUsageFilter::UsageTrend(rate, timeToLimit);
+}
+
 }
 
 void
@@ -126,6 +159,25 @@ DiskMemUsageFilter::recalcState(const Guard &guard)
                                                                 _diskUsedSizeBytes);
             LOG(info, "Write operations are now un-blocked: '%s'", unblockMsg.c_str());
         }
+        bool approaching = _diskTrend.approaching_limit(approach_warn_window_sec) ||
+                           _memoryTrend.approaching_limit(approach_warn_window_sec);
+        if (approaching && !_approachWarned) {
+            std::ostringstream warn;
+            bool first = true;
+            if (_diskTrend.approaching_limit(approach_warn_window_sec)) {
+                makeApproachingLimitMessage(warn, "disk", diskUsed, _config._diskLimit, _diskTrend);
+                first = false;
+            }
+            if (_memoryTrend.approaching_limit(approach_warn_window_sec)) {
+                if (!first) {
+                    warn << ", ";
+                }
+                makeApproachingLimitMessage(warn, "memory", memoryUsed, _config._memoryLimit, _memoryTrend);
+            }
+            LOG(warning, "Resource usage is growing towards the limit, "
+                "write operations will be blocked when it is reached: '%s'", warn.str().c_str());
+        }
+        _approachWarned = approaching;
         _state = State();
         _acceptWrite = true;
     }
@@ -163,6 +215,25 @@ DiskMemUsageFilter::get_relative_transient_disk_usage(const Guard&) const
     return  static_cast<double>(_transient_usage.disk()) / _hwInfo.disk().sizeBytes();
 }
 
+void
+DiskMemUsageFilter::updateTrends(const Guard &guard, vespalib::steady_time sampleTime)
+{
+    double diskUsed = getDiskUsedRatio(guard);
+    double memoryUsed = getMemoryUsedRatio(guard);
+    if (_lastSampleTime != vespalib::steady_time()) {
+        double dt = vespalib::to_s(sampleTime - _lastSampleTime);
+        if (dt > 0.0) {
+            _diskTrend = makeTrend(_diskTrend, (diskUsed - _lastDiskUsedRatio) / dt,
+                                   diskUsed, _config._diskLimit);
+            _memoryTrend = makeTrend(_memoryTrend, (memoryUsed - _lastMemoryUsedRatio) / dt,
+                                     memoryUsed, _config._memoryLimit);
+        }
+    }
+    _lastSampleTime = sampleTime;
+    _lastDiskUsedRatio = diskUsed;
+    _lastMemoryUsedRatio = memoryUsed;
+}
+
 DiskMemUsageFilter::DiskMemUsageFilter(const vespalib::HwInfo &hwInfo)
     : _lock(),
       _hwInfo(hwInfo),
@@ -174,17 +245,30 @@ DiskMemUsageFilter::DiskMemUsageFilter(const vespalib::HwInfo &hwInfo)
       _state(),
       _dmstate(),
       _disk_mem_usage_metrics(),
-      _listeners()
+      _listeners(),
+      _lastSampleTime(),
+      _lastDiskUsedRatio(0.0),
+      _lastMemoryUsedRatio(0.0),
+      _diskTrend(),
+      _memoryTrend(),
+      _approachWarned(false)
 { }
 
 DiskMemUsageFilter::~DiskMemUsageFilter() = default;
 
 void
 DiskMemUsageFilter::set_resource_usage(const TransientResourceUsage& transient_usage, vespalib::ProcessMemoryStats memoryStats, uint64_t diskUsedSizeBytes) {
+    set_resource_usage(transient_usage, memoryStats, diskUsedSizeBytes, vespalib::steady_clock::now());
+}
+
+void
+DiskMemUsageFilter::set_resource_usage(const TransientResourceUsage& transient_usage, vespalib::ProcessMemoryStats memoryStats,
+                                       uint64_t diskUsedSizeBytes, vespalib::steady_time sampleTime) {
     Guard guard(_lock);
     _transient_usage = transient_usage;
     _memoryStats = memoryStats;
     _diskUsedSizeBytes = diskUsedSizeBytes;
+    updateTrends(guard, sampleTime);
     recalcState(guard);
 }
 
@@ -242,6 +326,20 @@ DiskMemUsageFilter::get_metrics() const
     return result;
 }
 
+DiskMemUsageFilter::UsageTrend
+DiskMemUsageFilter::get_disk_trend() const
+{
+    Guard guard(_lock);
+    return _diskTrend;
+}
+
+DiskMemUsageFilter::UsageTrend
+DiskMemUsageFilter::get_memory_trend() const
+{
+    Guard guard(_lock);
+    return _memoryTrend;
+}
+
 bool
 DiskMemUsageFilter::acceptWriteOperation() const
 {
@@ -9,6 +9,7 @@
 #include <vespa/searchcore/proton/persistenceengine/i_resource_write_filter.h>
 #include <vespa/vespalib/util/hw_info.h>
 #include <vespa/vespalib/util/process_memory_stats.h>
+#include <vespa/vespalib/util/time.h>
 #include <atomic>
 #include <filesystem>
 #include <mutex>
@@ -46,6 +47,29 @@ public:
         }
     };
 
+    /**
+     * Projected development of a resource based on recent usage samples.
+     * growth_rate() is the smoothed increase in usage ratio per second,
+     * time_to_limit() the projected number of seconds until the configured
+     * limit is reached, or a negative value when usage is not growing
+     * towards the limit.
+     */
+    class UsageTrend {
+        double _growth_rate;
+        double _time_to_limit;
+    public:
+        UsageTrend() noexcept : _growth_rate(0.0), _time_to_limit(-1.0) { }
+        UsageTrend(double growth_rate_in, double time_to_limit_in) noexcept
+            : _growth_rate(growth_rate_in),
+              _time_to_limit(time_to_limit_in)
+        { }
+        double growth_rate() const noexcept { return _growth_rate; }
+        double time_to_limit() const noexcept { return _time_to_limit; }
+        bool approaching_limit(double window_sec) const noexcept {
+            return (_time_to_limit >= 0.0) && (_time_to_limit < window_sec);
+        }
+    };
+
 private:
     mutable Mutex                _lock;
     vespalib::HwInfo             _hwInfo;
@@ -59,8 +83,15 @@ private:
     DiskMemUsageState            _dmstate;
     mutable DiskMemUsageMetrics  _disk_mem_usage_metrics;
     std::vector<IDiskMemUsageListener *> _listeners;
+    vespalib::steady_time        _lastSampleTime;
+    double                       _lastDiskUsedRatio;
+    double                       _lastMemoryUsedRatio;
+    UsageTrend                   _diskTrend;
+    UsageTrend                   _memoryTrend;
+    bool                         _approachWarned;
 
     void recalcState(const Guard &guard); // called with _lock held
+    void updateTrends(const Guard &guard, vespalib::steady_time sampleTime);
     double getMemoryUsedRatio(const Guard &guard) const;
     double getDiskUsedRatio(const Guard &guard) const;
     double get_relative_transient_memory_usage(const Guard& guard) const;
@@ -71,6 +102,8 @@ public:
     DiskMemUsageFilter(const vespalib::HwInfo &hwInfo);
     ~DiskMemUsageFilter() override;
     void set_resource_usage(const TransientResourceUsage& transient_usage, vespalib::ProcessMemoryStats memoryStats, uint64_t diskUsedSizeBytes);
+    void set_resource_usage(const TransientResourceUsage& transient_usage, vespalib::ProcessMemoryStats memoryStats,
+                            uint64_t diskUsedSizeBytes, vespalib::steady_time sampleTime);
     [[nodiscard]] bool setConfig(Config config);
     vespalib::ProcessMemoryStats getMemoryStats() const;
     uint64_t getDiskUsedSize() const;
@@ -79,6 +112,8 @@ public:
     const vespalib::HwInfo &getHwInfo() const { return _hwInfo; }
     DiskMemUsageState usageState() const;
     DiskMemUsageMetrics get_metrics() const;
+    UsageTrend get_disk_trend() const;
+    UsageTrend get_memory_trend() const;
     bool acceptWriteOperation() const override;
     State getAcceptState() const override;
     void addDiskMemUsageListener(IDiskMemUsageListener *listener) override;
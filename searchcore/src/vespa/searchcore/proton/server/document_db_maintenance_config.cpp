@@ -50,7 +50,8 @@ DocumentDBLidSpaceCompactionConfig::DocumentDBLidSpaceCompactionConfig() noexcep
       _allowedLidBloatFactor(1.0),
       _remove_batch_block_rate(0.5),
       _remove_block_rate(100),
-      _disabled(false)
+      _disabled(false),
+      _max_docs_to_move_per_invoke(1)
 {
 }
 
@@ -59,14 +60,16 @@ DocumentDBLidSpaceCompactionConfig::DocumentDBLidSpaceCompactionConfig(vespalib:
                                                                        double allowedLidBloatFactor,
                                                                        double remove_batch_block_rate,
                                                                        double remove_block_rate,
-                                                                       bool disabled) noexcept
+                                                                       bool disabled,
+                                                                       uint32_t max_docs_to_move_per_invoke) noexcept
     : _delay(std::min(MAX_DELAY_SEC, interval)),
       _interval(interval),
       _allowedLidBloat(allowedLidBloat),
       _allowedLidBloatFactor(allowedLidBloatFactor),
       _remove_batch_block_rate(remove_batch_block_rate),
       _remove_block_rate(remove_block_rate),
-      _disabled(disabled)
+      _disabled(disabled),
+      _max_docs_to_move_per_invoke(std::max(1u, max_docs_to_move_per_invoke))
 {
 }
 
@@ -85,7 +88,8 @@ DocumentDBLidSpaceCompactionConfig::operator==(const DocumentDBLidSpaceCompactio
            _interval == rhs._interval &&
            _allowedLidBloat == rhs._allowedLidBloat &&
            _allowedLidBloatFactor == rhs._allowedLidBloatFactor &&
-           _disabled == rhs._disabled;
+           _disabled == rhs._disabled &&
+           _max_docs_to_move_per_invoke == rhs._max_docs_to_move_per_invoke;
 }
 
 
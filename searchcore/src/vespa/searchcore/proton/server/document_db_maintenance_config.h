@@ -51,6 +51,7 @@ private:
     double               _remove_batch_block_rate;
     double               _remove_block_rate;
     bool                 _disabled;
+    uint32_t             _max_docs_to_move_per_invoke;
 
 public:
     DocumentDBLidSpaceCompactionConfig() noexcept;
@@ -59,7 +60,8 @@ public:
                                        double allowwedLidBloatFactor,
                                        double remove_batch_block_rate,
                                        double remove_block_rate,
-                                       bool disabled) noexcept;
+                                       bool disabled,
+                                       uint32_t max_docs_to_move_per_invoke = 1) noexcept;
 
     static DocumentDBLidSpaceCompactionConfig createDisabled() noexcept;
     bool operator==(const DocumentDBLidSpaceCompactionConfig &rhs) const noexcept;
@@ -70,6 +72,7 @@ public:
     double get_remove_batch_block_rate() const noexcept { return _remove_batch_block_rate; }
     double get_remove_block_rate() const noexcept { return _remove_block_rate; }
     bool isDisabled() const noexcept { return _disabled; }
+    uint32_t get_max_docs_to_move_per_invoke() const noexcept { return _max_docs_to_move_per_invoke; }
 };
 
 class BlockableMaintenanceJobConfig {
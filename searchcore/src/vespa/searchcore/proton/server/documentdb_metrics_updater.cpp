@@ -195,7 +195,7 @@ updateMatchingMetrics(const metrics::MetricLockGuard & guard, DocumentDBTaggedMe
 
         totalStats.add(matchingStats);
     }
-    metrics.matching.update(totalStats);
+    metrics.matching.update(guard, totalStats);
 }
 
 void
@@ -130,7 +130,8 @@ buildMaintenanceConfig(const BootstrapConfig::SP &bootstrapConfig,
                     proton.lidspacecompaction.allowedlidbloatfactor,
                     proton.lidspacecompaction.removebatchblockrate,
                     proton.lidspacecompaction.removeblockrate,
-                    isDocumentTypeGlobal),
+                    isDocumentTypeGlobal,
+                    proton.lidspacecompaction.maxdocstomoveperinvoke),
             AttributeUsageFilterConfig(
                     proton.writefilter.attribute.addressSpaceLimit),
             vespalib::from_s(proton.writefilter.sampleinterval),
@@ -6,6 +6,7 @@
 #include "removedonecontext.h"
 #include "putdonecontext.h"
 #include <vespa/searchcore/proton/feedoperation/operations.h>
+#include <vespa/vespalib/util/destructor_callbacks.h>
 
 using document::Document;
 using document::DocumentUpdate;
@@ -21,7 +22,13 @@ namespace proton {
 void
 FastAccessFeedView::putAttributes(SerialNum serialNum, search::DocumentIdT lid, const Document &doc, OnPutDoneType onWriteDone)
 {
-    _attributeWriter->put(serialNum, doc, lid, onWriteDone);
+    // The attribute writer spreads the fields over several threads;
+    // the wrapper marks the stage when the last of them is done.
+    std::shared_ptr<vespalib::IDestructorCallback> markDone =
+        vespalib::makeSharedLambdaCallback([onWriteDone = std::shared_ptr<PutDoneContext>(onWriteDone)] {
+            onWriteDone->mark_stage_complete(feedtoken::Stage::ATTRIBUTE_APPLY);
+        });
+    _attributeWriter->put(serialNum, doc, lid, markDone);
 }
 
 void
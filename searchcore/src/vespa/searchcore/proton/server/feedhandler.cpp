@@ -174,6 +174,7 @@ FeedHandler::performPut(FeedToken token, PutOperation &op) {
     }
     appendOperation(op, token);
     if (token) {
+        token->mark_stage_complete(feedtoken::Stage::TLS_APPEND);
         token->setResult(make_unique<Result>(), false);
     }
     _activeFeedView->handlePut(std::move(token), op);
@@ -208,6 +209,7 @@ FeedHandler::performInternalUpdate(FeedToken token, UpdateOperation &op)
 {
     appendOperation(op, token);
     if (token) {
+        token->mark_stage_complete(feedtoken::Stage::TLS_APPEND);
         token->setResult(make_unique<UpdateResult>(Timestamp(op.getPrevTimestamp())), true);
     }
     _activeFeedView->handleUpdate(std::move(token), op);
@@ -249,6 +251,7 @@ FeedHandler::performRemove(FeedToken token, RemoveOperation &op) {
         assert(op.notMovingLidInSameSubDb());
         appendOperation(op, token);
         if (token) {
+            token->mark_stage_complete(feedtoken::Stage::TLS_APPEND);
             bool documentWasFound = !op.getPrevMarkedAsRemoved();
             token->setResult(make_unique<RemoveResult>(documentWasFound), documentWasFound);
         }
@@ -257,6 +260,7 @@ FeedHandler::performRemove(FeedToken token, RemoveOperation &op) {
         assert(op.getDocType() == _docTypeName.getName());
         appendOperation(op, token);
         if (token) {
+            token->mark_stage_complete(feedtoken::Stage::TLS_APPEND);
             token->setResult(make_unique<RemoveResult>(false), false);
         }
         _activeFeedView->handleRemove(std::move(token), op);
@@ -34,6 +34,11 @@ namespace {
 
 const search::SerialNum REPLAY_PROGRESS_INTERVAL = 50000;
 
+// Maximum number of replay packets acked but not yet applied. This bounds
+// the memory used for buffered packets while still letting the tls session
+// read and decompress ahead of the master thread.
+constexpr uint32_t MAX_PENDING_REPLAY_PACKETS = 4;
+
 void
 handleProgress(TlsReplayProgress &progress, SerialNum currentSerial)
 {
@@ -171,8 +176,6 @@ PacketDispatcher::handlePacket(PacketWrapper & wrap)
             handleProgress(*wrap.progress, entry.serial());
         }
     }
-    wrap.result = RPC::OK;
-    wrap.gate.countDown();
 }
 
 void
@@ -199,17 +202,38 @@ ReplayTransactionLogState::ReplayTransactionLogState(
         IIncSerialNum& inc_serial_num)
     : FeedState(REPLAY_TRANSACTION_LOG),
       _doc_type_name(name),
-      _packet_handler(std::make_unique<TransactionLogReplayPacketHandler>(feed_view_ptr, bucketDBHandler, replay_config, config_store, replay_throttling_policy, inc_serial_num))
+      _packet_handler(std::make_unique<TransactionLogReplayPacketHandler>(feed_view_ptr, bucketDBHandler, replay_config, config_store, replay_throttling_policy, inc_serial_num)),
+      _pendingLock(),
+      _pendingCond(),
+      _pendingPackets(0)
 { }
 
 ReplayTransactionLogState::~ReplayTransactionLogState() = default;
 
 void
 ReplayTransactionLogState::receive(const PacketWrapper::SP &wrap, Executor &executor) {
+    {
+        std::unique_lock guard(_pendingLock);
+        while (_pendingPackets >= MAX_PENDING_REPLAY_PACKETS) {
+            _pendingCond.wait(guard);
+        }
+        ++_pendingPackets;
+    }
+    // The task may outlive this call, but all packet tasks are queued on the
+    // master executor before eof, so they complete before the feed state is
+    // replaced after replay is done.
     executor.execute(makeLambdaTask([this, wrap = wrap] () {
         PacketDispatcher dispatcher(_packet_handler.get());
         dispatcher.handlePacket(*wrap);
+        std::lock_guard guard(_pendingLock);
+        --_pendingPackets;
+        _pendingCond.notify_one();
     }));
+    // Ack right away; per-entry ordering is preserved by the single master
+    // executor while the window above provides the backpressure that the
+    // ack used to.
+    wrap->result = RPC::OK;
+    wrap->gate.countDown();
 }
 
 }  // namespace proton
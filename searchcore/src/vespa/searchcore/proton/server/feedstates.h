@@ -7,6 +7,8 @@
 #include "packetwrapper.h"
 #include "ireplaypackethandler.h"
 #include <vespa/searchcore/proton/common/commit_time_tracker.h>
+#include <condition_variable>
+#include <mutex>
 
 namespace proton {
 
@@ -44,10 +46,16 @@ public:
 /**
  * The feed handler is replaying the transaction log.
  * Replayed messages from the transaction log are sent to the active feed view.
+ * Packets are acked as soon as they are queued for the master thread, with a
+ * bounded window, so the tls session can read and decompress upcoming packets
+ * while earlier ones are being applied.
  */
 class ReplayTransactionLogState : public FeedState {
     vespalib::string _doc_type_name;
     std::unique_ptr<IReplayPacketHandler> _packet_handler;
+    std::mutex              _pendingLock;
+    std::condition_variable _pendingCond;
+    uint32_t                _pendingPackets;
 
 public:
     ReplayTransactionLogState(const vespalib::string &name,
@@ -71,14 +71,17 @@ private:
 bool
 CompactionJob::scanDocuments(const LidUsageStats &stats)
 {
-    if (_scanItr->valid()) {
+    // Starting a batch of moves per invocation amortizes job scheduling
+    // overhead; the limiter still caps the number of outstanding moves.
+    for (uint32_t i = 0; (i < _cfg.get_max_docs_to_move_per_invoke()) && _scanItr->valid(); ++i) {
         DocumentMetaData document = getNextDocument(stats);
-        if (document.valid()) {
-            Bucket metaBucket(document::Bucket(_bucketSpace, document.bucketId));
-            _bucketExecutor.execute(metaBucket, std::make_unique<MoveTask>(shared_from_this(), document, getLimiter().beginOperation()));
-            if (isBlocked(BlockedReason::OUTSTANDING_OPS)) {
-                return true;
-            }
+        if (!document.valid()) {
+            break;
+        }
+        Bucket metaBucket(document::Bucket(_bucketSpace, document.bucketId));
+        _bucketExecutor.execute(metaBucket, std::make_unique<MoveTask>(shared_from_this(), document, getLimiter().beginOperation()));
+        if (isBlocked(BlockedReason::OUTSTANDING_OPS)) {
+            return true;
         }
     }
     return false;
@@ -60,7 +60,8 @@ injectBucketMoveJob(MaintenanceController &controller,
     auto bmj = BucketMoveJob::create(std::move(calc), controller.retainDB(), moveHandler, bucketModifiedHandler, controller.masterThread(),
                                      bucketExecutor, controller.getReadySubDB(), controller.getNotReadySubDB(),
                                      bucketCreateNotifier, clusterStateChangedNotifier, bucketStateChangedNotifier,
-                                     diskMemUsageNotifier, config.getBlockableJobConfig(), docTypeName, bucketSpace);
+                                     diskMemUsageNotifier, config.getBlockableJobConfig(), docTypeName, bucketSpace,
+                                     config.getBucketMoveConfig().getMaxDocsToMovePerBucket());
     controller.registerJob(trackJob(jobTrackers.getBucketMove(), std::move(bmj)));
 }
 
@@ -0,0 +1,32 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "memory_allocation_explorer.h"
+#include <vespa/vespalib/data/slime/cursor.h>
+#include <vespa/vespalib/util/tagged_memory_allocator.h>
+
+using vespalib::alloc::AllocationTagRegistry;
+
+namespace proton {
+
+void
+MemoryAllocationExplorer::get_state(const vespalib::slime::Inserter& inserter, bool full) const
+{
+    auto& object = inserter.insertObject();
+    size_t total_live = 0;
+    auto snapshot = AllocationTagRegistry::instance().snapshot();
+    auto& tags = object.setObject("tags");
+    for (const auto& entry : snapshot) {
+        total_live += entry.second.live_bytes;
+        auto& tag = tags.setObject(entry.first);
+        tag.setLong("live_bytes", entry.second.live_bytes);
+        tag.setLong("peak_bytes", entry.second.peak_bytes);
+        if (full) {
+            tag.setLong("alloc_count", entry.second.alloc_count);
+            tag.setLong("free_count", entry.second.free_count);
+            tag.setLong("total_alloc_bytes", entry.second.total_alloc_bytes);
+        }
+    }
+    object.setLong("total_live_bytes", total_live);
+}
+
+}
@@ -0,0 +1,20 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/vespalib/net/http/state_explorer.h>
+
+namespace proton {
+
+/**
+ * Class used to explore the per-tag breakdown of memory handed out by
+ * the tagged memory allocators (live bytes, peak and allocation
+ * counters per component).
+ */
+class MemoryAllocationExplorer : public vespalib::StateExplorer
+{
+public:
+    void get_state(const vespalib::slime::Inserter& inserter, bool full) const override;
+};
+
+}
@@ -19,5 +19,13 @@ OperationDoneContext::is_replay() const
     return (!_token || _token->is_replay());
 }
 
+void
+OperationDoneContext::mark_stage_complete(feedtoken::Stage stage)
+{
+    if (_token) {
+        _token->mark_stage_complete(stage);
+    }
+}
+
 
 }  // namespace proton
@@ -4,7 +4,12 @@
 
 #include <vespa/vespalib/util/idestructorcallback.h>
 
-namespace proton::feedtoken { class IState; }
+#include <cstdint>
+
+namespace proton::feedtoken {
+class IState;
+enum class Stage : uint8_t;
+}
 
 namespace proton {
 
@@ -22,6 +27,7 @@ public:
 
     ~OperationDoneContext() override;
     bool is_replay() const;
+    void mark_stage_complete(feedtoken::Stage stage);
 private:
     std::shared_ptr<feedtoken::IState> _token;
     std::shared_ptr<vespalib::IDestructorCallback> _done_callback;
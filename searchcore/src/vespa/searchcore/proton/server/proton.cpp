@@ -1,6 +1,8 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "proton.h"
+#include "cpu_usage_explorer.h"
+#include "memory_allocation_explorer.h"
 #include "disk_mem_usage_sampler.h"
 #include "document_db_explorer.h"
 #include "documentdbconfig.h"
@@ -39,6 +41,7 @@
 #include <vespa/searchlib/common/packets.h>
 #include <vespa/searchlib/transactionlog/trans_log_server_explorer.h>
 #include <vespa/searchlib/transactionlog/translogserverapp.h>
+#include <vespa/searchlib/util/file_range_heatmap.h>
 #include <vespa/searchlib/util/fileheadertk.h>
 #include <vespa/vespalib/io/fileutil.h>
 #include <vespa/vespalib/net/http/state_server.h>
@@ -55,7 +58,10 @@
 #include <malloc.h>
 #endif
 
+#include <cinttypes>
+#include <fcntl.h>
 #include <sstream>
+#include <unistd.h>
 
 #include <vespa/log/log.h>
 LOG_SETUP(".proton.server.proton");
@@ -122,6 +128,39 @@ diskMemUsageSamplerConfig(const ProtonConfig &proton, const vespalib::HwInfo &hw
              hwInfo };
 }
 
+vespalib::string
+fileRangeHeatmapPath(const ProtonConfig &proton)
+{
+    return proton.basedir + "/file_range_heatmap.dat";
+}
+
+/*
+ * Ask the OS to start reading the hottest persisted file ranges into
+ * the page cache, hottest first, capped to avoid evicting more than we
+ * warm on small hosts.
+ */
+void
+warmFileRanges(const search::FileRangeHeatmap::RangeVector &ranges, uint64_t maxBytes)
+{
+    uint64_t warmedBytes = 0;
+    uint64_t warmedRanges = 0;
+    for (const auto &range : ranges) {
+        if (warmedBytes + range.length > maxBytes) {
+            break;
+        }
+        int fd = ::open(range.file.c_str(), O_RDONLY);
+        if (fd < 0) {
+            continue; // file is gone after e.g. flush or compaction
+        }
+        ::posix_fadvise(fd, range.offset, range.length, POSIX_FADV_WILLNEED);
+        ::close(fd);
+        warmedBytes += range.length;
+        ++warmedRanges;
+    }
+    LOG(info, "Warmed %" PRIu64 " hot file ranges (%" PRIu64 " bytes) from persisted heatmap",
+        warmedRanges, warmedBytes);
+}
+
 uint32_t
 computeRpcTransportThreads(const ProtonConfig & cfg, const vespalib::HwInfo::Cpu &cpuInfo) {
     bool areSearchAndDocsumAsync = cfg.docsum.async && cfg.search.async;
@@ -382,6 +421,15 @@ Proton::init(const BootstrapConfig::SP & configSnapshot)
     _sessionPruneHandle = _scheduler->scheduleAtFixedRate(makeLambdaTask([&]() {
         _sessionManager->pruneTimedOutSessions(vespalib::steady_clock::now(), _shared_service->shared());
     }), pruneSessionsInterval, pruneSessionsInterval);
+    vespalib::string heatmapPath = fileRangeHeatmapPath(protonConfig);
+    if (search::FileRangeHeatmap::instance().load(heatmapPath)) {
+        _shared_service->shared().execute(makeLambdaTask([]() {
+            warmFileRanges(search::FileRangeHeatmap::instance().hot_ranges(2), 1_Gi);
+        }));
+    }
+    _heatmapSaveHandle = _scheduler->scheduleAtFixedRate(makeLambdaTask([heatmapPath]() {
+        search::FileRangeHeatmap::instance().save(heatmapPath);
+    }), 10min, 10min);
     _isInitializing = false;
     _protonConfigurer.setAllowReconfig(true);
     _initComplete = true;
@@ -471,6 +519,7 @@ Proton::~Proton()
         _diskMemUsageSampler->notifier().removeDiskMemUsageListener(_memoryFlushConfigUpdater.get());
     }
     _sessionPruneHandle.reset();
+    _heatmapSaveHandle.reset();
     if (_diskMemUsageSampler) {
         _diskMemUsageSampler->close();
     }
@@ -943,6 +992,8 @@ const vespalib::string TLS_NAME = "tls";
 const vespalib::string RESOURCE_USAGE = "resourceusage";
 const vespalib::string THREAD_POOLS = "threadpools";
 const vespalib::string HW_INFO = "hwinfo";
+const vespalib::string CPU_USAGE = "cpuusage";
+const vespalib::string MEMORY_ALLOCATIONS = "memoryallocations";
 const vespalib::string SESSION = "session";
 
 
@@ -989,7 +1040,7 @@ Proton::get_state(const vespalib::slime::Inserter &, bool) const
 std::vector<vespalib::string>
 Proton::get_children_names() const
 {
-    return {DOCUMENT_DB, THREAD_POOLS, MATCH_ENGINE, FLUSH_ENGINE, TLS_NAME, HW_INFO, RESOURCE_USAGE, SESSION};
+    return {DOCUMENT_DB, THREAD_POOLS, MATCH_ENGINE, FLUSH_ENGINE, TLS_NAME, HW_INFO, CPU_USAGE, MEMORY_ALLOCATIONS, RESOURCE_USAGE, SESSION};
 }
 
 std::unique_ptr<vespalib::StateExplorer>
@@ -1016,6 +1067,10 @@ Proton::get_child(std::string_view name) const
 
     } else if (name == HW_INFO) {
         return std::make_unique<HwInfoExplorer>(_hw_info);
+    } else if (name == CPU_USAGE) {
+        return std::make_unique<CpuUsageExplorer>();
+    } else if (name == MEMORY_ALLOCATIONS) {
+        return std::make_unique<MemoryAllocationExplorer>();
     } else if (name == SESSION) {
         return std::make_unique<matching::SessionManagerExplorer>(*_sessionManager);
     }
@@ -45,6 +45,9 @@ ResourceUsageExplorer::get_state(const vespalib::slime::Inserter &inserter, bool
         disk.setDouble("limit", usageState.diskState().limit());
         disk.setDouble("utilization", usageState.diskState().utilization());
         disk.setDouble("transient", usageState.transient_disk_usage());
+        DiskMemUsageFilter::UsageTrend disk_trend = _usage_filter.get_disk_trend();
+        disk.setDouble("growth_rate_per_sec", disk_trend.growth_rate());
+        disk.setDouble("time_to_limit_sec", disk_trend.time_to_limit());
         convertDiskStatsToSlime(_usage_filter.getHwInfo(), _usage_filter.getDiskUsedSize(), disk.setObject("stats"));
 
         Cursor &memory = object.setObject("memory");
@@ -52,6 +55,9 @@ ResourceUsageExplorer::get_state(const vespalib::slime::Inserter &inserter, bool
         memory.setDouble("limit", usageState.memoryState().limit());
         memory.setDouble("utilization", usageState.memoryState().utilization());
         memory.setDouble("transient", usageState.transient_memory_usage());
+        DiskMemUsageFilter::UsageTrend memory_trend = _usage_filter.get_memory_trend();
+        memory.setDouble("growth_rate_per_sec", memory_trend.growth_rate());
+        memory.setDouble("time_to_limit_sec", memory_trend.time_to_limit());
         memory.setLong("physicalMemory", _usage_filter.getHwInfo().memory().sizeBytes());
         convertMemoryStatsToSlime(_usage_filter.getMemoryStats(), memory.setObject("stats"));
 
@@ -55,13 +55,13 @@ SearchableFeedView::putIndexedFields(SerialNum serialNum, search::DocumentIdT li
 void
 SearchableFeedView::performIndexPut(SerialNum serialNum, search::DocumentIdT lid, const Document &doc, OnOperationDoneType onWriteDone)
 {
-    (void) onWriteDone;
     assert(_writeService.index().isCurrentThread());
     VLOG(getDebugLevel(lid, doc.getId()),
          "database(%s): performIndexPut: serialNum(%" PRIu64 "), docId(%s), lid(%d)",
          _params._docTypeName.toString().c_str(), serialNum, doc.getId().toString().c_str(), lid);
 
     _indexWriter->put(serialNum, doc, lid, onWriteDone);
+    onWriteDone->mark_stage_complete(feedtoken::Stage::INDEX_APPLY);
 }
 
 void
@@ -19,6 +19,8 @@
 #include <vespa/searchlib/fef/indexproperties.h>
 #include <vespa/searchlib/fef/properties.h>
 #include <vespa/eval/eval/fast_value.h>
+#include <vespa/eval/eval/value_cache/constant_tensor_loader.h>
+#include <vespa/eval/eval/value_cache/constant_value_cache.h>
 
 using vespa::config::search::RankProfilesConfig;
 using proton::matching::MatchingStats;
@@ -30,6 +32,24 @@ using namespace searchcorespi;
 
 namespace proton {
 
+namespace {
+
+/*
+ * All document dbs share one constant value cache. Constants are keyed
+ * by (file path, type), and identical constants referenced from rank
+ * profiles in different document dbs resolve to the same distributed
+ * file, so sharing the cache loads and holds them in memory only once.
+ */
+const vespalib::eval::ConstantValueFactory &
+sharedConstantValueCache()
+{
+    static vespalib::eval::ConstantTensorLoader loader(FastValueBuilderFactory::get());
+    static vespalib::eval::ConstantValueCache cache(loader);
+    return cache;
+}
+
+}
+
 SearchableDocSubDB::SearchableDocSubDB(const Config &cfg, const Context &ctx)
     : FastAccessDocSubDB(cfg, ctx._fastUpdCtx),
       IIndexManager::Reconfigurer(),
@@ -37,9 +57,7 @@ SearchableDocSubDB::SearchableDocSubDB(const Config &cfg, const Context &ctx)
       _indexWriter(),
       _rSearchView(),
       _rFeedView(),
-      _tensorLoader(FastValueBuilderFactory::get()),
-      _constantValueCache(_tensorLoader),
-      _configurer(_iSummaryMgr, _rSearchView, _rFeedView, ctx._queryLimiter, _constantValueCache, ctx._now_ref,
+      _configurer(_iSummaryMgr, _rSearchView, _rFeedView, ctx._queryLimiter, sharedConstantValueCache(), ctx._now_ref,
                   getSubDbName(), ctx._fastUpdCtx._storeOnlyCtx._owner.getDistributionKey()),
       _warmupExecutor(ctx._warmupExecutor),
       _realGidToLidChangeHandler(std::make_shared<GidToLidChangeHandler>()),
@@ -9,8 +9,6 @@
 #include "igetserialnum.h"
 #include "document_db_flush_config.h"
 #include <vespa/config-rank-profiles.h>
-#include <vespa/eval/eval/value_cache/constant_tensor_loader.h>
-#include <vespa/eval/eval/value_cache/constant_value_cache.h>
 #include <vespa/searchcore/proton/common/doctypename.h>
 #include <vespa/searchcore/proton/docsummary/summarymanager.h>
 #include <vespa/searchcore/proton/documentmetastore/documentmetastorecontext.h>
@@ -66,8 +64,6 @@ private:
     IIndexWriter::SP                            _indexWriter;
     vespalib::VarHolder<SearchView::SP>         _rSearchView;
     vespalib::VarHolder<SearchableFeedView::SP> _rFeedView;
-    vespalib::eval::ConstantTensorLoader        _tensorLoader;
-    vespalib::eval::ConstantValueCache          _constantValueCache;
     SearchableDocSubDBConfigurer                _configurer;
     vespalib::Executor                         &_warmupExecutor;
     std::shared_ptr<GidToLidChangeHandler>      _realGidToLidChangeHandler;
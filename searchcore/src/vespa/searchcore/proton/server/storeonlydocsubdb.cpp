@@ -263,7 +263,7 @@ createDocumentMetaStoreInitializer(const AllocStrategy& alloc_strategy,
     *result = std::make_shared<DocumentMetaStoreInitializerResult>
               (std::make_shared<DocumentMetaStore>(_bucketDB, attrFileName, grow, _subDbType), tuneFile);
     return std::make_shared<documentmetastore::DocumentMetaStoreInitializer>
-        (baseDir, getSubDbName(), _docTypeName.toString(), (*result)->documentMetaStore());
+        (baseDir, getSubDbName(), _docTypeName.toString(), (*result)->documentMetaStore(), _writeService.shared());
 }
 
 
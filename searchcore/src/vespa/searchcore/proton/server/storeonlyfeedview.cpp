@@ -366,12 +366,12 @@ StoreOnlyFeedView::putSummary(SerialNum serialNum, Lid lid,
 {
     summaryExecutor().execute(
             makeLambdaTask([serialNum, lid, futureStream = std::move(futureStream), trackerToken = _pendingLidsForDocStore.produce(lid), onDone, this] () mutable {
-                (void) onDone;
                 (void) trackerToken;
                 vespalib::nbostream os = futureStream.get();
                 if (!os.empty()) {
                     _summaryAdapter->put(serialNum, lid, os);
                 }
+                onDone->mark_stage_complete(feedtoken::Stage::SUMMARY_APPLY);
             }));
 }
 
@@ -391,9 +391,9 @@ StoreOnlyFeedView::putSummary(SerialNum serialNum, Lid lid, Document::SP doc, On
 {
     summaryExecutor().execute(
             makeLambdaTask([serialNum, doc = std::move(doc), trackerToken = _pendingLidsForDocStore.produce(lid), onDone, lid, this] {
-                (void) onDone;
                 (void) trackerToken;
                 _summaryAdapter->put(serialNum, lid, *doc);
+                onDone->mark_stage_complete(feedtoken::Stage::SUMMARY_APPLY);
             }));
 }
 void
@@ -0,0 +1,102 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/searchlib/attribute/blocked_posting_list.h>
+#include <vespa/searchlib/fef/termfieldmatchdata.h>
+#include <vespa/searchlib/queryeval/simpleresult.h>
+#include <vespa/vespalib/gtest/gtest.h>
+
+using search::attribute::BlockedPostingList;
+using search::fef::TermFieldMatchData;
+using search::queryeval::SimpleResult;
+
+namespace {
+
+constexpr uint32_t doc_id_limit = 200000; // spans 4 blocks
+
+std::vector<uint32_t>
+make_hits()
+{
+    std::vector<uint32_t> hits;
+    // sparse first block -> offset array container
+    hits.push_back(1);
+    hits.push_back(100);
+    hits.push_back(65535);
+    // dense second block (cardinality > 4096) -> bitmap container
+    for (uint32_t offset = 0; offset < 5000; ++offset) {
+        hits.push_back(65536 + 2 * offset);
+    }
+    // third block left empty, last (partial) block sparse
+    hits.push_back(199999);
+    return hits;
+}
+
+BlockedPostingList
+make_list(const std::vector<uint32_t> &hits)
+{
+    BlockedPostingList list(doc_id_limit);
+    for (uint32_t hit : hits) {
+        list.insert(hit);
+    }
+    list.finalize();
+    return list;
+}
+
+}
+
+TEST(BlockedPostingListTest, test_bit_and_next_hit_cover_sparse_and_dense_blocks)
+{
+    auto hits = make_hits();
+    auto list = make_list(hits);
+    EXPECT_EQ(hits.size(), list.cardinality());
+    auto expect = hits.begin();
+    uint32_t doc_id = list.nextHit(0);
+    while (doc_id < doc_id_limit) {
+        ASSERT_TRUE(expect != hits.end());
+        EXPECT_EQ(*expect, doc_id);
+        EXPECT_TRUE(list.testBit(doc_id));
+        ++expect;
+        doc_id = list.nextHit(doc_id + 1);
+    }
+    EXPECT_TRUE(expect == hits.end());
+    EXPECT_FALSE(list.testBit(doc_id_limit));
+    EXPECT_EQ(doc_id_limit, list.nextHit(doc_id_limit));
+}
+
+TEST(BlockedPostingListTest, duplicate_inserts_are_counted_once)
+{
+    BlockedPostingList list(doc_id_limit);
+    list.insert(42);
+    list.insert(42);
+    list.insert(65537);
+    list.finalize();
+    EXPECT_EQ(2u, list.cardinality());
+    EXPECT_TRUE(list.testBit(42));
+    EXPECT_TRUE(list.testBit(65537));
+    EXPECT_FALSE(list.testBit(43));
+    EXPECT_FALSE(list.testBit(131073));
+}
+
+TEST(BlockedPostingListTest, iterators_match_reference)
+{
+    auto hits = make_hits();
+    auto list = make_list(hits);
+    SimpleResult expect;
+    for (uint32_t hit : hits) {
+        if (hit > 0) { // docid 0 is not a valid hit for iterators
+            expect.addHit(hit);
+        }
+    }
+    for (bool strict : {true, false}) {
+        TermFieldMatchData tfmd;
+        auto search = list.make_iterator(tfmd, strict);
+        SimpleResult result;
+        if (strict) {
+            result.searchStrict(*search, doc_id_limit);
+        } else {
+            result.search(*search, doc_id_limit);
+        }
+        EXPECT_EQ(expect, result);
+    }
+}
+
+GTEST_MAIN_RUN_ALL_TESTS()
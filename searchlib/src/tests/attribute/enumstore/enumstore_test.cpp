@@ -278,13 +278,14 @@ testUniques(const StringEnumStore& ses, const std::vector<std::string>& unique)
 
 class StringEnumStoreTest : public ::testing::Test {
 public:
-    static void testInsert(bool hasPostings);
+    static void testInsert(bool hasPostings, Type dictionary_type);
 };
 
 void
-StringEnumStoreTest::testInsert(bool hasPostings)
+StringEnumStoreTest::testInsert(bool hasPostings, Type dictionary_type)
 {
-    StringEnumStore ses(hasPostings, DictionaryConfig::Type::BTREE);
+    StringEnumStore ses(hasPostings, dictionary_type);
+    EXPECT_EQ(dictionary_type != Type::BTREE, ses.get_dictionary().get_has_hash_dictionary());
     using EntryType = StringEnumStore::EntryType;
 
     std::vector<EnumIndex> indices;
@@ -317,12 +318,42 @@ StringEnumStoreTest::testInsert(bool hasPostings)
 
 TEST_F(StringEnumStoreTest, test_insert_on_store_without_posting_lists)
 {
-    testInsert(false);
+    testInsert(false, Type::BTREE);
+}
+
+TEST_F(StringEnumStoreTest, test_insert_on_store_without_posting_lists_and_with_hash_dictionary)
+{
+    testInsert(false, Type::BTREE_AND_HASH);
 }
 
 TEST_F(StringEnumStoreTest, test_insert_on_store_with_posting_lists)
 {
-    testInsert(true);
+    testInsert(true, Type::BTREE);
+}
+
+TEST_F(StringEnumStoreTest, test_insert_on_store_with_posting_lists_and_hash_dictionary)
+{
+    testInsert(true, Type::BTREE_AND_HASH);
+}
+
+TEST_F(StringEnumStoreTest, folded_entries_share_posting_list_with_hash_dictionary)
+{
+    StringEnumStore ses(true, Type::BTREE_AND_HASH);
+    auto& dict = ses.get_dictionary();
+    EXPECT_TRUE(dict.get_has_hash_dictionary());
+    EnumIndex lower_idx = ses.insert("bar");
+    dict.update_posting_list(lower_idx, ses.get_comparator(), [](EntryRef) noexcept { return EntryRef(42); });
+    // Inserting an entry with the same folded key moves the shared posting list reference to the first entry.
+    EnumIndex upper_idx = ses.insert("BAR");
+    ses.freeze_dictionary();
+    auto find_result = dict.find_posting_list(ses.make_folded_comparator("bar"), dict.get_frozen_root());
+    EXPECT_EQ(upper_idx, find_result.first);
+    EXPECT_EQ(EntryRef(42), find_result.second);
+    EnumIndex idx;
+    EXPECT_TRUE(ses.find_index("BAR", idx));
+    EXPECT_EQ(upper_idx, idx);
+    EXPECT_TRUE(ses.find_index("bar", idx));
+    EXPECT_EQ(lower_idx, idx);
 }
 
 TEST(EnumStoreTest, test_hold_lists_and_generation)
@@ -0,0 +1,75 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/searchcommon/attribute/config.h>
+#include <vespa/searchlib/attribute/attributevector.h>
+#include <vespa/searchlib/test/attribute_builder.h>
+#include <vespa/vespalib/gtest/gtest.h>
+
+using search::AttributeVector;
+using search::attribute::BasicType;
+using search::attribute::CollectionType;
+using search::attribute::Config;
+using search::attribute::IAttributeVector;
+using search::attribute::test::AttributeBuilder;
+
+using DocId = IAttributeVector::DocId;
+using EnumHandle = IAttributeVector::EnumHandle;
+using largeint_t = IAttributeVector::largeint_t;
+
+namespace {
+
+const std::vector<DocId> docids = {3, 1, 4, 1, 2};
+
+void
+expect_gathered_ints(const IAttributeVector& attr)
+{
+    std::vector<largeint_t> values(docids.size());
+    attr.get_values(docids, values);
+    for (size_t i = 0; i < docids.size(); ++i) {
+        EXPECT_EQ(attr.getInt(docids[i]), values[i]);
+    }
+}
+
+void
+expect_gathered_floats(const IAttributeVector& attr)
+{
+    std::vector<double> values(docids.size());
+    attr.get_values(docids, values);
+    for (size_t i = 0; i < docids.size(); ++i) {
+        EXPECT_EQ(attr.getFloat(docids[i]), values[i]);
+    }
+}
+
+void
+expect_gathered_enums(const IAttributeVector& attr)
+{
+    std::vector<EnumHandle> values(docids.size());
+    attr.get_values(docids, values);
+    for (size_t i = 0; i < docids.size(); ++i) {
+        EXPECT_EQ(attr.getEnum(docids[i]), values[i]);
+    }
+}
+
+}
+
+TEST(GetValuesTest, single_value_numeric_attribute_gathers_batch)
+{
+    auto attr = AttributeBuilder("int32", Config(BasicType::INT32, CollectionType::SINGLE)).fill({10, 20, 30, 40, 50}).get();
+    expect_gathered_ints(*attr);
+    expect_gathered_floats(*attr);
+}
+
+TEST(GetValuesTest, multi_value_numeric_attribute_gathers_first_values)
+{
+    auto attr = AttributeBuilder("int32-array", Config(BasicType::INT32, CollectionType::ARRAY)).fill_array({{10, 11}, {}, {30}, {40, 41, 42}, {50}}).get();
+    expect_gathered_ints(*attr);
+    expect_gathered_floats(*attr);
+}
+
+TEST(GetValuesTest, single_value_enum_attribute_gathers_batch)
+{
+    auto attr = AttributeBuilder("str", Config(BasicType::STRING, CollectionType::SINGLE)).fill(AttributeBuilder::StringList{"ten", "twenty", "thirty", "forty", "fifty"}).get();
+    expect_gathered_enums(*attr);
+}
+
+GTEST_MAIN_RUN_ALL_TESTS()
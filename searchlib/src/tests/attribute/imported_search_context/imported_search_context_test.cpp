@@ -297,6 +297,47 @@ TEST_F("Non-strict blueprint with low hit rate is non-strict", Fixture(false, Fa
     EXPECT_TRUE(iter->is_strict() == Trinary::False);
 }
 
+TEST_F("Non-strict iterator without merged postings memoizes target finds", Fixture) {
+    reset_with_single_value_reference_mappings<IntegerAttribute, int32_t>(
+            f, BasicType::INT32,
+            {{DocId(1), dummy_gid(3), DocId(3), 1234},
+             {DocId(2), dummy_gid(3), DocId(3), 1234},
+             {DocId(4), dummy_gid(2), DocId(2), 5678},
+             {DocId(5), dummy_gid(3), DocId(3), 1234},
+             {DocId(6), dummy_gid(2), DocId(2), 5678}});
+
+    auto ctx = f.create_context(word_term("1234"));
+    ctx->fetchPostings(queryeval::ExecuteInfo::createForTest(1.0), false);
+    EXPECT_TRUE(ctx->has_find_cache());
+    TermFieldMatchData match;
+    auto iter = f.create_non_strict_iterator(*ctx, match);
+
+    EXPECT_TRUE(is_hit_with_weight(*iter, match, DocId(1), 1));
+    EXPECT_TRUE(is_hit_with_weight(*iter, match, DocId(2), 1));
+    EXPECT_FALSE(iter->seek(DocId(4)));
+    EXPECT_TRUE(is_hit_with_weight(*iter, match, DocId(5), 1));
+    EXPECT_FALSE(iter->seek(DocId(6)));
+}
+
+TEST_F("Non-strict iterator with low hit rate does not enable find cache", Fixture) {
+    reset_with_single_value_reference_mappings<IntegerAttribute, int32_t>(
+            f, BasicType::INT32,
+            {{DocId(1), dummy_gid(3), DocId(3), 1234},
+             {DocId(2), dummy_gid(3), DocId(3), 1234},
+             {DocId(4), dummy_gid(2), DocId(2), 5678},
+             {DocId(5), dummy_gid(3), DocId(3), 1234},
+             {DocId(6), dummy_gid(2), DocId(2), 5678}});
+
+    auto ctx = f.create_context(word_term("1234"));
+    ctx->fetchPostings(queryeval::ExecuteInfo::createForTest(0.001), false);
+    EXPECT_FALSE(ctx->has_find_cache());
+    TermFieldMatchData match;
+    auto iter = f.create_non_strict_iterator(*ctx, match);
+
+    EXPECT_TRUE(is_hit_with_weight(*iter, match, DocId(1), 1));
+    EXPECT_FALSE(iter->seek(DocId(4)));
+}
+
 struct SingleValueFixture : Fixture {
     SingleValueFixture() {
         reset_with_single_value_reference_mappings<IntegerAttribute, int32_t>(
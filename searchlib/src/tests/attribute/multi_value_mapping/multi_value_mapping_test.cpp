@@ -239,6 +239,24 @@ TEST_F(IntMappingTest, test_that_set_and_get_works)
     assertGet(5, {3});
 }
 
+TEST_F(IntMappingTest, test_that_docs_without_values_share_invalid_entry_ref)
+{
+    setup(3);
+    addDocs(10);
+    set(2, {4, 7});
+    auto before = _mvMapping->getArrayStoreMemoryUsage();
+    for (uint32_t docId = 3; docId < 10; ++docId) {
+        set(docId, {});
+    }
+    auto after = _mvMapping->getArrayStoreMemoryUsage();
+    EXPECT_EQ(before.usedBytes(), after.usedBytes());
+    auto refs = search::attribute::make_entry_ref_vector_snapshot(_mvMapping->get_ref_vector(), _mvMapping->size());
+    for (uint32_t docId = 3; docId < 10; ++docId) {
+        EXPECT_FALSE(refs[docId].valid());
+        assertGet(docId, {});
+    }
+}
+
 TEST_F(IntMappingTest, test_that_old_value_is_not_overwritten_while_held)
 {
     setup(3, 32, 64, 0);
@@ -373,4 +391,37 @@ TEST_F(CompactionIntMappingTest, test_that_compaction_works)
     EXPECT_LT(bufferCountAfter, bufferCountBefore);
 }
 
+TEST_F(CompactionIntMappingTest, test_that_compaction_can_run_incrementally)
+{
+    setup(3, 64, 512, 129);
+    uint32_t addDocs = 10;
+    uint32_t bufferCountBefore = 0;
+    do {
+        addRandomDocs(addDocs);
+        addDocs *= 2;
+        bufferCountBefore = countBuffers();
+    } while (bufferCountBefore < 10);
+    uint32_t docIdLimit = size();
+    for (uint32_t docId = 0; docId < docIdLimit / 2; ++docId) {
+        clearDoc(docId);
+    }
+    // A budget smaller than the ref vector forces multiple ticks.
+    _mvMapping->set_compaction_scan_budget(docIdLimit / 4);
+    compactWorst();
+    EXPECT_TRUE(_mvMapping->has_active_compaction());
+    checkRefMapping();
+    uint32_t ticks = 1;
+    while (_mvMapping->has_active_compaction()) {
+        CompactionStrategy compaction_strategy;
+        _mvMapping->consider_compact(compaction_strategy);
+        _attr->commit();
+        _attr->incGeneration();
+        checkRefMapping();
+        ++ticks;
+    }
+    EXPECT_LT(1u, ticks);
+    uint32_t bufferCountAfter = countBuffers();
+    EXPECT_LT(bufferCountAfter, bufferCountBefore);
+}
+
 GTEST_MAIN_RUN_ALL_TESTS()
@@ -103,6 +103,22 @@ struct WeightedFixture
     {
         EXPECT_EQUAL(exp, bvAsArray());
     }
+
+    std::vector<uint32_t> blockedAsArray() {
+        const auto &blocked = *_merger.getBlocked();
+        std::vector<uint32_t> result;
+        uint32_t lid = blocked.nextHit(0);
+        while (lid < docIdLimit) {
+            result.emplace_back(lid);
+            lid = blocked.nextHit(lid + 1);
+        }
+        return result;
+    }
+
+    void assertBlocked(std::vector<uint32_t> exp)
+    {
+        EXPECT_EQUAL(exp, blockedAsArray());
+    }
 };
 
 TEST_F("Single weighted array", WeightedFixture)
@@ -156,4 +172,21 @@ TEST_F("Merge multiple posting lists into bitvector", WeightedFixture)
     TEST_DO(f.assertBitVector({2, 3, 5, 6, 8, 9, 14, 17}));
 }
 
+TEST_F("Merge single posting list into blocked posting list", WeightedFixture)
+{
+    f._merger.allocBlocked();
+    f._merger.addToBlocked(WeightedPostingList({{ 2, 102}, {3, 103}, { 5, 105}, {9, 109}}));
+    f._merger.merge();
+    TEST_DO(f.assertBlocked({2, 3, 5, 9}));
+}
+
+TEST_F("Merge multiple posting lists into blocked posting list", WeightedFixture)
+{
+    f._merger.allocBlocked();
+    f._merger.addToBlocked(WeightedPostingList({{ 2, 102}, {3, 103}, { 5, 105}, {9, 109}}));
+    f._merger.addToBlocked(WeightedPostingList({{ 6, 106}, {8, 108}, { 14, 114}, {17, 117}}));
+    f._merger.merge();
+    TEST_DO(f.assertBlocked({2, 3, 5, 6, 8, 9, 14, 17}));
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -1295,6 +1295,35 @@ TEST_F(SearchContextTest, test_range_search_limited)
     performRangeSearch(vec, "[;;-1]", expected);
 }
 
+TEST_F(SearchContextTest, test_batched_range_scan_over_single_numeric_attribute)
+{
+    // no fast-search -> range evaluation scans the raw value array
+    Config cfg(BasicType::INT32, CollectionType::SINGLE);
+    const uint32_t numDocs = 1000;
+    std::vector<int32_t> values;
+    values.reserve(numDocs);
+    for (uint32_t i = 0; i < numDocs; ++i) {
+        values.push_back(i % 131);
+    }
+    auto ptr = AttributeBuilder("scan-int32", cfg).fill(values).get();
+    auto& vec = dynamic_cast<IntegerAttribute &>(*ptr);
+    uint32_t docIdLimit = vec.getCommittedDocIdLimit();
+    SearchContextPtr sc = getSearch(vec, "[10;42]", TermType::WORD);
+    fef::TermFieldMatchData dummy;
+    SearchBasePtr sb = sc->createIterator(&dummy, true);
+    sb->initRange(1, docIdLimit);
+    auto hits = sb->get_hits(1);
+    auto orred = BitVector::create(docIdLimit);
+    orred->setBit(1); // must survive the or operation
+    sb->or_hits_into(*orred, 1);
+    for (uint32_t docId = 1; docId < docIdLimit; ++docId) {
+        int32_t v = values[docId - 1];
+        bool expectHit = (v >= 10) && (v <= 42);
+        EXPECT_EQ(expectHit, hits->testBit(docId));
+        EXPECT_EQ(expectHit || (docId == 1), orred->testBit(docId));
+    }
+}
+
 TEST_F(SearchContextTest, test_range_search)
 {
     const uint32_t numDocs = 100;
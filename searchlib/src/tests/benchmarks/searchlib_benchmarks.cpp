@@ -0,0 +1,330 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+// Micro-benchmark suite for the central search kernels. Each
+// benchmark is reported with the minimal time over a fixed budget
+// (see BenchmarkTimer), printed human-readable on stderr and
+// optionally written as json with --json for tracking over time. A
+// previous json report can be given with --baseline to print the
+// ratio between the two runs per benchmark.
+//
+// This is a benchmark target, not a unit test; it is built as part of
+// the test build but never executed by ctest.
+
+#include <vespa/searchlib/common/bitvector.h>
+#include <vespa/searchlib/queryeval/andsearch.h>
+#include <vespa/searchlib/queryeval/orsearch.h>
+#include <vespa/searchlib/queryeval/simplesearch.h>
+#include <vespa/searchlib/queryeval/hitcollector.h>
+#include <vespa/searchlib/attribute/enumstore.h>
+#include <vespa/vespalib/btree/btreeroot.h>
+#include <vespa/vespalib/btree/btreenodeallocator.h>
+#include <vespa/vespalib/btree/btree.h>
+#include <vespa/vespalib/btree/btreenodeallocator.hpp>
+#include <vespa/vespalib/btree/btreenode.hpp>
+#include <vespa/vespalib/btree/btreenodestore.hpp>
+#include <vespa/vespalib/btree/btreeiterator.hpp>
+#include <vespa/vespalib/btree/btreeroot.hpp>
+#include <vespa/vespalib/btree/btree.hpp>
+#include <vespa/vespalib/data/simple_buffer.h>
+#include <vespa/vespalib/data/slime/slime.h>
+#include <vespa/vespalib/hwaccelerated/iaccelerated.h>
+#include <vespa/vespalib/util/benchmark_timer.h>
+#include <vespa/vespalib/util/rand48.h>
+#include <vespa/vespalib/util/stringfmt.h>
+#include <cinttypes>
+#include <cstdio>
+#include <map>
+
+using namespace search;
+using namespace search::queryeval;
+using vespalib::BenchmarkTimer;
+using vespalib::Rand48;
+using vespalib::Slime;
+using vespalib::hwaccelerated::IAccelerated;
+
+namespace {
+
+constexpr uint32_t num_docs = 1000000;
+
+uint64_t sink = 0; // defeats optimizing away benchmark bodies
+
+struct Config {
+    double budget_s = 1.0;
+    vespalib::string filter;
+    vespalib::string json_file;
+    vespalib::string baseline_file;
+};
+
+struct Result {
+    vespalib::string name;
+    double time_ms;
+};
+std::vector<Result> results;
+
+template <typename F>
+void bench(const Config &cfg, const vespalib::string &name, F &&func) {
+    if (!cfg.filter.empty() && name.find(cfg.filter) == vespalib::string::npos) {
+        return;
+    }
+    BenchmarkTimer timer(cfg.budget_s);
+    while (timer.has_budget()) {
+        timer.before();
+        func();
+        timer.after();
+    }
+    double time_ms = timer.min_time() * 1000.0;
+    fprintf(stderr, "%-48s %12.6f ms\n", name.c_str(), time_ms);
+    results.push_back(Result{name, time_ms});
+}
+
+std::vector<uint32_t> make_hits(uint32_t permille, uint32_t seed) {
+    Rand48 rnd(seed);
+    std::vector<uint32_t> hits;
+    for (uint32_t docid = 1; docid < num_docs; ++docid) {
+        if ((rnd.lrand48() % 1000) < permille) {
+            hits.push_back(docid);
+        }
+    }
+    return hits;
+}
+
+void consume_hits(SearchIterator &search) {
+    search.initRange(1, num_docs);
+    uint32_t docid = 1;
+    while (!search.isAtEnd(docid)) {
+        if (search.seek(docid)) {
+            sink += docid;
+            ++docid;
+        } else {
+            docid = std::max(docid + 1, search.getDocId());
+        }
+    }
+}
+
+void bench_posting_scan(const Config &cfg) {
+    for (uint32_t permille : {1, 10, 100}) {
+        auto bv = BitVector::create(num_docs);
+        for (uint32_t docid : make_hits(permille, permille)) {
+            bv->setBit(docid);
+        }
+        bv->invalidateCachedCount();
+        bench(cfg, vespalib::make_string("bitvector/scan_density_%.1f%%", permille / 10.0),
+              [&bv]() {
+                  for (uint32_t docid = bv->getFirstTrueBit();
+                       docid < num_docs; docid = bv->getNextTrueBit(docid + 1)) {
+                      sink += docid;
+                  }
+              });
+    }
+}
+
+void bench_iterator_trees(const Config &cfg) {
+    auto term = [](uint32_t permille, uint32_t seed) {
+        return std::make_unique<SimpleSearch>(SimpleResult(make_hits(permille, seed)), true);
+    };
+    bench(cfg, "iterator/and_2_terms_10%_1%", [&term]() {
+        MultiSearch::Children children;
+        children.push_back(term(100, 1));
+        children.push_back(term(10, 2));
+        auto search = AndSearch::create(std::move(children), true);
+        consume_hits(*search);
+    });
+    bench(cfg, "iterator/or_8_terms_1%", [&term]() {
+        MultiSearch::Children children;
+        for (uint32_t i = 0; i < 8; ++i) {
+            children.push_back(term(10, i));
+        }
+        auto search = OrSearch::create(std::move(children), true);
+        consume_hits(*search);
+    });
+}
+
+void bench_hwaccelerated(const Config &cfg) {
+    const IAccelerated &accel = IAccelerated::getAccelerator();
+    constexpr size_t sz = 1024;
+    std::vector<float> af(sz), bf(sz);
+    std::vector<int8_t> ab(sz), bb(sz);
+    std::vector<uint64_t> bits(sz);
+    Rand48 rnd(42);
+    for (size_t i = 0; i < sz; ++i) {
+        af[i] = rnd.lrand48() % 1000;
+        bf[i] = rnd.lrand48() % 1000;
+        ab[i] = rnd.lrand48() % 100;
+        bb[i] = rnd.lrand48() % 100;
+        bits[i] = rnd.lrand48();
+    }
+    bench(cfg, "hwaccelerated/dot_product_float_1024", [&]() {
+        sink += (uint64_t) accel.dotProduct(af.data(), bf.data(), sz);
+    });
+    bench(cfg, "hwaccelerated/dot_product_int8_1024", [&]() {
+        sink += accel.dotProduct(ab.data(), bb.data(), sz);
+    });
+    bench(cfg, "hwaccelerated/euclidean_distance_float_1024", [&]() {
+        sink += (uint64_t) accel.squaredEuclideanDistance(af.data(), bf.data(), sz);
+    });
+    bench(cfg, "hwaccelerated/popcount_1024_words", [&]() {
+        sink += accel.populationCount(bits.data(), sz);
+    });
+}
+
+void bench_btree(const Config &cfg) {
+    using Tree = vespalib::btree::BTree<uint32_t, uint32_t>;
+    constexpr uint32_t num_keys = 100000;
+    Rand48 rnd(7);
+    std::vector<uint32_t> keys;
+    keys.reserve(num_keys);
+    for (uint32_t i = 0; i < num_keys; ++i) {
+        keys.push_back(rnd.lrand48());
+    }
+    bench(cfg, "btree/insert_100k_random", [&keys]() {
+        Tree tree;
+        for (uint32_t key : keys) {
+            tree.insert(key, key);
+        }
+        sink += tree.size();
+    });
+    Tree tree;
+    for (uint32_t key : keys) {
+        tree.insert(key, key);
+    }
+    bench(cfg, "btree/lookup_100k_random", [&]() {
+        for (uint32_t key : keys) {
+            auto itr = tree.find(key);
+            sink += itr.valid() ? itr.getData() : 0;
+        }
+    });
+}
+
+void bench_enum_dictionary(const Config &cfg) {
+    constexpr uint32_t num_values = 100000;
+    Rand48 rnd(13);
+    std::vector<int32_t> values;
+    values.reserve(num_values);
+    for (uint32_t i = 0; i < num_values; ++i) {
+        values.push_back(rnd.lrand48());
+    }
+    bench(cfg, "enumstore/insert_100k_random", [&values]() {
+        EnumStoreT<int32_t> store(false, DictionaryConfig(DictionaryConfig::Type::BTREE));
+        for (int32_t value : values) {
+            sink += store.insert(value).ref();
+        }
+    });
+    EnumStoreT<int32_t> store(false, DictionaryConfig(DictionaryConfig::Type::BTREE));
+    for (int32_t value : values) {
+        store.insert(value);
+    }
+    store.freeze_dictionary();
+    bench(cfg, "enumstore/lookup_100k_random", [&]() {
+        IEnumStore::Index idx;
+        for (int32_t value : values) {
+            sink += store.find_index(value, idx) ? idx.ref() : 0;
+        }
+    });
+}
+
+void bench_hitcollector(const Config &cfg) {
+    auto hits = make_hits(100, 21);
+    Rand48 rnd(22);
+    std::vector<double> scores;
+    scores.reserve(hits.size());
+    for (size_t i = 0; i < hits.size(); ++i) {
+        scores.push_back(rnd.lrand48() % 1000000);
+    }
+    for (uint32_t topk : {10, 10000}) {
+        bench(cfg, vespalib::make_string("hitcollector/collect_10%%_top_%u", topk), [&]() {
+            HitCollector hc(num_docs, topk);
+            for (size_t i = 0; i < hits.size(); ++i) {
+                hc.addHit(hits[i], scores[i]);
+            }
+            sink += hc.getSortedHitSequence(topk).valid() ? 1 : 0;
+        });
+    }
+}
+
+void write_json(const Config &cfg) {
+    Slime slime;
+    auto &arr = slime.setObject().setArray("benchmarks");
+    for (const auto &result : results) {
+        auto &obj = arr.addObject();
+        obj.setString("name", result.name);
+        obj.setDouble("time_ms", result.time_ms);
+    }
+    vespalib::SimpleBuffer buf;
+    vespalib::slime::JsonFormat::encode(slime, buf, false);
+    FILE *file = fopen(cfg.json_file.c_str(), "w");
+    if (file == nullptr) {
+        fprintf(stderr, "could not write json to '%s'\n", cfg.json_file.c_str());
+        return;
+    }
+    fprintf(file, "%s\n", buf.get().make_string().c_str());
+    fclose(file);
+}
+
+void compare_with_baseline(const Config &cfg) {
+    FILE *file = fopen(cfg.baseline_file.c_str(), "r");
+    if (file == nullptr) {
+        fprintf(stderr, "could not read baseline from '%s'\n", cfg.baseline_file.c_str());
+        return;
+    }
+    vespalib::string json;
+    char chunk[4096];
+    for (size_t n; (n = fread(chunk, 1, sizeof(chunk), file)) > 0; ) {
+        json.append(chunk, n);
+    }
+    fclose(file);
+    Slime slime;
+    if (vespalib::slime::JsonFormat::decode(json, slime) == 0) {
+        fprintf(stderr, "could not parse baseline from '%s'\n", cfg.baseline_file.c_str());
+        return;
+    }
+    std::map<vespalib::string, double> baseline;
+    const auto &arr = slime.get()["benchmarks"];
+    for (size_t i = 0; i < arr.entries(); ++i) {
+        baseline[arr[i]["name"].asString().make_string()] = arr[i]["time_ms"].asDouble();
+    }
+    fprintf(stderr, "\ncompared to baseline '%s' (time ratio < 1.0 is faster):\n", cfg.baseline_file.c_str());
+    for (const auto &result : results) {
+        auto pos = baseline.find(result.name);
+        if (pos == baseline.end() || pos->second <= 0.0) {
+            fprintf(stderr, "%-48s (no baseline)\n", result.name.c_str());
+        } else {
+            fprintf(stderr, "%-48s %12.6f ms vs %12.6f ms -> %.3f\n",
+                    result.name.c_str(), result.time_ms, pos->second, result.time_ms / pos->second);
+        }
+    }
+}
+
+} // namespace <unnamed>
+
+int main(int argc, char **argv) {
+    Config cfg;
+    for (int i = 1; i < argc; ++i) {
+        vespalib::string arg = argv[i];
+        if ((arg == "--budget") && ((i + 1) < argc)) {
+            cfg.budget_s = atof(argv[++i]);
+        } else if ((arg == "--filter") && ((i + 1) < argc)) {
+            cfg.filter = argv[++i];
+        } else if ((arg == "--json") && ((i + 1) < argc)) {
+            cfg.json_file = argv[++i];
+        } else if ((arg == "--baseline") && ((i + 1) < argc)) {
+            cfg.baseline_file = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--budget sec] [--filter substring] [--json file] [--baseline file]\n", argv[0]);
+            return 1;
+        }
+    }
+    bench_posting_scan(cfg);
+    bench_iterator_trees(cfg);
+    bench_hwaccelerated(cfg);
+    bench_btree(cfg);
+    bench_enum_dictionary(cfg);
+    bench_hitcollector(cfg);
+    if (!cfg.json_file.empty()) {
+        write_json(cfg);
+    }
+    if (!cfg.baseline_file.empty()) {
+        compare_with_baseline(cfg);
+    }
+    fprintf(stderr, "(ignore: %" PRIu64 ")\n", sink);
+    return 0;
+}
@@ -227,9 +227,13 @@ DiskIndexTest::requireThatWeCanReadPostingList()
     TermFieldMatchDataArray mda;
     { // field 'f1'
         LookupResult::UP r = _index->lookup(0, "w1");
+        auto stats_before = _index->getFieldReadStats(0);
         PostingListHandle::UP h = _index->readPostingList(*r);
         auto sb = h->createIterator(r->counts, mda);
         EXPECT_EQ(SimpleResult({1,3}), SimpleResult().search(*sb));
+        auto stats_after = _index->getFieldReadStats(0);
+        EXPECT_EQ(stats_before.read_count + 1, stats_after.read_count);
+        EXPECT_LT(stats_before.read_bytes, stats_after.read_bytes);
     }
 }
 
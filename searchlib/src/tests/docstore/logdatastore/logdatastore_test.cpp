@@ -18,7 +18,9 @@
 #include <vespa/vespalib/util/threadstackexecutor.h>
 #include <vespa/vespalib/util/size_literals.h>
 #include <vespa/vespalib/util/memory.h>
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <iomanip>
 #include <random>
 #include <vespa/vespalib/testkit/test_kit.h>
@@ -389,6 +391,11 @@ TEST("test visit cache does not cache empty ones and is able to access some back
     EXPECT_EQUAL(2u, visitCache.read({1,3}).getBlobSet().getPositions().size());
     visitCache.remove(3);
     EXPECT_EQUAL(1u, visitCache.read({1,3}).getBlobSet().getPositions().size());
+    CacheStats before = visitCache.getCacheStats();
+    EXPECT_EQUAL(2u, visitCache.read({2,4}).getBlobSet().getPositions().size());
+    CacheStats after = visitCache.getCacheStats();
+    EXPECT_EQUAL(before.hits + 1, after.hits);
+    EXPECT_EQUAL(before.misses, after.misses);
 }
 
 using vespalib::string;
@@ -674,6 +681,10 @@ TEST("test that the integrated visit cache works.") {
     TEST_DO(verifyCacheStats(ds.getCacheStats(), 101, 107, 100, BASE_SZ-611));
     vcs.verifyVisit({41, 42, 43, 44}, true);
     TEST_DO(verifyCacheStats(ds.getCacheStats(), 101, 108, 99, BASE_SZ-611));
+    vcs.verifyVisit({41, 42}, true); // Subsets are served from the cached set.
+    TEST_DO(verifyCacheStats(ds.getCacheStats(), 102, 108, 99, BASE_SZ-611));
+    vcs.verifyVisit({43, 44}, true);
+    TEST_DO(verifyCacheStats(ds.getCacheStats(), 103, 108, 99, BASE_SZ-611));
 }
 
 TEST("testWriteRead") {
@@ -750,6 +761,62 @@ TEST("testWriteRead") {
     std::filesystem::remove_all(std::filesystem::path("empty"));
 }
 
+uint32_t
+sumBadChunks(const LogDataStore::ScrubResult & result) {
+    uint32_t numBadChunks(0);
+    for (const auto & stats : result) {
+        numBadChunks += stats.numBadChunks;
+    }
+    return numBadChunks;
+}
+
+TEST("testScrubDetectsCorruptChunks") {
+    DirectoryHandler tmpDir("scrub");
+    DummyFileHeaderContext fileHeaderContext;
+    vespalib::ThreadStackExecutor executor(1);
+    MyTlSyncer tlSyncer;
+    LogDataStore::Config config;
+    config.setMaxFileSize(4_Ki);
+    char buffer[4000];
+    std::minstd_rand rand_gen(42);
+    for (size_t i(0); i < sizeof(buffer); i++) {
+        buffer[i] = rand_gen() & 0xff;
+    }
+    {
+        LogDataStore datastore(executor, "scrub", config, GrowStrategy(),
+                               TuneFileSummary(), fileHeaderContext, tlSyncer, nullptr);
+        for (size_t i(0); i < 100; i++) {
+            datastore.write(i + 1, i, buffer, sizeof(buffer));
+        }
+        datastore.flush(datastore.initFlush(100));
+        LogDataStore::ScrubResult result = datastore.scrub(0);
+        EXPECT_LESS(1u, datastore.getAllActiveFiles().size());
+        EXPECT_LESS(0u, result.size());
+        EXPECT_EQUAL(0u, sumBadChunks(result));
+    }
+    std::vector<std::filesystem::path> datFiles;
+    for (const auto & entry : std::filesystem::directory_iterator("scrub")) {
+        if (entry.path().extension() == ".dat") {
+            datFiles.push_back(entry.path());
+        }
+    }
+    std::sort(datFiles.begin(), datFiles.end());
+    ASSERT_LESS(1u, datFiles.size());
+    {
+        // Flip bytes near the end of the oldest '.dat' file. The '.idx'
+        // files are untouched so loading the store will not notice.
+        std::fstream file(datFiles.front(), std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-8, std::ios::end);
+        file.write("corrupt", 7);
+    }
+    {
+        LogDataStore datastore(executor, "scrub", config, GrowStrategy(),
+                               TuneFileSummary(), fileHeaderContext, tlSyncer, nullptr);
+        LogDataStore::ScrubResult result = datastore.scrub(0);
+        EXPECT_LESS(0u, sumBadChunks(result));
+    }
+}
+
 TEST("requireThatFlushTimeIsAvailableAfterFlush") {
     DirectoryHandler testDir("flushtime");
     vespalib::system_time before(vespalib::system_clock::now());
@@ -4,6 +4,8 @@
 #include <vespa/searchlib/fef/fef.h>
 #include <vespa/searchlib/queryeval/hitcollector.h>
 #include <vespa/vespalib/gtest/gtest.h>
+#include <numeric>
+#include <random>
 
 #include <vespa/log/log.h>
 LOG_SETUP("hitcollector_test");
@@ -159,6 +161,30 @@ TEST(HitCollectorTest, testAddHit)
 {
     testAddHit(30, 10, "numDocs==30");
     testAddHit(400, 10, "numDocs==400"); // 400/32 = 12 which is bigger than 10.
+    testAddHit(5000, 2048, "large maxHitsSize"); // uses buffered selection instead of heap
+}
+
+TEST(HitCollectorTest, buffered_selection_for_large_topn)
+{
+    uint32_t numDocs = 10000;
+    uint32_t maxHitsSize = 1500;
+    HitCollector hc(numDocs, maxHitsSize);
+    std::vector<feature_t> scores(numDocs / 2);
+    std::iota(scores.begin(), scores.end(), 1.0);
+    std::shuffle(scores.begin(), scores.end(), std::minstd_rand(42));
+    std::vector<HitCollector::Hit> ref;
+    for (uint32_t i = 0; i < scores.size(); ++i) {
+        hc.addHit(i * 2, scores[i]);
+        ref.emplace_back(i * 2, scores[i]);
+    }
+    std::sort(ref.begin(), ref.end(),
+              [](const auto &a, const auto &b) { return (a.second > b.second); });
+    auto hits = extract(hc.getSortedHitSequence(maxHitsSize));
+    ASSERT_EQ(maxHitsSize, hits.size());
+    for (uint32_t i = 0; i < maxHitsSize; ++i) {
+        EXPECT_EQ(ref[i].first, hits[i].first);
+        EXPECT_DOUBLE_EQ(ref[i].second, hits[i].second);
+    }
 }
 
 struct Fixture {
@@ -0,0 +1,82 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/searchlib/queryeval/execution_arena.h>
+#include <vespa/searchlib/queryeval/emptysearch.h>
+#include <vespa/searchlib/queryeval/leaf_blueprints.h>
+#include <vespa/searchlib/queryeval/simpleresult.h>
+#include <vespa/searchlib/queryeval/simplesearch.h>
+#include <vespa/vespalib/gtest/gtest.h>
+#include <cstring>
+
+using namespace search::queryeval;
+
+TEST(ExecutionArenaTest, activation_is_scoped_and_nestable)
+{
+    EXPECT_TRUE(ExecutionArena::active() == nullptr);
+    ExecutionArena outer;
+    {
+        ExecutionArena::Activation a(outer);
+        EXPECT_EQ(&outer, ExecutionArena::active());
+        {
+            ExecutionArena inner;
+            ExecutionArena::Activation b(inner);
+            EXPECT_EQ(&inner, ExecutionArena::active());
+        }
+        EXPECT_EQ(&outer, ExecutionArena::active());
+    }
+    EXPECT_TRUE(ExecutionArena::active() == nullptr);
+}
+
+TEST(ExecutionArenaTest, iterators_and_blueprints_can_live_in_an_arena)
+{
+    ExecutionArena arena;
+    SearchIterator::UP search;
+    Blueprint::UP blueprint;
+    {
+        ExecutionArena::Activation bind(arena);
+        SimpleResult hits;
+        hits.addHit(3).addHit(7);
+        search = std::make_unique<SimpleSearch>(hits, true);
+        blueprint = std::make_unique<SimpleBlueprint>(hits);
+    }
+    SimpleResult result;
+    result.search(*search);
+    EXPECT_EQ(SimpleResult().addHit(3).addHit(7), result);
+    // objects are destroyed before the arena reclaims their memory
+    search.reset();
+    blueprint.reset();
+}
+
+TEST(ExecutionArenaTest, heap_allocations_survive_an_active_arena)
+{
+    // allocated without an arena -> must be properly heap-freed even
+    // if an arena happens to be active when deleted
+    auto search = std::make_unique<EmptySearch>();
+    ExecutionArena arena;
+    ExecutionArena::Activation bind(arena);
+    search.reset();
+}
+
+TEST(ExecutionArenaTest, alignment_is_honored)
+{
+    ExecutionArena arena;
+    ExecutionArena::Activation bind(arena);
+    for (size_t align : {16u, 64u, 128u}) {
+        void *p = ExecutionArena::alloc_tagged(100, align);
+        EXPECT_EQ(0u, uintptr_t(p) % align);
+        ExecutionArena::free_tagged(p);
+    }
+}
+
+TEST(ExecutionArenaTest, heap_path_round_trip)
+{
+    EXPECT_TRUE(ExecutionArena::active() == nullptr);
+    for (size_t align : {16u, 64u}) {
+        void *p = ExecutionArena::alloc_tagged(100, align);
+        EXPECT_EQ(0u, uintptr_t(p) % align);
+        memset(p, 0x55, 100);
+        ExecutionArena::free_tagged(p);
+    }
+}
+
+GTEST_MAIN_RUN_ALL_TESTS()
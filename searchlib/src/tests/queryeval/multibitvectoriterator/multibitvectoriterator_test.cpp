@@ -679,6 +679,42 @@ Verifier::create(bool strict) const {
     return mbvit;
 }
 
+TEST_F(MultiBitVectorIteratorTest, test_seek_block)
+{
+    TermFieldMatchData tfmd[3];
+    for (bool isAnd : {false, true}) {
+        MultiSearch::Children children;
+        for (size_t i(0); i < 3; i++) {
+            children.push_back(createIter(i, false, tfmd[i], true));
+        }
+        SearchIterator::UP s = isAnd
+            ? AndSearch::create(std::move(children), true)
+            : OrSearch::create(std::move(children), true);
+        s = MultiBitVectorIteratorBase::optimize(std::move(s));
+        ASSERT_TRUE(dynamic_cast<const MultiBitVectorIteratorBase *>(s.get()) != nullptr);
+        std::vector<uint32_t> expected;
+        s->initRange(1, 10000);
+        for (uint32_t docId = s->seekFirst(1); !s->isAtEnd(); docId = s->seekNext(docId + 1)) {
+            expected.push_back(docId);
+        }
+        for (uint32_t capacity : {1u, 7u, 256u}) {
+            std::vector<uint32_t> hits(capacity);
+            std::vector<uint32_t> actual;
+            s->initRange(1, 10000);
+            uint32_t begin = 1;
+            while (begin < 10000) {
+                uint32_t n = s->seek_block(begin, 10000, hits.data(), capacity);
+                actual.insert(actual.end(), hits.begin(), hits.begin() + n);
+                if (n < capacity) {
+                    break;
+                }
+                begin = hits[n - 1] + 1;
+            }
+            EXPECT_EQ(expected, actual);
+        }
+    }
+}
+
 TEST_F(MultiBitVectorIteratorTest, test_iterator_conformance)
 {
     for (bool is_and : {false, true}) {
@@ -321,6 +321,67 @@ TEST("require that NOT is supported - subqueries") {
     EXPECT_TRUE(search.seek(2));
 }
 
+TEST("require that compact evaluation of short interval ranges works") {
+    MyPostingList plists[] = {{{2, 0x00010001}},
+                              {{2, 0x00020002}},
+                              {{2, 0x00030003}}};
+    MF mf{0, 0, 0};
+    CV cv{0, 0, 3};
+    IR ir(3, 0x0003);
+    PredicateSearch search(&mf[0], &ir[0], 0x0003, cv, make_posting_lists_vector(plists), tfmda);
+    search.initFullRange();
+    EXPECT_TRUE(search.seek(2));
+}
+
+TEST("require that compact evaluation detects insufficient interval coverage") {
+    MyPostingList plists[] = {{{2, 0x00010001}},
+                              {{2, 0x00030003}}};
+    MF mf{0, 0, 0};
+    CV cv{0, 0, 2};
+    IR ir(3, 0x0003);
+    PredicateSearch search(&mf[0], &ir[0], 0x0003, cv, make_posting_lists_vector(plists), tfmda);
+    search.initFullRange();
+    EXPECT_FALSE(search.seek(2));
+}
+
+TEST("require that NOT is supported with short interval ranges - no match") {
+    MyPostingList plists[] = {{{2, 0x00010001}},  // [l, r]
+                              {{2, 0x00010000},   // [l, r]*
+                               {2, 0x00020001}}};  // [r+1, r+1]*
+    MF mf{0, 0, 0};
+    CV cv{0, 0, 3};
+    IR ir(3, 0x0002);
+    PredicateSearch search(&mf[0], &ir[0], 0x0002, cv, make_posting_lists_vector(plists), tfmda);
+    search.initFullRange();
+    EXPECT_FALSE(search.seek(2));
+}
+
+TEST("require that NOT is supported with short interval ranges - match") {
+    MyPostingList plists[] = {{{2, 0x00010000},   // [l, r]*
+                               {2, 0x00020001}}};  // [r+1, r+1]*
+    MF mf{0, 0, 0};
+    CV cv{0, 0, 2};
+    IR ir(3, 0x0002);
+    PredicateSearch search(&mf[0], &ir[0], 0x0002, cv, make_posting_lists_vector(plists), tfmda);
+    search.initFullRange();
+    EXPECT_TRUE(search.seek(2));
+}
+
+TEST("require that subquery bitmap is unpacked with short interval ranges") {
+    MyPostingList plists[] = {{{2, 0x00010001}}};
+    TermFieldMatchDataArray array;
+    TermFieldMatchData data;
+    array.add(&data);
+    MF mf{0, 0, 0};
+    CV cv{0, 0, 1};
+    IR ir(3, 0x0001);
+    PredicateSearch search(&mf[0], &ir[0], 0x0001, cv, make_posting_lists_vector(plists), array);
+    search.initFullRange();
+    EXPECT_TRUE(search.seek(2));
+    search.unpack(2);
+    EXPECT_EQUAL(0xffffffffffffffffUL, data.getSubqueries());
+}
+
 TEST("require that there can be many intervals") {
     MyPostingList plists[] = {{{2, 0x00010001},
                                {2, 0x00020002},
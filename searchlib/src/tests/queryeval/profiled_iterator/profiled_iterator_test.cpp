@@ -147,16 +147,17 @@ void verify_termwise_result(SearchIterator &search, const std::vector<uint32_t>
     }
 }
 
-void verify_operation(ExecutionProfiler &profiler, std::map<vespalib::string,size_t> &seen, const vespalib::string &expect) {
+void verify_operation(ExecutionProfiler &profiler, std::map<vespalib::string,size_t> &seen,
+                      std::initializer_list<vespalib::string> expect)
+{
     Slime slime;
     profiler.report(slime.setObject());
     auto counts = collect_counts(slime.get());
+    for (const auto &name: expect) {
+        ++seen[name];
+    }
     for (const auto &[name, count]: counts) {
-        if (name == expect) {
-            EXPECT_EQ(count, ++seen[name]);
-        } else {
-            EXPECT_EQ(count, seen[name]);
-        }
+        EXPECT_EQ(count, seen[name]) << name;
     }
 }
 
@@ -165,23 +166,23 @@ TEST(ProfiledIteratorTest, init_seek_unpack_termwise_is_profiled) {
     std::map<vespalib::string,size_t> seen;
     auto root = ProfiledIterator::profile(profiler, T({1,2,3}));
     root->initRange(1,4);
-    verify_operation(profiler, seen, "/SimpleSearch/init");
+    verify_operation(profiler, seen, {"/SimpleSearch/init"});
     root->seek(2);
-    verify_operation(profiler, seen, "/SimpleSearch/seek");
+    verify_operation(profiler, seen, {"/SimpleSearch/seek", "/SimpleSearch/hit"});
     root->unpack(2);
-    verify_operation(profiler, seen, "/SimpleSearch/unpack");
+    verify_operation(profiler, seen, {"/SimpleSearch/unpack"});
     root->initRange(1,4);
-    verify_operation(profiler, seen, "/SimpleSearch/init");
+    verify_operation(profiler, seen, {"/SimpleSearch/init"});
     auto bits = root->get_hits(1);
-    verify_operation(profiler, seen, "/SimpleSearch/termwise");
+    verify_operation(profiler, seen, {"/SimpleSearch/termwise"});
     root->initRange(1,4);
-    verify_operation(profiler, seen, "/SimpleSearch/init");
+    verify_operation(profiler, seen, {"/SimpleSearch/init"});
     root->or_hits_into(*bits, 1);
-    verify_operation(profiler, seen, "/SimpleSearch/termwise");
+    verify_operation(profiler, seen, {"/SimpleSearch/termwise"});
     root->initRange(1,4);
-    verify_operation(profiler, seen, "/SimpleSearch/init");
+    verify_operation(profiler, seen, {"/SimpleSearch/init"});
     root->and_hits_into(*bits, 1);
-    verify_operation(profiler, seen, "/SimpleSearch/termwise");
+    verify_operation(profiler, seen, {"/SimpleSearch/termwise"});
 }
 
 TEST(ProfiledIteratorTest, iterator_tree_can_be_profiled) {
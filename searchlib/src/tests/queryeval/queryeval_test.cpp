@@ -3,6 +3,7 @@
 #include <vespa/vespalib/regex/regex.h>
 #define ENABLE_GTEST_MIGRATION
 #include <vespa/searchlib/test/initrange.h>
+#include <vespa/searchlib/common/bitvectoriterator.h>
 #include <vespa/searchlib/queryeval/andnotsearch.h>
 #include <vespa/searchlib/queryeval/andsearch.h>
 #include <vespa/searchlib/queryeval/booleanmatchiteratorwrapper.h>
@@ -28,6 +29,7 @@ LOG_SETUP("query_eval_test");
 
 using namespace search::queryeval;
 using search::BitVector;
+using search::BitVectorIterator;
 using search::attribute::SearchContextParams;
 using search::fef::MatchData;
 using search::fef::TermFieldMatchData;
@@ -294,6 +296,68 @@ TEST(QueryEvalTest, test_or)
     }
 }
 
+std::vector<uint32_t> collect_blocks(SearchIterator &search, uint32_t capacity) {
+    std::vector<uint32_t> hits;
+    std::vector<uint32_t> buf(capacity);
+    search.initFullRange();
+    uint32_t begin_id = 1;
+    for (;;) {
+        uint32_t cnt = search.seek_block(begin_id, search::endDocId, buf.data(), capacity);
+        hits.insert(hits.end(), buf.begin(), buf.begin() + cnt);
+        if (cnt < capacity) {
+            break;
+        }
+        begin_id = buf[cnt - 1] + 1;
+    }
+    return hits;
+}
+
+TEST(QueryEvalTest, test_seek_block)
+{
+    SimpleResult a;
+    SimpleResult b;
+    a.addHit(5).addHit(10).addHit(16).addHit(30);
+    b.addHit(3).addHit(5).addHit(17).addHit(30).addHit(52);
+    std::vector<uint32_t> or_expect({3, 5, 10, 16, 17, 30, 52});
+    std::vector<uint32_t> and_expect({5, 30});
+    for (uint32_t capacity : {1, 2, 3, 128}) {
+        {
+            MultiSearch::Children ch;
+            ch.emplace_back(new SimpleSearch(a));
+            ch.emplace_back(new SimpleSearch(b));
+            SearchIterator::UP s = OrSearch::create(std::move(ch), true, UnpackInfo(), OrSearch::StrictImpl::PLAIN);
+            EXPECT_EQ(collect_blocks(*s, capacity), or_expect);
+        }
+        {
+            MultiSearch::Children ch;
+            ch.emplace_back(new SimpleSearch(a));
+            ch.emplace_back(new SimpleSearch(b));
+            SearchIterator::UP s = AndSearch::create(std::move(ch), true);
+            EXPECT_EQ(collect_blocks(*s, capacity), and_expect);
+        }
+    }
+}
+
+TEST(QueryEvalTest, test_and_adapts_child_order_from_observed_rejects)
+{
+    SimpleResult dense;
+    for (uint32_t docid = 1; docid <= 6000; ++docid) {
+        dense.addHit(docid);
+    }
+    SimpleResult sparse; // rejects everything
+    MultiSearch::Children ch;
+    ch.emplace_back(&((new SimpleSearch(dense))->tag("dense")));
+    ch.emplace_back(&((new SimpleSearch(sparse))->tag("sparse")));
+    SearchIterator::UP s = AndSearch::create(std::move(ch), false);
+    s->initFullRange();
+    expect_match(s->asString(), "dense.*sparse");
+    for (uint32_t docid = 1; docid <= 5000; ++docid) {
+        s->seek(docid);
+    }
+    // the child observed to reject all candidates has moved first
+    expect_match(s->asString(), "sparse.*dense");
+}
+
 class TestInsertRemoveSearch : public MultiSearch
 {
 public:
@@ -896,4 +960,25 @@ TEST(QueryEvalTest, test_andnotsearchstrict_iterators_adheres_to_init_range) {
 }
 
 
+TEST(QueryEvalTest, test_andnot_skips_seeks_on_sparse_bitvector_not_child) {
+    TermFieldMatchData tfmd;
+    auto not_side = BitVector::create(10000);
+    not_side->setBit(777);
+    not_side->setBit(9000);
+    not_side->invalidateCachedCount();
+    SimpleResult positive;
+    positive.addHit(10).addHit(777).addHit(4000).addHit(9000).addHit(9999);
+    SimpleResult expect;
+    expect.addHit(10).addHit(4000).addHit(9999);
+    for (bool strict : {false, true}) {
+        SCOPED_TRACE(strict ? "strict" : "non-strict");
+        auto pos = std::make_unique<SimpleSearch>(positive, true);
+        auto neg = BitVectorIterator::create(not_side.get(), tfmd, false);
+        SearchIterator::UP search = AndNotSearch::create({ std::move(pos), std::move(neg) }, strict);
+        SimpleResult res;
+        res.search(*search, 10000);
+        EXPECT_EQ(expect, res);
+    }
+}
+
 GTEST_MAIN_RUN_ALL_TESTS()
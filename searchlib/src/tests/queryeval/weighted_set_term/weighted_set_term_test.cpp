@@ -105,6 +105,34 @@ struct WS {
         }
         return result;
     }
+
+    std::vector<uint32_t> collect_blocks(Searchable &searchable, const std::string &field, uint32_t capacity) const {
+        FakeRequestContext requestContext;
+        MatchData::UP md = layout.createMatchData();
+        if (term_is_not_needed) {
+            md->resolveTermField(handle)->tagAsNotNeeded();
+        }
+        Node::UP node = createNode();
+        FieldSpecList fields;
+        fields.add(FieldSpec(field, fieldId, handle, field_is_filter));
+        auto bp = searchable.createBlueprint(requestContext, fields, *node);
+        bp->basic_plan(true, 1000);
+        bp->fetchPostings(ExecuteInfo::FULL);
+        auto sb = bp->createSearch(*md);
+        sb->initFullRange();
+        std::vector<uint32_t> hits(capacity);
+        std::vector<uint32_t> result;
+        uint32_t begin = 1;
+        while (begin < 10) {
+            uint32_t n = sb->seek_block(begin, 10, hits.data(), capacity);
+            result.insert(result.end(), hits.begin(), hits.begin() + n);
+            if (n < capacity) {
+                break;
+            }
+            begin = hits[n - 1] + 1;
+        }
+        return result;
+    }
 };
 
 WS::WS()
@@ -232,6 +260,25 @@ TEST(WeightedSetTermTest, test_simple_single_unranked_filter_field)
     run_simple(true, true, true);
 }
 
+TEST(WeightedSetTermTest, test_seek_block)
+{
+    FakeSearchable index;
+    setupFakeSearchable(index);
+    std::vector<uint32_t> expect({3, 5, 7});
+    for (bool not_needed : {false, true}) {
+        for (bool filter : {false, true}) {
+            WS ws;
+            ws.set_field_is_filter(filter);
+            ws.set_term_is_not_needed(not_needed);
+            ws.add("3", 30).add("5", 50).add("7", 70);
+            for (uint32_t capacity : {1u, 2u, 16u}) {
+                EXPECT_EQ(expect, ws.collect_blocks(index, "field", capacity));
+                EXPECT_EQ(expect, ws.collect_blocks(index, "multi-field", capacity));
+            }
+        }
+    }
+}
+
 void run_multi(bool field_is_filter, bool term_is_not_needed)
 {
     FakeSearchable index;
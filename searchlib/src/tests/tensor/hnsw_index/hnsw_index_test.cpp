@@ -470,6 +470,19 @@ TYPED_TEST(HnswIndexTest, 2d_vectors_inserted_in_level_0_graph_with_simple_selec
     this->expect_top_3(2, {});
 }
 
+TYPED_TEST(HnswIndexTest, selective_filter_is_searched_with_two_hop_bridging)
+{
+    this->init(false);
+    for (uint32_t docid = 1; docid <= 7; ++docid) {
+        this->add_document(docid);
+    }
+    // Selectivity is below the two-hop bridging limit, so filtered-out
+    // nodes act as bridges instead of being scored.
+    this->set_filter({4});
+    this->expect_top_3(2, {4});
+    this->expect_top_3(8, {4});
+}
+
 TYPED_TEST(HnswIndexTest, 2d_vectors_inserted_and_removed)
 {
     this->init(false);
@@ -1027,6 +1040,30 @@ TEST_F(HnswMultiIndexTest, duplicate_docid_is_removed)
     EXPECT_EQ(2, filter->max_docid());
 }
 
+TEST_F(HnswMultiIndexTest, winning_subspace_is_exposed_in_search_results)
+{
+    this->init(false);
+    this->vectors
+        .set(1, {0, 0, 0, 2})
+        .set(2, {1, 0})
+        .set(3, {2, 0, 2, 2});
+    for (uint32_t docid = 1; docid < 4; ++docid) {
+        this->add_document(docid);
+    }
+    auto check = [this](std::vector<float> qv, uint32_t exp_docid, uint32_t exp_subspace) {
+        vespalib::ArrayRef<float> qv_ref(qv);
+        vespalib::eval::TypedCells qv_cells(qv_ref);
+        auto df = this->index->distance_function_factory().for_query_vector(qv_cells);
+        auto hits = this->index->find_top_k(1, *df, 10, this->_doom->get_doom(), 10000.0);
+        ASSERT_EQ(1, hits.size());
+        EXPECT_EQ(exp_docid, hits[0].docid);
+        EXPECT_EQ(exp_subspace, hits[0].subspace);
+    };
+    check({0, 0}, 1, 0);
+    check({0, 2}, 1, 1);
+    check({2, 2}, 3, 1);
+}
+
 TEST_F(HnswMultiIndexTest, docid_with_empty_tensor_can_be_removed)
 {
     this->init(false);
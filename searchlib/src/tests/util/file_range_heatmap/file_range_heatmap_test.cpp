@@ -0,0 +1,94 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#include <vespa/searchlib/util/file_range_heatmap.h>
+#include <vespa/vespalib/gtest/gtest.h>
+
+#include <vespa/log/log.h>
+LOG_SETUP("file_range_heatmap_test");
+
+using namespace search;
+
+namespace {
+
+constexpr uint64_t MiB = 1 << 20;
+
+}
+
+TEST(FileRangeHeatmapTest, hot_ranges_are_coalesced_and_sorted_by_heat)
+{
+    FileRangeHeatmap map(1);
+    auto a = map.track_file("a.dat");
+    auto b = map.track_file("b.dat");
+    for (int i = 0; i < 5; ++i) {
+        a->note_access(0, 100);
+    }
+    for (int i = 0; i < 3; ++i) {
+        a->note_access(MiB, 2 * MiB);
+    }
+    b->note_access(10 * MiB, 10);
+
+    auto ranges = map.hot_ranges(2);
+    ASSERT_EQ(1u, ranges.size()); // b.dat is below the threshold
+    EXPECT_EQ("a.dat", ranges[0].file);
+    EXPECT_EQ(0u, ranges[0].offset);
+    EXPECT_EQ(3 * MiB, ranges[0].length);
+    EXPECT_EQ(5u + 3u + 3u, ranges[0].heat);
+
+    auto all = map.hot_ranges(1);
+    ASSERT_EQ(2u, all.size());
+    EXPECT_GE(all[0].heat, all[1].heat);
+    EXPECT_EQ("b.dat", all[1].file);
+}
+
+TEST(FileRangeHeatmapTest, sampled_accesses_are_scaled_by_the_sample_interval)
+{
+    FileRangeHeatmap map(4);
+    auto a = map.track_file("a.dat");
+    for (int i = 0; i < 8; ++i) {
+        a->note_access(0, 100); // samples access 0 and 4
+    }
+    auto ranges = map.hot_ranges(1);
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(8u, ranges[0].heat);
+}
+
+TEST(FileRangeHeatmapTest, closed_files_are_pruned)
+{
+    FileRangeHeatmap map(1);
+    auto a = map.track_file("a.dat");
+    a->note_access(0, 100);
+    a.reset(); // file rotated or compacted away
+    auto b = map.track_file("b.dat");
+    b->note_access(0, 100);
+    auto ranges = map.hot_ranges(1);
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ("b.dat", ranges[0].file);
+}
+
+TEST(FileRangeHeatmapTest, heatmap_survives_save_and_load)
+{
+    vespalib::string path = "heatmap_test.dat";
+    FileRangeHeatmap map(1);
+    auto a = map.track_file("a.dat");
+    a->note_access(0, 100);
+    a->note_access(0, 100);
+    ASSERT_TRUE(map.save(path));
+
+    FileRangeHeatmap loaded(1);
+    ASSERT_TRUE(loaded.load(path));
+    auto ranges = loaded.hot_ranges(1);
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(2u, ranges[0].heat);
+
+    // reopening the file claims the persisted heat
+    auto reopened = loaded.track_file("a.dat");
+    reopened->note_access(0, 100);
+    ranges = loaded.hot_ranges(1);
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(3u, ranges[0].heat);
+
+    loaded.clear();
+    EXPECT_TRUE(loaded.hot_ranges(1).empty());
+    EXPECT_FALSE(loaded.load("nonexistent_heatmap.dat"));
+}
+
+GTEST_MAIN_RUN_ALL_TESTS()
@@ -278,6 +278,23 @@ Grouping::configureStaticStuff(const ConfigureStaticParams & params)
         }
     }
 
+    // Levels grouping directly on an attribute can aggregate on the
+    // 32-bit enum handles instead of materializing a value per hit; ids
+    // are resolved to their string form once per surviving group by the
+    // EnumConverter in postProcess(). This is only valid for levels that
+    // are aggregated in this pass - frozen levels already carry resolved
+    // ids that fresh enum handles would not compare equal to - and only
+    // for plain attribute selectors, which is what the converter knows
+    // how to resolve. The flag must be set before the attributes are
+    // wired below, as it selects the stable-enum attribute lookup.
+    size_t lastActive = std::min(size_t(_lastLevel) + 1, _levels.size());
+    for (size_t i = _firstLevel; i < lastActive; ++i) {
+        ExpressionNode * root = _levels[i].getExpression().getRoot();
+        if ((root != nullptr) && root->getClass().equal(AttributeNode::classId)) {
+            static_cast<AttributeNode *>(root)->enableEnumOptimization(true);
+        }
+    }
+
     if (params._attrCtx != nullptr) {
         AttributeNode::Configure confAttr(*params._attrCtx);
         select(confAttr, confAttr);
@@ -0,0 +1,58 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "attribute_save_buffer_pool.h"
+#include "attributefilebufferwriter.h"
+#include <vespa/searchlib/util/file_settings.h>
+
+namespace search {
+
+AttributeSaveBufferPool::AttributeSaveBufferPool(size_t buffer_size, size_t alignment, size_t max_buffers)
+    : _lock(),
+      _buffers(),
+      _buffer_size(buffer_size),
+      _alignment(alignment),
+      _max_buffers(max_buffers)
+{
+}
+
+AttributeSaveBufferPool::~AttributeSaveBufferPool() = default;
+
+std::unique_ptr<vespalib::DataBuffer>
+AttributeSaveBufferPool::acquire(size_t size)
+{
+    if (size == _buffer_size) {
+        std::lock_guard guard(_lock);
+        if (!_buffers.empty()) {
+            auto buffer = std::move(_buffers.back());
+            _buffers.pop_back();
+            return buffer;
+        }
+    }
+    return std::make_unique<vespalib::DataBuffer>(size, _alignment);
+}
+
+void
+AttributeSaveBufferPool::release(std::unique_ptr<vespalib::DataBuffer> buffer)
+{
+    if (!buffer || buffer->referencesExternalData()) {
+        return;
+    }
+    buffer->reset();
+    if (buffer->getFreeLen() < _buffer_size) {
+        return;
+    }
+    std::lock_guard guard(_lock);
+    if (_buffers.size() < _max_buffers) {
+        _buffers.push_back(std::move(buffer));
+    }
+}
+
+AttributeSaveBufferPool&
+AttributeSaveBufferPool::instance()
+{
+    static AttributeSaveBufferPool pool(AttributeFileBufferWriter::BUFFER_SIZE,
+                                        FileSettings::DIRECTIO_ALIGNMENT, 8);
+    return pool;
+}
+
+}
@@ -0,0 +1,48 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/vespalib/data/databuffer.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace search {
+
+/*
+ * Pool of reusable aligned staging buffers for attribute save and load.
+ * Attribute flushes allocate multi-MiB direct IO aligned buffers for
+ * every attribute in every flush cycle; recycling them avoids the
+ * repeated large allocations.
+ */
+class AttributeSaveBufferPool
+{
+    std::mutex                                         _lock;
+    std::vector<std::unique_ptr<vespalib::DataBuffer>> _buffers;
+    const size_t                                       _buffer_size;
+    const size_t                                       _alignment;
+    const size_t                                       _max_buffers;
+public:
+    AttributeSaveBufferPool(size_t buffer_size, size_t alignment, size_t max_buffers);
+    AttributeSaveBufferPool(const AttributeSaveBufferPool &) = delete;
+    AttributeSaveBufferPool & operator=(const AttributeSaveBufferPool &) = delete;
+    ~AttributeSaveBufferPool();
+
+    /*
+     * Get an aligned buffer of the given size, reusing a pooled one
+     * when the size matches the pooled buffer size.
+     */
+    std::unique_ptr<vespalib::DataBuffer> acquire(size_t size);
+
+    /*
+     * Hand a buffer back to the pool. Buffers wrapping external memory
+     * or too small to stage a full pooled buffer are just destroyed.
+     */
+    void release(std::unique_ptr<vespalib::DataBuffer> buffer);
+
+    size_t buffer_size() const noexcept { return _buffer_size; }
+
+    static AttributeSaveBufferPool& instance();
+};
+
+}
@@ -1,6 +1,7 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "attributefilebufferwriter.h"
+#include "attribute_save_buffer_pool.h"
 #include <vespa/vespalib/data/databuffer.h>
 
 namespace search {
@@ -22,6 +23,7 @@ AttributeFileBufferWriter(IAttributeFileWriter &fileWriter)
 AttributeFileBufferWriter::~AttributeFileBufferWriter()
 {
     assert(usedLen() == 0);
+    AttributeSaveBufferPool::instance().release(std::move(_buf));
 }
 
 
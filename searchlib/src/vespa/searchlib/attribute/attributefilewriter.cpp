@@ -2,6 +2,7 @@
 
 #include "attributefilewriter.h"
 #include "attribute_header.h"
+#include "attribute_save_buffer_pool.h"
 #include "attributefilebufferwriter.h"
 #include <vespa/fastos/file.h>
 #include <vespa/searchlib/common/fileheadercontext.h>
@@ -139,7 +140,7 @@ AttributeFileWriter::addTags(vespalib::GenericHeader &header)
 AttributeFileWriter::Buffer
 AttributeFileWriter::allocBuf(size_t size)
 {
-    return std::make_unique<BufferBuf>(size, FileSettings::DIRECTIO_ALIGNMENT);
+    return AttributeSaveBufferPool::instance().acquire(size);
 }
 
 void
@@ -149,6 +150,7 @@ AttributeFileWriter::writeBuf(Buffer buf)
     // TODO: pad to DirectIO boundary when burning bridges
     writeDirectIOAligned(*_file, buf->getData(), bufLen);
     _fileBitSize += bufLen * 8;
+    AttributeSaveBufferPool::instance().release(std::move(buf));
 }
 
 void
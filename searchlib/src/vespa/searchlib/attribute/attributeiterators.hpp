@@ -8,6 +8,7 @@
 #include <vespa/searchlib/fef/termfieldmatchdataposition.h>
 #include <vespa/searchlib/common/bitvector.h>
 #include <vespa/vespalib/objects/visit.h>
+#include <type_traits>
 
 namespace search {
 
@@ -18,6 +19,13 @@ bool matches(const SC & sc, uint32_t doc) {
     return sc.find(doc, 0) >= 0;
 }
 
+// detect search contexts providing a vectorized scan over the raw values
+template <typename SC, typename = void>
+struct has_scan_hits_into : std::false_type {};
+
+template <typename SC>
+struct has_scan_hits_into<SC, std::void_t<decltype(std::declval<const SC&>().scan_hits_into(std::declval<BitVector&>(), 0u, 0u))>> : std::true_type {};
+
 }
 
 template <typename SC>
@@ -30,7 +38,11 @@ AttributeIteratorBase::and_hits_into(const SC & sc, BitVector & result, uint32_t
 template <typename SC>
 void
 AttributeIteratorBase::or_hits_into(const SC & sc, BitVector & result, uint32_t begin_id) const {
-    result.foreach_falsebit([&](uint32_t key) { if ( matches(sc, key)) { result.setBit(key); }}, begin_id);
+    if constexpr (has_scan_hits_into<SC>::value) {
+        sc.scan_hits_into(result, begin_id, result.size());
+    } else {
+        result.foreach_falsebit([&](uint32_t key) { if ( matches(sc, key)) { result.setBit(key); }}, begin_id);
+    }
     result.invalidateCachedCount();
 }
 
@@ -39,9 +51,13 @@ template <typename SC>
 std::unique_ptr<BitVector>
 AttributeIteratorBase::get_hits(const SC & sc, uint32_t begin_id) const {
     BitVector::UP result = BitVector::create(begin_id, getEndId());
-    for (uint32_t docId(std::max(begin_id, getDocId())); docId < getEndId(); docId++) {
-        if (matches(sc, docId)) {
-            result->setBit(docId);
+    if constexpr (has_scan_hits_into<SC>::value) {
+        sc.scan_hits_into(*result, std::max(begin_id, getDocId()), getEndId());
+    } else {
+        for (uint32_t docId(std::max(begin_id, getDocId())); docId < getEndId(); docId++) {
+            if (matches(sc, docId)) {
+                result->setBit(docId);
+            }
         }
     }
     result->invalidateCachedCount();
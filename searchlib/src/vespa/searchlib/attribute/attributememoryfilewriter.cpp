@@ -1,6 +1,7 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "attributememoryfilewriter.h"
+#include "attribute_save_buffer_pool.h"
 #include "attributememoryfilebufferwriter.h"
 #include <vespa/searchlib/util/file_settings.h>
 #include <vespa/vespalib/data/databuffer.h>
@@ -21,7 +22,7 @@ AttributeMemoryFileWriter::~AttributeMemoryFileWriter() = default;
 AttributeMemoryFileWriter::Buffer
 AttributeMemoryFileWriter::allocBuf(size_t size)
 {
-    return std::make_unique<BufferBuf>(size, FileSettings::DIRECTIO_ALIGNMENT);
+    return AttributeSaveBufferPool::instance().acquire(size);
 }
 
 
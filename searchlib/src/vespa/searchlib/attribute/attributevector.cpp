@@ -24,6 +24,7 @@
 #include <vespa/vespalib/util/exceptions.h>
 #include <vespa/vespalib/util/mmap_file_allocator_factory.h>
 #include <vespa/vespalib/util/size_literals.h>
+#include <vespa/vespalib/util/tagged_memory_allocator.h>
 #include <thread>
 #include <filesystem>
 
@@ -71,7 +72,11 @@ std::unique_ptr<vespalib::alloc::MemoryAllocator>
 make_memory_allocator(const vespalib::string& name, const search::attribute::Config& config)
 {
     if (allow_paged(config)) {
-        return vespalib::alloc::MmapFileAllocatorFactory::instance().make_memory_allocator(name);
+        auto allocator = vespalib::alloc::MmapFileAllocatorFactory::instance().make_memory_allocator(name);
+        if (allocator) {
+            return vespalib::alloc::AllocationTagRegistry::instance().
+                make_tagged_allocator("attribute/" + name, std::move(allocator));
+        }
     }
     return {};
 }
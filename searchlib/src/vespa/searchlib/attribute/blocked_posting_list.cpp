@@ -0,0 +1,162 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "blocked_posting_list.h"
+#include <vespa/searchlib/fef/termfieldmatchdata.h>
+#include <vespa/vespalib/objects/visit.h>
+#include <vespa/vespalib/util/optimized.h>
+#include <algorithm>
+
+namespace search::attribute {
+
+namespace {
+
+class BlockedPostingListIterator : public queryeval::SearchIterator
+{
+protected:
+    const BlockedPostingList &_list;
+    fef::TermFieldMatchData  &_tfmd;
+
+    void doSeek(uint32_t docId) override {
+        if (_list.testBit(docId)) {
+            setDocId(docId);
+        }
+    }
+    void doUnpack(uint32_t docId) override {
+        _tfmd.resetOnlyDocId(docId);
+    }
+    void visitMembers(vespalib::ObjectVisitor &visitor) const override {
+        SearchIterator::visitMembers(visitor);
+        visit(visitor, "docIdLimit", _list.getDocIdLimit());
+        visit(visitor, "cardinality", _list.cardinality());
+    }
+public:
+    BlockedPostingListIterator(const BlockedPostingList &list, fef::TermFieldMatchData &tfmd) noexcept
+        : _list(list),
+          _tfmd(tfmd)
+    { }
+    Trinary is_strict() const override { return Trinary::False; }
+};
+
+class BlockedPostingListIteratorStrict : public BlockedPostingListIterator
+{
+    void doSeek(uint32_t docId) override {
+        uint32_t hit = _list.nextHit(docId);
+        if (hit >= _list.getDocIdLimit()) {
+            setAtEnd();
+        } else {
+            setDocId(hit);
+        }
+    }
+public:
+    BlockedPostingListIteratorStrict(const BlockedPostingList &list, fef::TermFieldMatchData &tfmd) noexcept
+        : BlockedPostingListIterator(list, tfmd)
+    { }
+    Trinary is_strict() const override { return Trinary::True; }
+};
+
+}
+
+BlockedPostingList::BlockedPostingList(uint32_t docIdLimit)
+    : _blocks((docIdLimit + block_size - 1) >> block_shift),
+      _docIdLimit(docIdLimit),
+      _cardinality(0)
+{ }
+
+BlockedPostingList::~BlockedPostingList() = default;
+
+void
+BlockedPostingList::insert(uint32_t docId)
+{
+    Block &block = _blocks[docId >> block_shift];
+    if (!block.bitmap) {
+        block.bitmap = std::make_unique<uint64_t[]>(words_per_block);
+    }
+    uint64_t &word = block.bitmap[(docId & (block_size - 1)) >> 6];
+    uint64_t mask = 1ul << (docId & 63);
+    if ((word & mask) == 0) {
+        word |= mask;
+        ++block.cardinality;
+        ++_cardinality;
+    }
+}
+
+void
+BlockedPostingList::finalize()
+{
+    for (Block &block : _blocks) {
+        if (block.bitmap && (block.cardinality <= array_container_limit)) {
+            block.offsets.reserve(block.cardinality);
+            for (uint32_t w = 0; w < words_per_block; ++w) {
+                uint64_t bits = block.bitmap[w];
+                while (bits != 0) {
+                    block.offsets.push_back((w << 6) + vespalib::Optimized::lsbIdx(bits));
+                    bits &= (bits - 1);
+                }
+            }
+            block.bitmap.reset();
+        }
+    }
+}
+
+bool
+BlockedPostingList::testBit(uint32_t docId) const
+{
+    if (docId >= _docIdLimit) {
+        return false;
+    }
+    const Block &block = _blocks[docId >> block_shift];
+    uint32_t offset = docId & (block_size - 1);
+    if (block.bitmap) {
+        return (block.bitmap[offset >> 6] >> (offset & 63)) & 1;
+    }
+    return std::binary_search(block.offsets.begin(), block.offsets.end(), uint16_t(offset));
+}
+
+uint32_t
+BlockedPostingList::nextHit(uint32_t docId) const
+{
+    if (docId >= _docIdLimit) {
+        return _docIdLimit;
+    }
+    uint32_t blockIdx = docId >> block_shift;
+    uint32_t offset = docId & (block_size - 1);
+    for (; blockIdx < _blocks.size(); ++blockIdx, offset = 0) {
+        const Block &block = _blocks[blockIdx];
+        if (block.cardinality == 0) {
+            continue;
+        }
+        uint32_t base = blockIdx << block_shift;
+        if (block.bitmap) {
+            uint32_t w = offset >> 6;
+            uint64_t bits = block.bitmap[w] & (~uint64_t(0) << (offset & 63));
+            for (;;) {
+                if (bits != 0) {
+                    uint32_t hit = base + (w << 6) + vespalib::Optimized::lsbIdx(bits);
+                    return (hit < _docIdLimit) ? hit : _docIdLimit;
+                }
+                if (++w == words_per_block) {
+                    break;
+                }
+                bits = block.bitmap[w];
+            }
+        } else {
+            auto it = std::lower_bound(block.offsets.begin(), block.offsets.end(), uint16_t(offset));
+            if (it != block.offsets.end()) {
+                uint32_t hit = base + *it;
+                return (hit < _docIdLimit) ? hit : _docIdLimit;
+            }
+        }
+    }
+    return _docIdLimit;
+}
+
+std::unique_ptr<queryeval::SearchIterator>
+BlockedPostingList::make_iterator(fef::TermFieldMatchData &tfmd, bool strict) const
+{
+    if (strict) {
+        return std::make_unique<BlockedPostingListIteratorStrict>(*this, tfmd);
+    }
+    return std::make_unique<BlockedPostingListIterator>(*this, tfmd);
+}
+
+}
@@ -0,0 +1,78 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/searchlib/queryeval/searchiterator.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace search::fef { class TermFieldMatchData; }
+
+namespace search::attribute {
+
+/*
+ * Synthetic posting list storing document ids in roaring-style blocked
+ * containers. The docid space is split into blocks of 65536 documents
+ * where each populated block is represented either as a sorted array of
+ * 16-bit docid offsets (sparse block) or as a bitmap (dense block).
+ * This is considerably more compact than a full bitvector for
+ * mid-density posting lists while insertion stays cheap and order
+ * independent during the build phase.
+ *
+ * Usage is two-phased: insert() may only be called before finalize(),
+ * lookup (testBit() / nextHit() / make_iterator()) only after.
+ */
+class BlockedPostingList {
+public:
+    static constexpr uint32_t block_shift = 16;
+    static constexpr uint32_t block_size = 1u << block_shift;
+    static constexpr uint32_t words_per_block = block_size / 64;
+    // blocks at most this full are converted to sorted offset arrays
+    static constexpr uint32_t array_container_limit = 4096;
+
+private:
+    struct Block {
+        std::unique_ptr<uint64_t[]> bitmap;   // build phase and dense blocks
+        std::vector<uint16_t>       offsets;  // sparse blocks after finalize()
+        uint32_t                    cardinality;
+        Block() noexcept : bitmap(), offsets(), cardinality(0) {}
+    };
+
+    std::vector<Block> _blocks;
+    uint32_t           _docIdLimit;
+    uint32_t           _cardinality;
+
+public:
+    explicit BlockedPostingList(uint32_t docIdLimit);
+    BlockedPostingList(BlockedPostingList &&) noexcept = default;
+    BlockedPostingList &operator=(BlockedPostingList &&) noexcept = default;
+    ~BlockedPostingList();
+
+    uint32_t getDocIdLimit() const noexcept { return _docIdLimit; }
+    uint32_t cardinality() const noexcept { return _cardinality; }
+
+    /*
+     * Add a document id, any insertion order, duplicates allowed.
+     * The caller must ensure docId < getDocIdLimit().
+     */
+    void insert(uint32_t docId);
+
+    /*
+     * Convert sparse blocks to offset arrays, ending the build phase.
+     */
+    void finalize();
+
+    bool testBit(uint32_t docId) const;
+
+    /*
+     * Return the first hit >= docId, or getDocIdLimit() when there are
+     * no more hits.
+     */
+    uint32_t nextHit(uint32_t docId) const;
+
+    std::unique_ptr<queryeval::SearchIterator>
+    make_iterator(fef::TermFieldMatchData &tfmd, bool strict) const;
+};
+
+}
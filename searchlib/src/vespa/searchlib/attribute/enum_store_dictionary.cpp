@@ -172,6 +172,13 @@ EnumStoreDictionary<EnumTree>::find_posting_list(const EntryComparator&, EntryRe
     LOG_ABORT("should not be reached");
 }
 
+template <>
+std::pair<IEnumStore::Index, EntryRef>
+EnumStoreDictionary<EnumTree, vespalib::datastore::ShardedHashMap>::find_posting_list(const EntryComparator&, EntryRef) const
+{
+    LOG_ABORT("should not be reached");
+}
+
 template <typename BTreeDictionaryT, typename HashDictionaryT>
 std::pair<IEnumStore::Index, EntryRef>
 EnumStoreDictionary<BTreeDictionaryT, HashDictionaryT>::find_posting_list(const EntryComparator& cmp, EntryRef root) const
@@ -214,6 +221,13 @@ EnumStoreDictionary<EnumTree>::clear_all_posting_lists(std::function<void(EntryR
     LOG_ABORT("should not be reached");
 }
 
+template <>
+void
+EnumStoreDictionary<EnumTree, vespalib::datastore::ShardedHashMap>::clear_all_posting_lists(std::function<void(EntryRef)>)
+{
+    LOG_ABORT("should not be reached");
+}
+
 template <typename BTreeDictionaryT, typename HashDictionaryT>
 void
 EnumStoreDictionary<BTreeDictionaryT, HashDictionaryT>::clear_all_posting_lists(std::function<void(EntryRef)> clearer)
@@ -245,6 +259,13 @@ EnumStoreDictionary<EnumTree>::update_posting_list(Index, const EntryComparator&
     LOG_ABORT("should not be reached");
 }
 
+template <>
+void
+EnumStoreDictionary<EnumTree, vespalib::datastore::ShardedHashMap>::update_posting_list(Index, const EntryComparator&, std::function<EntryRef(EntryRef)>)
+{
+    LOG_ABORT("should not be reached");
+}
+
 template <typename BTreeDictionaryT, typename HashDictionaryT>
 void
 EnumStoreDictionary<BTreeDictionaryT, HashDictionaryT>::update_posting_list(Index idx, const EntryComparator& cmp, std::function<EntryRef(EntryRef)> updater)
@@ -278,6 +299,13 @@ EnumStoreDictionary<EnumTree>::normalize_posting_lists(std::function<EntryRef(En
     LOG_ABORT("should not be reached");
 }
 
+template <>
+bool
+EnumStoreDictionary<EnumTree, vespalib::datastore::ShardedHashMap>::normalize_posting_lists(std::function<EntryRef(EntryRef)>)
+{
+    LOG_ABORT("should not be reached");
+}
+
 template <typename BTreeDictionaryT, typename HashDictionaryT>
 bool
 EnumStoreDictionary<BTreeDictionaryT, HashDictionaryT>::normalize_posting_lists(std::function<EntryRef(EntryRef)> normalize)
@@ -312,6 +340,13 @@ EnumStoreDictionary<EnumTree>::normalize_posting_lists(std::function<void(std::v
     LOG_ABORT("should not be reached");
 }
 
+template <>
+bool
+EnumStoreDictionary<EnumTree, vespalib::datastore::ShardedHashMap>::normalize_posting_lists(std::function<void(std::vector<EntryRef>&)>, const EntryRefFilter&)
+{
+    LOG_ABORT("should not be reached");
+}
+
 namespace {
 
 template <typename HashDictionaryT>
@@ -433,6 +468,13 @@ EnumStoreDictionary<EnumTree>::foreach_posting_list(std::function<void(const std
     LOG_ABORT("should not be reached");
 }
 
+template <>
+void
+EnumStoreDictionary<EnumTree, vespalib::datastore::ShardedHashMap>::foreach_posting_list(std::function<void(const std::vector<EntryRef>&)>, const EntryRefFilter&)
+{
+    LOG_ABORT("should not be reached");
+}
+
 template <typename BTreeDictionaryT, typename HashDictionaryT>
 void
 EnumStoreDictionary<BTreeDictionaryT, HashDictionaryT>::foreach_posting_list(std::function<void(const std::vector<EntryRef>&)> callback, const EntryRefFilter& filter)
@@ -468,6 +510,13 @@ EnumStoreDictionary<EnumTree>::get_posting_dictionary() const
     LOG_ABORT("should not be reached");
 }
 
+template <>
+const EnumPostingTree &
+EnumStoreDictionary<EnumTree, vespalib::datastore::ShardedHashMap>::get_posting_dictionary() const
+{
+    LOG_ABORT("should not be reached");
+}
+
 template <>
 const EnumPostingTree &
 EnumStoreDictionary<vespalib::datastore::NoBTreeDictionary, vespalib::datastore::ShardedHashMap>::get_posting_dictionary() const
@@ -482,62 +531,103 @@ EnumStoreDictionary<BTreeDictionaryT, HashDictionaryT>::get_posting_dictionary()
     return this->_btree_dict;
 }
 
-EnumStoreFoldedDictionary::EnumStoreFoldedDictionary(IEnumStore& enumStore, std::unique_ptr<EntryComparator> compare, std::unique_ptr<EntryComparator> folded_compare)
-    : EnumStoreDictionary<EnumPostingTree>(enumStore, std::move(compare)),
+template <typename HashDictionaryT>
+EnumStoreFoldedDictionary<HashDictionaryT>::EnumStoreFoldedDictionary(IEnumStore& enumStore, std::unique_ptr<EntryComparator> compare, std::unique_ptr<EntryComparator> folded_compare)
+    : ParentDictionary(enumStore, std::move(compare)),
       _folded_compare(std::move(folded_compare))
 {
 }
 
-EnumStoreFoldedDictionary::~EnumStoreFoldedDictionary() = default;
+template <typename HashDictionaryT>
+EnumStoreFoldedDictionary<HashDictionaryT>::~EnumStoreFoldedDictionary() = default;
 
+template <typename HashDictionaryT>
 UniqueStoreAddResult
-EnumStoreFoldedDictionary::add(const EntryComparator& comp, std::function<EntryRef(void)> insertEntry)
+EnumStoreFoldedDictionary<HashDictionaryT>::add(const EntryComparator& comp, std::function<EntryRef(void)> insertEntry)
 {
-    static_assert(!has_hash_dictionary, "Folded Dictionary does not support hash dictionary");
-    auto it = _btree_dict.lowerBound(AtomicEntryRef(), comp);
+    auto it = this->_btree_dict.lowerBound(AtomicEntryRef(), comp);
     if (it.valid() && !comp.less(EntryRef(), it.getKey().load_relaxed())) {
         // Entry already exists
         return UniqueStoreAddResult(it.getKey().load_relaxed(), false);
     }
     EntryRef newRef = insertEntry();
-    _btree_dict.insert(it, AtomicEntryRef(newRef), AtomicEntryRef());
+    this->_btree_dict.insert(it, AtomicEntryRef(newRef), AtomicEntryRef());
+    if constexpr (has_hash_dictionary) {
+        std::function<EntryRef(void)> insert_hash_entry([newRef]() noexcept -> EntryRef { return newRef; });
+        auto& add_result = this->_hash_dict.add(comp, newRef, insert_hash_entry);
+        assert(add_result.first.load_relaxed() == newRef);
+    }
     // Maybe move posting list reference from next entry
     ++it;
     if (it.valid() && it.getData().load_relaxed().valid() && !_folded_compare->less(newRef, it.getKey().load_relaxed())) {
         EntryRef posting_list_ref(it.getData().load_relaxed());
-        _btree_dict.thaw(it);
+        this->_btree_dict.thaw(it);
         it.writeData(AtomicEntryRef());
+        if constexpr (has_hash_dictionary) {
+            auto find_result = this->_hash_dict.find(this->_hash_dict.get_default_comparator(), it.getKey().load_relaxed());
+            assert(find_result != nullptr && find_result->second.load_relaxed() == posting_list_ref);
+            find_result->second.store_release(EntryRef());
+        }
         --it;
         assert(it.valid() && it.getKey().load_relaxed() == newRef);
         it.writeData(AtomicEntryRef(posting_list_ref));
+        if constexpr (has_hash_dictionary) {
+            auto find_result = this->_hash_dict.find(this->_hash_dict.get_default_comparator(), newRef);
+            assert(find_result != nullptr && find_result->first.load_relaxed() == newRef);
+            find_result->second.store_release(posting_list_ref);
+        }
     }
     return UniqueStoreAddResult(newRef, true);
 }
 
+template <typename HashDictionaryT>
 void
-EnumStoreFoldedDictionary::remove(const EntryComparator& comp, EntryRef ref)
+EnumStoreFoldedDictionary<HashDictionaryT>::remove(const EntryComparator& comp, EntryRef ref)
 {
-    static_assert(!has_hash_dictionary, "Folded Dictionary does not support hash dictionary");
     assert(ref.valid());
-    auto it = _btree_dict.lowerBound(AtomicEntryRef(ref), comp);
+    auto it = this->_btree_dict.lowerBound(AtomicEntryRef(ref), comp);
     assert(it.valid() && it.getKey().load_relaxed() == ref);
     EntryRef posting_list_ref(it.getData().load_relaxed());
-    _btree_dict.remove(it);
+    this->_btree_dict.remove(it);
+    if constexpr (has_hash_dictionary) {
+        auto *result = this->_hash_dict.remove(comp, ref);
+        assert(result != nullptr && result->first.load_relaxed() == ref);
+    }
     // Maybe copy posting list reference to next entry
     if (posting_list_ref.valid()) {
         if (it.valid() && !it.getData().load_relaxed().valid() && !_folded_compare->less(ref, it.getKey().load_relaxed())) {
             this->_btree_dict.thaw(it);
             it.writeData(AtomicEntryRef(posting_list_ref));
+            if constexpr (has_hash_dictionary) {
+                auto find_result = this->_hash_dict.find(this->_hash_dict.get_default_comparator(), it.getKey().load_relaxed());
+                assert(find_result != nullptr && !find_result->second.load_relaxed().valid());
+                find_result->second.store_release(posting_list_ref);
+            }
         } else {
             LOG_ABORT("Posting list not cleared for removed unique value");
         }
     }
 }
 
+template <typename HashDictionaryT>
+std::pair<IEnumStore::Index, EntryRef>
+EnumStoreFoldedDictionary<HashDictionaryT>::find_posting_list(const EntryComparator& cmp, EntryRef root) const
+{
+    // Lookups use folded comparators while the hash dictionary is keyed
+    // on unfolded values, so always resolve through the btree dictionary.
+    typename BTreeDictionaryType::ConstIterator itr(vespalib::btree::BTreeNode::Ref(), this->_btree_dict.getAllocator());
+    itr.lower_bound(root, AtomicEntryRef(), cmp);
+    if (itr.valid() && !cmp.less(Index(), itr.getKey().load_acquire())) {
+        return std::make_pair(itr.getKey().load_acquire(), itr.getData().load_acquire());
+    }
+    return std::make_pair(Index(), EntryRef());
+}
+
+template <typename HashDictionaryT>
 void
-EnumStoreFoldedDictionary::collect_folded(Index idx, EntryRef root, const std::function<void(EntryRef)>& callback) const
+EnumStoreFoldedDictionary<HashDictionaryT>::collect_folded(Index idx, EntryRef root, const std::function<void(EntryRef)>& callback) const
 {
-    BTreeDictionaryType::ConstIterator itr(vespalib::btree::BTreeNode::Ref(), _btree_dict.getAllocator());
+    typename BTreeDictionaryType::ConstIterator itr(vespalib::btree::BTreeNode::Ref(), this->_btree_dict.getAllocator());
     itr.lower_bound(root, AtomicEntryRef(idx), *_folded_compare);
     while (itr.valid() && !_folded_compare->less(idx, itr.getKey().load_acquire())) {
         callback(itr.getKey().load_acquire());
@@ -545,22 +635,29 @@ EnumStoreFoldedDictionary::collect_folded(Index idx, EntryRef root, const std::f
     }
 }
 
+template <typename HashDictionaryT>
 IEnumStore::Index
-EnumStoreFoldedDictionary::remap_index(Index idx)
+EnumStoreFoldedDictionary<HashDictionaryT>::remap_index(Index idx)
 {
-    auto itr = _btree_dict.find(AtomicEntryRef(idx), *_folded_compare);
+    auto itr = this->_btree_dict.find(AtomicEntryRef(idx), *_folded_compare);
     assert(itr.valid());
     return itr.getKey().load_acquire();
 }
 
 template class EnumStoreDictionary<EnumTree>;
 
+template class EnumStoreDictionary<EnumTree, vespalib::datastore::ShardedHashMap>;
+
 template class EnumStoreDictionary<EnumPostingTree>;
 
 template class EnumStoreDictionary<EnumPostingTree, vespalib::datastore::ShardedHashMap>;
 
 template class EnumStoreDictionary<vespalib::datastore::NoBTreeDictionary, vespalib::datastore::ShardedHashMap>;
 
+template class EnumStoreFoldedDictionary<vespalib::datastore::NoHashDictionary>;
+
+template class EnumStoreFoldedDictionary<vespalib::datastore::ShardedHashMap>;
+
 }
 
 namespace vespalib::btree {
@@ -69,10 +69,24 @@ public:
  * ensure that entries with same folded key share a posting list
  * (e.g. case insensitive search) and posting list reference is found
  * for the first of these entries.
+ *
+ * An optional hash dictionary can be kept alongside the btree
+ * dictionary to speed up lookups using exact (unfolded) comparators.
+ * The btree dictionary remains the authority; folded lookups always
+ * use it since the hash dictionary is keyed on unfolded values.
  */
-class EnumStoreFoldedDictionary : public EnumStoreDictionary<EnumPostingTree>
+template <typename HashDictionaryT = vespalib::datastore::NoHashDictionary>
+class EnumStoreFoldedDictionary : public EnumStoreDictionary<EnumPostingTree, HashDictionaryT>
 {
 private:
+    using ParentDictionary = EnumStoreDictionary<EnumPostingTree, HashDictionaryT>;
+    using AtomicEntryRef = IEnumStoreDictionary::AtomicEntryRef;
+    using BTreeDictionaryType = EnumPostingTree;
+    using EntryComparator = IEnumStoreDictionary::EntryComparator;
+    using EntryRef = IEnumStoreDictionary::EntryRef;
+    using Index = IEnumStoreDictionary::Index;
+    using ParentDictionary::has_hash_dictionary;
+
     std::unique_ptr<EntryComparator> _folded_compare;
 
 public:
@@ -80,6 +94,7 @@ public:
     ~EnumStoreFoldedDictionary() override;
     vespalib::datastore::UniqueStoreAddResult add(const EntryComparator& comp, std::function<EntryRef(void)> insertEntry) override;
     void remove(const EntryComparator& comp, EntryRef ref) override;
+    std::pair<Index, EntryRef> find_posting_list(const EntryComparator& cmp, EntryRef root) const override;
     void collect_folded(Index idx, EntryRef root, const std::function<void(EntryRef)>& callback) const override;
     Index remap_index(Index idx) override;
 };
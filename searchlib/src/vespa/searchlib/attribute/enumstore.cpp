@@ -38,10 +38,24 @@ make_enum_store_dictionary(IEnumStore &store, bool has_postings, const Dictionar
                            std::unique_ptr<EntryComparator> folded_compare)
 {
     using NoBTreeDictionary = vespalib::datastore::NoBTreeDictionary;
+    using NoHashDictionary = vespalib::datastore::NoHashDictionary;
     using ShardedHashMap = vespalib::datastore::ShardedHashMap;
     if (has_postings) {
         if (folded_compare) {
-            return std::make_unique<EnumStoreFoldedDictionary>(store, std::move(compare), std::move(folded_compare));
+            /*
+             * Folded dictionaries need the btree to share posting lists
+             * between entries with the same folded key, so a pure hash
+             * dictionary cannot be used. Both hash configs get a hash
+             * front-end for exact lookups with the btree kept as the
+             * authority.
+             */
+            switch (dict_cfg.getType()) {
+            case DictionaryConfig::Type::HASH:
+            case DictionaryConfig::Type::BTREE_AND_HASH:
+                return std::make_unique<EnumStoreFoldedDictionary<ShardedHashMap>>(store, std::move(compare), std::move(folded_compare));
+            default:
+                return std::make_unique<EnumStoreFoldedDictionary<NoHashDictionary>>(store, std::move(compare), std::move(folded_compare));
+            }
         } else {
             switch (dict_cfg.getType()) {
             case DictionaryConfig::Type::HASH:
@@ -53,7 +67,18 @@ make_enum_store_dictionary(IEnumStore &store, bool has_postings, const Dictionar
             }
         }
     } else {
-        return std::make_unique<EnumStoreDictionary<EnumTree>>(store, std::move(compare));
+        /*
+         * Dictionaries without postings are still iterated in sort order
+         * (e.g. when saving), so the btree is kept and the hash configs
+         * add a hash front-end for point lookups.
+         */
+        switch (dict_cfg.getType()) {
+        case DictionaryConfig::Type::HASH:
+        case DictionaryConfig::Type::BTREE_AND_HASH:
+            return std::make_unique<EnumStoreDictionary<EnumTree, ShardedHashMap>>(store, std::move(compare));
+        default:
+            return std::make_unique<EnumStoreDictionary<EnumTree>>(store, std::move(compare));
+        }
     }
 }
 
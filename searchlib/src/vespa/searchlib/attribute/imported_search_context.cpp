@@ -49,7 +49,8 @@ ImportedSearchContext::ImportedSearchContext(
       _target_docid_limit(_target_search_context->get_committed_docid_limit()),
       _merger(_reference_attribute.getCommittedDocIdLimit()),
       _params(params),
-      _zero_hits(false)
+      _zero_hits(false),
+      _find_cache()
 {
 }
 
@@ -304,6 +305,24 @@ ImportedSearchContext::considerAddSearchCacheEntry()
     }
 }
 
+void
+ImportedSearchContext::consider_enable_find_cache(const queryeval::ExecuteInfo &execInfo)
+{
+    // Each evaluated doc pays a find() against the target attribute, and
+    // referring docs share target docs, so memoizing per target lid pays
+    // off once the expected number of evaluations exceeds the cost of
+    // setting up one cache entry per target lid. The expected evaluations
+    // are estimated from the upstream hit rate; for selective queries the
+    // eager fill would cost more than the memoization saves. The cache
+    // lives only as long as this search context, which holds guards for
+    // the whole query.
+    uint32_t referring_docs = _reference_attribute.getCommittedDocIdLimit();
+    double expected_evaluations = execInfo.hit_rate() * referring_docs;
+    if ((_target_docid_limit > 0) && (expected_evaluations > _target_docid_limit)) {
+        _find_cache.resize(_target_docid_limit, CachedFind(pack_find(FIND_NOT_CACHED, 0)));
+    }
+}
+
 void
 ImportedSearchContext::fetchPostings(const queryeval::ExecuteInfo &execInfo, bool strict) {
     if (!_searchCacheLookup) {
@@ -311,6 +330,8 @@ ImportedSearchContext::fetchPostings(const queryeval::ExecuteInfo &execInfo, boo
         if (!_merger.merge_done() && (strict || (_target_attribute.getIsFastSearch() && execInfo.hit_rate() > 0.01))) {
                 makeMergedPostings(_target_attribute.getIsFilter());
                 considerAddSearchCacheEntry();
+        } else if (!_merger.merge_done()) {
+            consider_enable_find_cache(execInfo);
         }
     }
 }
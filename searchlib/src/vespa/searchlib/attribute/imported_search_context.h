@@ -8,6 +8,8 @@
 #include <vespa/searchcommon/attribute/i_search_context.h>
 #include <vespa/vespalib/datastore/atomic_value_wrapper.h>
 #include <vespa/vespalib/util/arrayref.h>
+#include <limits>
+#include <vector>
 
 namespace search::fef { class TermFieldMatchData; }
 namespace search { class QueryTermSimple; }
@@ -42,9 +44,29 @@ class ImportedSearchContext : public ISearchContext {
     PostingListMerger<int32_t>                      _merger;
     SearchContextParams                             _params;
     mutable std::atomic<bool>                       _zero_hits;
-
+    /*
+     * Memoized target attribute find() results, indexed by target lid and
+     * shared by all referring docs mapping to that target. Only populated
+     * when iterating without merged postings, cf. consider_enable_find_cache().
+     * The context is shared by all match threads, so elem_id and weight are
+     * packed into a single atomic word and published as a unit.
+     */
+    using CachedFind = vespalib::datastore::AtomicValueWrapper<uint64_t>;
+    mutable std::vector<CachedFind>                 _find_cache;
+
+    static constexpr int32_t FIND_NOT_CACHED = std::numeric_limits<int32_t>::min();
     static constexpr uint32_t MIN_TARGET_HITS_FOR_APPROXIMATION = 50;
 
+    static constexpr uint64_t pack_find(int32_t elem_id, int32_t weight) noexcept {
+        return (uint64_t(uint32_t(elem_id)) << 32) | uint32_t(weight);
+    }
+    static constexpr int32_t packed_find_elem_id(uint64_t packed) noexcept {
+        return int32_t(uint32_t(packed >> 32));
+    }
+    static constexpr int32_t packed_find_weight(uint64_t packed) noexcept {
+        return int32_t(uint32_t(packed & 0xffffffffu));
+    }
+
     uint32_t getTargetLid(uint32_t lid) const {
         // Check range to avoid reading memory beyond end of mapping array
         uint32_t target_lid = lid < _targetLids.size() ? _targetLids[lid].load_acquire() : 0u;
@@ -52,8 +74,24 @@ class ImportedSearchContext : public ISearchContext {
         return target_lid < _target_docid_limit ? target_lid : 0u;
     }
 
+    int32_t cached_find(uint32_t target_lid, int32_t& weight) const {
+        auto& entry = _find_cache[target_lid];
+        uint64_t packed = entry.load_relaxed();
+        if (packed_find_elem_id(packed) == FIND_NOT_CACHED) {
+            int32_t found_weight = 0;
+            int32_t elem_id = _target_search_context->find(target_lid, 0, found_weight);
+            packed = pack_find(elem_id, found_weight);
+            // Racing threads compute the same value from the read-only target
+            // attribute, so a plain atomic publish is fine.
+            entry.store_relaxed(packed);
+        }
+        weight = packed_find_weight(packed);
+        return packed_find_elem_id(packed);
+    }
+
     void makeMergedPostings(bool isFilter);
     void considerAddSearchCacheEntry();
+    void consider_enable_find_cache(const queryeval::ExecuteInfo &execInfo);
     uint32_t calc_approx_hits(uint32_t target_approx_hits) const;
     uint32_t calc_exact_hits() const;
 public:
@@ -76,10 +114,17 @@ public:
     using DocId = uint32_t;
 
     int32_t find(DocId docId, int32_t elemId, int32_t& weight) const {
+        if ((elemId == 0) && !_find_cache.empty()) {
+            return cached_find(getTargetLid(docId), weight);
+        }
         return _target_search_context->find(getTargetLid(docId), elemId, weight);
     }
 
     int32_t find(DocId docId, int32_t elemId) const {
+        if ((elemId == 0) && !_find_cache.empty()) {
+            int32_t weight(0);
+            return cached_find(getTargetLid(docId), weight);
+        }
         return _target_search_context->find(getTargetLid(docId), elemId);
     }
 
@@ -91,6 +136,8 @@ public:
     const ISearchContext &target_search_context() const noexcept {
         return *_target_search_context;
     }
+    // Only used by unit tests.
+    bool has_find_cache() const noexcept { return !_find_cache.empty(); }
     uint32_t get_committed_docid_limit() const noexcept override;
 };
 
@@ -32,7 +32,18 @@ private:
     using ConstArrayRef = vespalib::ConstArrayRef<ElemT>;
 
     ArrayStore _store;
+    vespalib::datastore::ICompactionContext::UP _compaction_context;
+    uint32_t _compaction_scan_pos;
+    uint32_t _compaction_scan_budget;
 public:
+    /*
+     * Max number of entry refs scanned per tick when moving data out of
+     * the buffers being compacted. Compaction runs on the attribute
+     * writer thread, so bounding the work per tick lets feeding
+     * interleave with an ongoing compaction instead of stalling behind
+     * a full scan of the ref vector.
+     */
+    static constexpr uint32_t default_compaction_scan_budget = 0x40000;
     MultiValueMapping(const MultiValueMapping &) = delete;
     MultiValueMapping & operator = (const MultiValueMapping &) = delete;
     MultiValueMapping(const vespalib::datastore::ArrayStoreConfig &storeCfg,
@@ -65,6 +76,10 @@ public:
     vespalib::MemoryUsage getArrayStoreMemoryUsage() const override;
     vespalib::MemoryUsage update_stat(const CompactionStrategy& compaction_strategy);
     bool consider_compact(const CompactionStrategy &compactionStrategy) {
+        if (has_active_compaction()) {
+            compaction_tick();
+            return true;
+        }
         if (_store.consider_compact()) {
             compact_worst(compactionStrategy);
             return true;
@@ -72,9 +87,13 @@ public:
         return false;
     }
     void compact_worst(const CompactionStrategy& compaction_strategy);
+    void compaction_tick();
+    bool has_active_compaction() const noexcept { return static_cast<bool>(_compaction_context); }
     bool has_free_lists_enabled() const { return _store.has_free_lists_enabled(); }
     // Set compaction spec. Only used by unit tests.
     void set_compaction_spec(vespalib::datastore::CompactionSpec compaction_spec) noexcept { _store.set_compaction_spec(compaction_spec); }
+    // Set compaction scan budget. Only used by unit tests.
+    void set_compaction_scan_budget(uint32_t budget) noexcept { _compaction_scan_budget = budget; }
     // Get type mapper. Only used by unit tests.
     const ArrayStoreTypeMapper &get_mapper() const noexcept { return _store.get_mapper(); }
 
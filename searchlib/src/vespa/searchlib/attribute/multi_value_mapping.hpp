@@ -13,7 +13,10 @@ MultiValueMapping<ElemT,RefT>::MultiValueMapping(const vespalib::datastore::Arra
                                                   const vespalib::GrowStrategy &gs,
                                                   std::shared_ptr<vespalib::alloc::MemoryAllocator> memory_allocator)
   : MultiValueMappingBase(gs, ArrayStore::getGenerationHolderLocation(_store), memory_allocator),
-    _store(storeCfg, std::move(memory_allocator), ArrayStoreTypeMapper(storeCfg.max_type_id(), array_store_grow_factor, max_buffer_size))
+    _store(storeCfg, std::move(memory_allocator), ArrayStoreTypeMapper(storeCfg.max_type_id(), array_store_grow_factor, max_buffer_size)),
+    _compaction_context(),
+    _compaction_scan_pos(0),
+    _compaction_scan_budget(default_compaction_scan_budget)
 {
 }
 
@@ -26,6 +29,10 @@ MultiValueMapping<ElemT,RefT>::set(uint32_t docId, ConstArrayRef values)
 {
     _indices.ensure_size(docId + 1);
     EntryRef oldRef(_indices[docId].load_relaxed());
+    if (values.empty() && !oldRef.valid()) {
+        // All docs without values share the invalid entry ref, cf. ArrayStore::add().
+        return;
+    }
     ConstArrayRef oldValues = _store.get(oldRef);
     _indices[docId].store_release(_store.add(values));
     updateValueCount(oldValues.size(), values.size());
@@ -45,9 +52,33 @@ template <typename ElemT, typename RefT>
 void
 MultiValueMapping<ElemT,RefT>::compact_worst(const CompactionStrategy& compaction_strategy)
 {
-    vespalib::datastore::ICompactionContext::UP compactionContext(_store.compact_worst(compaction_strategy));
-    if (compactionContext) {
-        compactionContext->compact(vespalib::ArrayRef<AtomicEntryRef>(&_indices[0], _indices.size()));
+    if (!has_active_compaction()) {
+        _compaction_context = _store.compact_worst(compaction_strategy);
+        _compaction_scan_pos = 0;
+    }
+    if (has_active_compaction()) {
+        compaction_tick();
+    }
+}
+
+template <typename ElemT, typename RefT>
+void
+MultiValueMapping<ElemT,RefT>::compaction_tick()
+{
+    uint32_t limit = _indices.size();
+    uint32_t begin = _compaction_scan_pos;
+    uint32_t end = std::min(limit, begin + _compaction_scan_budget);
+    if (begin < end) {
+        _compaction_context->compact(vespalib::ArrayRef<AtomicEntryRef>(&_indices[begin], end - begin));
+    }
+    _compaction_scan_pos = end;
+    if (end >= limit) {
+        /*
+         * All entry refs have been scanned, no more data references the
+         * buffers being compacted. Destroying the context puts them on
+         * hold so memory is released when readers are done.
+         */
+        _compaction_context.reset();
     }
 }
 
@@ -96,6 +96,18 @@ public:
         (void) doc;
         return std::numeric_limits<uint32_t>::max(); // does not have enum
     }
+    void get_values(vespalib::ConstArrayRef<DocId> docids, vespalib::ArrayRef<largeint_t> values) const override {
+        for (size_t i = 0; i < docids.size(); ++i) {
+            MultiValueArrayRef doc_values(this->_mvMapping.get(docids[i]));
+            values[i] = static_cast<largeint_t>((doc_values.size() > 0) ? multivalue::get_value(doc_values[0]) : T());
+        }
+    }
+    void get_values(vespalib::ConstArrayRef<DocId> docids, vespalib::ArrayRef<double> values) const override {
+        for (size_t i = 0; i < docids.size(); ++i) {
+            MultiValueArrayRef doc_values(this->_mvMapping.get(docids[i]));
+            values[i] = static_cast<double>((doc_values.size() > 0) ? multivalue::get_value(doc_values[0]) : T());
+        }
+    }
     uint32_t get(DocId doc, largeint_t * v, uint32_t sz) const override {
         return getHelper(doc, v, sz);
     }
@@ -46,6 +46,16 @@ public:
         return _children[ref].getData();
     }
 
+    uint32_t seek_block(ref_t ref, uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity) noexcept {
+        uint32_t cnt = 0;
+        uint32_t docid = seek(ref, begin_id);
+        while ((docid < end_id) && (cnt < capacity)) {
+            hits[cnt++] = docid;
+            docid = next(ref);
+        }
+        return cnt;
+    }
+
     std::unique_ptr<BitVector> get_hits(uint32_t begin_id, uint32_t end_id);
     void or_hits_into(BitVector &result, uint32_t begin_id);
 
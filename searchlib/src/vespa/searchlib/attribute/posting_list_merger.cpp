@@ -10,6 +10,7 @@ PostingListMerger<DataT>::PostingListMerger(uint32_t docIdLimit) noexcept
     : _array(),
       _startPos(),
       _bitVector(),
+      _blocked(),
       _docIdLimit(docIdLimit),
       _arrayValid(false)
 {
@@ -35,11 +36,20 @@ PostingListMerger<DataT>::allocBitVector()
     _bitVector = BitVector::create(_docIdLimit);
 }
 
+template <typename DataT>
+void
+PostingListMerger<DataT>::allocBlocked()
+{
+    _blocked = std::make_unique<BlockedPostingList>(_docIdLimit);
+}
+
 template <typename DataT>
 void
 PostingListMerger<DataT>::merge()
 {
-    if (_bitVector) {
+    if (_blocked) {
+        _blocked->finalize();
+    } else if (_bitVector) {
         _bitVector->invalidateCachedCount();
     } else {
         if (_startPos.size() > 2) {
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "blocked_posting_list.h"
 #include <vespa/vespalib/btree/btree_key_data.h>
 #include <vespa/searchlib/common/bitvector.h>
 #include <vespa/vespalib/util/arrayref.h>
@@ -10,7 +11,7 @@ namespace search::attribute {
 
 /*
  * Class providing a synthetic posting list by merging multiple posting lists
- * into an array or bitvector.
+ * into an array, a blocked posting list or a bitvector.
  */
 template <typename DataT>
 class PostingListMerger
@@ -22,6 +23,7 @@ class PostingListMerger
     PostingVector  _array;
     StartVector    _startPos;
     std::shared_ptr<BitVector> _bitVector;
+    std::unique_ptr<BlockedPostingList> _blocked;
     uint32_t       _docIdLimit;
     bool           _arrayValid;
 
@@ -33,14 +35,17 @@ public:
 
     void reserveArray(uint32_t postingsCount, size_t postingsSize);
     void allocBitVector();
+    void allocBlocked();
     void merge();
     bool hasArray() const noexcept { return _arrayValid; }
     bool hasBitVector() const noexcept { return static_cast<bool>(_bitVector); }
+    bool hasBlocked() const noexcept { return static_cast<bool>(_blocked); }
     bool emptyArray() const noexcept { return _array.empty(); }
     vespalib::ConstArrayRef<Posting> getArray() const noexcept { return _array; }
     const BitVector *getBitVector() const noexcept { return _bitVector.get(); }
     BitVector *getBitVector() noexcept { return _bitVector.get(); }
     const std::shared_ptr<BitVector> &getBitVectorSP() const noexcept { return _bitVector; }
+    const BlockedPostingList *getBlocked() const noexcept { return _blocked.get(); }
     uint32_t getDocIdLimit() const noexcept { return _docIdLimit; }
 
     template <typename PostingListType>
@@ -63,7 +68,16 @@ public:
                                 { if (__builtin_expect(key < limit, true)) { bv.setBit(key); } });
     }
 
-    bool merge_done() const noexcept { return hasArray() || hasBitVector(); }
+    template <typename PostingListType>
+    void addToBlocked(const PostingListType & postingList)
+    {
+        BlockedPostingList &blocked = *_blocked;
+        uint32_t limit = _docIdLimit;
+        postingList.foreach_key([&blocked, limit](uint32_t key)
+                                { if (__builtin_expect(key < limit, true)) { blocked.insert(key); } });
+    }
+
+    bool merge_done() const noexcept { return hasArray() || hasBitVector() || hasBlocked(); }
 
     // Until diversity handling has been rewritten
     PostingVector &getWritableArray() noexcept { return _array; }
@@ -97,7 +97,8 @@ protected:
 
     const PostingStore& _posting_store;
     /*
-     * Synthetic posting lists for range search, in array or bitvector form
+     * Synthetic posting lists for range search, in array, blocked or
+     * bitvector form
      */
     PostingListMerger<DataT> _merger;
 
@@ -108,6 +109,7 @@ protected:
 
     void lookupSingle();
     virtual void fillArray();
+    virtual void fillBlocked();
     virtual void fillBitVector(const ExecuteInfo &);
 
     void fetchPostings(const ExecuteInfo &exec, bool strict) override;
@@ -155,12 +157,15 @@ protected:
                                     bool useBitVector, const ISearchContext &baseSearchCtx);
     ~PostingListFoldedSearchContextT() override;
 
+    enum class MergeForm : uint8_t { ARRAY, BLOCKED, BITVECTOR };
+
     size_t calc_estimated_hits_in_range() const override;
-    template <bool fill_array>
-    void fill_array_or_bitvector_helper(EntryRef pidx);
-    template <bool fill_array>
-    void fill_array_or_bitvector();
+    template <MergeForm form>
+    void fill_merger_helper(EntryRef pidx);
+    template <MergeForm form>
+    void fill_merger();
     void fillArray() override;
+    void fillBlocked() override;
     void fillBitVector(const ExecuteInfo &) override;
 };
 
@@ -66,6 +66,16 @@ PostingListSearchContextT<DataT>::fillArray()
     _merger.merge();
 }
 
+template <typename DataT>
+void
+PostingListSearchContextT<DataT>::fillBlocked()
+{
+    for (auto it(_lowerDictItr); it != _upperDictItr; ++it) {
+        _merger.addToBlocked(PostingListTraverser<PostingStore>(_posting_store, it.getData().load_acquire()));
+    }
+    _merger.merge();
+}
+
 template <typename DataT>
 struct PostingListSearchContextT<DataT>::FillPart : public vespalib::Runnable {
     FillPart(const vespalib::Doom & doom, const PostingStore& posting_store, const DictionaryConstIterator & from,
@@ -167,6 +177,13 @@ PostingListSearchContextT<DataT>::fetchPostings(const ExecuteInfo & exec_info, b
     //
     // The threshold for when to use array merging is therefore 0.0025 (0.08 / 32).
     constexpr float threshold_for_using_array = 0.0025;
+    // Above roughly 5% of the docid space the posting lists are so dense
+    // that most blocks of the blocked (roaring-style) posting list degrade
+    // to bitmap containers anyway; a plain bitvector is then just as
+    // compact and can be filled in parallel, so it is preferred. Below
+    // that, the blocked form avoids allocating and clearing docIdLimit
+    // bits for hits that only touch a fraction of them.
+    constexpr float threshold_for_using_blocked = 0.05;
     if (!_merger.merge_done() && _uniqueValues >= 2u && this->_dictionary.get_has_btree_dictionary()) {
         if (strict || use_posting_lists_when_non_strict(exec_info)) {
             size_t sum = estimated_hits_in_range();
@@ -174,6 +191,9 @@ PostingListSearchContextT<DataT>::fetchPostings(const ExecuteInfo & exec_info, b
             if (sum < (_docIdLimit * threshold_for_using_array)) {
                 _merger.reserveArray(_uniqueValues, sum);
                 fillArray();
+            } else if (sum < (_docIdLimit * threshold_for_using_blocked)) {
+                _merger.allocBlocked();
+                fillBlocked();
             } else {
                 _merger.allocBitVector();
                 fillBitVector(exec_info);
@@ -211,6 +231,9 @@ createPostingIterator(fef::TermFieldMatchData *matchData, bool strict)
     if (_uniqueValues == 0u) {
         return std::make_unique<EmptySearch>();
     }
+    if (_merger.hasBlocked()) { // synthetic results are available
+        return _merger.getBlocked()->make_iterator(*matchData, strict);
+    }
     if (_merger.hasArray() || _merger.hasBitVector()) { // synthetic results are available
         if (!_merger.emptyArray()) {
             assert(_merger.hasArray());
@@ -385,31 +408,33 @@ PostingListFoldedSearchContextT<DataT>::calc_estimated_hits_in_range() const
 }
 
 template <typename DataT>
-template <bool fill_array>
+template <typename PostingListFoldedSearchContextT<DataT>::MergeForm form>
 void
-PostingListFoldedSearchContextT<DataT>::fill_array_or_bitvector_helper(EntryRef pidx)
+PostingListFoldedSearchContextT<DataT>::fill_merger_helper(EntryRef pidx)
 {
-    if constexpr (fill_array) {
+    if constexpr (form == MergeForm::ARRAY) {
         _merger.addToArray(PostingListTraverser<PostingStore>(_posting_store, pidx));
+    } else if constexpr (form == MergeForm::BLOCKED) {
+        _merger.addToBlocked(PostingListTraverser<PostingStore>(_posting_store, pidx));
     } else {
         _merger.addToBitVector(PostingListTraverser<PostingStore>(_posting_store, pidx));
     }
 }
 
 template <typename DataT>
-template <bool fill_array>
+template <typename PostingListFoldedSearchContextT<DataT>::MergeForm form>
 void
-PostingListFoldedSearchContextT<DataT>::fill_array_or_bitvector()
+PostingListFoldedSearchContextT<DataT>::fill_merger()
 {
     for (auto pidx : _posting_indexes) {
-        fill_array_or_bitvector_helper<fill_array>(pidx);
+        fill_merger_helper<form>(pidx);
     }
     if (_resume_scan_itr.valid()) {
         for (auto it(_resume_scan_itr); it != _upperDictItr;) {
             if (use_dictionary_entry(it)) {
                 auto pidx = it.getData().load_acquire();
                 if (pidx.valid()) {
-                    fill_array_or_bitvector_helper<fill_array>(pidx);
+                    fill_merger_helper<form>(pidx);
                 }
                 ++it;
             }
@@ -422,7 +447,14 @@ template <typename DataT>
 void
 PostingListFoldedSearchContextT<DataT>::fillArray()
 {
-    fill_array_or_bitvector<true>();
+    fill_merger<MergeForm::ARRAY>();
+}
+
+template <typename DataT>
+void
+PostingListFoldedSearchContextT<DataT>::fillBlocked()
+{
+    fill_merger<MergeForm::BLOCKED>();
 }
 
 template <typename DataT>
@@ -430,7 +462,7 @@ void
 PostingListFoldedSearchContextT<DataT>::fillBitVector(const ExecuteInfo & exec_info)
 {
     (void) exec_info;
-    fill_array_or_bitvector<false>();
+    fill_merger<MergeForm::BITVECTOR>();
 }
 
 
@@ -473,8 +505,7 @@ template <typename BaseSC, typename AttrT, typename DataT>
 bool
 StringPostingSearchContext<BaseSC, AttrT, DataT>::use_dictionary_entry(PostingListSearchContext::DictionaryConstIterator& it) const {
     if ( this->isRegex() ) {
-        if (this->getRegex().valid() &&
-            this->getRegex().partial_match(_enumStore.get_value(it.getKey().load_acquire()))) {
+        if (this->is_regex_match(_enumStore.get_value(it.getKey().load_acquire()))) {
             return true;
         }
         ++it;
@@ -15,6 +15,44 @@ SingleNumericSearchContext<T, M>::SingleNumericSearchContext(std::unique_ptr<Que
 {
 }
 
+template <typename T, typename M>
+void
+SingleNumericSearchContext<T, M>::scan_hits_into(BitVector& result, uint32_t begin_id, uint32_t end_id) const
+{
+    const T* data = _data.data();
+    end_id = std::min(end_id, std::min(uint32_t(_data.size()), result.size()));
+    begin_id = std::max(begin_id, result.getStartIndex());
+    if (begin_id >= end_id) {
+        return;
+    }
+    auto* words = static_cast<BitWord::Word*>(result.getStart());
+    uint32_t docId = begin_id;
+    BitWord::Word bits = 0;
+    for (; (docId < end_id) && (BitWord::bitNum(docId) != 0); ++docId) {
+        bits |= BitWord::Word(this->match(vespalib::atomic::load_ref_relaxed(data[docId]))) << BitWord::bitNum(docId);
+    }
+    if (bits != 0) {
+        words[BitWord::wordNum(begin_id)] |= bits;
+    }
+    while (docId + BitWord::WordLen <= end_id) {
+        bits = 0;
+        for (uint32_t i = 0; i < BitWord::WordLen; ++i) {
+            bits |= BitWord::Word(this->match(vespalib::atomic::load_ref_relaxed(data[docId + i]))) << i;
+        }
+        if (bits != 0) {
+            words[BitWord::wordNum(docId)] |= bits;
+        }
+        docId += BitWord::WordLen;
+    }
+    bits = 0;
+    for (; docId < end_id; ++docId) {
+        bits |= BitWord::Word(this->match(vespalib::atomic::load_ref_relaxed(data[docId]))) << BitWord::bitNum(docId);
+    }
+    if (bits != 0) {
+        words[BitWord::wordNum(end_id - 1)] |= bits;
+    }
+}
+
 template <typename T, typename M>
 std::unique_ptr<queryeval::SearchIterator>
 SingleNumericSearchContext<T, M>::createFilterIterator(fef::TermFieldMatchData* matchData, bool strict)
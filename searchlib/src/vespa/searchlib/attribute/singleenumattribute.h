@@ -113,6 +113,11 @@ public:
     EnumHandle getEnum(DocId doc) const override {
        return getE(doc);
     }
+    void get_values(vespalib::ConstArrayRef<DocId> docids, vespalib::ArrayRef<EnumHandle> values) const override {
+        for (size_t i = 0; i < docids.size(); ++i) {
+            values[i] = getE(docids[i]);
+        }
+    }
     uint32_t get(DocId doc, EnumHandle * e, uint32_t sz) const override {
         if (sz > 0) {
             e[0] = getE(doc);
@@ -89,6 +89,16 @@ public:
         (void) doc;
         return std::numeric_limits<uint32_t>::max(); // does not have enum
     }
+    void get_values(vespalib::ConstArrayRef<DocId> docids, vespalib::ArrayRef<largeint_t> values) const override {
+        for (size_t i = 0; i < docids.size(); ++i) {
+            values[i] = static_cast<largeint_t>(getFast(docids[i]));
+        }
+    }
+    void get_values(vespalib::ConstArrayRef<DocId> docids, vespalib::ArrayRef<double> values) const override {
+        for (size_t i = 0; i < docids.size(); ++i) {
+            values[i] = static_cast<double>(getFast(docids[i]));
+        }
+    }
     uint32_t get(DocId doc, largeint_t * v, uint32_t sz) const override {
         (void) sz;
         v[0] = static_cast<largeint_t>(getFast(doc));
@@ -68,6 +68,12 @@ makePostingChange(const vespalib::datastore::EntryComparator &cmpa,
         uint32_t docId = elem.first;
         EnumIndex oldIdx = this->_enumIndices[docId].load_relaxed();
         EnumIndex newIdx = elem.second;
+        if (oldIdx == newIdx) {
+            // The changes cancelled each other out (e.g. counter bumped
+            // and reverted, or updated to the stored value), leave the
+            // posting list alone.
+            continue;
+        }
 
         // add new posting
         changePost[EnumPostingPair(newIdx, &cmpa)].add(docId, 1);
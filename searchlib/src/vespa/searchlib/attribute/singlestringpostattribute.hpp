@@ -77,15 +77,20 @@ makePostingChange(const vespalib::datastore::EntryComparator &cmpa,
         EnumIndex oldIdx = this->_enumIndices[docId].load_relaxed();
         EnumIndex newIdx = elem.second;
 
-        // add new posting
         auto remapped_new_idx = dictionary.remap_index(newIdx);
-        changePost[EnumPostingPair(remapped_new_idx, &cmpa)].add(docId, 1);
-
-        // remove old posting
-        if ( oldIdx.valid()) {
+        if (oldIdx.valid()) {
             auto remapped_old_idx = dictionary.remap_index(oldIdx);
+            if (remapped_old_idx == remapped_new_idx) {
+                // The changes cancelled each other out within the shared
+                // (folded) posting list, leave it alone.
+                continue;
+            }
+            // remove old posting
             changePost[EnumPostingPair(remapped_old_idx, &cmpa)].remove(docId);
         }
+
+        // add new posting
+        changePost[EnumPostingPair(remapped_new_idx, &cmpa)].add(docId, 1);
     }
 }
 
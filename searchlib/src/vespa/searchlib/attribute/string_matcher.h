@@ -30,6 +30,7 @@ protected:
     bool isCased() const { return _helper.isCased(); }
     bool isFuzzy() const { return _helper.isFuzzy(); }
     const vespalib::Regex& getRegex() const { return _helper.getRegex(); }
+    bool is_regex_match(const char *src) const { return _helper.is_regex_match(src); }
     const vespalib::FuzzyMatcher& getFuzzyMatcher() const { return _helper.getFuzzyMatcher(); }
     const QueryTermUCS4* get_query_term_ptr() const noexcept { return _query_term.get(); }
 
@@ -7,6 +7,10 @@
 #include <vespa/vespalib/text/lowercase.h>
 #include <vespa/vespalib/text/utf8.h>
 #include <vespa/vespalib/fuzzy/fuzzy_matcher.h>
+#include <vespa/vespalib/util/regexp.h>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
 
 
 namespace search::attribute {
@@ -31,10 +35,55 @@ to_dfa_type(FMA algorithm)
     }
 }
 
+/*
+ * 'k' and 's' take part in multi-codepoint Unicode fold orbits
+ * (U+212A KELVIN SIGN and U+017F LATIN SMALL LETTER LONG S), so a
+ * bytewise case-insensitive probe for them could reject candidates
+ * that the regex engine would match.
+ */
+bool
+safe_for_uncased_probe(char c)
+{
+    auto uc = static_cast<unsigned char>(c);
+    return (uc < 0x80) && (std::tolower(uc) != 'k') && (std::tolower(uc) != 's');
+}
+
+bool
+starts_with_uncased(const char * src, const vespalib::string & needle)
+{
+    for (size_t i = 0; i < needle.size(); ++i) {
+        if (std::tolower(static_cast<unsigned char>(src[i])) != needle[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+contains_uncased(const char * src, const vespalib::string & needle)
+{
+    for (;; ++src) {
+        size_t i = 0;
+        while ((i < needle.size()) &&
+               (std::tolower(static_cast<unsigned char>(src[i])) == needle[i]))
+        {
+            ++i;
+        }
+        if (i == needle.size()) {
+            return true;
+        }
+        if (*src == '\0') {
+            return false;
+        }
+    }
+}
+
 }
 
 StringSearchHelper::StringSearchHelper(QueryTermUCS4 & term, bool cased, vespalib::FuzzyMatchingAlgorithm fuzzy_matching_algorithm)
     : _regex(),
+      _regexRequired(),
+      _regexLiteral(),
       _fuzzyMatcher(),
       _dfa_fuzzy_matcher(),
       _term(),
@@ -42,12 +91,42 @@ StringSearchHelper::StringSearchHelper(QueryTermUCS4 & term, bool cased, vespali
       _isPrefix(term.isPrefix()),
       _isRegex(term.isRegex()),
       _isCased(cased),
-      _isFuzzy(term.isFuzzy())
+      _isFuzzy(term.isFuzzy()),
+      _regexIsLiteral(false),
+      _regexAnchoredStart(false),
+      _regexAnchoredEnd(false)
 {
     if (isRegex()) {
+        vespalib::string literal;
+        if (vespalib::RegexpUtil::get_literal(term.getTerm(), literal, _regexAnchoredStart, _regexAnchoredEnd) &&
+            (isCased() || std::all_of(literal.begin(), literal.end(), safe_for_uncased_probe)))
+        {
+            // Pure literal pattern (notably substring and suffix match
+            // modes); match with plain string comparison and skip the
+            // regex engine entirely.
+            if (!isCased()) {
+                for (char & c : literal) {
+                    c = std::tolower(static_cast<unsigned char>(c));
+                }
+            }
+            _regexLiteral = std::move(literal);
+            _regexIsLiteral = true;
+            return;
+        }
         _regex = (isCased())
                 ? vespalib::Regex::from_pattern(term.getTerm(), vespalib::Regex::Options::None)
                 : vespalib::Regex::from_pattern(term.getTerm(), vespalib::Regex::Options::IgnoreCase);
+        vespalib::string required(vespalib::RegexpUtil::get_required_substring(term.getTerm()));
+        if (isCased()) {
+            _regexRequired = required;
+        } else if (!required.empty() &&
+                   std::all_of(required.begin(), required.end(), safe_for_uncased_probe))
+        {
+            _regexRequired.reserve(required.size());
+            for (char c : required) {
+                _regexRequired.push_back(std::tolower(static_cast<unsigned char>(c)));
+            }
+        }
     } else if (isFuzzy()) {
         const auto max_edit_dist = term.fuzzy_max_edit_distance();
         _fuzzyMatcher = std::make_unique<vespalib::FuzzyMatcher>(term.getTerm(),
@@ -56,7 +135,7 @@ StringSearchHelper::StringSearchHelper(QueryTermUCS4 & term, bool cased, vespali
                                                                  isCased(),
                                                                  term.fuzzy_prefix_match());
         if ((fuzzy_matching_algorithm != FMA::BruteForce) &&
-            (max_edit_dist > 0 && max_edit_dist <= 2)) {
+            (max_edit_dist > 0 && max_edit_dist <= 3)) {
             _dfa_fuzzy_matcher = std::make_unique<DfaFuzzyMatcher>(term.getTerm(),
                                                                    max_edit_dist,
                                                                    term.fuzzy_prefix_lock_length(),
@@ -79,7 +158,7 @@ StringSearchHelper::~StringSearchHelper() = default;
 bool
 StringSearchHelper::isMatch(const char *src) const noexcept {
     if (__builtin_expect(isRegex(), false)) {
-        return getRegex().valid() && getRegex().partial_match(std::string_view(src));
+        return is_regex_match(src);
     }
     if (__builtin_expect(isFuzzy(), false)) {
         return _dfa_fuzzy_matcher ? _dfa_fuzzy_matcher->is_match(std::string_view(src))
@@ -102,6 +181,45 @@ StringSearchHelper::isMatch(const char *src) const noexcept {
     return (_ucs4[j] == 0 && (val == 0 || isPrefix()));
 }
 
+bool
+StringSearchHelper::is_regex_match(const char *src) const noexcept
+{
+    if (_regexIsLiteral) {
+        return is_literal_match(src);
+    }
+    if (!_regexRequired.empty()) {
+        bool found = isCased() ? (strstr(src, _regexRequired.c_str()) != nullptr)
+                               : contains_uncased(src, _regexRequired);
+        if (!found) {
+            return false;
+        }
+    }
+    return _regex.valid() && _regex.partial_match(std::string_view(src));
+}
+
+bool
+StringSearchHelper::is_literal_match(const char *src) const noexcept
+{
+    if (_regexAnchoredEnd) {
+        size_t len = strlen(src);
+        if (len < _regexLiteral.size()) {
+            return false;
+        }
+        const char *tail = src + len - _regexLiteral.size();
+        if (_regexAnchoredStart && (len != _regexLiteral.size())) {
+            return false;
+        }
+        return isCased() ? (memcmp(tail, _regexLiteral.data(), _regexLiteral.size()) == 0)
+                         : starts_with_uncased(tail, _regexLiteral);
+    }
+    if (_regexAnchoredStart) {
+        return isCased() ? (strncmp(src, _regexLiteral.c_str(), _regexLiteral.size()) == 0)
+                         : starts_with_uncased(src, _regexLiteral);
+    }
+    return isCased() ? (strstr(src, _regexLiteral.c_str()) != nullptr)
+                     : contains_uncased(src, _regexLiteral);
+}
+
 template <typename DictionaryConstIteratorType>
 bool
 StringSearchHelper::is_fuzzy_match(const char* word, DictionaryConstIteratorType& itr, const DfaStringComparator::DataStoreType& data_store) const
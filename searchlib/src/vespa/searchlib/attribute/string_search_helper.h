@@ -5,6 +5,7 @@
 #include "dfa_string_comparator.h"
 #include <vespa/vespalib/fuzzy/fuzzy_matching_algorithm.h>
 #include <vespa/vespalib/regex/regex.h>
+#include <vespa/vespalib/stllike/string.h>
 
 namespace vespalib { class FuzzyMatcher; }
 namespace search { class QueryTermUCS4; }
@@ -27,6 +28,15 @@ public:
     StringSearchHelper & operator =(const StringSearchHelper &) = delete;
     ~StringSearchHelper();
     bool isMatch(const char *src) const noexcept;
+    /**
+     * Match src against the regex, first probing for a literal substring
+     * required by the pattern so that most non-matching candidates are
+     * rejected without entering the regex engine. Patterns that are pure
+     * literals (notably the escaped expressions substring and suffix
+     * match modes are rewritten to) are matched with plain string
+     * comparison without a regex engine at all.
+     */
+    bool is_regex_match(const char *src) const noexcept;
     bool isPrefix() const noexcept { return _isPrefix; }
     bool isRegex() const noexcept { return _isRegex; }
     bool isCased() const noexcept { return _isCased; }
@@ -39,7 +49,11 @@ public:
 
 private:
     using ucs4_t = uint32_t;
+    VESPA_DLL_LOCAL bool is_literal_match(const char *src) const noexcept;
+
     vespalib::Regex                _regex;
+    vespalib::string               _regexRequired;
+    vespalib::string               _regexLiteral;
     std::unique_ptr<FuzzyMatcher>  _fuzzyMatcher;
     std::unique_ptr<DfaFuzzyMatcher> _dfa_fuzzy_matcher;
     std::unique_ptr<ucs4_t[]>      _ucs4;
@@ -49,6 +63,9 @@ private:
     bool                           _isRegex;
     bool                           _isCased;
     bool                           _isFuzzy;
+    bool                           _regexIsLiteral;
+    bool                           _regexAnchoredStart;
+    bool                           _regexAnchoredEnd;
 };
 
 }
@@ -78,6 +78,7 @@ public:
 private:
     void initRange(uint32_t begin, uint32_t end) override;
     void doSeek(uint32_t docId) override;
+    uint32_t seek_block(uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity) override;
     Trinary is_strict() const override { return Trinary::True; }
     uint32_t getNextBit(uint32_t docId) const noexcept {
         return inverse ? this->_bv.getNextFalseBit(docId) : this->_bv.getNextTrueBit(docId);
@@ -110,6 +111,30 @@ BitVectorIteratorStrictT<inverse>::doSeek(uint32_t docId)
     }
 }
 
+template<bool inverse>
+uint32_t
+BitVectorIteratorStrictT<inverse>::seek_block(uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity)
+{
+    uint32_t cnt = 0;
+    uint32_t docId = std::max(begin_id, this->getDocId());
+    uint32_t limit = std::min(end_id, this->_docIdLimit);
+    if (__builtin_expect(docId >= this->_docIdLimit, false)) {
+        this->setAtEnd();
+        return 0;
+    }
+    docId = getFirstBit(docId);
+    while ((docId < limit) && (cnt < capacity)) {
+        hits[cnt++] = docId;
+        docId = getNextBit(docId + 1);
+    }
+    if (docId >= this->_docIdLimit) {
+        this->setAtEnd();
+    } else {
+        this->setDocId(docId);
+    }
+    return cnt;
+}
+
 template<bool inverse>
 void
 BitVectorIteratorStrictT<inverse>::initRange(uint32_t begin, uint32_t end)
@@ -3,6 +3,7 @@
 #include "sortresults.h"
 #include "sort.h"
 #include <vespa/searchcommon/attribute/iattributecontext.h>
+#include <vespa/vespalib/stllike/hash_map.hpp>
 #include <vespa/vespalib/util/array.h>
 #include <vespa/vespalib/util/issue.h>
 
@@ -218,12 +219,23 @@ FastS_SortSpec::initSortData(const RankedHit *hits, uint32_t n)
     }
     _binarySortData.resize((fixedWidth + variableWidth) * n);
     _sortDataArray.resize(n);
+    _enumCaches.resize(_vectors.size());
+
+    std::vector<EnumBlobCache *> caches(_vectors.size(), nullptr);
+    for (size_t v(0); v < _vectors.size(); ++v) {
+        const auto & vec = _vectors[v];
+        if ((vec._type <= DESC_VECTOR) && (vec._vector->getFixedWidth() == 0) &&
+            !vec._vector->hasMultiValue() && vec._vector->hasEnum())
+        {
+            caches[v] = &_enumCaches[v];
+        }
+    }
 
     size_t offset = 0;
     for (uint32_t i(0), idx(0); (i < n) && !_doom.hard_doom(); ++i) {
         uint32_t len = 0;
-        for (const auto & vec : _vectors) {
-            int written = initSortData(vec, hits[i], offset);
+        for (size_t v(0); v < _vectors.size(); ++v) {
+            int written = initSortData(_vectors[v], caches[v], hits[i], offset);
             offset += written;
             len += written;
         }
@@ -237,8 +249,31 @@ FastS_SortSpec::initSortData(const RankedHit *hits, uint32_t n)
     }
 }
 
+long
+FastS_SortSpec::serializeThroughCache(const VectorRef & vec, EnumBlobCache & cache, const RankedHit & hit,
+                                      uint8_t * serTo, uint32_t available)
+{
+    uint32_t e = vec._vector->getEnum(hit.getDocId());
+    auto found = cache.find(e);
+    if (found == cache.end()) {
+        long written = (vec._type == ASC_VECTOR)
+                ? vec._vector->serializeForAscendingSort(hit.getDocId(), serTo, available, vec._converter)
+                : vec._vector->serializeForDescendingSort(hit.getDocId(), serTo, available, vec._converter);
+        if (written >= 0) {
+            cache[e] = std::vector<uint8_t>(serTo, serTo + written);
+        }
+        return written;
+    }
+    const std::vector<uint8_t> & blob = found->second;
+    if (blob.size() > available) {
+        return -1;
+    }
+    memcpy(serTo, blob.data(), blob.size());
+    return blob.size();
+}
+
 int
-FastS_SortSpec::initSortData(const VectorRef & vec, const RankedHit & hit, size_t offset) {
+FastS_SortSpec::initSortData(const VectorRef & vec, EnumBlobCache * cache, const RankedHit & hit, size_t offset) {
     long written(0);
     do {
         uint8_t * mySortData = _binarySortData.data() + offset;
@@ -277,10 +312,14 @@ FastS_SortSpec::initSortData(const VectorRef & vec, const RankedHit & hit, size_
                 written = serializeForSort<convertForSort<search::HitRank, false> >(hit.getRank(), mySortData, available);
                 break;
             case ASC_VECTOR:
-                written = vec._vector->serializeForAscendingSort(hit.getDocId(), mySortData, available, vec._converter);
-                break;
             case DESC_VECTOR:
-                written = vec._vector->serializeForDescendingSort(hit.getDocId(), mySortData, available, vec._converter);
+                if (cache != nullptr) {
+                    written = serializeThroughCache(vec, *cache, hit, mySortData, available);
+                } else if (vec._type == ASC_VECTOR) {
+                    written = vec._vector->serializeForAscendingSort(hit.getDocId(), mySortData, available, vec._converter);
+                } else {
+                    written = vec._vector->serializeForDescendingSort(hit.getDocId(), mySortData, available, vec._converter);
+                }
                 break;
         }
         if (written < 0) {
@@ -354,6 +393,7 @@ FastS_SortSpec::copySortData(uint32_t offset, uint32_t n,
 void
 FastS_SortSpec::freeSortData()
 {
+    _enumCaches.clear();
     {
         BinarySortData tmp;
         _binarySortData.swap(tmp);
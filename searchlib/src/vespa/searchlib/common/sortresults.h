@@ -5,6 +5,7 @@
 #include "rankedhit.h"
 #include "sortspec.h"
 #include <vespa/vespalib/stllike/allocator.h>
+#include <vespa/vespalib/stllike/hash_map.h>
 #include <vespa/vespalib/util/doom.h>
 
 #define INSERT_SORT_LEVEL 80
@@ -95,18 +96,27 @@ private:
     using BinarySortData = std::vector<uint8_t, vespalib::allocator_large<uint8_t>>;
     using SortDataArray = std::vector<SortData, vespalib::allocator_large<SortData>>;
     using ConverterFactory = search::common::ConverterFactory;
+    // Cache of serialized sort blobs for enumerated single value string
+    // attributes, keyed by enum handle. Duplicate values (the common
+    // case when sorting many hits on a low cardinality field) then pay
+    // the converter and serialization cost only once per distinct value
+    // instead of once per hit.
+    using EnumBlobCache = vespalib::hash_map<uint32_t, std::vector<uint8_t>>;
     vespalib::string         _documentmetastore;
     uint16_t                 _partitionId;
     vespalib::Doom           _doom;
     const ConverterFactory & _ucaFactory;
     search::common::SortSpec _sortSpec;
     VectorRefList            _vectors;
+    std::vector<EnumBlobCache> _enumCaches;
     BinarySortData           _binarySortData;
     SortDataArray            _sortDataArray;
 
     bool Add(search::attribute::IAttributeContext & vecMan, const search::common::SortInfo & sInfo);
     void initSortData(const search::RankedHit *a, uint32_t n);
-    int initSortData(const VectorRef & vec, const search::RankedHit & hit, size_t offset);
+    int initSortData(const VectorRef & vec, EnumBlobCache * cache, const search::RankedHit & hit, size_t offset);
+    long serializeThroughCache(const VectorRef & vec, EnumBlobCache & cache, const search::RankedHit & hit,
+                               uint8_t * serTo, uint32_t available);
 
 public:
     FastS_SortSpec(const FastS_SortSpec &) = delete;
@@ -52,6 +52,7 @@ DiskIndex::DiskIndex(const vespalib::string &indexDir, size_t cacheSize)
       _schema(),
       _postingFiles(),
       _bitVectorDicts(),
+      _readCounters(),
       _dicts(),
       _tuneFileSearch(),
       _cache(*this, cacheSize),
@@ -139,6 +140,7 @@ DiskIndex::openField(const vespalib::string &fieldDir,
     }
     _postingFiles.push_back(pFile);
     _bitVectorDicts.push_back(bDict);
+    _readCounters.push_back(std::make_unique<FieldReadCounters>());
     return true;
 }
 
@@ -186,6 +188,7 @@ DiskIndex::setup(const TuneFileSearch &tuneFileSearch, const DiskIndex &old)
             uint32_t oldPacked = oItr.getIndex();
             _postingFiles.push_back(old._postingFiles[oldPacked]);
             _bitVectorDicts.push_back(old._bitVectorDicts[oldPacked]);
+            _readCounters.push_back(std::make_unique<FieldReadCounters>());
         }
     }
     _tuneFileSearch = tuneFileSearch;
@@ -300,9 +303,25 @@ DiskIndex::readPostingList(const LookupResult &lookupRes) const
     const uint32_t firstSegment = 0;
     const uint32_t numSegments = 0; // means all segments
     handle->_file->readPostingList(lookupRes.counts, firstSegment, numSegments,*handle);
+    FieldReadCounters &counters = *_readCounters[it.getIndex()];
+    counters._count.fetch_add(1, std::memory_order_relaxed);
+    counters._bytes.fetch_add((lookupRes.counts._bitLength + 7) >> 3, std::memory_order_relaxed);
     return handle;
 }
 
+DiskIndex::FieldReadStats
+DiskIndex::getFieldReadStats(uint32_t indexId) const
+{
+    SchemaUtil::IndexIterator it(_schema, indexId);
+    uint32_t fieldId = it.getIndex();
+    if (fieldId >= _readCounters.size()) {
+        return {0u, 0u};
+    }
+    const FieldReadCounters &counters = *_readCounters[fieldId];
+    return {counters._count.load(std::memory_order_relaxed),
+            counters._bytes.load(std::memory_order_relaxed)};
+}
+
 BitVector::UP
 DiskIndex::readBitVector(const LookupResult &lookupRes) const
 {
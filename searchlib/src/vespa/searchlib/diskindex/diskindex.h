@@ -10,6 +10,7 @@
 #include <vespa/searchcommon/common/schema.h>
 #include <vespa/vespalib/stllike/string.h>
 #include <vespa/vespalib/stllike/cache.h>
+#include <atomic>
 
 namespace search::diskindex {
 
@@ -43,6 +44,18 @@ public:
     using LookupResultVector = std::vector<LookupResult>;
     using IndexList = std::vector<uint32_t>;
 
+    /**
+     * Snapshot of posting list read activity for a single field.
+     *
+     * The counters show which field directories are hot. A field
+     * directory can be a symbolic link, so frequently read fields can
+     * be placed on faster storage than the rest of the index.
+     **/
+    struct FieldReadStats {
+        uint64_t read_count;
+        uint64_t read_bytes;
+    };
+
     class Key {
     public:
         Key() noexcept;
@@ -72,11 +85,18 @@ private:
     using DiskPostingFileDynamicKReal = ZcPosOccRandRead;
     using Cache = vespalib::cache<vespalib::CacheParam<vespalib::LruParam<Key, LookupResultVector>, DiskIndex>>;
 
+    struct FieldReadCounters {
+        std::atomic<uint64_t> _count;
+        std::atomic<uint64_t> _bytes;
+        FieldReadCounters() noexcept : _count(0), _bytes(0) { }
+    };
+
     vespalib::string                       _indexDir;
     size_t                                 _cacheSize;
     index::Schema                          _schema;
     std::vector<DiskPostingFile::SP>       _postingFiles;
     std::vector<BitVectorDictionary::SP>   _bitVectorDicts;
+    std::vector<std::unique_ptr<FieldReadCounters>> _readCounters;
     std::vector<std::unique_ptr<index::DictionaryFileRandRead>> _dicts;
     TuneFileSearch                         _tuneFileSearch;
     Cache                                  _cache;
@@ -149,6 +169,13 @@ public:
     const index::Schema &getSchema() const { return _schema; }
     const vespalib::string &getIndexDir() const { return _indexDir; }
 
+    /**
+     * Get posting list read statistics for the given field.
+     *
+     * @param indexId the id of the field to get statistics for.
+     */
+    FieldReadStats getFieldReadStats(uint32_t indexId) const;
+
     /**
      * Needed for the Cache::BackingStore interface.
      */
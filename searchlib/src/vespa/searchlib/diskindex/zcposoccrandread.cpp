@@ -3,7 +3,9 @@
 #include "zcposoccrandread.h"
 #include "zcposocciterators.h"
 #include <vespa/vespalib/data/fileheader.h>
+#include <vespa/vespalib/util/size_literals.h>
 #include <vespa/searchlib/queryeval/emptysearch.h>
+#include <vespa/searchlib/util/file_range_heatmap.h>
 #include <vespa/fastos/file.h>
 #include <cassert>
 
@@ -29,6 +31,11 @@ vespalib::string myId4("Zc.4");
 vespalib::string myId5("Zc.5");
 vespalib::string interleaved_features("interleaved_features");
 
+// Posting lists at least this large get an explicit readahead hint
+// when memory mapped; shorter ones are served well enough by demand
+// paging and do not warrant the extra syscall.
+constexpr uint64_t MIN_READAHEAD_HINT_BYTES = 64_Ki;
+
 }
 
 namespace search::diskindex {
@@ -37,6 +44,7 @@ using vespalib::getLastErrorString;
 
 ZcPosOccRandRead::ZcPosOccRandRead()
     : _file(std::make_unique<FastOS_File>()),
+      _range_tracker(),
       _fileSize(0),
       _posting_params(64, 1 << 30, 10000000, true, true, false),
       _numWords(0),
@@ -105,11 +113,22 @@ ZcPosOccRandRead::readPostingList(const PostingListCounts &counts,
     // Align start at 64-bit boundary
     startOffset -= (startOffset & 7);
 
+    if (_range_tracker) {
+        _range_tracker->note_access(startOffset, (handle._bitLength + 7) >> 3);
+    }
+
     void *mapPtr = _file->MemoryMapPtr(startOffset);
     if (mapPtr != nullptr) {
         handle._mem = mapPtr;
         handle._allocMem = nullptr;
         handle._allocSize = 0;
+        // Long postings are consumed sequentially by the iterator;
+        // tell the OS to start readahead for them right away.
+        uint64_t byteLength = (handle._bitLength + 7) >> 3;
+        if (byteLength >= MIN_READAHEAD_HINT_BYTES) {
+            _file->memoryMapAdvise(startOffset, byteLength,
+                                   FastOS_FileInterface::MemoryMapAdvice::WILLNEED);
+        }
     } else {
         uint64_t endOffset = (handle._bitOffset + _headerBitSize +
                               handle._bitLength + 7) >> 3;
@@ -167,6 +186,7 @@ open(const vespalib::string &name, const TuneFileRandRead &tuneFileRead)
         return false;
     }
     _fileSize = _file->getSize();
+    _range_tracker = FileRangeHeatmap::instance().track_file(name);
 
     readHeader();
     return true;
@@ -176,6 +196,7 @@ open(const vespalib::string &name, const TuneFileRandRead &tuneFileRead)
 bool
 ZcPosOccRandRead::close()
 {
+    _range_tracker.reset();
     return _file->Close();
 }
 
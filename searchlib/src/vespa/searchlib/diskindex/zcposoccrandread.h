@@ -9,12 +9,15 @@
 #include <vespa/searchlib/fef/termfieldmatchdataarray.h>
 #include "zc4_posting_params.h"
 
+namespace search { class FileRangeTracker; }
+
 namespace search::diskindex {
 
 class ZcPosOccRandRead : public index::PostingListFileRandRead
 {
 protected:
     std::unique_ptr<FastOS_FileInterface> _file;
+    std::shared_ptr<FileRangeTracker> _range_tracker;
     uint64_t         _fileSize;
     Zc4PostingParams _posting_params;
     uint64_t _numWords;     // Number of words in file
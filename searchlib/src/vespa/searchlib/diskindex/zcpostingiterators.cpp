@@ -200,6 +200,9 @@ ZcPostingIteratorBase::ZcPostingIteratorBase(TermFieldMatchDataArray matchData,
       _l3(),
       _l4(),
       _chunk(),
+      _block_docids(),
+      _block_len(0),
+      _block_pos(0),
       _featuresSize(0),
       _hasMore(false),
       _decode_normal_features(decode_normal_features),
@@ -326,6 +329,7 @@ ZcPostingIterator<bigEndian>::readWordStart(uint32_t docIdLimit)
     _featuresBitOffset = d.getBitOffset();
     _featureSeekPos = 0;
     clearUnpacked();
+    resetDocIdBlock();
     // Unpack first docid delta in chunk
     nextDocId(prevDocId);
 #if DEBUG_ZCPOSTING_PRINTF
@@ -351,6 +355,27 @@ ZcPostingIteratorBase::doChunkSkipSeek(uint32_t docId)
 }
 
 
+void
+ZcPostingIteratorBase::fillDocIdBlock(uint32_t prevDocId)
+{
+    // Decode docid deltas in one tight pass, producing a contiguous
+    // docid array. The next L1 skip docid bounds the decode; it is a
+    // docid present in the stream, so the loop never reads beyond the
+    // docid area for this chunk.
+    const uint8_t *oCompr = _valI;
+    uint32_t docId = prevDocId;
+    uint32_t bound = _l1._skipDocId;
+    uint32_t len = 0;
+    while ((docId < bound) && (len < DOCID_BLOCK_SIZE)) {
+        ZCDECODE(oCompr, docId += 1 +);
+        _block_docids[len++] = docId;
+    }
+    _valI = oCompr;
+    _block_len = len;
+    _block_pos = 0;
+}
+
+
 void
 ZcPostingIteratorBase::doL4SkipSeek(uint32_t docId)
 {
@@ -496,6 +521,7 @@ void
 ZcPostingIteratorBase::doL1SkipSeek(uint32_t docId)
 {
     uint32_t lastL1SkipDocId;
+    resetDocIdBlock();
     if (__builtin_expect(docId > _l2._skipDocId, false)) {
         doL2SkipSeek(docId);
         if (docId <= _l1._skipDocId) {
@@ -544,6 +570,28 @@ ZcPostingIteratorBase::doSeek(uint32_t docId)
     assert(oDocId <= _l4._skipDocId);
     assert(docId <= _l4._skipDocId);
 #endif
+    if (!_decode_interleaved_features) {
+        // Block decode path: decode deltas in bulk, then locate the
+        // target with a branch-free lower bound in the decoded array.
+        while (__builtin_expect(oDocId < docId, true)) {
+            if (_block_pos == _block_len) {
+                fillDocIdBlock(oDocId);
+            }
+            const uint32_t *base = &_block_docids[_block_pos];
+            uint32_t n = _block_len - _block_pos;
+            while (n > 1) {
+                uint32_t half = n >> 1;
+                base += (base[half - 1] < docId) ? half : 0;
+                n -= half;
+            }
+            uint32_t idx = base - _block_docids;
+            addNeedUnpack(idx + 1 - _block_pos);
+            oDocId = _block_docids[idx];
+            _block_pos = idx + 1;
+        }
+        setDocId(oDocId);
+        return;
+    }
     const uint8_t *oCompr = _valI;
     uint32_t field_length = _field_length;
     uint32_t num_occs = _num_occs;
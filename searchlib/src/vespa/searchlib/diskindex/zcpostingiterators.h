@@ -272,6 +272,15 @@ protected:
     L3Skip _l3;
     L4Skip _l4;
     ChunkSkip _chunk;
+    /*
+     * Block of docid deltas decoded in one tight pass, giving a
+     * contiguous docid array that doSeek() searches without further
+     * byte decoding. Must be reset whenever _valI is repositioned.
+     */
+    static constexpr uint32_t DOCID_BLOCK_SIZE = 32;
+    uint32_t _block_docids[DOCID_BLOCK_SIZE];
+    uint32_t _block_len;
+    uint32_t _block_pos;
     uint64_t _featuresSize;
     bool     _hasMore;
     bool     _decode_normal_features;
@@ -291,6 +300,11 @@ protected:
             ZCDECODE(_valI, _num_occs = 1 +);
         }
     }
+    void resetDocIdBlock() {
+        _block_len = 0;
+        _block_pos = 0;
+    }
+    VESPA_DLL_LOCAL void fillDocIdBlock(uint32_t prevDocId);
     virtual void featureSeek(uint64_t offset) = 0;
     VESPA_DLL_LOCAL void doChunkSkipSeek(uint32_t docId);
     VESPA_DLL_LOCAL void doL4SkipSeek(uint32_t docId);
@@ -4,6 +4,7 @@
 #include "data_store_file_chunk_stats.h"
 #include "summaryexceptions.h"
 #include "randreaders.h"
+#include <vespa/searchlib/util/file_range_heatmap.h>
 #include <vespa/searchlib/util/filekit.h>
 #include <vespa/vespalib/util/lambdatask.h>
 #include <vespa/vespalib/data/fileheader.h>
@@ -77,6 +78,7 @@ FileChunk::FileChunk(FileId fileId, NameId nameId, const vespalib::string & base
       _tune(tune),
       _dataFileName(createDatFileName(_name)),
       _idxFileName(createIdxFileName(_name)),
+      _range_tracker(FileRangeHeatmap::instance().track_file(_dataFileName)),
       _chunkInfo(),
       _lastPersistedSerialNum(0),
       _dataHeaderLen(0u),
@@ -338,7 +340,18 @@ void
 FileChunk::read(LidInfoWithLidV::const_iterator begin, size_t count, IBufferVisitor & visitor) const
 {
     if (count == 0) { return; }
+    // Start readahead for all but the first chunk; they are consumed
+    // after earlier chunks have been read and decompressed.
     uint32_t prevChunk = begin->getChunkId();
+    for (size_t i(1); i < count; i++) {
+        const LidInfoWithLid & li = *(begin + i);
+        if (li.getChunkId() != prevChunk) {
+            const ChunkInfo & ci = _chunkInfo[li.getChunkId()];
+            _file->prefetch(ci.getOffset(), ci.getSize());
+            prevChunk = li.getChunkId();
+        }
+    }
+    prevChunk = begin->getChunkId();
     uint32_t start(0);
     for (size_t i(0); i < count; i++) {
         const LidInfoWithLid & li = *(begin + i);
@@ -382,6 +395,7 @@ FileChunk::read(uint32_t lid, SubChunkId chunkId, const ChunkInfo & chunkInfo,
                 vespalib::DataBuffer & buffer) const
 {
     vespalib::DataBuffer whole(0ul, ALIGNMENT);
+    _range_tracker->note_access(chunkInfo.getOffset(), chunkInfo.getSize());
     FileRandRead::FSP keepAlive(_file->read(chunkInfo.getOffset(), whole, chunkInfo.getSize()));
     Chunk chunk(chunkId, whole.getData(), whole.getDataLen());
     return chunk.read(lid, buffer);
@@ -476,6 +490,31 @@ FileChunk::verify(bool reportOnly) const
     }
 }
 
+bool
+FileChunk::verifyChunk(uint32_t chunkId, size_t & bytesRead) const
+{
+    const ChunkInfo & ci = _chunkInfo[chunkId];
+    vespalib::DataBuffer whole(0ul, ALIGNMENT);
+    FileRandRead::FSP keepAlive(_file->read(ci.getOffset(), whole, ci.getSize()));
+    bytesRead = whole.getDataLen();
+    try {
+        Chunk chunk(chunkId, whole.getData(), whole.getDataLen());
+        if (chunk.getLastSerial() != ci.getLastSerial()) {
+            LOG(error,
+                "Chunk %u/%zu in file '%s' has last serial number %" PRIu64 " in the '.dat' file,"
+                " while the '.idx' file says %" PRIu64,
+                chunkId, _chunkInfo.size(), _name.c_str(), chunk.getLastSerial(), ci.getLastSerial());
+            return false;
+        }
+    } catch (const std::exception & e) {
+        LOG(error,
+            "Chunk %u/%zu in file '%s' at offset %" PRIu64 " with size %u is corrupt. Got Exception : %s",
+            chunkId, _chunkInfo.size(), _name.c_str(), ci.getOffset(), ci.getSize(), e.what());
+        return false;
+    }
+    return true;
+}
+
 uint32_t
 FileChunk::getNumChunks() const
 {
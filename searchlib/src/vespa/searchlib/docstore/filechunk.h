@@ -13,6 +13,8 @@
 #include <vespa/vespalib/util/memoryusage.h>
 #include <vespa/vespalib/util/time.h>
 
+namespace search { class FileRangeTracker; }
+
 class FastOS_FileInterface;
 
 namespace vespalib {
@@ -182,6 +184,15 @@ public:
      * @param reportOnly If set inconsitencies will be written to 'stderr'.
      */
     void verify(bool reportOnly) const;
+    /**
+     * Read a single chunk from disk and verify its integrity, reporting
+     * any corruption to the log.
+     *
+     * @param chunkId   The chunk to verify, must be less than getNumChunks().
+     * @param bytesRead Set to the number of bytes read from disk.
+     * @return False if the chunk is corrupt.
+     */
+    bool verifyChunk(uint32_t chunkId, size_t & bytesRead) const;
 
     uint32_t      getNumChunks() const;
     size_t       getNumBuckets() const { return _sumNumBuckets; }
@@ -253,6 +264,7 @@ protected:
     TuneFileSummary        _tune;
     vespalib::string       _dataFileName;
     vespalib::string       _idxFileName;
+    std::shared_ptr<FileRangeTracker> _range_tracker;
     ChunkInfoVector        _chunkInfo;
     std::atomic<uint64_t>  _lastPersistedSerialNum;
     uint32_t               _dataHeaderLen;
@@ -991,6 +991,49 @@ LogDataStore::verify(bool reportOnly) const
     }
 }
 
+LogDataStore::ScrubResult
+LogDataStore::scrub(size_t maxBytesPerSec)
+{
+    ScrubResult result;
+    vespalib::steady_time start = vespalib::steady_clock::now();
+    size_t bytesScrubbed(0);
+    for (size_t i(0); i < _fileChunks.size(); i++) {
+        const FileChunk * fc(nullptr);
+        std::unique_ptr<FileChunkHolder> holder;
+        {
+            MonitorGuard guard(_updateLock);
+            fc = _fileChunks[i].get();
+            if ((fc == nullptr) || ! fc->frozen()) continue;
+            holder = holdFileChunk(guard, FileId(i));
+        }
+        // The file is frozen and held, so it can be read without the
+        // update lock while compaction is prevented from dropping it.
+        ScrubStats stats(fc->getName(), fc->getNumChunks());
+        for (uint32_t chunkId(0); chunkId < stats.numChunks; chunkId++) {
+            size_t bytesRead(0);
+            if ( ! fc->verifyChunk(chunkId, bytesRead)) {
+                stats.numBadChunks++;
+            }
+            bytesScrubbed += bytesRead;
+            if (maxBytesPerSec > 0) {
+                vespalib::duration budget = vespalib::from_s(double(bytesScrubbed) / maxBytesPerSec);
+                vespalib::duration used = vespalib::steady_clock::now() - start;
+                if (budget > used) {
+                    std::this_thread::sleep_for(budget - used);
+                }
+            }
+        }
+        if (stats.numBadChunks > 0) {
+            LOG(error, "Scrub found %u corrupt chunks of %u in file '%s'",
+                stats.numBadChunks, stats.numChunks, stats.fileName.c_str());
+        }
+        result.push_back(std::move(stats));
+    }
+    LOG(debug, "Scrubbed %ld bytes in %ld files in %1.3f seconds",
+        bytesScrubbed, result.size(), vespalib::to_s(vespalib::steady_clock::now() - start));
+    return result;
+}
+
 class LogDataStore::WrapVisitor : public IWriteData
 {
     IDataStoreVisitor &_visitor;
@@ -129,6 +129,27 @@ public:
      */
     void verify(bool reportOnly) const;
 
+    struct ScrubStats {
+        ScrubStats(const vespalib::string & fileName_, uint32_t numChunks_) noexcept
+            : fileName(fileName_), numChunks(numChunks_), numBadChunks(0) { }
+        vespalib::string fileName;
+        uint32_t         numChunks;
+        uint32_t         numBadChunks;
+    };
+    using ScrubResult = std::vector<ScrubStats>;
+
+    /**
+     * Verify the chunk content of all frozen files while the data store
+     * remains online. Unlike verify() the update lock is only held briefly
+     * per file, while compaction is prevented from dropping the file
+     * currently being read. The active file is skipped as its content is
+     * still being written.
+     *
+     * @param maxBytesPerSec Upper bound on read bandwidth, 0 means unbounded.
+     * @return Per-file chunk counts, including the number of corrupt chunks.
+     */
+    ScrubResult scrub(size_t maxBytesPerSec);
+
     /**
      * Visit all data found in data store.
      */
@@ -18,6 +18,15 @@ public:
     using FSP = std::shared_ptr<FastOS_FileInterface>;
     virtual ~FileRandRead() = default;
     virtual FSP read(size_t offset, vespalib::DataBuffer & buffer, size_t sz) = 0;
+    /**
+     * Hint that the given range will be read shortly, allowing the
+     * implementation to start readahead while earlier data is being
+     * processed. Default is to do nothing.
+     */
+    virtual void prefetch(size_t offset, size_t sz) {
+        (void) offset;
+        (void) sz;
+    }
     virtual int64_t getSize() const = 0;
 };
 
@@ -83,6 +83,12 @@ MMapRandRead::read(size_t offset, vespalib::DataBuffer & buffer, size_t sz)
     return FSP();
 }
 
+void
+MMapRandRead::prefetch(size_t offset, size_t sz)
+{
+    _file->memoryMapAdvise(offset, sz, FastOS_FileInterface::MemoryMapAdvice::WILLNEED);
+}
+
 int64_t
 MMapRandRead::getSize() const {
     return _file->getSize();
@@ -139,6 +145,15 @@ MMapRandReadDynamic::read(size_t offset, vespalib::DataBuffer & buffer, size_t s
     return file;
 }
 
+void
+MMapRandReadDynamic::prefetch(size_t offset, size_t sz)
+{
+    FSP file(_holder.get());
+    if ((file->MemoryMapPtr(offset) != nullptr) && contains(*file, offset + sz)) {
+        file->memoryMapAdvise(offset, sz, FastOS_FileInterface::MemoryMapAdvice::WILLNEED);
+    }
+}
+
 bool
 MMapRandReadDynamic::contains(const FastOS_FileInterface & file, size_t sz) {
     return (sz == 0) || (file.MemoryMapPtr(sz - 1) != nullptr);
@@ -28,6 +28,7 @@ class MMapRandRead : public FileRandRead
 public:
     MMapRandRead(const vespalib::string & fileName, int mmapFlags, int fadviseOptions);
     FSP read(size_t offset, vespalib::DataBuffer & buffer, size_t sz) override;
+    void prefetch(size_t offset, size_t sz) override;
     int64_t getSize() const override;
     const void * getMapping();
 private:
@@ -39,6 +40,7 @@ class MMapRandReadDynamic : public FileRandRead
 public:
     MMapRandReadDynamic(const vespalib::string & fileName, int mmapFlags, int fadviseOptions);
     FSP read(size_t offset, vespalib::DataBuffer & buffer, size_t sz) override;
+    void prefetch(size_t offset, size_t sz) override;
     int64_t getSize() const override;
 private:
     static bool contains(const FastOS_FileInterface & file, size_t sz);
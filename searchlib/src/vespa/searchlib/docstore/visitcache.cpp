@@ -157,6 +157,8 @@ using CacheParams = vespalib::CacheParam<
  * it will correctly invalidate the cached sets when objects are removed/updated.
  * It will also detect the addition of new objects to any of the sets upon first
  * usage of the set and then invalidate and perform fresh visit of the backing store.
+ * A request that is fully covered by an already cached set is served from that
+ * set instead of invalidating it.
  */
 class VisitCache::Cache : public vespalib::cache<CacheParams> {
 public:
@@ -173,6 +175,7 @@ private:
     using LidUniqueKeySetId = vespalib::hash_map<uint32_t, uint64_t>;
     using IdKeySetMap = vespalib::hash_map<uint64_t, KeySet>;
     IdSet findSetsContaining(const UniqueLock &, const KeySet & keys) const;
+    KeySet findSetContainingAll(const UniqueLock &, const KeySet & keys) const;
     void onInsert(const K & key) override;
     void onRemove(const K & key) override;
     LidUniqueKeySetId _lid2Id;
@@ -225,19 +228,44 @@ VisitCache::Cache::findSetsContaining(const UniqueLock &, const KeySet & keys) c
     return found;
 }
 
+KeySet
+VisitCache::Cache::findSetContainingAll(const UniqueLock &, const KeySet & keys) const {
+    // Any cached superset must also contain the smallest key, so there is
+    // at most one candidate to check.
+    const auto foundLid = _lid2Id.find(keys.getKeys().front());
+    if (foundLid != _lid2Id.end()) {
+        const auto foundKeySet = _id2KeySet.find(foundLid->second);
+        if ((foundKeySet != _id2KeySet.end()) && foundKeySet->second.contains(keys)) {
+            return foundKeySet->second;
+        }
+    }
+    return KeySet();
+}
+
 CompressedBlobSet
 VisitCache::Cache::readSet(const KeySet & key)
 {
-    if (!key.empty()) {
-        {
-            auto cacheGuard = getGuard();
-            if (!hasKey(cacheGuard, key)) {
+    if (key.empty()) {
+        return CompressedBlobSet();
+    }
+    KeySet superSet;
+    {
+        auto cacheGuard = getGuard();
+        if (!hasKey(cacheGuard, key)) {
+            superSet = findSetContainingAll(cacheGuard, key);
+            if (superSet.empty()) {
                 locateAndInvalidateOtherSubsets(cacheGuard, key);
             }
         }
-        return read(key);
     }
-    return CompressedBlobSet();
+    if (!superSet.empty()) {
+        // The cached set covers all requested lids and can serve the
+        // request directly since the caller only looks up the lids it
+        // asked for. Invalidating and refetching here would let large
+        // visits evict the sets serving smaller online requests.
+        return read(superSet);
+    }
+    return read(key);
 }
 
 void
@@ -472,17 +472,29 @@ WriteableFileChunk::computeChunkMeta(ProcessedChunkQ & chunks, size_t startPos,
 void
 WriteableFileChunk::writeData(const ProcessedChunkQ & chunks, size_t sz)
 {
+    if (chunks.size() == 1) {
+        // A single chunk is already aligned and padded, so it can be
+        // written as is without going through a coalescing buffer.
+        const vespalib::DataBuffer & buf = chunks.front()->getBuf();
+        writeToDisk(buf.getData(), buf.getDataLen());
+        return;
+    }
     vespalib::DataBuffer buf(0ul, _alignment);
     buf.ensureFree(sz);
     for (const auto & chunk : chunks) {
         buf.writeBytes(chunk->getBuf().getData(), chunk->getBuf().getDataLen());
     }
+    writeToDisk(buf.getData(), buf.getDataLen());
+}
 
+void
+WriteableFileChunk::writeToDisk(const void * data, size_t len)
+{
     std::lock_guard guard(_writeLock);
-    ssize_t wlen = _dataFile.Write2(buf.getData(), buf.getDataLen());
-    if (wlen != static_cast<ssize_t>(buf.getDataLen())) {
+    ssize_t wlen = _dataFile.Write2(data, len);
+    if (wlen != static_cast<ssize_t>(len)) {
         throw SummaryException(make_string("Failed writing %ld bytes to dat file. Only %ld written",
-                                           buf.getDataLen(), wlen),
+                                           len, wlen),
                                _dataFile, VESPA_STRLOC);
     }
     updateCurrentDiskFootprint();
@@ -99,6 +99,7 @@ private:
                                size_t offset, const ProcessedChunk & tmp, const Chunk & active);
     ChunkMetaV computeChunkMeta(ProcessedChunkQ & chunks, size_t startPos, size_t & sz, bool & done);
     void writeData(const ProcessedChunkQ & chunks, size_t sz);
+    void writeToDisk(const void * data, size_t len);
     void updateChunkInfo(const ProcessedChunkQ & chunks, const ChunkMetaV & cmetaV, size_t sz);
     void updateCurrentDiskFootprint();
     size_t getDiskFootprint(const unique_lock & guard) const;
@@ -8,6 +8,7 @@
 #include <vespa/fnet/frt/rpcrequest.h>
 #include <vespa/fnet/frt/supervisor.h>
 #include <vespa/vespalib/util/compressor.h>
+#include <vespa/vespalib/util/size_literals.h>
 #include <vespa/vespalib/data/databuffer.h>
 #include <vespa/searchlib/common/packets.h>
 
@@ -79,6 +80,51 @@ bool decode_message(const FRT_Values &src, MSG &dst) {
 
 //-----------------------------------------------------------------------------
 
+// Scoped protobuf arena used for the request/reply message trees built while
+// decoding and encoding rpc payloads. The first arena on a thread borrows a
+// thread-local initial block, so steady-state conversions reuse the same
+// memory instead of allocating a fresh message tree from the heap for every
+// rpc; if another arena is already live on the thread (decode and completion
+// can overlap on the same stack), we fall back to a plain heap-backed arena.
+// Messages created in the arena must not outlive it.
+class ProtoArena {
+public:
+    ProtoArena()
+        : _owns_block(!thread_block_in_use()),
+          _arena(_owns_block ? thread_block() : nullptr,
+                 _owns_block ? BLOCK_SIZE : 0)
+    {
+        if (_owns_block) {
+            thread_block_in_use() = true;
+        }
+    }
+    ~ProtoArena() {
+        if (_owns_block) {
+            thread_block_in_use() = false;
+        }
+    }
+    ProtoArena(const ProtoArena &) = delete;
+    ProtoArena &operator=(const ProtoArena &) = delete;
+    template <typename MSG>
+    MSG &create() {
+        return *::google::protobuf::Arena::Create<MSG>(&_arena);
+    }
+private:
+    static constexpr size_t BLOCK_SIZE = 64_Ki;
+    static char *thread_block() {
+        thread_local auto block = std::make_unique<char[]>(BLOCK_SIZE);
+        return block.get();
+    }
+    static bool &thread_block_in_use() {
+        thread_local bool in_use = false;
+        return in_use;
+    }
+    bool                       _owns_block;
+    ::google::protobuf::Arena  _arena;
+};
+
+//-----------------------------------------------------------------------------
+
 struct SearchRequestDecoder : SearchRequest::Source::Decoder {
     FRT_RPCRequest &rpc; // valid until Return is called
     QueryStats &stats;
@@ -86,7 +132,8 @@ struct SearchRequestDecoder : SearchRequest::Source::Decoder {
     SearchRequestDecoder(FRT_RPCRequest &rpc_in, QueryStats &stats_in)
         : rpc(rpc_in), stats(stats_in), relative_time(std::make_unique<SteadyClock>()) {}
     std::unique_ptr<SearchRequest> decode() override {
-        ProtoSearchRequest msg;
+        ProtoArena arena;
+        auto &msg = arena.create<ProtoSearchRequest>();
         stats.request_size = (*rpc.GetParams())[2]._data._len;
         if (!decode_message(*rpc.GetParams(), msg)) {
             LOG(warning, "got bad protobuf search request over rpc (unable to decode)");
@@ -110,7 +157,8 @@ struct SearchCompletionHandler : SearchClient {
     SearchCompletionHandler(FRT_RPCRequest &req_in, SearchProtocolMetrics &metrics_in)
         : req(req_in), metrics(metrics_in), stats() {}
     void searchDone(SearchReply::UP reply) override {
-        ProtoSearchReply msg;
+        ProtoArena arena;
+        auto &msg = arena.create<ProtoSearchReply>();
         ProtoConverter::search_reply_to_proto(*reply, msg);
         encode_search_reply(msg, *req.GetReturn());
         stats.reply_size = (*req.GetReturn())[2]._data._len;
@@ -131,7 +179,8 @@ struct DocsumRequestDecoder : DocsumRequest::Source::Decoder {
     DocsumRequestDecoder(FRT_RPCRequest &rpc_in, DocsumStats &stats_in)
         : rpc(rpc_in), stats(stats_in), relative_time(std::make_unique<SteadyClock>()) {}
     std::unique_ptr<DocsumRequest> decode() override {
-        ProtoDocsumRequest msg;
+        ProtoArena arena;
+        auto &msg = arena.create<ProtoDocsumRequest>();
         stats.request_size = (*rpc.GetParams())[2]._data._len;
         if (!decode_message(*rpc.GetParams(), msg)) {
             LOG(warning, "got bad protobuf docsum request over rpc (unable to decode)");
@@ -156,7 +205,8 @@ struct GetDocsumsCompletionHandler : DocsumClient {
     GetDocsumsCompletionHandler(FRT_RPCRequest &req_in, SearchProtocolMetrics &metrics_in)
         : req(req_in), metrics(metrics_in), stats() {}
     void getDocsumsDone(DocsumReply::UP reply) override {
-        ProtoDocsumReply msg;
+        ProtoArena arena;
+        auto &msg = arena.create<ProtoDocsumReply>();
         ProtoConverter::docsum_reply_to_proto(*reply, msg);
         encode_message(msg, *req.GetReturn());
         stats.reply_size = (*req.GetReturn())[2]._data._len;
@@ -175,7 +225,8 @@ struct PingCompletionHandler : MonitorClient {
     FRT_RPCRequest &req;
     PingCompletionHandler(FRT_RPCRequest &req_in) : req(req_in) {}
     void pingDone(std::unique_ptr<MonitorReply> reply) override {
-        ProtoMonitorReply msg;
+        ProtoArena arena;
+        auto &msg = arena.create<ProtoMonitorReply>();
         ProtoConverter::monitor_reply_to_proto(*reply, msg);
         encode_message(msg, *req.GetReturn());
         req.Return();
@@ -266,7 +317,8 @@ ProtoRpcAdapter::rpc_ping(FRT_RPCRequest *rpc)
         return rpc->SetError(FRTE_RPC_METHOD_FAILED, "Server not online");
     }
     rpc->Detach();
-    ProtoMonitorRequest msg;
+    ProtoArena arena;
+    auto &msg = arena.create<ProtoMonitorRequest>();
     if (decode_message(*rpc->GetParams(), msg)) {
         auto req = std::make_unique<MonitorRequest>();
         ProtoConverter::monitor_request_from_proto(msg, *req);
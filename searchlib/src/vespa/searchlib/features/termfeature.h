@@ -17,6 +17,7 @@ public:
      * @param termId The id of the query term to evaluate.
      */
     TermExecutor(const fef::IQueryEnvironment &env, uint32_t termId);
+    bool isPure() override { return true; }
     void execute(uint32_t docId) override;
 
 private:
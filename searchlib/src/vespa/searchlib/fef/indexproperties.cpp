@@ -444,6 +444,16 @@ GlobalFilterUpperLimit::lookup(const Properties &props, double defaultValue)
     return lookupDouble(props, NAME, defaultValue);
 }
 
+const vespalib::string CacheGlobalFilter::NAME("vespa.matching.global_filter.cache");
+
+const bool CacheGlobalFilter::DEFAULT_VALUE(false);
+
+bool
+CacheGlobalFilter::check(const Properties &props, bool fallback)
+{
+    return lookupBool(props, NAME, fallback);
+}
+
 const vespalib::string TargetHitsMaxAdjustmentFactor::NAME("vespa.matching.nns.target_hits_max_adjustment_factor");
 
 const double TargetHitsMaxAdjustmentFactor::DEFAULT_VALUE(20.0);
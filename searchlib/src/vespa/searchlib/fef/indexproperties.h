@@ -325,6 +325,20 @@ namespace matching {
         static double lookup(const Properties &props, double defaultValue);
     };
 
+    /**
+     * Property to enable reuse of materialized global filters across
+     * queries with identical filter input. Cached filters can be up to
+     * half a second out of date with respect to attribute updates, so
+     * this trades slightly stale filter results for reduced filter
+     * execution cost and is off by default.
+     **/
+    struct CacheGlobalFilter {
+        static const vespalib::string NAME;
+        static const bool DEFAULT_VALUE;
+        static bool check(const Properties &props) { return check(props, DEFAULT_VALUE); }
+        static bool check(const Properties &props, bool fallback);
+    };
+
     /**
      * Property to control the auto-adjustment of targetHits in a nearestNeighbor search using HNSW index with post-filtering.
      *
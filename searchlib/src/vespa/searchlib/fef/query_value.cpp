@@ -11,9 +11,11 @@
 #include <vespa/eval/eval/value.h>
 #include <vespa/eval/eval/value_codec.h>
 #include <vespa/vespalib/locale/c.h>
+#include <vespa/vespalib/stllike/lrucache_map.hpp>
 #include <vespa/vespalib/util/issue.h>
 #include <vespa/vespalib/objects/nbostream.h>
 #include <cerrno>
+#include <mutex>
 
 using document::TensorDataType;
 using vespalib::Issue;
@@ -30,7 +32,7 @@ using namespace search::fef::indexproperties;
 
 namespace search::fef {
 
-using ValueWrapper = AnyWrapper<Value::UP>;
+using ValueWrapper = AnyWrapper<std::shared_ptr<const Value>>;
 
 InvalidValueTypeException::InvalidValueTypeException(const vespalib::string& query_key, const vespalib::string& type_str_in)
     : vespalib::Exception("Invalid type '" + type_str_in + "' for query value '" + query_key + "'"),
@@ -96,15 +98,56 @@ as_tensor(const vespalib::string& expr, const ValueType& wanted_type)
     return {};
 }
 
-std::unique_ptr<Value>
+/**
+ * Bounded LRU of decoded query tensors shared across queries. Clients
+ * typically resend the same serialized tensors query after query
+ * (per-user embeddings and the like), and decoding them on the match
+ * setup path every time adds up. The key is the full serialized blob,
+ * so a hit can never alias a different tensor, and values are shared
+ * so an entry evicted mid-query stays alive for the queries using it.
+ */
+class DecodedTensorCache {
+public:
+    static DecodedTensorCache& instance() {
+        static DecodedTensorCache cache;
+        return cache;
+    }
+    std::shared_ptr<const Value> find(const vespalib::string& serialized) {
+        std::lock_guard guard(_lock);
+        if (_cache.hasKey(serialized)) {
+            return _cache[serialized];
+        }
+        return {};
+    }
+    void store(const vespalib::string& serialized, const std::shared_ptr<const Value>& value) {
+        std::lock_guard guard(_lock);
+        if (!_cache.hasKey(serialized)) {
+            _cache.insert(serialized, value);
+        }
+    }
+private:
+    static constexpr size_t max_entries = 512;
+    DecodedTensorCache() : _lock(), _cache(max_entries) {}
+    std::mutex _lock;
+    vespalib::lrucache_map<vespalib::LruParam<vespalib::string, std::shared_ptr<const Value>>> _cache;
+};
+
+std::shared_ptr<const Value>
 decode_tensor_value(Property prop, const ValueType& value_type)
 {
     if (prop.found() && !prop.get().empty()) {
         const vespalib::string& value = prop.get();
+        auto& cache = DecodedTensorCache::instance();
+        if (auto cached = cache.find(value)) {
+            if (TensorDataType::isAssignableType(value_type, cached->type())) {
+                return cached;
+            }
+        }
         vespalib::nbostream stream(value.data(), value.size());
         try {
-            auto tensor = vespalib::eval::decode_value(stream, vespalib::eval::FastValueBuilderFactory::get());
+            std::shared_ptr<const Value> tensor = vespalib::eval::decode_value(stream, vespalib::eval::FastValueBuilderFactory::get());
             if (TensorDataType::isAssignableType(value_type, tensor->type())) {
+                cache.store(value, tensor);
                 return tensor;
             } else {
                 Issue::report("Query value type is '%s' but decoded tensor type is '%s'",
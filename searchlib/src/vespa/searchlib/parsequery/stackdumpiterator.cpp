@@ -34,8 +34,8 @@ SimpleQueryStackDumpIterator::SimpleQueryStackDumpIterator(std::string_view buf)
       _extraIntArg3(0),
       _extraDoubleArg4(0),
       _extraDoubleArg5(0),
-      _predicate_query_term(),
-      _terms()
+      _terms_offset(0),
+      _term_count(0)
 {
 }
 
@@ -232,21 +232,21 @@ bool SimpleQueryStackDumpIterator::readNext() {
 void
 SimpleQueryStackDumpIterator::readPredicate(const char *&p) {
     _curr_index_name = read_string_view(p);
-    _predicate_query_term = std::make_unique<PredicateQueryTerm>();
+    _terms_offset = p - _buf;
 
+    // Skip and validate the feature sets, materialized on demand by
+    // getPredicateQueryTerm().
     size_t count = readCompressedPositiveInt(p);
     for (size_t i = 0; i < count; ++i) {
-        std::string_view key = read_string_view(p);
-        std::string_view value = read_string_view(p);
-        uint64_t sub_queries = read_value<uint64_t>(p);
-        _predicate_query_term->addFeature(vespalib::string(key), vespalib::string(value), sub_queries);
+        (void) read_string_view(p);
+        (void) read_string_view(p);
+        (void) read_value<uint64_t>(p);
     }
     count = readCompressedPositiveInt(p);
     for (size_t i = 0; i < count; ++i) {
-        std::string_view key = read_string_view(p);
-        uint64_t value = read_value<uint64_t>(p);
-        uint64_t sub_queries = read_value<uint64_t>(p);
-        _predicate_query_term->addRangeFeature(vespalib::string(key), value, sub_queries);
+        (void) read_string_view(p);
+        (void) read_value<uint64_t>(p);
+        (void) read_value<uint64_t>(p);
     }
 }
 
@@ -288,41 +288,80 @@ SimpleQueryStackDumpIterator::readFuzzy(const char *&p) {
 std::unique_ptr<query::PredicateQueryTerm>
 SimpleQueryStackDumpIterator::getPredicateQueryTerm()
 {
-    return std::move(_predicate_query_term);
+    if (_currType != ParseItem::ITEM_PREDICATE_QUERY) {
+        return {};
+    }
+    // The payload was validated by readNext(), so re-reading it here
+    // cannot fail.
+    const char *p = _buf + _terms_offset;
+    auto term = std::make_unique<PredicateQueryTerm>();
+    size_t count = readCompressedPositiveInt(p);
+    for (size_t i = 0; i < count; ++i) {
+        std::string_view key = read_string_view(p);
+        std::string_view value = read_string_view(p);
+        uint64_t sub_queries = read_value<uint64_t>(p);
+        term->addFeature(vespalib::string(key), vespalib::string(value), sub_queries);
+    }
+    count = readCompressedPositiveInt(p);
+    for (size_t i = 0; i < count; ++i) {
+        std::string_view key = read_string_view(p);
+        uint64_t value = read_value<uint64_t>(p);
+        uint64_t sub_queries = read_value<uint64_t>(p);
+        term->addRangeFeature(vespalib::string(key), value, sub_queries);
+    }
+    return term;
 }
 
 void
 SimpleQueryStackDumpIterator::read_string_in(const char*& p)
 {
-    uint32_t num_terms = readCompressedPositiveInt(p);
+    _term_count = readCompressedPositiveInt(p);
     _currArity = 0;
     _curr_index_name = read_string_view(p);
     _curr_term = std::string_view();
-    auto terms = std::make_unique<StringTermVector>(num_terms);
-    for (uint32_t i = 0; i < num_terms; ++i) {
-        terms->addTerm(read_string_view(p));
+    _terms_offset = p - _buf;
+    // Skip and validate the terms, materialized on demand by get_terms().
+    for (uint32_t i = 0; i < _term_count; ++i) {
+        (void) read_string_view(p);
     }
-    _terms = std::move(terms);
 }
 
 void
 SimpleQueryStackDumpIterator::read_numeric_in(const char*& p)
 {
-    uint32_t num_terms = readCompressedPositiveInt(p);
+    _term_count = readCompressedPositiveInt(p);
     _currArity = 0;
     _curr_index_name = read_string_view(p);
     _curr_term = std::string_view();
-    auto terms = std::make_unique<IntegerTermVector>(num_terms);
-    for (uint32_t i = 0; i < num_terms; ++i) {
-        terms->addTerm(read_value<int64_t>(p));
+    _terms_offset = p - _buf;
+    // Skip the terms, materialized on demand by get_terms().
+    if (p + _term_count * sizeof(int64_t) > _bufEnd) {
+        throw false;
     }
-    _terms = std::move(terms);
+    p += _term_count * sizeof(int64_t);
 }
 
 std::unique_ptr<query::TermVector>
 SimpleQueryStackDumpIterator::get_terms()
 {
-    return std::move(_terms);
+    // The payload was validated by readNext(), so re-reading it here
+    // cannot fail.
+    const char *p = _buf + _terms_offset;
+    if (_currType == ParseItem::ITEM_STRING_IN) {
+        auto terms = std::make_unique<StringTermVector>(_term_count);
+        for (uint32_t i = 0; i < _term_count; ++i) {
+            terms->addTerm(read_string_view(p));
+        }
+        return terms;
+    }
+    if (_currType == ParseItem::ITEM_NUMERIC_IN) {
+        auto terms = std::make_unique<IntegerTermVector>(_term_count);
+        for (uint32_t i = 0; i < _term_count; ++i) {
+            terms->addTerm(read_value<int64_t>(p));
+        }
+        return terms;
+    }
+    return {};
 }
 
 }
@@ -51,9 +51,10 @@ private:
     uint32_t _extraIntArg3;
     double   _extraDoubleArg4;
     double   _extraDoubleArg5;
-    /** The predicate query specification */
-    std::unique_ptr<query::PredicateQueryTerm> _predicate_query_term;
-    std::unique_ptr<query::TermVector>         _terms;
+    /** Offset into the buffer of the term payload of the current item */
+    uint32_t _terms_offset;
+    /** Number of terms in the payload of the current item */
+    uint32_t _term_count;
 
     VESPA_DLL_LOCAL std::string_view read_string_view(const char *&p);
     VESPA_DLL_LOCAL uint64_t readCompressedPositiveInt(const char *&p);
@@ -140,7 +141,17 @@ public:
     [[nodiscard]] uint32_t fuzzy_max_edit_distance() const noexcept { return _extraIntArg1; }
     [[nodiscard]] uint32_t fuzzy_prefix_lock_length() const noexcept { return _extraIntArg2; }
 
+    /**
+     * Materialize the predicate query specification of the current
+     * item. The payload is only scanned and validated by next();
+     * nothing is allocated until this is called.
+     */
     std::unique_ptr<query::PredicateQueryTerm> getPredicateQueryTerm();
+    /**
+     * Materialize the term vector of the current (string or numeric
+     * in) item. The payload is only scanned and validated by next();
+     * nothing is allocated until this is called.
+     */
     std::unique_ptr<query::TermVector> get_terms();
 
     std::string_view index_as_view() const noexcept { return _curr_index_name; }
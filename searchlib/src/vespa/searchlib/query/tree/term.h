@@ -24,6 +24,7 @@ public:
     virtual ~Term() = 0;
 
     void setView(vespalib::string view) { _view = std::move(view); }
+    void setWeight(Weight weight) noexcept { _weight = weight; }
     void setRanked(bool ranked) noexcept { _ranked = ranked; }
     void setPositionData(bool position_data) noexcept { _position_data = position_data; }
     // Used for fuzzy prefix matching. Not to be confused with distinct Prefix query term type
@@ -62,6 +63,13 @@ public:
     ~TermBase() override = 0;
     const T &getTerm() const { return _term; }
 
+    /**
+     * Overwrites the term value, allowing one scratch node to be
+     * reused for all the entries of a multi-term node when building
+     * blueprints.
+     */
+    void set_term(T term) { _term = std::move(term); }
+
 protected:
     TermBase(T term, const vespalib::string & view, int32_t id, Weight weight);
 };
@@ -6,6 +6,48 @@
 
 namespace search::queryeval {
 
+void
+AndNotSearch::initRange(uint32_t beginId, uint32_t endId)
+{
+    MultiSearch::initRange(beginId, endId);
+    if (!_notBlockFiltersBuilt) {
+        // The negative children's bitvectors do not change while the
+        // iterator is in use, and initRange is called once per scheduler
+        // docid range, so the full occupancy scan is only done once.
+        buildNotBlockFilters();
+        _notBlockFiltersBuilt = true;
+    }
+}
+
+void
+AndNotSearch::buildNotBlockFilters()
+{
+    const Children & children(getChildren());
+    _notBlockFilters.clear();
+    _notBlockFilters.resize(children.size() - 1);
+    for (uint32_t i = 1; i < children.size(); ++i) {
+        BitVectorMeta bv = children[i]->asBitVector();
+        if (!bv.valid() || bv.inverted()) {
+            continue; // must fall back to exact seeks
+        }
+        const BitVector & vector = *bv.vector();
+        const BitWord::Word * words = static_cast<const BitWord::Word *>(vector.getStart());
+        uint32_t startWord = BitWord::wordNum(vector.getStartIndex());
+        uint32_t numWords = BitWord::wordNum(vector.size()) + 1; // including the guard word
+        std::vector<uint64_t> & filter = _notBlockFilters[i - 1];
+        filter.resize((numWords + 63) / 64, 0);
+        // words below the start index are not valid; treat them as 'maybe'
+        for (uint32_t w = 0; w < startWord; ++w) {
+            filter[w >> 6] |= (1ul << (w & 63));
+        }
+        for (uint32_t w = startWord; w < numWords; ++w) {
+            if (words[w] != 0) {
+                filter[w >> 6] |= (1ul << (w & 63));
+            }
+        }
+    }
+}
+
 void
 AndNotSearch::doSeek(uint32_t docid)
 {
@@ -14,7 +56,7 @@ AndNotSearch::doSeek(uint32_t docid)
         return; // not match in positive subtree
     }
     for (uint32_t i = 1; i < children.size(); ++i) {
-        if (children[i]->seek(docid)) {
+        if (seekNotChild(i, docid)) {
             return; // match in negative subtree
         }
     }
@@ -75,7 +117,7 @@ AndNotSearchStrict::internalSeek(uint32_t docid)
         hit = children[0]->seek(docid);
     }
     for (uint32_t i = 1; hit && i < children.size(); ++i) {
-        if (children[i]->seek(docid)) {
+        if (seekNotChild(i, docid)) {
             hit = false;
         }
     }
@@ -87,7 +129,7 @@ AndNotSearchStrict::internalSeek(uint32_t docid)
     while (!isAtEnd(nextId)) {
         bool foundHit = true;
         for (uint32_t i = 1; i < children.size(); ++i) {
-            if (children[i]->seek(nextId)) {
+            if (seekNotChild(i, nextId)) {
                 foundHit = false;
                 ++nextId;
                 break;
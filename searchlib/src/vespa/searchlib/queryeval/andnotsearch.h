@@ -24,11 +24,36 @@ protected:
      *
      * @param children the search objects we are andnot'ing
      **/
-    AndNotSearch(MultiSearch::Children children) : MultiSearch(std::move(children)) { }
+    AndNotSearch(MultiSearch::Children children)
+        : MultiSearch(std::move(children)),
+          _notBlockFilters(),
+          _notBlockFiltersBuilt(false)
+    { }
+
+    /**
+     * Seek the given negative child, first consulting its block filter
+     * when one could be built. A cleared filter bit means the child has
+     * no hits at all among the 64 docids covering 'docid', so the
+     * virtual seek can be skipped. Typical for tombstone filters where
+     * the negative side is a very sparse bitvector.
+     **/
+    bool seekNotChild(uint32_t i, uint32_t docid) {
+        const std::vector<uint64_t> & filter = _notBlockFilters[i - 1];
+        if (!filter.empty()) {
+            uint32_t block = docid >> 6;
+            if (((block >> 6) < filter.size()) &&
+                ((filter[block >> 6] & (1ul << (block & 63))) == 0))
+            {
+                return false;
+            }
+        }
+        return getChildren()[i]->seek(docid);
+    }
 
 public:
     static std::unique_ptr<SearchIterator> create(ChildrenIterators children, bool strict);
 
+    void initRange(uint32_t beginId, uint32_t endId) override;
     std::unique_ptr<BitVector> get_hits(uint32_t begin_id) override;
     void or_hits_into(BitVector &result, uint32_t begin_id) override;
 
@@ -37,6 +62,13 @@ private:
     bool needUnpack(size_t index) const override {
         return index == 0;
     }
+    void buildNotBlockFilters();
+
+    // one filter per negative child, with one bit per bitvector word;
+    // empty when the child is not a plain (non-inverted) bitvector.
+    // Built on the first initRange call and reused for later ranges.
+    std::vector<std::vector<uint64_t>> _notBlockFilters;
+    bool _notBlockFiltersBuilt;
 };
 
 class AndNotSearchStrictBase : public AndNotSearch
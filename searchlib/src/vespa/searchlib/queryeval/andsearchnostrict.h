@@ -23,14 +23,24 @@ public:
      **/
     AndSearchNoStrict(Children children, const Unpack & unpacker) :
         AndSearch(std::move(children)),
-        _unpacker(unpacker)
+        _unpacker(unpacker),
+        _rejected(getChildren().size(), 0),
+        _seeks_until_adapt(adapt_interval)
     { }
 
 protected:
+    // Number of seeks between each re-evaluation of child order based
+    // on observed reject counts. Children that actually reject the
+    // most candidates are moved towards the front, recovering from
+    // mis-planned queries where static estimates were off.
+    static constexpr uint32_t adapt_interval = 4096;
+
     void doSeek(uint32_t docid) override {
+        maybe_adapt_order(0);
         const Children & children(getChildren());
         for (uint32_t i = 0; i < children.size(); ++i) {
             if (!children[i]->seek(docid)) {
+                note_rejected(i);
                 return;
             }
         }
@@ -38,14 +48,60 @@ protected:
     }
     Trinary is_strict() const override { return Trinary::False; }
 
+    void note_rejected(uint32_t index) noexcept {
+        if (index < _rejected.size()) {
+            ++_rejected[index];
+        }
+    }
+
+    /**
+     * Re-order children so that the ones observed to reject the most
+     * candidates are checked first. The first 'keep' children are
+     * pinned (a strict AND needs its strict driver to stay first).
+     * Only call this from a place where no child indexes are held.
+     */
+    void maybe_adapt_order(uint32_t keep) {
+        if (__builtin_expect(--_seeks_until_adapt != 0, true)) {
+            return;
+        }
+        _seeks_until_adapt = adapt_interval;
+        // snapshot counts; the onRemove/onInsert hooks mutate _rejected
+        std::vector<uint64_t> counts(_rejected);
+        for (uint32_t p = keep; (p + 1) < counts.size(); ++p) {
+            uint32_t best = p;
+            for (uint32_t q = p + 1; q < counts.size(); ++q) {
+                if (counts[q] > counts[best]) {
+                    best = q;
+                }
+            }
+            if (best != p) {
+                insert(p, remove(best));
+                uint64_t cnt = counts[best];
+                counts.erase(counts.begin() + best);
+                counts.insert(counts.begin() + p, cnt);
+            }
+        }
+        // age the counts so that old observations fade
+        for (uint64_t & cnt : counts) {
+            cnt >>= 1;
+        }
+        _rejected = std::move(counts);
+    }
+
     void doUnpack(uint32_t docid) override {
         _unpacker.unpack(docid, *this);
     }
     void onRemove(size_t index) override {
         _unpacker.onRemove(index);
+        if (index < _rejected.size()) {
+            _rejected.erase(_rejected.begin() + index);
+        }
     }
     void onInsert(size_t index) override {
         _unpacker.onInsert(index);
+        if (index <= _rejected.size()) {
+            _rejected.insert(_rejected.begin() + index, 0);
+        }
     }
     bool needUnpack(size_t index) const override {
         return _unpacker.needUnpack(index);
@@ -53,6 +109,8 @@ protected:
 
 private:
     Unpack _unpacker;
+    std::vector<uint64_t> _rejected;
+    uint32_t _seeks_until_adapt;
 };
 
 }
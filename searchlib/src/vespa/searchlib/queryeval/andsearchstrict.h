@@ -3,6 +3,8 @@
 #pragma once
 
 #include "andsearchnostrict.h"
+#include <vespa/vespalib/hwaccelerated/iaccelerated.h>
+#include <algorithm>
 
 namespace search::queryeval {
 
@@ -16,8 +18,12 @@ private:
     template<bool doSeekOnly>
     VESPA_DLL_LOCAL void advance(uint32_t failedChildIndexd) __attribute__((noinline));
     using Trinary=vespalib::Trinary;
+    std::vector<uint32_t> _block_scratch;
+    std::vector<uint32_t> _child_block;
+    std::vector<uint32_t> _out_block;
 protected:
     void doSeek(uint32_t docid) override;
+    uint32_t seek_block(uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity) override;
     Trinary is_strict() const override { return Trinary::True; }
     SearchIterator::UP andWith(SearchIterator::UP filter, uint32_t estimate) override;
 public:
@@ -57,6 +63,7 @@ AndSearchStrict<Unpack>::advance(uint32_t failedChildIndex)
         for (uint32_t i(1); foundHit && (i < children.size()); ++i) {
             SearchIterator & child(*children[i]);
             if (!(foundHit = child.seek(nextId))) {
+                this->note_rejected(i);
                 if (__builtin_expect(!child.isAtEnd(), true)) {
                     firstChild.doSeek(std::max(nextId+1, child.getDocId()));
                     nextId = firstChild.getDocId();
@@ -70,14 +77,67 @@ AndSearchStrict<Unpack>::advance(uint32_t failedChildIndex)
     this->setDocId(nextId);
 }
 
+template<typename Unpack>
+uint32_t
+AndSearchStrict<Unpack>::seek_block(uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity)
+{
+    const MultiSearch::Children & children(this->getChildren());
+    _block_scratch.resize(capacity);
+    uint32_t cnt = 0;
+    uint32_t block_begin = begin_id;
+    while ((cnt < capacity) && (block_begin < end_id)) {
+        uint32_t n = children[0]->seek_block(block_begin, end_id, _block_scratch.data(), capacity - cnt);
+        if (n == 0) {
+            break;
+        }
+        block_begin = _block_scratch[n - 1] + 1;
+        const auto & accel = vespalib::hwaccelerated::IAccelerated::getAccelerator();
+        for (uint32_t i = 1; (i < children.size()) && (n > 0); ++i) {
+            SearchIterator & child(*children[i]);
+            if (child.is_strict() == Trinary::True) {
+                // intersect the candidate array with the child's own
+                // hit block using the accelerated kernel
+                _child_block.resize(capacity);
+                _out_block.resize(capacity);
+                uint32_t m = child.seek_block(_block_scratch[0], _block_scratch[n - 1] + 1, _child_block.data(), capacity);
+                uint32_t covered_end = (m == capacity) ? (_child_block[m - 1] + 1) : (_block_scratch[n - 1] + 1);
+                uint32_t n_cov = std::lower_bound(_block_scratch.begin(), _block_scratch.begin() + n, covered_end) - _block_scratch.begin();
+                uint32_t kept = accel.intersectU32(_block_scratch.data(), n_cov, _child_block.data(), m, _out_block.data());
+                // candidates beyond the child's covered range are filtered one by one
+                for (uint32_t j = n_cov; j < n; ++j) {
+                    if (child.seek(_block_scratch[j])) {
+                        _out_block[kept++] = _block_scratch[j];
+                    }
+                }
+                _out_block.swap(_block_scratch);
+                n = kept;
+            } else {
+                uint32_t kept = 0;
+                for (uint32_t j = 0; j < n; ++j) {
+                    if (child.seek(_block_scratch[j])) {
+                        _block_scratch[kept++] = _block_scratch[j];
+                    }
+                }
+                n = kept;
+            }
+        }
+        for (uint32_t j = 0; j < n; ++j) {
+            hits[cnt++] = _block_scratch[j];
+        }
+    }
+    return cnt;
+}
+
 template<typename Unpack>
 void
 AndSearchStrict<Unpack>::doSeek(uint32_t docid)
 {
+    this->maybe_adapt_order(1);
     const MultiSearch::Children & children(this->getChildren());
     for (uint32_t i(0); i < children.size(); ++i) {
         children[i]->doSeek(docid);
         if (children[i]->getDocId() != docid) {
+            this->note_rejected(i);
             advance<true>(i);
             return;
         }
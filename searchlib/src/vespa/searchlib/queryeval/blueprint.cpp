@@ -5,6 +5,7 @@
 #include "andsearch.h"
 #include "emptysearch.h"
 #include "field_spec.hpp"
+#include "execution_arena.h"
 #include "flow_tuning.h"
 #include "full_search.h"
 #include "leaf_blueprints.h"
@@ -28,6 +29,32 @@ namespace search::queryeval {
 
 //-----------------------------------------------------------------------------
 
+void *
+Blueprint::operator new(size_t sz)
+{
+    return ExecutionArena::alloc_tagged(sz, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void *
+Blueprint::operator new(size_t sz, std::align_val_t align)
+{
+    return ExecutionArena::alloc_tagged(sz, size_t(align));
+}
+
+void
+Blueprint::operator delete(void *p) noexcept
+{
+    ExecutionArena::free_tagged(p);
+}
+
+void
+Blueprint::operator delete(void *p, std::align_val_t) noexcept
+{
+    ExecutionArena::free_tagged(p);
+}
+
+//-----------------------------------------------------------------------------
+
 void maybe_eliminate_self(Blueprint* &self, Blueprint::UP replacement) {
     // replace with replacement
     if (replacement) {
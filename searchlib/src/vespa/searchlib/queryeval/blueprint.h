@@ -54,6 +54,14 @@ public:
     using Children = std::vector<Blueprint::UP>;
     using SearchIteratorUP = std::unique_ptr<SearchIterator>;
 
+    // Blueprint trees are built per query; when an ExecutionArena is
+    // active on the thread the memory comes from the arena and is
+    // reclaimed wholesale when the query completes.
+    static void *operator new(size_t sz);
+    static void *operator new(size_t sz, std::align_val_t align);
+    static void operator delete(void *p) noexcept;
+    static void operator delete(void *p, std::align_val_t align) noexcept;
+
     enum class OptimizePass { FIRST, LAST };
 
     class Options {
@@ -83,9 +83,13 @@ CreateBlueprintVisitorHelper::createWeightedSet(std::unique_ptr<WS> bp, NODE &n)
     bp->reserve(n.getNumTerms());
     Blueprint::HitEstimate estimate;
     FieldSpec childField(_field);
+    // One scratch node is reused for all the terms to avoid
+    // constructing a term node (with view and term copies) per entry.
+    query::SimpleStringTerm node("", n.getView(), 0, query::Weight(0));
     for (size_t i = 0; i < n.getNumTerms(); ++i) {
         auto term = n.getAsString(i);
-        query::SimpleStringTerm node(vespalib::string(term.first), n.getView(), 0, term.second); // TODO Temporary
+        node.set_term(vespalib::string(term.first));
+        node.setWeight(term.second);
         childField.setBase(bp->getNextChildField(_field));
         bp->addTerm(_searchable.createBlueprint(_requestContext, childField, node), term.second.percent(), estimate);
     }
@@ -0,0 +1,86 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "execution_arena.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace search::queryeval {
+
+namespace {
+
+thread_local ExecutionArena *active_arena = nullptr;
+
+constexpr uint64_t ARENA_TAG = 0x616e657261ull; // "arena"
+constexpr uint64_t HEAP_TAG  = 0x70616568ull;   // "heap"
+
+struct AllocHeader {
+    uint64_t tag;
+    uint64_t offset; // distance from the returned pointer back to the underlying allocation
+};
+
+void *
+finish_alloc(char *base, size_t align, uint64_t tag) noexcept
+{
+    uintptr_t ret = (uintptr_t(base) + sizeof(AllocHeader) + (align - 1)) & ~uintptr_t(align - 1);
+    auto *header = reinterpret_cast<AllocHeader *>(ret) - 1;
+    header->tag = tag;
+    header->offset = ret - uintptr_t(base);
+    return reinterpret_cast<void *>(ret);
+}
+
+}
+
+ExecutionArena::ExecutionArena()
+    : _stash()
+{ }
+
+ExecutionArena::~ExecutionArena() = default;
+
+ExecutionArena::Activation::Activation(ExecutionArena &arena) noexcept
+    : _prev(active_arena)
+{
+    active_arena = &arena;
+}
+
+ExecutionArena::Activation::~Activation()
+{
+    active_arena = _prev;
+}
+
+ExecutionArena *
+ExecutionArena::active() noexcept
+{
+    return active_arena;
+}
+
+void *
+ExecutionArena::alloc_tagged(size_t sz, size_t align)
+{
+    align = std::max(align, alignof(AllocHeader));
+    size_t full = sz + sizeof(AllocHeader) + align;
+    if (active_arena != nullptr) {
+        return finish_alloc(active_arena->_stash.alloc(full), align, ARENA_TAG);
+    }
+    char *base = static_cast<char *>(malloc(full));
+    if (base == nullptr) {
+        throw std::bad_alloc();
+    }
+    return finish_alloc(base, align, HEAP_TAG);
+}
+
+void
+ExecutionArena::free_tagged(void *p) noexcept
+{
+    if (p == nullptr) {
+        return;
+    }
+    auto *header = static_cast<AllocHeader *>(p) - 1;
+    if (header->tag == HEAP_TAG) {
+        free(static_cast<char *>(p) - header->offset);
+    }
+    // arena memory is released when the arena itself goes away
+}
+
+}
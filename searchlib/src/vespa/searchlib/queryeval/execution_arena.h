@@ -0,0 +1,54 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/vespalib/util/stash.h>
+#include <cstddef>
+
+namespace search::queryeval {
+
+/**
+ * Monotonic per-query arena used to back blueprint and iterator trees.
+ * While an arena is activated on a thread, Blueprint and SearchIterator
+ * objects are carved out of it by their class-level operator new. Their
+ * operator delete only runs destructors; the memory itself is released
+ * wholesale when the arena is destroyed. Each allocation is prefixed
+ * with a small header so operator delete can tell arena memory from
+ * ordinary heap memory, which means objects must never outlive the
+ * arena they were allocated from. An arena may only be used from one
+ * thread at a time.
+ **/
+class ExecutionArena {
+public:
+    ExecutionArena();
+    ~ExecutionArena();
+    ExecutionArena(const ExecutionArena &) = delete;
+    ExecutionArena &operator=(const ExecutionArena &) = delete;
+
+    /**
+     * Activates an arena on the current thread for the duration of the
+     * scope; restores the previously active arena (if any) when done.
+     **/
+    class Activation {
+    public:
+        explicit Activation(ExecutionArena &arena) noexcept;
+        ~Activation();
+        Activation(const Activation &) = delete;
+        Activation &operator=(const Activation &) = delete;
+    private:
+        ExecutionArena *_prev;
+    };
+
+    // the arena activated on the current thread, if any
+    static ExecutionArena *active() noexcept;
+
+    // allocate from the active arena, falling back to the heap; both
+    // paths prefix the memory with a header consumed by free_tagged
+    static void *alloc_tagged(size_t sz, size_t align);
+    static void free_tagged(void *p) noexcept;
+
+private:
+    vespalib::Stash _stash;
+};
+
+}
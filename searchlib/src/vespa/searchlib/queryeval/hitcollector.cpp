@@ -24,6 +24,18 @@ HitCollector::sortHitsByScore(size_t topn)
     }
 }
 
+void
+HitCollector::compactHitBuffer()
+{
+    if (_hits.size() > _maxHitsSize) {
+        std::nth_element(_hits.begin(), _hits.begin() + (_maxHitsSize - 1), _hits.end(), ScoreComparator());
+        _hits.resize(_maxHitsSize);
+        _selectThreshold = _hits[_maxHitsSize - 1].second;
+        _hitsSortOrder = SortOrder::NONE;
+        _scoreOrder.clear();
+    }
+}
+
 void
 HitCollector::sortHitsByDocId()
 {
@@ -44,7 +56,8 @@ HitCollector::HitCollector(uint32_t numDocs, uint32_t maxHitsSize)
       _unordered(false),
       _docIdVector(),
       _bitVector(),
-      _reRankedHits()
+      _reRankedHits(),
+      _selectThreshold(-HUGE_VAL)
 {
     if (_maxHitsSize > 0) {
         _collector = std::make_unique<RankedHitCollector>(*this);
@@ -118,9 +131,20 @@ HitCollector::RankedHitCollector::collectAndChangeCollector(uint32_t docId, feat
         hc._bitVector->setBit(docId);
         newCollector = std::make_unique<BitVectorCollector<true>>(hc);
     }
-    // treat hit vector as a heap
-    std::make_heap(hc._hits.begin(), hc._hits.end(), ScoreComparator());
-    hc._hitsSortOrder = SortOrder::HEAP;
+    if (hc.use_buffered_selection()) {
+        // flat-buffer mode; reject on threshold, select lazily
+        hc._hits.reserve(2 * size_t(hc._maxHitsSize));
+        feature_t min_score = hc._hits[0].second;
+        for (const auto& hit : hc._hits) {
+            min_score = std::min(min_score, hit.second);
+        }
+        hc._selectThreshold = min_score;
+        hc._hitsSortOrder = SortOrder::NONE;
+    } else {
+        // treat hit vector as a heap
+        std::make_heap(hc._hits.begin(), hc._hits.end(), ScoreComparator());
+        hc._hitsSortOrder = SortOrder::HEAP;
+    }
     this->considerForHitVector(docId, score);
     hc._collector = std::move(newCollector); // note - self-destruct.
 }
@@ -166,6 +190,7 @@ HitCollector::DocIdCollector<CollectRankedHit>::collectAndChangeCollector(uint32
 SortedHitSequence
 HitCollector::getSortedHitSequence(size_t max_hits)
 {
+    compactHitBuffer();
     size_t num_hits = std::min(_hits.size(), max_hits);
     sortHitsByScore(num_hits);
     return {_hits.data(), _scoreOrder.data(), num_hits};
@@ -378,6 +403,7 @@ HitCollector::get_result_set(std::optional<double> second_phase_rank_drop_limit,
     }
 
     // destroys the heap property or score sort order
+    compactHitBuffer();
     sortHitsByDocId();
 
     auto rs = std::make_unique<ResultSet>();
@@ -34,6 +34,7 @@ private:
     std::vector<uint32_t>       _docIdVector;
     std::unique_ptr<BitVector>  _bitVector;
     std::vector<Hit>            _reRankedHits;
+    feature_t                   _selectThreshold;
 
     std::pair<Scores, Scores> _ranges;
 
@@ -87,7 +88,11 @@ private:
     public:
         explicit CollectorBase(HitCollector &hc) noexcept : _hc(hc) { }
         void considerForHitVector(uint32_t docId, feature_t score) {
-            if (__builtin_expect((score > _hc._hits[0].second), false)) {
+            if (_hc.use_buffered_selection()) {
+                if (__builtin_expect((score > _hc._selectThreshold), false)) {
+                    _hc.appendToHitBuffer(docId, score);
+                }
+            } else if (__builtin_expect((score > _hc._hits[0].second), false)) {
                 replaceHitInVector(docId, score);
             }
         }
@@ -119,6 +124,20 @@ private:
         void collect(uint32_t docId, feature_t score) override;
     };
 
+    // With large topN the per-hit heap maintenance dominates; instead
+    // hits are appended to a flat buffer that is compacted down to the
+    // N best with a single selection pass whenever it grows to twice
+    // the target size.
+    static constexpr uint32_t buffered_selection_threshold = 1024;
+
+    bool use_buffered_selection() const noexcept { return _maxHitsSize >= buffered_selection_threshold; }
+    void appendToHitBuffer(uint32_t docId, feature_t score) {
+        _hits.emplace_back(docId, score);
+        if (_hits.size() >= (2 * size_t(_maxHitsSize))) {
+            compactHitBuffer();
+        }
+    }
+    VESPA_DLL_LOCAL void compactHitBuffer();
     VESPA_DLL_LOCAL void sortHitsByScore(size_t topn);
     VESPA_DLL_LOCAL void sortHitsByDocId();
 
@@ -44,6 +44,10 @@ public:
         return _children[ref]->getDocId();
     }
 
+    uint32_t seek_block(ref_t ref, uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity) {
+        return _children[ref]->seek_block(begin_id, end_id, hits, capacity);
+    }
+
     int32_t get_weight(ref_t ref, uint32_t docid) {
         _children[ref]->doUnpack(docid);
         return _childMatch[ref]->getWeight();
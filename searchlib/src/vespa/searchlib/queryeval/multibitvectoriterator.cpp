@@ -98,6 +98,32 @@ MultiBitVector<Update>::strictSeek(uint32_t docId) noexcept
         : _numDocs;
 }
 
+template<typename Update>
+uint32_t
+MultiBitVector<Update>::fill_block(uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity) noexcept
+{
+    uint32_t cnt = 0;
+    uint32_t docId = begin_id;
+    end_id = std::min(end_id, _numDocs);
+    while ((docId < end_id) && (cnt < capacity)) {
+        if (updateLastValue(docId)) {
+            break;
+        }
+        Word value = _lastValue & BitWord::checkTab(docId);
+        uint32_t wordBase = _lastMaxDocIdLimit - BitWord::WordLen;
+        while ((value != 0) && (cnt < capacity)) {
+            uint32_t hit = wordBase + vespalib::Optimized::lsbIdx(value);
+            if (hit >= end_id) {
+                return cnt;
+            }
+            hits[cnt++] = hit;
+            value &= value - 1;
+        }
+        docId = (value == 0) ? _lastMaxDocIdLimit : (hits[cnt - 1] + 1);
+    }
+    return cnt;
+}
+
 template<typename Update>
 bool
 MultiBitVector<Update>::seek(uint32_t docId) noexcept
@@ -152,6 +178,9 @@ private:
             this->setDocId(docId);
         }
     }
+    uint32_t seek_block(uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity) override {
+        return this->_mbv.fill_block(begin_id, end_id, hits, capacity);
+    }
     Trinary is_strict() const override { return Trinary::True; }
 };
 
@@ -35,6 +35,12 @@ public:
     explicit MultiBitVector(size_t reserved);
     uint32_t strictSeek(uint32_t docId) noexcept;
     bool seek(uint32_t docId) noexcept;
+    /**
+     * Extract all hits in [begin_id, end_id) from the fused words in a
+     * single pass, without re-entering strictSeek per hit. Fills at most
+     * 'capacity' docids into 'hits' and returns the number written.
+     **/
+    uint32_t fill_block(uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity) noexcept;
     bool acceptExtraFilter() const noexcept { return Update::isAnd(); }
 private:
     bool updateLastValue(uint32_t docId) noexcept {
@@ -46,8 +46,8 @@ protected:
     MultiSearch();
     void doUnpack(uint32_t docid) override;
     void visitMembers(vespalib::ObjectVisitor &visitor) const override;
+    SearchIterator::UP remove(size_t index); // subclasses and friends only
 private:
-    SearchIterator::UP remove(size_t index); // friends only
     /**
      * Call back when children are removed / inserted after the Iterator has been constructed.
      * This is to support code that make assumptions that iterators do not move around or disappear.
@@ -131,70 +131,62 @@ NearSearch::NearSearch(Children terms,
     setup_fields(window, _matchers, data, getChildren().size());
 }
 
-namespace {
-
-struct PosIter {
-    search::fef::TermFieldMatchData::PositionsIterator curPos;
-    search::fef::TermFieldMatchData::PositionsIterator endPos;
-
-    bool operator< (const PosIter &other) const {
-        // assumes none is at end
-        TermFieldMatchDataPositionKey mykey = *curPos;
-        TermFieldMatchDataPositionKey otherkey = *other.curPos;
-        return mykey < otherkey;
-    }
-};
-
-struct Iterators
+bool
+NearSearch::PosIter::operator<(const PosIter &other) const
 {
-    vespalib::PriorityQueue<PosIter> _queue;
-    TermFieldMatchDataPositionKey _maxOcc;
+    // assumes none is at end
+    TermFieldMatchDataPositionKey mykey = *curPos;
+    TermFieldMatchDataPositionKey otherkey = *other.curPos;
+    return mykey < otherkey;
+}
 
-    void update(TermFieldMatchDataPositionKey occ)
-    {
-        if (_queue.size() == 1 || _maxOcc < occ) { _maxOcc = occ; }
-    }
+void
+NearSearch::Matcher::update(TermFieldMatchDataPositionKey occ)
+{
+    if (_queue.size() == 1 || _maxOcc < occ) { _maxOcc = occ; }
+}
 
-    void add(const search::fef::TermFieldMatchData *term)
-    {
-        PosIter iter;
-        iter.curPos = term->begin();
-        iter.endPos = term->end();
-        LOG_ASSERT(iter.curPos != iter.endPos);
-        _queue.push(iter);
-        update(*iter.curPos);
-    }
+void
+NearSearch::Matcher::add(const search::fef::TermFieldMatchData *term)
+{
+    PosIter iter;
+    iter.curPos = term->begin();
+    iter.endPos = term->end();
+    LOG_ASSERT(iter.curPos != iter.endPos);
+    _queue.push(iter);
+    update(*iter.curPos);
+}
 
-    bool match(uint32_t window) {
-        for (;;) {
-            PosIter &front = _queue.front();
-            TermFieldMatchDataPositionKey lastAllowed = *front.curPos;
-            lastAllowed.setPosition(front.curPos->getPosition() + window);
+bool
+NearSearch::Matcher::findWindow()
+{
+    for (;;) {
+        PosIter &front = _queue.front();
+        TermFieldMatchDataPositionKey lastAllowed = *front.curPos;
+        lastAllowed.setPosition(front.curPos->getPosition() + window());
 
-            if (!(lastAllowed < _maxOcc)) {
-                return true;
+        if (!(lastAllowed < _maxOcc)) {
+            return true;
+        }
+        do {
+            ++front.curPos;
+            if (front.curPos == front.endPos) {
+                return false;
             }
-            do {
-                ++front.curPos;
-                if (front.curPos == front.endPos) {
-                    return false;
-                }
-                lastAllowed = *front.curPos;
-                lastAllowed.setPosition(front.curPos->getPosition() + window);
-            } while (lastAllowed < _maxOcc);
+            lastAllowed = *front.curPos;
+            lastAllowed.setPosition(front.curPos->getPosition() + window());
+        } while (lastAllowed < _maxOcc);
 
-            update(*front.curPos);
-            _queue.adjust();
-        }
+        update(*front.curPos);
+        _queue.adjust();
     }
-};
-
-} // namespace <unnamed>
+}
 
 bool
 NearSearch::Matcher::match(uint32_t docId)
 {
-    Iterators pos;
+    _queue.clear();
+    _maxOcc = TermFieldMatchDataPositionKey();
     for (uint32_t i = 0, len = inputs().size(); i < len; ++i) {
         const search::fef::TermFieldMatchData *term = inputs()[i];
         if (term->getDocId() != docId || term->begin() == term->end()) {
@@ -202,11 +194,11 @@ NearSearch::Matcher::match(uint32_t docId)
             return false;
         }
         LOG(debug, "Got positions iterator for term %d.", i);
-        pos.add(term);
+        add(term);
     }
 
     // Look for matching window.
-    return pos.match(window());
+    return findWindow();
 }
 
 bool
@@ -236,7 +228,8 @@ bool
 ONearSearch::Matcher::match(uint32_t docId)
 {
     uint32_t numTerms = inputs().size();
-    PositionsIteratorList pos;
+    PositionsIteratorList &pos = _pos;
+    pos.clear();
     for (uint32_t i = 0; i < numTerms; ++i) {
         const search::fef::TermFieldMatchData *term = inputs()[i];
         if (term->getDocId() != docId || term->begin() == term->end()) {
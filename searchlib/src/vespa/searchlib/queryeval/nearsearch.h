@@ -3,6 +3,7 @@
 
 #include <vespa/searchlib/fef/termfieldmatchdata.h>
 #include <vespa/searchlib/fef/termfieldmatchdataarray.h>
+#include <vespa/vespalib/util/priority_queue.h>
 #include "andsearch.h"
 
 namespace search::queryeval {
@@ -86,11 +87,25 @@ public:
 class NearSearch : public NearSearchBase
 {
 private:
+    struct PosIter {
+        search::fef::TermFieldMatchData::PositionsIterator curPos;
+        search::fef::TermFieldMatchData::PositionsIterator endPos;
+        bool operator<(const PosIter &other) const;
+    };
+
     struct Matcher : public NearSearchBase::MatcherBase
     {
         Matcher(uint32_t win, uint32_t fieldId, const TermFieldMatchDataArray &in)
-            : MatcherBase(win, fieldId, in) {}
+            : MatcherBase(win, fieldId, in), _queue(), _maxOcc() {}
         bool match(uint32_t docId);
+    private:
+        void update(search::fef::TermFieldMatchDataPositionKey occ);
+        void add(const search::fef::TermFieldMatchData *term);
+        bool findWindow();
+        // The queue is reused between candidate documents to avoid
+        // allocating a new one for every match check.
+        vespalib::PriorityQueue<PosIter>           _queue;
+        search::fef::TermFieldMatchDataPositionKey _maxOcc;
     };
 
     std::vector<Matcher> _matchers;
@@ -121,8 +136,12 @@ private:
     struct Matcher : public NearSearchBase::MatcherBase
     {
         Matcher(uint32_t win, uint32_t fieldId, const TermFieldMatchDataArray &in)
-            : MatcherBase(win, fieldId, in) {}
+            : MatcherBase(win, fieldId, in), _pos() {}
         bool match(uint32_t docId);
+    private:
+        // Reused between candidate documents to avoid allocating a new
+        // iterator list for every match check.
+        PositionsIteratorList _pos;
     };
 
     std::vector<Matcher> _matchers;
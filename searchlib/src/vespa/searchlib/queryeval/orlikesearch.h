@@ -4,6 +4,7 @@
 
 #include "orsearch.h"
 #include <vespa/vespalib/objects/visit.h>
+#include <algorithm>
 
 namespace search::queryeval {
 
@@ -33,6 +34,46 @@ protected:
         }
     }
     Trinary is_strict() const override { return strict ? Trinary::True : Trinary::False; }
+    uint32_t seek_block(uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity) override {
+        if constexpr (!strict) {
+            return OrSearch::seek_block(begin_id, end_id, hits, capacity);
+        }
+        const Children & children(getChildren());
+        _block_scratch.resize(capacity);
+        uint32_t cnt = 0;
+        uint32_t block_begin = begin_id;
+        while (cnt < capacity) {
+            uint32_t block_end = end_id;
+            for (uint32_t i = 0; i < children.size(); ++i) {
+                uint32_t n = children[i]->seek_block(block_begin, block_end, _block_scratch.data(), capacity);
+                if (n == capacity) {
+                    // child filled its buffer before block_end; shrink the block
+                    block_end = _block_scratch[n - 1] + 1;
+                }
+                if (_pending.empty()) {
+                    _pending.assign(_block_scratch.begin(), _block_scratch.begin() + n);
+                } else {
+                    _merge_scratch.clear();
+                    std::set_union(_pending.begin(), _pending.end(),
+                                   _block_scratch.begin(), _block_scratch.begin() + n,
+                                   std::back_inserter(_merge_scratch));
+                    _pending.swap(_merge_scratch);
+                }
+            }
+            // serve merged hits covered by the block; hits beyond a
+            // shrunken block stay pending for later calls
+            size_t served = 0;
+            while ((served < _pending.size()) && (_pending[served] < block_end) && (cnt < capacity)) {
+                hits[cnt++] = _pending[served++];
+            }
+            _pending.erase(_pending.begin(), _pending.begin() + served);
+            if (block_end >= end_id) {
+                break;
+            }
+            block_begin = block_end;
+        }
+        return cnt;
+    }
     void visitMembers(vespalib::ObjectVisitor &visitor) const override {
         MultiSearch::visitMembers(visitor);
         visit(visitor, "strict", strict);
@@ -63,7 +104,14 @@ private:
     bool needUnpack(size_t index) const override {
         return _unpacker.needUnpack(index);
     }
+    void initRange(uint32_t begin, uint32_t end) override {
+        OrSearch::initRange(begin, end);
+        _pending.clear();
+    }
     Unpack _unpacker;
+    std::vector<uint32_t> _block_scratch;
+    std::vector<uint32_t> _merge_scratch;
+    std::vector<uint32_t> _pending;
 };
 
 template <typename Unpack, typename HEAP, typename ref_t>
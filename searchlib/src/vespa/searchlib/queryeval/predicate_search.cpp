@@ -142,6 +142,7 @@ PredicateSearch::PredicateSearch(const uint8_t * minFeatureVector,
       _doc_ids(_posting_lists.size()),
       _intervals(_posting_lists.size()),
       _subqueries(_posting_lists.size()),
+      _all_subqueries_default(true),
       _subquery_markers(new uint64_t[max_interval_range+1]),
       _visited(new bool[max_interval_range+1]),
       _termFieldMatchData(tfmda.valid()? tfmda[0] : nullptr),
@@ -153,6 +154,7 @@ PredicateSearch::PredicateSearch(const uint8_t * minFeatureVector,
         _sorted_indexes[i] = i;
         _doc_ids[i] = _posting_lists[i]->getDocId();
         _subqueries[i] = _posting_lists[i]->getSubquery();
+        _all_subqueries_default &= (_subqueries[i] == UINT64_MAX);
     }
 }
 
@@ -257,6 +259,9 @@ PredicateSearch::evaluateHit(uint32_t doc_id, uint32_t k) {
     size_t candidates = sortIntervals(doc_id, k);
 
     size_t interval_end = _interval_range_vector[doc_id];
+    if (_all_subqueries_default && (interval_end < 64)) {
+        return evaluateHitCompact(candidates, interval_end);
+    }
     memset(_subquery_markers, 0, sizeof(uint64_t) * (interval_end + 1));
     memset(_visited, false, sizeof(bool) * (interval_end + 1));
     _subquery_markers[0] = UINT64_MAX;
@@ -281,6 +286,64 @@ PredicateSearch::evaluateHit(uint32_t doc_id, uint32_t k) {
     return _subquery_markers[interval_end] != 0;
 }
 
+/*
+ * Specialized version of evaluateHit() for the common case where no
+ * posting list is restricted to a subset of the subqueries. All
+ * subquery markers are then either 0 or UINT64_MAX, so for documents
+ * with a short interval range the cover state collapses to one
+ * visited bit and one marker bit per interval boundary, carried in
+ * registers instead of the per-document cleared marker arrays.
+ * Marks only propagate towards higher interval boundaries, so marks
+ * outside the tracked window can never contribute to the end marker
+ * and are safe to skip.
+ */
+bool
+PredicateSearch::evaluateHitCompact(size_t candidates, uint32_t interval_end) {
+    uint64_t visited = 1;
+    uint64_t markers = 1;
+    uint32_t highest_end_seen = 1;
+    for (size_t i = 0; i < candidates; ) {
+        size_t index = _sorted_indexes[i];
+        uint32_t interval = _intervals[index];
+        uint32_t begin = interval >> 16;
+        uint32_t end = interval & 0xffff;
+        uint32_t last_end_seen;
+        if (isNotInterval(begin, end)) {
+            // Note: End and begin values are swapped for zStar intervals
+            if (highest_end_seen < end) {
+                return false;
+            }
+            if ((begin < 64) && ((visited >> end) & 1)) {
+                visited |= (uint64_t(1) << begin);
+                markers |= ((~(markers >> end)) & 1) << begin;
+            }
+            last_end_seen = begin;
+        } else {
+            if (highest_end_seen < begin - 1) {
+                return false;
+            }
+            if ((end < 64) && ((visited >> (begin - 1)) & 1)) {
+                visited |= (uint64_t(1) << end);
+                markers |= ((markers >> (begin - 1)) & 1) << end;
+            }
+            last_end_seen = end;
+        }
+        highest_end_seen = std::max(last_end_seen, highest_end_seen);
+        if (_posting_lists[index]->nextInterval()) {
+            _intervals[index] = _posting_lists[index]->getInterval();
+            restoreSortedOrder(i, candidates, _sorted_indexes, _intervals);
+        } else {
+            ++i;
+        }
+    }
+    if ((markers >> interval_end) & 1) {
+        // doUnpack() reads the end marker for the matched document.
+        _subquery_markers[interval_end] = UINT64_MAX;
+        return true;
+    }
+    return false;
+}
+
 size_t
 PredicateSearch::sortIntervals(uint32_t doc_id, uint32_t k) {
     size_t candidates = k + 1;
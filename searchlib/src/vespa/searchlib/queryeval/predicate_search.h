@@ -38,6 +38,7 @@ class PredicateSearch : public SearchIterator {
     std::vector<uint32_t> _doc_ids;
     std::vector<uint32_t> _intervals;
     std::vector<uint64_t> _subqueries;
+    bool _all_subqueries_default;
     uint64_t *_subquery_markers;
     bool * _visited;
     fef::TermFieldMatchData *_termFieldMatchData;
@@ -47,6 +48,7 @@ class PredicateSearch : public SearchIterator {
     VESPA_DLL_LOCAL bool advanceOneTo(uint32_t doc_id, size_t index);
     VESPA_DLL_LOCAL void advanceAllTo(uint32_t doc_id);
     VESPA_DLL_LOCAL bool evaluateHit(uint32_t doc_id, uint32_t k);
+    VESPA_DLL_LOCAL bool evaluateHitCompact(size_t candidates, uint32_t interval_end);
     VESPA_DLL_LOCAL size_t sortIntervals(uint32_t doc_id, uint32_t k);
     VESPA_DLL_LOCAL void skipMinFeature(uint32_t doc_id) __attribute__((noinline));
 
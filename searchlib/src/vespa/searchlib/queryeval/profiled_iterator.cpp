@@ -42,9 +42,10 @@ std::unique_ptr<SearchIterator> create(Profiler &profiler,
     return std::make_unique<ProfiledIterator>(profiler, std::move(search),
                                               profiler.resolve(prefix + "init"),
                                               profiler.resolve(prefix + "seek"),
+                                              profiler.resolve(prefix + "hit"),
                                               profiler.resolve(prefix + "unpack"),
                                               profiler.resolve(prefix + "termwise"),
-                                              ctor_token);    
+                                              ctor_token);
 }
 
 }
@@ -64,6 +65,9 @@ ProfiledIterator::doSeek(uint32_t docid)
     TaskGuard guard(_profiler, _seek_tag);
     _search->doSeek(docid);
     setDocId(_search->getDocId());
+    if (getDocId() == docid) {
+        _profiler.count(_hit_tag);
+    }
 }
 
 void
@@ -16,6 +16,10 @@ namespace search::queryeval {
  * 'unpack' -> doUnpack
  * 'termwise' -> get_hits, or_hits_into, and_hits_into
  *
+ * In addition, each seek that matches the requested document is
+ * counted as a 'hit' sub-task of 'seek', making the seeks-per-hit
+ * ratio of each iterator visible in the profile.
+ *
  * The full name of each profiled task will be the path down the
  * iterator tree combined with the class name and the operation name.
  **/
@@ -27,6 +31,7 @@ private:
     std::unique_ptr<SearchIterator> _search;
     Profiler::TaskId _init_tag;
     Profiler::TaskId _seek_tag;
+    Profiler::TaskId _hit_tag;
     Profiler::TaskId _unpack_tag;
     Profiler::TaskId _termwise_tag;
     struct ctor_tag{};
@@ -35,11 +40,12 @@ public:
                      std::unique_ptr<SearchIterator> search,
                      Profiler::TaskId init_tag,
                      Profiler::TaskId seek_tag,
+                     Profiler::TaskId hit_tag,
                      Profiler::TaskId unpack_tag,
                      Profiler::TaskId termwise_tag,
                      ctor_tag) noexcept
       : _profiler(profiler), _search(std::move(search)),
-        _init_tag(init_tag), _seek_tag(seek_tag),
+        _init_tag(init_tag), _seek_tag(seek_tag), _hit_tag(hit_tag),
         _unpack_tag(unpack_tag), _termwise_tag(termwise_tag) {}
     void initRange(uint32_t begin_id, uint32_t end_id) override;
     void doSeek(uint32_t docid) override;
@@ -1,6 +1,7 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "searchiterator.h"
+#include "execution_arena.h"
 #include <vespa/searchlib/index/docidandfeatures.h>
 #include <vespa/vespalib/objects/objectdumper.h>
 #include <vespa/vespalib/objects/object2slime.h>
@@ -11,6 +12,30 @@
 
 namespace search::queryeval {
 
+void *
+SearchIterator::operator new(size_t sz)
+{
+    return ExecutionArena::alloc_tagged(sz, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void *
+SearchIterator::operator new(size_t sz, std::align_val_t align)
+{
+    return ExecutionArena::alloc_tagged(sz, size_t(align));
+}
+
+void
+SearchIterator::operator delete(void *p) noexcept
+{
+    ExecutionArena::free_tagged(p);
+}
+
+void
+SearchIterator::operator delete(void *p, std::align_val_t) noexcept
+{
+    ExecutionArena::free_tagged(p);
+}
+
 BitVector::UP
 SearchIterator::get_hits(uint32_t begin_id)
 {
@@ -26,6 +51,18 @@ SearchIterator::get_hits(uint32_t begin_id)
     return result;
 }
 
+uint32_t
+SearchIterator::seek_block(uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity)
+{
+    uint32_t cnt = 0;
+    uint32_t docid = seekFirst(std::max(begin_id, getDocId()));
+    while ((docid < end_id) && (cnt < capacity)) {
+        hits[cnt++] = docid;
+        docid = seekNext(docid + 1);
+    }
+    return cnt;
+}
+
 SearchIterator::UP
 SearchIterator::andWith(UP filter, uint32_t estimate)
 {
@@ -7,6 +7,7 @@
 #include <vespa/vespalib/stllike/string.h>
 #include <vespa/vespalib/util/trinary.h>
 #include <memory>
+#include <new>
 #include <vector>
 #include <functional>
 
@@ -77,6 +78,15 @@ protected:
 
 public:
     using Trinary=vespalib::Trinary;
+
+    // Iterator trees are built per query; when an ExecutionArena is
+    // active on the thread the memory comes from the arena and is
+    // reclaimed wholesale when the query completes.
+    static void *operator new(size_t sz);
+    static void *operator new(size_t sz, std::align_val_t align);
+    static void operator delete(void *p) noexcept;
+    static void operator delete(void *p, std::align_val_t align) noexcept;
+
     // doSeek and doUnpack are called by templated classes, so making
     // them public to avoid complicated friend requests. Note that if
     // you call doSeek and doUnpack directly instead of using
@@ -177,6 +187,29 @@ public:
      **/
     virtual void and_hits_into(BitVector &result, uint32_t begin_id);
 
+    /**
+     * Find hits in the docid range [begin_id, end_id) and write them
+     * in increasing order to the given hit buffer, at most capacity
+     * entries. This allows block-at-a-time evaluation where
+     * intermediate iterators merge arrays of hits from their children
+     * instead of performing one virtual seek per candidate
+     * document. The iterator must be strict and blocks must be
+     * requested in forward contiguous order; when the buffer is
+     * filled before end_id is reached, issue another call starting
+     * just past the last hit returned. A return value less than
+     * capacity means the requested range has been fully
+     * evaluated. Callers should not rely on getDocId() between block
+     * calls, as implementations may leave the visible docid lagging
+     * behind the evaluated range.
+     *
+     * @return number of hits written to the buffer
+     * @param begin_id the lowest hit candidate in the block
+     * @param end_id the first docid after the block
+     * @param hits buffer to receive matching docids
+     * @param capacity maximum number of hits to write
+     **/
+    virtual uint32_t seek_block(uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity);
+
 public:
     using UP = std::unique_ptr<SearchIterator>;
 
@@ -90,20 +90,6 @@ public:
         }
     }
 
-    bool hasMatch() {
-        if (_tmds.size() == 1) {
-            return true;
-        }
-
-        while (iterator(_eval_order[0]) != end(_eval_order[0])) {
-            if (match()) {
-                return true;
-            }
-            ++iterator(_eval_order[0]);
-        }
-        return false;
-    }
-
     void fillPositions(TermFieldMatchData &tmd) {
         if (_tmds.size() == 1) {
             if (tmd.needs_normal_features()) {
@@ -155,12 +141,62 @@ SimplePhraseSearch::phraseSeek(uint32_t doc_id) {
 
 void
 SimplePhraseSearch::matchPhrase(uint32_t doc_id) {
-    AndSearch::doUnpack(doc_id);
-    if (PhraseMatcher(_childMatch, _eval_order, _iterators).hasMatch()) {
+    if (unpackAndMatch(doc_id)) {
         setDocId(doc_id);
     }
 }
 
+bool
+SimplePhraseSearch::unpackAndMatch(uint32_t doc_id) {
+    // Children are unpacked lazily in evaluation order so that the
+    // (often large) position lists of the most frequent terms are
+    // never decoded when the positions of the rarer terms already
+    // rule out a phrase match.
+    const Children &children = getChildren();
+    uint32_t first = _eval_order[0];
+    children[first]->doUnpack(doc_id);
+    if (children.size() == 1) {
+        return true;
+    }
+    _candidates.clear();
+    for (const fef::TermFieldMatchDataPosition &pos : *_childMatch[first]) {
+        if (pos.getPosition() >= first) {
+            // this position is late enough in the element to allow a
+            // match of the preceding phrase terms
+            _candidates.emplace_back(pos.getElementId(), pos.getPosition() - first);
+        }
+    }
+    for (size_t i = 1; (i < _eval_order.size()) && !_candidates.empty(); ++i) {
+        uint32_t word_index = _eval_order[i];
+        children[word_index]->doUnpack(doc_id);
+        filterCandidates(word_index);
+    }
+    return !_candidates.empty();
+}
+
+void
+SimplePhraseSearch::filterCandidates(uint32_t word_index) {
+    auto it = _childMatch[word_index]->begin();
+    auto it_end = _childMatch[word_index]->end();
+    size_t out = 0;
+    for (const auto &cand : _candidates) {
+        uint32_t position = cand.second + word_index;
+        while ((it != it_end) &&
+               ((it->getElementId() < cand.first) ||
+                ((it->getElementId() == cand.first) && (it->getPosition() < position))))
+        {
+            ++it;
+        }
+        if (it == it_end) {
+            break;
+        }
+        if ((it->getElementId() == cand.first) && (it->getPosition() == position)) {
+            _candidates[out++] = cand;
+        }
+    }
+    _candidates.resize(out);
+}
+
 
 SimplePhraseSearch::SimplePhraseSearch(Children children,
                                        fef::MatchData::UP md,
@@ -173,7 +209,8 @@ SimplePhraseSearch::SimplePhraseSearch(Children children,
       _eval_order(std::move(eval_order)),
       _tmd(tmd),
       _strict(strict),
-      _iterators(getChildren().size())
+      _iterators(getChildren().size()),
+      _candidates()
 {
     assert( ! getChildren().empty());
     assert(getChildren().size() == _childMatch.size());
@@ -26,9 +26,14 @@ class SimplePhraseSearch : public AndSearch
     using It = fef::TermFieldMatchData::PositionsIterator;
     // Reuse this vector instead of allocating a new one when needed.
     std::vector<It> _iterators;
+    // Candidate (element id, phrase start position) pairs, reused
+    // between documents.
+    std::vector<std::pair<uint32_t, uint32_t>> _candidates;
 
     VESPA_DLL_LOCAL void phraseSeek(uint32_t doc_id);
     VESPA_DLL_LOCAL void matchPhrase(uint32_t doc_id) __attribute__((noinline));
+    VESPA_DLL_LOCAL bool unpackAndMatch(uint32_t doc_id);
+    VESPA_DLL_LOCAL void filterCandidates(uint32_t word_index);
     VESPA_DLL_LOCAL void doStrictSeek(uint32_t doc_id) __attribute__((noinline));
 public:
     /**
@@ -98,8 +98,17 @@ public:
     void doUnpack(uint32_t docid) override {
         score_t score = _algo.get_full_score(_terms, _heaps, DotProductScorer());
         if (!_readonly_scores_heap) {
-            _localScores.push_back(score);
-            if (_localScores.size() == _matchParams.scoresAdjustFrequency) {
+            score_t min_score = _matchParams.scores.getMinScore();
+            if ((min_score == 0) || (score > min_score)) {
+                _localScores.push_back(score);
+            }
+            // Once the shared threshold has passed the initial one,
+            // qualifying scores are rare, so publish them at once to
+            // tighten the threshold for all threads instead of
+            // sitting on them until the buffer fills up.
+            if ((_localScores.size() == _matchParams.scoresAdjustFrequency) ||
+                (!_localScores.empty() && (min_score > _matchParams.scoreThreshold)))
+            {
                 _matchParams.scores.adjust(&_localScores[0], &_localScores[0] + _localScores.size());
                 _localScores.clear();
             }
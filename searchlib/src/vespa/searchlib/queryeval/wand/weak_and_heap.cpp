@@ -49,6 +49,23 @@ SharedWeakAndPriorityQueue::~SharedWeakAndPriorityQueue() = default;
 
 void
 SharedWeakAndPriorityQueue::adjust(score_t *begin, score_t *end) {
+    // Drop scores that cannot enter the heap before taking the lock,
+    // so that threads can publish their scores frequently without
+    // contending once the global threshold has tightened. The min
+    // score only increases, so this filter is safe without the lock.
+    score_t min_score = getMinScore();
+    if (min_score > 0) {
+        score_t *keep = begin;
+        for (score_t *itr = begin; itr != end; ++itr) {
+            if (*itr > min_score) {
+                *keep++ = *itr;
+            }
+        }
+        end = keep;
+        if (begin == end) {
+            return;
+        }
+    }
     std::lock_guard guard(_lock);
     WeakAndPriorityQueue::adjust(begin, end);
 }
@@ -56,6 +56,9 @@ private:
     ref_t                                         *_data_stash;
     ref_t                                         *_data_end;
     IteratorPack                                   _children;
+    std::vector<uint32_t>                          _block_scratch;
+    std::vector<uint32_t>                          _merge_scratch;
+    std::vector<uint32_t>                          _pending;
 
     void seek_child(ref_t child, uint32_t docId) {
         _termPos[child] = _children.seek(child, docId);
@@ -84,7 +87,10 @@ public:
           _data_begin(nullptr),
           _data_stash(nullptr),
           _data_end(nullptr),
-          _children(std::move(iteratorPack))
+          _children(std::move(iteratorPack)),
+          _block_scratch(),
+          _merge_scratch(),
+          _pending()
     {
         HEAP::require_left_heap();
         assert(_children.size() > 0);
@@ -138,6 +144,7 @@ public:
     void initRange(uint32_t begin, uint32_t end) override {
         WeightedSetTermSearch::initRange(begin, end);
         _children.initRange(begin, end);
+        _pending.clear();
         for (size_t i = 0; i < _children.size(); ++i) {
             _termPos[i] = _children.get_docid(i);
         }
@@ -148,6 +155,48 @@ public:
     }
     Trinary is_strict() const override { return Trinary::True; }
 
+    uint32_t seek_block(uint32_t begin_id, uint32_t end_id, uint32_t *hits, uint32_t capacity) override {
+        if constexpr (unpack_type == UnpackType::DocidAndWeights) {
+            // weight unpacking needs the heap to track every child;
+            // stay on the generic one-docid-at-a-time path
+            return WeightedSetTermSearch::seek_block(begin_id, end_id, hits, capacity);
+        }
+        // batched union of per-child docid blocks; avoids the per-doc
+        // heap churn that dominates large weighted sets
+        _block_scratch.resize(capacity);
+        uint32_t cnt = 0;
+        uint32_t block_begin = begin_id;
+        while (cnt < capacity) {
+            uint32_t block_end = end_id;
+            for (ref_t i = 0; i < _children.size(); ++i) {
+                uint32_t n = _children.seek_block(i, block_begin, block_end, _block_scratch.data(), capacity);
+                if (n == capacity) {
+                    // child filled its buffer before block_end; shrink the block
+                    block_end = _block_scratch[n - 1] + 1;
+                }
+                if (_pending.empty()) {
+                    _pending.assign(_block_scratch.begin(), _block_scratch.begin() + n);
+                } else {
+                    _merge_scratch.clear();
+                    std::set_union(_pending.begin(), _pending.end(),
+                                   _block_scratch.begin(), _block_scratch.begin() + n,
+                                   std::back_inserter(_merge_scratch));
+                    _pending.swap(_merge_scratch);
+                }
+            }
+            size_t served = 0;
+            while ((served < _pending.size()) && (_pending[served] < block_end) && (cnt < capacity)) {
+                hits[cnt++] = _pending[served++];
+            }
+            _pending.erase(_pending.begin(), _pending.begin() + served);
+            if (block_end >= end_id) {
+                break;
+            }
+            block_begin = block_end;
+        }
+        return cnt;
+    }
+
     void visitMembers(vespalib::ObjectVisitor &) const override { }
 
     BitVector::UP get_hits(uint32_t begin_id) override {
@@ -17,12 +17,25 @@ template <typename VectorStoreType>
 class BoundEuclideanDistance final : public BoundDistanceFunction {
 private:
     using FloatType = VectorStoreType::FloatType;
+    using FixedKernel = vespalib::hwaccelerated::IAccelerated::EuclideanDistanceKernelF32;
     const vespalib::hwaccelerated::IAccelerated & _computer;
+    const FixedKernel _fixed_kernel;
     mutable VectorStoreType _tmpSpace;
     const vespalib::ConstArrayRef<FloatType> _lhs_vector;
+
+    static FixedKernel select_fixed_kernel(const vespalib::hwaccelerated::IAccelerated & computer, size_t sz) noexcept {
+        if constexpr (std::is_same_v<FloatType, float>) {
+            return computer.squaredEuclideanDistanceKernel(sz);
+        } else {
+            (void) computer;
+            (void) sz;
+            return nullptr;
+        }
+    }
 public:
     explicit BoundEuclideanDistance(TypedCells lhs)
         : _computer(vespalib::hwaccelerated::IAccelerated::getAccelerator()),
+          _fixed_kernel(select_fixed_kernel(_computer, lhs.size)),
           _tmpSpace(lhs.size),
           _lhs_vector(_tmpSpace.storeLhs(lhs))
     {}
@@ -30,6 +43,11 @@ public:
         vespalib::ConstArrayRef<FloatType> rhs_vector = _tmpSpace.convertRhs(rhs);
         auto a = _lhs_vector.data();
         auto b = rhs_vector.data();
+        if constexpr (std::is_same_v<FloatType, float>) {
+            if (_fixed_kernel != nullptr) {
+                return _fixed_kernel(a, b);
+            }
+        }
         return _computer.squaredEuclideanDistance(cast(a), cast(b), _lhs_vector.size());
     }
     double convert_threshold(double threshold) const noexcept override {
@@ -20,6 +20,7 @@
 #include <vespa/vespalib/util/doom.h>
 #include <vespa/vespalib/util/memory_allocator.h>
 #include <vespa/vespalib/util/size_literals.h>
+#include <vespa/vespalib/util/small_vector.h>
 #include <vespa/vespalib/util/time.h>
 #include <vespa/log/log.h>
 
@@ -329,6 +330,51 @@ calc_distance_helper(const BoundDistanceFunction &df, vespalib::eval::TypedCells
     return df.calc(rhs);
 }
 
+/*
+ * Below this filter selectivity the layer search routes around
+ * filtered-out nodes via their neighbors (two-hop bridging) instead of
+ * scoring them, cf. search_layer_helper().
+ */
+constexpr double TWO_HOP_FILTER_SELECTIVITY_LIMIT = 0.2;
+
+/*
+ * Start fetching the head of a neighbor vector while other neighbors
+ * are gathered, so the distance calculations don't stall on a cache
+ * miss per candidate. Prefetching past the end of small vectors is
+ * harmless.
+ */
+void
+prefetch_vector_head(vespalib::eval::TypedCells cells)
+{
+    const char* data = static_cast<const char*>(cells.data);
+    __builtin_prefetch(data, 0);
+    __builtin_prefetch(data + 64, 0);
+    __builtin_prefetch(data + 128, 0);
+    __builtin_prefetch(data + 192, 0);
+}
+
+/*
+ * Neighbor gathered during graph traversal, with its vector cells
+ * resolved so distances can be computed in a separate pass.
+ */
+struct GatheredNeighbor {
+    uint32_t nodeid;
+    vespalib::datastore::EntryRef levels_ref;
+    uint32_t docid;
+    uint32_t subspace;
+    vespalib::eval::TypedCells cells;
+
+    GatheredNeighbor(uint32_t nodeid_in, vespalib::datastore::EntryRef levels_ref_in, uint32_t docid_in,
+                     uint32_t subspace_in, vespalib::eval::TypedCells cells_in) noexcept
+        : nodeid(nodeid_in),
+          levels_ref(levels_ref_in),
+          docid(docid_in),
+          subspace(subspace_in),
+          cells(cells_in)
+    {
+    }
+};
+
 }
 
 template <HnswIndexType type>
@@ -376,22 +422,31 @@ HnswCandidate
 HnswIndex<type>::find_nearest_in_layer(const BoundDistanceFunction &df, const HnswCandidate& entry_point, uint32_t level) const
 {
     HnswCandidate nearest = entry_point;
+    vespalib::SmallVector<GatheredNeighbor, 32> gathered;
     bool keep_searching = true;
     while (keep_searching) {
         keep_searching = false;
+        // Gather the neighbors and start fetching their vectors before
+        // any distances are computed, cf. search_layer_helper().
         for (uint32_t neighbor_nodeid : _graph.get_link_array(nearest.levels_ref, level)) {
             auto& neighbor_node = _graph.acquire_node(neighbor_nodeid);
             auto neighbor_ref = neighbor_node.levels_ref().load_acquire();
             uint32_t neighbor_docid = acquire_docid(neighbor_node, neighbor_nodeid);
             uint32_t neighbor_subspace = neighbor_node.acquire_subspace();
-            double dist = calc_distance(df, neighbor_docid, neighbor_subspace);
-            if (_graph.still_valid(neighbor_nodeid, neighbor_ref)
+            auto neighbor_cells = get_vector(neighbor_docid, neighbor_subspace);
+            prefetch_vector_head(neighbor_cells);
+            gathered.emplace_back(neighbor_nodeid, neighbor_ref, neighbor_docid, neighbor_subspace, neighbor_cells);
+        }
+        for (const auto& neighbor : gathered) {
+            double dist = calc_distance_helper(df, neighbor.cells);
+            if (_graph.still_valid(neighbor.nodeid, neighbor.levels_ref)
                 && dist < nearest.distance)
             {
-                nearest = HnswCandidate(neighbor_nodeid, neighbor_docid, neighbor_ref, dist);
+                nearest = HnswCandidate(neighbor.nodeid, neighbor.docid, neighbor.subspace, neighbor.levels_ref, dist);
                 keep_searching = true;
             }
         }
+        gathered.clear();
     }
     return nearest;
 }
@@ -426,6 +481,19 @@ HnswIndex<type>::search_layer_helper(const BoundDistanceFunction &df, uint32_t n
         }
     }
     double limit_dist = std::numeric_limits<double>::max();
+    vespalib::SmallVector<GatheredNeighbor, 32> gathered;
+    /*
+     * With a selective filter, most neighbors fail the filter and their
+     * distances only steer the traversal. Instead of scoring them, use
+     * them as bridges to their own (filter-passing) neighbors, keeping
+     * the filtered subgraph connected while only computing distances
+     * for docs that can become hits.
+     */
+    bool two_hop_bridging = false;
+    if ((filter != nullptr) && filter->is_active() && (filter->size() > 0)) {
+        double selectivity = double(filter->count()) / filter->size();
+        two_hop_bridging = (selectivity < TWO_HOP_FILTER_SELECTIVITY_LIMIT);
+    }
 
     while (!candidates.empty()) {
         auto cand = candidates.top();
@@ -433,6 +501,8 @@ HnswIndex<type>::search_layer_helper(const BoundDistanceFunction &df, uint32_t n
             break;
         }
         candidates.pop();
+        // Gather the unvisited neighbors and start fetching their
+        // vectors before any distances are computed.
         for (uint32_t neighbor_nodeid : _graph.get_link_array(cand.levels_ref, level)) {
             if (neighbor_nodeid >= nodeid_limit) {
                 continue;
@@ -446,11 +516,41 @@ HnswIndex<type>::search_layer_helper(const BoundDistanceFunction &df, uint32_t n
             }
             uint32_t neighbor_docid = acquire_docid(neighbor_node, neighbor_nodeid);
             uint32_t neighbor_subspace = neighbor_node.acquire_subspace();
-            double dist_to_input = calc_distance(df, neighbor_docid, neighbor_subspace);
+            if (two_hop_bridging && !filter_wrapper.check(neighbor_docid)) {
+                for (uint32_t second_nodeid : _graph.get_link_array(neighbor_ref, level)) {
+                    if (second_nodeid >= nodeid_limit) {
+                        continue;
+                    }
+                    auto& second_node = _graph.acquire_node(second_nodeid);
+                    auto second_ref = second_node.levels_ref().load_acquire();
+                    if (! second_ref.valid()) {
+                        continue;
+                    }
+                    uint32_t second_docid = acquire_docid(second_node, second_nodeid);
+                    uint32_t second_subspace = second_node.acquire_subspace();
+                    // Leave filtered-out two-hop nodes unvisited so they
+                    // can bridge other parts of the graph later.
+                    if (!filter_wrapper.check(second_docid)
+                        || ! visited.try_mark(second_nodeid))
+                    {
+                        continue;
+                    }
+                    auto second_cells = get_vector(second_docid, second_subspace);
+                    prefetch_vector_head(second_cells);
+                    gathered.emplace_back(second_nodeid, second_ref, second_docid, second_subspace, second_cells);
+                }
+                continue;
+            }
+            auto neighbor_cells = get_vector(neighbor_docid, neighbor_subspace);
+            prefetch_vector_head(neighbor_cells);
+            gathered.emplace_back(neighbor_nodeid, neighbor_ref, neighbor_docid, neighbor_subspace, neighbor_cells);
+        }
+        for (const auto& neighbor : gathered) {
+            double dist_to_input = calc_distance_helper(df, neighbor.cells);
             if (dist_to_input < limit_dist) {
-                candidates.emplace(neighbor_nodeid, neighbor_ref, dist_to_input);
-                if (filter_wrapper.check(neighbor_docid)) {
-                    best_neighbors.emplace(neighbor_nodeid, neighbor_docid, neighbor_ref, dist_to_input);
+                candidates.emplace(neighbor.nodeid, neighbor.levels_ref, dist_to_input);
+                if (filter_wrapper.check(neighbor.docid)) {
+                    best_neighbors.emplace(neighbor.nodeid, neighbor.docid, neighbor.subspace, neighbor.levels_ref, dist_to_input);
                     while (best_neighbors.size() > neighbors_to_find) {
                         best_neighbors.pop();
                         limit_dist = best_neighbors.top().distance;
@@ -458,6 +558,7 @@ HnswIndex<type>::search_layer_helper(const BoundDistanceFunction &df, uint32_t n
                 }
             }
         }
+        gathered.clear();
         if (doom != nullptr && doom->soft_doom()) {
             break;
         }
@@ -546,8 +647,9 @@ HnswIndex<type>::internal_prepare_add_node(PreparedAddDoc& op, TypedCells input_
     auto df = _distance_ff->for_insertion_vector(input_vector);
     double entry_dist = calc_distance(*df, entry.nodeid);
     uint32_t entry_docid = get_docid(entry.nodeid);
+    uint32_t entry_subspace = _graph.acquire_node(entry.nodeid).acquire_subspace();
     // TODO: check if entry nodeid/levels_ref is still valid here
-    HnswCandidate entry_point(entry.nodeid, entry_docid, entry.levels_ref, entry_dist);
+    HnswCandidate entry_point(entry.nodeid, entry_docid, entry_subspace, entry.levels_ref, entry_dist);
     while (search_level > node_max_level) {
         entry_point = find_nearest_in_layer(*df, entry_point, search_level);
         --search_level;
@@ -959,8 +1061,9 @@ HnswIndex<type>::top_k_candidates(const BoundDistanceFunction &df, uint32_t k, c
     int search_level = entry.level;
     double entry_dist = calc_distance(df, entry.nodeid);
     uint32_t entry_docid = get_docid(entry.nodeid);
+    uint32_t entry_subspace = _graph.acquire_node(entry.nodeid).acquire_subspace();
     // TODO: check if entry docid/levels_ref is still valid here
-    HnswCandidate entry_point(entry.nodeid, entry_docid, entry.levels_ref, entry_dist);
+    HnswCandidate entry_point(entry.nodeid, entry_docid, entry_subspace, entry.levels_ref, entry_dist);
     while (search_level > 0) {
         entry_point = find_nearest_in_layer(df, entry_point, search_level);
         --search_level;
@@ -34,10 +34,18 @@ struct HnswTraversalCandidate {
  */
 struct HnswCandidate : public HnswTraversalCandidate {
     uint32_t docid;
+    uint32_t subspace;
 
     HnswCandidate(uint32_t nodeid_in, uint32_t docid_in, vespalib::datastore::EntryRef levels_ref_in, double distance_in) noexcept
         : HnswTraversalCandidate(nodeid_in, docid_in, levels_ref_in, distance_in),
-          docid(docid_in)
+          docid(docid_in),
+          subspace(0)
+    {
+    }
+    HnswCandidate(uint32_t nodeid_in, uint32_t docid_in, uint32_t subspace_in, vespalib::datastore::EntryRef levels_ref_in, double distance_in) noexcept
+        : HnswTraversalCandidate(nodeid_in, docid_in, levels_ref_in, distance_in),
+          docid(docid_in),
+          subspace(subspace_in)
     {
     }
 };
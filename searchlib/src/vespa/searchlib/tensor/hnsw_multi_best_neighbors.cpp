@@ -18,7 +18,7 @@ HnswMultiBestNeighbors::get_neighbors(uint32_t k, double distance_threshold)
         auto& hit = _candidates.top();
         uint32_t docid = hit.docid;
         if (remove_docid(docid) && (!(hit.distance > distance_threshold))) {
-            result.emplace_back(docid, hit.distance);
+            result.emplace_back(docid, hit.subspace, hit.distance);
         }
         _candidates.pop();
     }
@@ -60,9 +60,9 @@ public:
     bool empty() const { return _candidates.empty(); }
     const HnswCandidate& top() const { return _candidates.top(); }
     size_t size() const { return _docids.size(); }
-    void emplace(uint32_t nodeid, uint32_t docid, EntryRef ref, double distance) {
+    void emplace(uint32_t nodeid, uint32_t docid, uint32_t subspace, EntryRef ref, double distance) {
         add_docid(docid);
-        _candidates.emplace(nodeid, docid, ref, distance);
+        _candidates.emplace(nodeid, docid, subspace, ref, distance);
     }
 };
 
@@ -14,7 +14,7 @@ HnswSingleBestNeighbors::get_neighbors(uint32_t k, double distance_threshold)
     result.reserve(_candidates.size());
     for (const HnswCandidate & hit : _candidates.peek()) {
         if (hit.distance > distance_threshold) continue;
-        result.emplace_back(hit.docid, hit.distance);
+        result.emplace_back(hit.docid, hit.subspace, hit.distance);
     }
     return result;
 }
@@ -28,7 +28,7 @@ public:
     bool empty() const { return _candidates.empty(); }
     const HnswCandidate& top() const { return _candidates.top(); }
     size_t size() const { return _candidates.size(); }
-    void emplace(uint32_t nodeid, uint32_t docid, EntryRef ref, double distance) { _candidates.emplace(nodeid, docid, ref, distance); }
+    void emplace(uint32_t nodeid, uint32_t docid, uint32_t subspace, EntryRef ref, double distance) { _candidates.emplace(nodeid, docid, subspace, ref, distance); }
 };
 
 }
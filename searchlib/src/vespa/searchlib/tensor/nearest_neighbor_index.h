@@ -43,11 +43,15 @@ public:
     using generation_t = vespalib::GenerationHandler::generation_t;
     struct Neighbor {
         uint32_t docid;
+        uint32_t subspace; // winning subspace for multi-vector documents, 0 otherwise
         double distance;
         Neighbor(uint32_t id, double dist) noexcept
-          : docid(id), distance(dist)
+          : docid(id), subspace(0), distance(dist)
         {}
-        Neighbor() noexcept : docid(0), distance(0.0) {}
+        Neighbor(uint32_t id, uint32_t subspace_in, double dist) noexcept
+          : docid(id), subspace(subspace_in), distance(dist)
+        {}
+        Neighbor() noexcept : docid(0), subspace(0), distance(0.0) {}
         bool operator==(const Neighbor& rhs) const {
             return docid == rhs.docid && distance == rhs.distance;
         }
@@ -206,7 +206,7 @@ TensorAttributeLoader::TensorAttributeLoader(TensorAttribute& attr, GenerationHa
 TensorAttributeLoader::~TensorAttributeLoader() = default;
 
 void
-TensorAttributeLoader::load_dense_tensor_store(BlobSequenceReader& reader, uint32_t docid_limit, DenseTensorStore& dense_store)
+TensorAttributeLoader::load_dense_tensor_store(BlobSequenceReader& reader, uint32_t docid_limit, DenseTensorStore& dense_store, IndexBuilder* index_builder)
 {
     assert(reader.getVersion() == DENSE_TENSOR_ATTRIBUTE_VERSION);
     uint8_t presence_flag = 0;
@@ -216,6 +216,9 @@ TensorAttributeLoader::load_dense_tensor_store(BlobSequenceReader& reader, uint3
             auto raw = dense_store.allocRawBuffer();
             reader.readBlob(raw.data, dense_store.getBufSize());
             _ref_vector.push_back(AtomicEntryRef(raw.ref));
+            if (index_builder != nullptr) {
+                index_builder->add(lid);
+            }
         } else {
             _ref_vector.push_back(AtomicEntryRef());
         }
@@ -226,7 +229,7 @@ TensorAttributeLoader::load_dense_tensor_store(BlobSequenceReader& reader, uint3
 }
 
 void
-TensorAttributeLoader::load_tensor_store(BlobSequenceReader& reader, uint32_t docid_limit)
+TensorAttributeLoader::load_tensor_store(BlobSequenceReader& reader, uint32_t docid_limit, IndexBuilder* index_builder)
 {
     assert(reader.getVersion() == TENSOR_ATTRIBUTE_VERSION);
     vespalib::Array<char> buffer(1024);
@@ -240,6 +243,9 @@ TensorAttributeLoader::load_tensor_store(BlobSequenceReader& reader, uint32_t do
             vespalib::nbostream source(&buffer[0], tensorSize);
             EntryRef ref = _store.store_encoded_tensor(source);
             _ref_vector.push_back(AtomicEntryRef(ref));
+            if (index_builder != nullptr) {
+                index_builder->add(lid);
+            }
         } else {
             EntryRef invalid;
             _ref_vector.push_back(AtomicEntryRef(invalid));
@@ -250,23 +256,13 @@ TensorAttributeLoader::load_tensor_store(BlobSequenceReader& reader, uint32_t do
     }
 }
 
-void
-TensorAttributeLoader::build_index(vespalib::Executor* executor, uint32_t docid_limit)
+std::unique_ptr<IndexBuilder>
+TensorAttributeLoader::make_index_builder(vespalib::Executor* executor)
 {
-    std::unique_ptr<IndexBuilder> builder;
     if (executor != nullptr) {
-        builder = std::make_unique<ThreadedIndexBuilder>(_attr, _generation_handler, _store, *_index, *executor);
-    } else {
-        builder = std::make_unique<ForegroundIndexBuilder>(_attr, *_index);
-    }
-    for (uint32_t lid = 0; lid < docid_limit; ++lid) {
-        auto ref = _ref_vector[lid].load_relaxed();
-        if (ref.valid()) {
-            builder->add(lid);
-        }
+        return std::make_unique<ThreadedIndexBuilder>(_attr, _generation_handler, _store, *_index, *executor);
     }
-    builder->wait_complete();
-    _attr.commit();
+    return std::make_unique<ForegroundIndexBuilder>(_attr, *_index);
 }
 
 bool
@@ -304,20 +300,31 @@ TensorAttributeLoader::on_load(vespalib::Executor* executor)
     _ref_vector.reset();
     _ref_vector.unsafe_reserve(docid_limit);
     auto dense_store = _store.as_dense();
+    bool use_index_file = false;
+    if (_index != nullptr && has_index_file(_attr)) {
+        auto header = AttributeHeader::extractTags(reader.getDatHeader(), _attr.getBaseFileName());
+        use_index_file = can_use_index_save_file(_attr.getConfig(), header);
+    }
+    std::unique_ptr<IndexBuilder> builder;
+    if (_index != nullptr && !use_index_file) {
+        /*
+         * The index must be rebuilt. Feed docs to the builder as their
+         * tensors are loaded, so index preparation (on the shared
+         * executor when available) overlaps with reading the rest of
+         * the file. Graph mutation stays on this thread, cf. the
+         * prepare/complete split used when feeding.
+         */
+        builder = make_index_builder(executor);
+    }
     if (dense_store != nullptr) {
-        load_dense_tensor_store(reader, docid_limit, *dense_store);
+        load_dense_tensor_store(reader, docid_limit, *dense_store, builder.get());
     } else {
-        load_tensor_store(reader, docid_limit);
+        load_tensor_store(reader, docid_limit, builder.get());
     }
     _attr.commit();
     _attr.getStatus().setNumDocs(docid_limit);
     _attr.setCommittedDocIdLimit(docid_limit);
     if (_index != nullptr) {
-        bool use_index_file = false;
-        if (has_index_file(_attr)) {
-            auto header = AttributeHeader::extractTags(reader.getDatHeader(), _attr.getBaseFileName());
-            use_index_file = can_use_index_save_file(_attr.getConfig(), header);
-        }
         if (use_index_file) {
             if (!load_index()) {
                 return false;
@@ -326,7 +333,8 @@ TensorAttributeLoader::on_load(vespalib::Executor* executor)
                 check_consistency(docid_limit);
             }
         } else {
-            build_index(executor, docid_limit);
+            builder->wait_complete();
+            _attr.commit();
         }
     }
     return true;
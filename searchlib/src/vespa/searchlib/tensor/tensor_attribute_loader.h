@@ -4,6 +4,7 @@
 
 #include <vespa/vespalib/datastore/atomic_entry_ref.h>
 #include <vespa/vespalib/util/rcuvector.h>
+#include <memory>
 
 namespace search::attribute { class BlobSequenceReader; }
 
@@ -11,6 +12,8 @@ namespace vespalib { class Executor; }
 
 namespace search::tensor {
 
+inline namespace loader { class IndexBuilder; }
+
 class DenseTensorStore;
 class NearestNeighborIndex;
 class TensorAttribute;
@@ -30,9 +33,9 @@ class TensorAttributeLoader {
     TensorStore&          _store;
     NearestNeighborIndex* _index;
 
-    void load_dense_tensor_store(search::attribute::BlobSequenceReader& reader, uint32_t docid_limit, DenseTensorStore& dense_store);
-    void load_tensor_store(search::attribute::BlobSequenceReader& reader, uint32_t docid_limit);
-    void build_index(vespalib::Executor* executor, uint32_t docid_limit);
+    void load_dense_tensor_store(search::attribute::BlobSequenceReader& reader, uint32_t docid_limit, DenseTensorStore& dense_store, IndexBuilder* index_builder);
+    void load_tensor_store(search::attribute::BlobSequenceReader& reader, uint32_t docid_limit, IndexBuilder* index_builder);
+    std::unique_ptr<IndexBuilder> make_index_builder(vespalib::Executor* executor);
     bool load_index();
     void check_consistency(uint32_t docid_limit);
 
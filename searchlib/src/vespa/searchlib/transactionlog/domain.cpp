@@ -57,6 +57,10 @@ Domain::Domain(const string &domainName, const string & baseDir, vespalib::Execu
       _sessionMutex(),
       _sessions(),
       _maxSessionRunTime(),
+      _pendingCommits(0),
+      _pendingSync(),
+      _lastSync(vespalib::steady_clock::now()),
+      _syncLatency(vespalib::duration::zero()),
       _baseDir(baseDir),
       _fileHeaderContext(fileHeaderContext),
       _markedDeleted(false)
@@ -222,7 +226,7 @@ Domain::triggerSyncNow(std::unique_ptr<vespalib::IDestructorCallback> after_sync
     }
     _singleCommitter->execute(makeLambdaTask([this, after_sync=std::move(after_sync)]() {
         (void) after_sync;
-        getActivePart()->sync();
+        syncAndReleasePending(*getActivePart());
     }));
 }
 
@@ -304,7 +308,7 @@ DomainPart::SP
 Domain::optionallyRotateFile(SerialNum serialNum) {
     DomainPart::SP dp = getActivePart();
     if (dp->byteSize() > _config.getPartSizeLimit()) {
-        dp->sync();
+        syncAndReleasePending(*dp);
         dp->close();
         dp = std::make_shared<DomainPart>(_name, dir(), serialNum, _fileHeaderContext, false);
         {
@@ -376,25 +380,49 @@ Domain::commitChunk(std::unique_ptr<CommitChunk> chunk, const UniqueLock & chunk
                                       encoding=_config.getEncoding(), compressionLevel=_config.getCompressionlevel()]() mutable {
         promise.set_value(SerializedChunk(std::move(chunk), encoding, compressionLevel));
     }));
+    _pendingCommits.fetch_add(1, std::memory_order_relaxed);
     _singleCommitter->execute( makeLambdaTask([this, future = std::move(future)]() mutable {
         doCommit(future.get());
     }));
 }
 
-
+vespalib::duration
+Domain::getSyncWindow() const {
+    // Bound how long acks can be held back when the committer never runs dry.
+    return std::clamp(10 * _syncLatency, vespalib::duration(1ms), vespalib::duration(100ms));
+}
 
 void
-Domain::doCommit(const SerializedChunk & serialized) {
+Domain::syncAndReleasePending(DomainPart & dp) {
+    vespalib::steady_time start = vespalib::steady_clock::now();
+    dp.sync();
+    _lastSync = vespalib::steady_clock::now();
+    vespalib::duration elapsed = _lastSync - start;
+    _syncLatency = (_syncLatency == vespalib::duration::zero()) ? elapsed : ((7 * _syncLatency) + elapsed) / 8;
+    _pendingSync.clear();
+}
 
+void
+Domain::doCommit(SerializedChunk serialized) {
+    _pendingCommits.fetch_sub(1, std::memory_order_relaxed);
     SerialNumRange range = serialized.range();
     DomainPart::SP dp = optionallyRotateFile(range.from());
     dp->commit(serialized);
+    LOG(debug, "Releasing %zu acks and %zu entries and %zu bytes.",
+        serialized.getNumCallBacks(), serialized.getNumEntries(), serialized.getData().size());
     if (_config.getFSyncOnCommit()) {
-        dp->sync();
+        // Group commit: hold the acks back and defer the fsync while more
+        // chunks are queued behind us, so one sync can cover them all. The
+        // window is bounded by the observed sync latency to keep ack
+        // latency predictable when the committer never runs dry.
+        _pendingSync.push_back(std::move(serialized));
+        if ((_pendingCommits.load(std::memory_order_relaxed) == 0) ||
+            ((vespalib::steady_clock::now() - _lastSync) >= getSyncWindow()))
+        {
+            syncAndReleasePending(*dp);
+        }
     }
     cleanSessions();
-    LOG(debug, "Releasing %zu acks and %zu entries and %zu bytes.",
-        serialized.getNumCallBacks(), serialized.getNumEntries(), serialized.getData().size());
 }
 
 bool
@@ -63,7 +63,9 @@ private:
 
     std::unique_ptr<CommitChunk> grabCurrentChunk(const UniqueLock & guard);
     void commitChunk(std::unique_ptr<CommitChunk> chunk, const UniqueLock & chunkOrderGuard);
-    void doCommit(const SerializedChunk & serialized);
+    void doCommit(SerializedChunk serialized);
+    void syncAndReleasePending(DomainPart & dp);
+    vespalib::duration getSyncWindow() const;
     SerialNum begin(const UniqueLock & guard) const;
     SerialNum end(const UniqueLock & guard) const;
     size_t byteSize(const UniqueLock & guard) const;
@@ -95,6 +97,12 @@ private:
     mutable std::mutex           _sessionMutex;
     SessionList                  _sessions;
     DurationSeconds              _maxSessionRunTime;
+    std::atomic<uint32_t>        _pendingCommits;
+    // Committed chunks whose acks are held back until the covering fsync.
+    // Only accessed from the single committer thread.
+    std::vector<SerializedChunk> _pendingSync;
+    vespalib::steady_time        _lastSync;
+    vespalib::duration           _syncLatency;
     vespalib::string             _baseDir;
     const FileHeaderContext     &_fileHeaderContext;
     bool                         _markedDeleted;
@@ -0,0 +1,221 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "file_range_heatmap.h"
+#include <algorithm>
+#include <fstream>
+
+namespace search {
+
+namespace {
+
+const vespalib::string magic = "fileRangeHeatmap";
+constexpr uint32_t format_version = 1;
+
+}
+
+FileRangeTracker::FileRangeTracker(uint32_t sample_interval, BucketMap loaded)
+    : _lock(),
+      _buckets(std::move(loaded)),
+      _accesses(0),
+      _sample_interval(sample_interval)
+{
+}
+
+FileRangeTracker::~FileRangeTracker() = default;
+
+void
+FileRangeTracker::note_access(uint64_t offset, uint64_t length)
+{
+    if (length == 0) {
+        return;
+    }
+    // a relaxed counter bump is the only cost for unsampled accesses
+    if ((_accesses.fetch_add(1, std::memory_order_relaxed) % _sample_interval) != 0) {
+        return;
+    }
+    uint64_t first_bucket = offset >> BUCKET_BITS;
+    uint64_t last_bucket = (offset + length - 1) >> BUCKET_BITS;
+    std::lock_guard guard(_lock);
+    for (uint64_t bucket = first_bucket; bucket <= last_bucket; ++bucket) {
+        // scale by the sample interval to approximate the true count
+        _buckets[bucket] += _sample_interval;
+    }
+}
+
+FileRangeTracker::BucketMap
+FileRangeTracker::snapshot() const
+{
+    std::lock_guard guard(_lock);
+    return _buckets;
+}
+
+FileRangeHeatmap::FileRangeHeatmap(uint32_t sample_interval)
+    : _lock(),
+      _sample_interval(std::max(1u, sample_interval)),
+      _files(),
+      _loaded()
+{
+}
+
+FileRangeHeatmap::~FileRangeHeatmap() = default;
+
+void
+FileRangeHeatmap::prune_closed_files()
+{
+    // caller must hold _lock
+    auto itr = _files.begin();
+    while (itr != _files.end()) {
+        if (itr->second.expired()) {
+            itr = _files.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+}
+
+FileRangeHeatmap::TrackerSP
+FileRangeHeatmap::track_file(const vespalib::string& file)
+{
+    std::lock_guard guard(_lock);
+    auto itr = _files.find(file);
+    if (itr != _files.end()) {
+        auto existing = itr->second.lock();
+        if (existing) {
+            return existing;
+        }
+    }
+    BucketMap loaded;
+    auto loaded_itr = _loaded.find(file);
+    if (loaded_itr != _loaded.end()) {
+        loaded = std::move(loaded_itr->second);
+        _loaded.erase(loaded_itr);
+    }
+    auto tracker = std::make_shared<FileRangeTracker>(_sample_interval, std::move(loaded));
+    _files[file] = tracker;
+    prune_closed_files();
+    return tracker;
+}
+
+FileRangeHeatmap::RangeVector
+FileRangeHeatmap::hot_ranges(uint64_t min_heat) const
+{
+    RangeVector result;
+    std::map<vespalib::string, BucketMap> files;
+    {
+        std::lock_guard guard(_lock);
+        files = _loaded;
+        for (const auto& file_entry : _files) {
+            auto tracker = file_entry.second.lock();
+            if (tracker) {
+                files[file_entry.first] = tracker->snapshot();
+            }
+        }
+    }
+    for (const auto& file_entry : files) {
+        const BucketMap& buckets = file_entry.second;
+        auto itr = buckets.begin();
+        while (itr != buckets.end()) {
+            if (itr->second < min_heat) {
+                ++itr;
+                continue;
+            }
+            uint64_t first_bucket = itr->first;
+            uint64_t last_bucket = first_bucket;
+            uint64_t heat = itr->second;
+            ++itr;
+            while ((itr != buckets.end()) && (itr->first == last_bucket + 1) && (itr->second >= min_heat)) {
+                last_bucket = itr->first;
+                heat += itr->second;
+                ++itr;
+            }
+            result.emplace_back(Range{file_entry.first,
+                                      first_bucket << BUCKET_BITS,
+                                      (last_bucket - first_bucket + 1) << BUCKET_BITS,
+                                      heat});
+        }
+    }
+    std::sort(result.begin(), result.end(),
+              [](const Range& lhs, const Range& rhs) { return lhs.heat > rhs.heat; });
+    return result;
+}
+
+bool
+FileRangeHeatmap::save(const vespalib::string& path) const
+{
+    std::ofstream out(path.c_str(), std::ofstream::trunc);
+    if (!out) {
+        return false;
+    }
+    out << magic << " " << format_version << "\n";
+    // only persist files that are still open; heat for files that have
+    // been rotated or compacted away is dropped here
+    std::map<vespalib::string, BucketMap> files;
+    {
+        std::lock_guard guard(_lock);
+        for (const auto& file_entry : _files) {
+            auto tracker = file_entry.second.lock();
+            if (tracker) {
+                files[file_entry.first] = tracker->snapshot();
+            }
+        }
+    }
+    for (const auto& file_entry : files) {
+        for (const auto& bucket_entry : file_entry.second) {
+            out << file_entry.first << " " << bucket_entry.first << " " << bucket_entry.second << "\n";
+        }
+    }
+    return static_cast<bool>(out);
+}
+
+bool
+FileRangeHeatmap::load(const vespalib::string& path)
+{
+    std::ifstream in(path.c_str());
+    if (!in) {
+        return false;
+    }
+    std::string file_magic;
+    uint32_t version = 0;
+    if (!(in >> file_magic >> version) || (file_magic != magic) || (version != format_version)) {
+        return false;
+    }
+    std::map<vespalib::string, BucketMap> files;
+    std::string file;
+    uint64_t bucket = 0;
+    uint64_t heat = 0;
+    while (in >> file >> bucket >> heat) {
+        files[file][bucket] += heat;
+    }
+    std::lock_guard guard(_lock);
+    for (auto& file_entry : files) {
+        auto itr = _files.find(file_entry.first);
+        auto tracker = (itr != _files.end()) ? itr->second.lock() : TrackerSP();
+        if (tracker) {
+            // file already reopened; merge into its live tracker
+            std::lock_guard tracker_guard(tracker->_lock);
+            for (const auto& bucket_entry : file_entry.second) {
+                tracker->_buckets[bucket_entry.first] += bucket_entry.second;
+            }
+        } else {
+            _loaded[file_entry.first] = std::move(file_entry.second);
+        }
+    }
+    return true;
+}
+
+void
+FileRangeHeatmap::clear()
+{
+    std::lock_guard guard(_lock);
+    _files.clear();
+    _loaded.clear();
+}
+
+FileRangeHeatmap&
+FileRangeHeatmap::instance()
+{
+    static FileRangeHeatmap heatmap;
+    return heatmap;
+}
+
+}
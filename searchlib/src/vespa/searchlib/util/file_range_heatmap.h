@@ -0,0 +1,103 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/vespalib/stllike/string.h>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace search {
+
+/**
+ * Per-file access tracker handed out by FileRangeHeatmap::track_file().
+ * Only one in every sample interval accesses is recorded (scaled back
+ * up by the interval), and only recorded accesses take the per-file
+ * lock; the fast path is a single relaxed counter bump. The tracker is
+ * kept alive by the file reader, the heatmap itself only holds a weak
+ * reference.
+ **/
+class FileRangeTracker {
+public:
+    static constexpr uint64_t BUCKET_BITS = 20; // 1 MiB buckets
+    using BucketMap = std::map<uint64_t, uint64_t>; // bucket -> access count
+private:
+    mutable std::mutex    _lock;
+    BucketMap             _buckets;
+    std::atomic<uint32_t> _accesses;
+    uint32_t              _sample_interval;
+
+    friend class FileRangeHeatmap;
+    BucketMap snapshot() const;
+public:
+    FileRangeTracker(uint32_t sample_interval, BucketMap loaded);
+    FileRangeTracker(const FileRangeTracker &) = delete;
+    FileRangeTracker & operator=(const FileRangeTracker &) = delete;
+    ~FileRangeTracker();
+
+    void note_access(uint64_t offset, uint64_t length);
+};
+
+/**
+ * Process-wide tracker of which file ranges are read. Read paths that
+ * want their access pattern to survive a restart register their file
+ * once when it is opened and note reads through the returned tracker;
+ * the accumulated heat can be persisted and used to warm the page cache
+ * with the hottest ranges after the next startup. Accesses are tracked
+ * at a fixed bucket granularity to bound memory usage.
+ *
+ * Entries for files that are no longer open (rotated or compacted away)
+ * are pruned as their trackers expire; persisted heat for files that
+ * are never reopened is dropped at the next save.
+ **/
+class FileRangeHeatmap {
+public:
+    struct Range {
+        vespalib::string file;
+        uint64_t         offset;
+        uint64_t         length;
+        uint64_t         heat;
+    };
+    using RangeVector = std::vector<Range>;
+    using TrackerSP = std::shared_ptr<FileRangeTracker>;
+
+    static constexpr uint64_t BUCKET_BITS = FileRangeTracker::BUCKET_BITS;
+    static constexpr uint32_t SAMPLE_INTERVAL = 16;
+private:
+    using BucketMap = FileRangeTracker::BucketMap;
+    mutable std::mutex                                     _lock;
+    uint32_t                                               _sample_interval;
+    std::map<vespalib::string, std::weak_ptr<FileRangeTracker>> _files;
+    std::map<vespalib::string, BucketMap>                  _loaded; // persisted heat for files not reopened yet
+
+    void prune_closed_files();
+public:
+    explicit FileRangeHeatmap(uint32_t sample_interval = SAMPLE_INTERVAL);
+    FileRangeHeatmap(const FileRangeHeatmap &) = delete;
+    FileRangeHeatmap & operator=(const FileRangeHeatmap &) = delete;
+    ~FileRangeHeatmap();
+
+    /*
+     * Get a tracker for noting accesses to the given file, seeded with
+     * any persisted heat for it. Trackers are shared if the same file
+     * is registered more than once.
+     */
+    TrackerSP track_file(const vespalib::string& file);
+
+    /*
+     * Get the tracked ranges with heat of at least min_heat, hottest
+     * first. Adjacent hot buckets in the same file are coalesced.
+     */
+    RangeVector hot_ranges(uint64_t min_heat) const;
+
+    bool save(const vespalib::string& path) const;
+    bool load(const vespalib::string& path);
+    void clear();
+
+    static FileRangeHeatmap& instance();
+};
+
+}
@@ -2,7 +2,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace search::docsummary {
 
@@ -22,6 +24,13 @@ public:
      * Get a docsum specific abstract of the document for the given local document id.
      **/
     virtual std::unique_ptr<const IDocsumStoreDocument> get_document(uint32_t docid) = 0;
+
+    /**
+     * Hint that the given local document ids will be fetched with
+     * get_document(), allowing the implementation to read them from the
+     * backing store in one batch. The default implementation does nothing.
+     **/
+    virtual void prefetch_documents(const std::vector<uint32_t> &docids) { (void) docids; }
 };
 
 }
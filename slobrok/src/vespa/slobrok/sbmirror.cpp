@@ -179,22 +179,16 @@ MirrorAPI::handleIncrementalFetch()
         }
         updateTo(std::move(specs), diff_to);
     } else if (_specsGen == diff_from) {
-        // incremental update
-        SpecMap specs;
-        for (const auto & spec : _specs) {
-            bool keep = true;
-            for (uint32_t idx = 0; idx < numRemove; idx++) {
-                if (spec.first == r[idx]._str) keep = false;
-            }
-            for (uint32_t idx = 0; idx < numNames; idx++) {
-                if (spec.first == n[idx]._str) keep = false;
-            }
-            if (keep) specs[spec.first] = spec.second;
+        // incremental update; apply the diff with hash lookups instead of
+        // scanning the remove and add arrays once per existing service
+        SpecMap specs = _specs;
+        for (uint32_t idx = 0; idx < numRemove; idx++) {
+            specs.erase(r[idx]._str);
         }
         for (uint32_t idx = 0; idx < numNames; idx++) {
             specs[n[idx]._str] = s[idx]._str;
         }
-        updateTo(specs, diff_to);
+        updateTo(std::move(specs), diff_to);
     }
     return false;
 }
@@ -190,6 +190,35 @@ TEST_F(DistributorBucketSpaceTest, check_available_nodes)
     EXPECT_EQ((std::vector<bool>{true, true, true, true}), bucket_space.get_available_nodes());
 }
 
+TEST_F(DistributorBucketSpaceTest, node_down_transition_applied_as_delta_matches_full_recomputation)
+{
+    bucket_space.setDistribution(distribution_r2);
+    bucket_space.setClusterState(stable_state);
+    auto buckets = make_normal_buckets();
+    // Populate the ideal nodes cache before the state transition.
+    for (auto& bucket : buckets) {
+        (void) bucket_space.get_ideal_service_layer_nodes_bundle(bucket);
+    }
+    bucket_space.setClusterState(node_1_down_state);
+
+    DistributorBucketSpace fresh_space(0u);
+    fresh_space.setDistribution(distribution_r2);
+    fresh_space.setClusterState(node_1_down_state);
+    for (auto& bucket : buckets) {
+        const auto& delta_bundle = bucket_space.get_ideal_service_layer_nodes_bundle(bucket);
+        const auto& fresh_bundle = fresh_space.get_ideal_service_layer_nodes_bundle(bucket);
+        auto to_vector = [](IdealServiceLayerNodesBundle::ConstNodesRef nodes) {
+            return std::vector<uint16_t>(nodes.begin(), nodes.end());
+        };
+        EXPECT_EQ(to_vector(fresh_bundle.available_nodes()),
+                  to_vector(delta_bundle.available_nodes()));
+        EXPECT_EQ(to_vector(fresh_bundle.available_nonretired_nodes()),
+                  to_vector(delta_bundle.available_nonretired_nodes()));
+        EXPECT_EQ(to_vector(fresh_bundle.available_nonretired_or_maintenance_nodes()),
+                  to_vector(delta_bundle.available_nonretired_or_maintenance_nodes()));
+    }
+}
+
 TEST_F(DistributorBucketSpaceTest, check_owned_deep_split_buckets)
 {
     bucket_space.setDistribution(distribution_r1);
@@ -3,6 +3,7 @@
 #include <tests/distributor/distributor_stripe_test_util.h>
 #include <vespa/config/helper/configgetter.h>
 #include <vespa/config/helper/configgetter.hpp>
+#include <vespa/document/base/globalid.h>
 #include <vespa/document/config/documenttypes_config_fwd.h>
 #include <vespa/document/fieldset/fieldsets.h>
 #include <vespa/document/repo/documenttyperepo.h>
@@ -56,12 +57,14 @@ struct GetOperationTest : Test, DistributorStripeTestUtil {
         op.reset();
     }
 
-    void start_operation(std::shared_ptr<api::GetCommand> cmd, api::InternalReadConsistency consistency) {
+    void start_operation(std::shared_ptr<api::GetCommand> cmd, api::InternalReadConsistency consistency,
+                         bool symmetric_replica_selection = false)
+    {
         op = std::make_unique<GetOperation>(
                 node_context(), getDistributorBucketSpace(),
                 getDistributorBucketSpace().getBucketDatabase().acquire_read_guard(),
                 std::move(cmd), metrics().gets,
-                consistency);
+                consistency, symmetric_replica_selection);
         op->start(_sender);
     }
 
@@ -202,6 +205,31 @@ TEST_F(GetOperationTest, simple) {
     EXPECT_EQ(replica_of(api::Timestamp(100), bucketId, 0, false, false), *op->newest_replica());
 }
 
+TEST_F(GetOperationTest, symmetric_replica_selection_spreads_gets_by_document_gid) {
+    setClusterState("distributor:1 storage:3");
+
+    addNodesToBucketDB(bucketId, "1=4,2=4");
+
+    auto msg = std::make_shared<api::GetCommand>(makeDocumentBucket(BucketId(0)), docId, document::AllFields::NAME);
+    start_operation(std::move(msg), api::InternalReadConsistency::Strong, true);
+
+    // Target choice is a deterministic function of the document's global id,
+    // spreading reads across the mutually consistent replicas.
+    const uint16_t expected_node = 1 + (document::GlobalId::hash()(docId.getGlobalId()) % 2);
+    ASSERT_EQ("Get => " + std::to_string(expected_node), _sender.getCommands(true));
+}
+
+TEST_F(GetOperationTest, symmetric_replica_selection_still_prefers_replica_on_local_node) {
+    setClusterState("distributor:1 storage:3");
+
+    addNodesToBucketDB(bucketId, "0=4,2=4");
+
+    auto msg = std::make_shared<api::GetCommand>(makeDocumentBucket(BucketId(0)), docId, document::AllFields::NAME);
+    start_operation(std::move(msg), api::InternalReadConsistency::Strong, true);
+
+    ASSERT_EQ("Get => 0", _sender.getCommands(true));
+}
+
 TEST_F(GetOperationTest, ask_all_checksum_groups_if_inconsistent_even_if_trusted_replica_available) {
     setClusterState("distributor:1 storage:4");
 
@@ -724,6 +724,59 @@ TEST_F(MergeThrottlerTest, priority_queuing) {
     }
 }
 
+TEST_F(MergeThrottlerTest, starved_queued_merge_is_dequeued_before_younger_higher_priority_merge) {
+    _servers[0]->getClock().setAbsoluteTimeInSeconds(1000);
+    StorServerConfigBuilder cfg(*default_server_config());
+    cfg.mergeThrottlingQueueStarvationAgingSecs = 10.0;
+    _throttlers[0]->on_configure(cfg);
+
+    // Fill up all active merges
+    size_t maxPending = throttler_max_merges_pending(0);
+    std::vector<MergeBucketCommand::Node> nodes({{0}, {1}, {2}});
+    for (size_t i = 0; i < maxPending; ++i) {
+        auto cmd = std::make_shared<MergeBucketCommand>(
+                makeDocumentBucket(BucketId(32, 0xf00baa00 + i)), nodes, 1234);
+        cmd->setPriority(100);
+        _topLinks[0]->sendDown(cmd);
+    }
+    _topLinks[0]->waitForMessages(maxPending, 5);
+    waitUntilMergeQueueIs(*_throttlers[0], 0, _messageWaitTime);
+
+    // A low priority merge is enqueued first...
+    {
+        auto cmd = std::make_shared<MergeBucketCommand>(makeDocumentBucket(BucketId(32, 1)), nodes, 1234);
+        cmd->setPriority(240);
+        _topLinks[0]->sendDown(cmd);
+    }
+    waitUntilMergeQueueIs(*_throttlers[0], 1, _messageWaitTime);
+    // ...and ages past the starvation threshold before a higher priority merge arrives
+    _servers[0]->getClock().addSecondsToTime(11);
+    {
+        auto cmd = std::make_shared<MergeBucketCommand>(makeDocumentBucket(BucketId(32, 2)), nodes, 1234);
+        cmd->setPriority(120);
+        _topLinks[0]->sendDown(cmd);
+    }
+    waitUntilMergeQueueIs(*_throttlers[0], 2, _messageWaitTime);
+
+    // Remove all but one forwarded merge
+    for (size_t i = 0; i < maxPending - 1; ++i) {
+        _topLinks[0]->getAndRemoveMessage(MessageType::MERGEBUCKET);
+    }
+    // Free up a single active window slot. The starved low priority merge
+    // must be scheduled ahead of the younger, higher priority one.
+    {
+        StorageMessage::SP replyTo = _topLinks[0]->getAndRemoveMessage(MessageType::MERGEBUCKET);
+        auto reply = std::make_shared<MergeBucketReply>(dynamic_cast<const MergeBucketCommand&>(*replyTo));
+        reply->setResult(ReturnCode(ReturnCode::OK, ""));
+        _topLinks[0]->sendDown(reply);
+    }
+
+    _topLinks[0]->waitForMessage(MessageType::MERGEBUCKET, _messageWaitTime);
+    waitUntilMergeQueueIs(*_throttlers[0], 1, _messageWaitTime);
+    StorageMessage::SP cmd = _topLinks[0]->getAndRemoveMessage(MessageType::MERGEBUCKET);
+    EXPECT_EQ(uint8_t(240), cmd->getPriority());
+}
+
 // Test that we can detect and reject merges that due to resending
 // and potential priority queue sneaking etc may end up with duplicates
 // in the queue for a merge that is already known.
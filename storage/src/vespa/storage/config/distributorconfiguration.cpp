@@ -47,6 +47,7 @@ DistributorConfiguration::DistributorConfiguration(StorageComponent& component)
       _enable_metadata_only_fetch_phase_for_inconsistent_updates(true),
       _enable_operation_cancellation(false),
       _symmetric_put_and_activate_replica_selection(false),
+      _symmetric_get_replica_selection(false),
       _minimumReplicaCountingMode(ReplicaCountingMode::TRUSTED)
 {
 }
@@ -152,6 +153,7 @@ DistributorConfiguration::configure(const DistributorManagerConfig & config)
     _enable_operation_cancellation = config.enableOperationCancellation;
     _minimumReplicaCountingMode = deriveReplicaCountingMode(config.minimumReplicaCountingMode);
     _symmetric_put_and_activate_replica_selection = config.symmetricPutAndActivateReplicaSelection;
+    _symmetric_get_replica_selection = config.symmetricGetReplicaSelection;
 
     if (config.maxClusterClockSkewSec >= 0) {
         _maxClusterClockSkew = std::chrono::seconds(config.maxClusterClockSkewSec);
@@ -237,6 +237,9 @@ public:
     [[nodiscard]] bool symmetric_put_and_activate_replica_selection() const noexcept {
         return _symmetric_put_and_activate_replica_selection;
     }
+    [[nodiscard]] bool symmetric_get_replica_selection() const noexcept {
+        return _symmetric_get_replica_selection;
+    }
 
     [[nodiscard]] bool containsTimeStatement(const std::string& documentSelection) const;
     
@@ -280,6 +283,7 @@ private:
     bool _enable_metadata_only_fetch_phase_for_inconsistent_updates; //TODO Rewrite tests and GC
     bool _enable_operation_cancellation;
     bool _symmetric_put_and_activate_replica_selection;
+    bool _symmetric_get_replica_selection;
 
     ReplicaCountingMode _minimumReplicaCountingMode;
 };
@@ -6,6 +6,7 @@
 #include <vespa/vdslib/state/clusterstate.h>
 #include <vespa/vdslib/distribution/distribution.h>
 #include <vespa/vespalib/stllike/hash_map.hpp>
+#include <algorithm>
 
 namespace storage::distributor {
 
@@ -14,6 +15,29 @@ namespace {
 const char *up_states = "uri";
 const char *nonretired_up_states = "ui";
 const char *nonretired_or_maintenance_up_states = "uim";
+// Union of the up state sets the cached ideal nodes bundles are computed over.
+const char *any_bundle_up_states = "urim";
+
+bool
+bundle_references_node(const IdealServiceLayerNodesBundle& bundle, const std::vector<uint16_t>& nodes)
+{
+    for (uint16_t node : bundle.available_nodes()) {
+        if (std::find(nodes.begin(), nodes.end(), node) != nodes.end()) {
+            return true;
+        }
+    }
+    for (uint16_t node : bundle.available_nonretired_nodes()) {
+        if (std::find(nodes.begin(), nodes.end(), node) != nodes.end()) {
+            return true;
+        }
+    }
+    for (uint16_t node : bundle.available_nonretired_or_maintenance_nodes()) {
+        if (std::find(nodes.begin(), nodes.end(), node) != nodes.end()) {
+            return true;
+        }
+    }
+    return false;
+}
 
 }
 
@@ -70,11 +94,79 @@ DistributorBucketSpace::enumerate_available_nodes()
 void
 DistributorBucketSpace::setClusterState(std::shared_ptr<const lib::ClusterState> clusterState)
 {
+    auto old_state = std::move(_clusterState);
     _clusterState = std::move(clusterState);
-    clear();
+    if (!old_state || !apply_cluster_state_delta(*old_state)) {
+        clear();
+    }
     enumerate_available_nodes();
 }
 
+/*
+ * Try to apply the transition from old_state to the current cluster state as a
+ * delta to the cached per-bucket state instead of discarding all of it.
+ *
+ * The ideal state algorithm scores each node independently (the cluster state
+ * only enters group selection through the distribution bit count), so when the
+ * only storage node changes are nodes leaving the up state sets, a cached ideal
+ * nodes bundle stays valid unless it references one of the nodes that left.
+ * Returns false when the delta is not of that shape (nodes joining, capacity
+ * changes or a different distribution bit count), in which case the caller
+ * falls back to clearing all cached state.
+ */
+bool
+DistributorBucketSpace::apply_cluster_state_delta(const lib::ClusterState& old_state)
+{
+    const lib::ClusterState& new_state = *_clusterState;
+    if (!_distribution || (old_state.getDistributionBitCount() != new_state.getDistributionBitCount())) {
+        return false;
+    }
+    uint16_t storage_node_count = std::max(old_state.getNodeCount(lib::NodeType::STORAGE),
+                                           new_state.getNodeCount(lib::NodeType::STORAGE));
+    std::vector<uint16_t> downed_nodes;
+    for (uint16_t node = 0; node < storage_node_count; ++node) {
+        lib::Node node_key(lib::NodeType::STORAGE, node);
+        const lib::NodeState& old_ns = old_state.getNodeState(node_key);
+        const lib::NodeState& new_ns = new_state.getNodeState(node_key);
+        if (old_ns == new_ns) {
+            continue;
+        }
+        if (new_ns.getState().oneOf(any_bundle_up_states)) {
+            // The node joined an up state set or changed within one (e.g. new
+            // capacity); affected buckets cannot be identified from the cached
+            // bundles alone.
+            return false;
+        }
+        if (old_ns.getState().oneOf(any_bundle_up_states)) {
+            downed_nodes.push_back(node);
+        }
+    }
+    uint16_t distributor_node_count = std::max(old_state.getNodeCount(lib::NodeType::DISTRIBUTOR),
+                                               new_state.getNodeCount(lib::NodeType::DISTRIBUTOR));
+    for (uint16_t node = 0; node < distributor_node_count; ++node) {
+        lib::Node node_key(lib::NodeType::DISTRIBUTOR, node);
+        if (!(old_state.getNodeState(node_key) == new_state.getNodeState(node_key))) {
+            // Bucket ownership may move between distributors; that cache is
+            // cheap to rebuild, so just drop it while keeping the ideal nodes.
+            _ownerships.clear();
+            break;
+        }
+    }
+    if (downed_nodes.empty()) {
+        return true;
+    }
+    std::vector<document::BucketId> invalidated;
+    for (const auto& entry : _ideal_nodes) {
+        if (bundle_references_node(*entry.second, downed_nodes)) {
+            invalidated.push_back(entry.first);
+        }
+    }
+    for (auto bucket : invalidated) {
+        _ideal_nodes.erase(bucket);
+    }
+    return true;
+}
+
 
 void
 DistributorBucketSpace::setDistribution(std::shared_ptr<const lib::Distribution> distribution) {
@@ -893,6 +893,8 @@ DistributorStripe::propagate_config_snapshot_to_internal_components()
             getConfig().allowStaleReadsDuringClusterStateTransitions());
     _externalOperationHandler.set_use_weak_internal_read_consistency_for_gets(
             getConfig().use_weak_internal_read_consistency_for_client_gets());
+    _externalOperationHandler.set_symmetric_get_replica_selection(
+            getConfig().symmetric_get_replica_selection());
 }
 
 void
@@ -90,7 +90,8 @@ ExternalOperationHandler::ExternalOperationHandler(DistributorNodeContext& node_
       _non_main_thread_ops_owner(*_direct_dispatch_sender, _node_ctx.clock()),
       _uuid_generator(std::make_unique<CryptoUuidGenerator>()),
       _concurrent_gets_enabled(false),
-      _use_weak_internal_read_consistency_for_gets(false)
+      _use_weak_internal_read_consistency_for_gets(false),
+      _symmetric_get_replica_selection(false)
 {
 }
 
@@ -435,7 +436,8 @@ std::shared_ptr<Operation> ExternalOperationHandler::try_generate_get_operation(
     assert(space_repo != nullptr);
     return std::make_shared<GetOperation>(_node_ctx, space_repo->get(bucket.getBucketSpace()),
                                           snapshot.steal_read_guard(), cmd, metrics,
-                                          desired_get_read_consistency());
+                                          desired_get_read_consistency(),
+                                          symmetric_get_replica_selection());
 }
 
 bool ExternalOperationHandler::onGet(const std::shared_ptr<api::GetCommand>& cmd) {
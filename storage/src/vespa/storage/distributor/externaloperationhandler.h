@@ -79,6 +79,14 @@ public:
         return _use_weak_internal_read_consistency_for_gets.load(std::memory_order_relaxed);
     }
 
+    void set_symmetric_get_replica_selection(bool symmetric) noexcept {
+        _symmetric_get_replica_selection.store(symmetric, std::memory_order_relaxed);
+    }
+
+    bool symmetric_get_replica_selection() const noexcept {
+        return _symmetric_get_replica_selection.load(std::memory_order_relaxed);
+    }
+
     // Exposed for testing
     OperationSequencer& operation_sequencer() noexcept {
         return _operation_sequencer;
@@ -101,6 +109,7 @@ private:
     std::unique_ptr<UuidGenerator> _uuid_generator;
     std::atomic<bool> _concurrent_gets_enabled;
     std::atomic<bool> _use_weak_internal_read_consistency_for_gets;
+    std::atomic<bool> _symmetric_get_replica_selection;
 
     template <typename Func>
     void bounce_or_invoke_read_only_op(api::StorageCommand& cmd,
@@ -3,6 +3,8 @@
 #include "distributor_stripe.h"
 #include "distributor_stripe_pool.h"
 #include "distributor_stripe_thread.h"
+#include <map>
+#include <thread>
 
 namespace storage::distributor {
 
@@ -89,23 +91,34 @@ MultiThreadedStripeAccessGuard::merge_entries_into_db(document::BucketSpace buck
     if (entries.empty()) {
         return;
     }
-    std::vector<dbtransition::Entry> stripe_entries;
-    stripe_entries.reserve(entries.size() / _stripe_pool.stripe_count());
-    auto* curr_stripe = &_stripe_pool.stripe_of_key(entries[0].bucket_key);
-    stripe_entries.push_back(entries[0]);
-    for (size_t i = 1; i < entries.size(); ++i) {
-        const auto& entry = entries[i];
-        auto* next_stripe = &_stripe_pool.stripe_of_key(entry.bucket_key);
-        if (curr_stripe != next_stripe) {
-            curr_stripe->merge_entries_into_db(bucket_space, gathered_at_timestamp, distribution,
-                                               new_state, storage_up_states, outdated_nodes, stripe_entries);
-            stripe_entries.clear();
-        }
-        curr_stripe = next_stripe;
-        stripe_entries.push_back(entry);
+    // Group entries by the stripe owning them; entries arrive sorted by
+    // bucket key, so relative order is preserved within each group.
+    std::map<TickableStripe*, std::vector<dbtransition::Entry>> stripe_entries;
+    for (const auto& entry : entries) {
+        stripe_entries[&_stripe_pool.stripe_of_key(entry.bucket_key)].push_back(entry);
+    }
+    auto merge_into_stripe = [&](TickableStripe& stripe, const std::vector<dbtransition::Entry>& my_entries) {
+        stripe.merge_entries_into_db(bucket_space, gathered_at_timestamp, distribution,
+                                     new_state, storage_up_states, outdated_nodes, my_entries);
+    };
+    if (stripe_entries.size() == 1) {
+        merge_into_stripe(*stripe_entries.begin()->first, stripe_entries.begin()->second);
+        return;
+    }
+    // All stripe threads are parked while this guard is held, so each
+    // worker below has exclusive access to its own stripe's databases
+    // and the merges can run in parallel. State transitions are rare
+    // enough that spawning short-lived workers is fine here.
+    std::vector<std::thread> workers;
+    workers.reserve(stripe_entries.size());
+    for (auto& [stripe, my_entries] : stripe_entries) {
+        workers.emplace_back([&merge_into_stripe, stripe, &my_entries = my_entries]() {
+            merge_into_stripe(*stripe, my_entries);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
     }
-    curr_stripe->merge_entries_into_db(bucket_space, gathered_at_timestamp, distribution,
-                                       new_state, storage_up_states, outdated_nodes, stripe_entries);
 }
 
 void MultiThreadedStripeAccessGuard::update_read_snapshot_before_db_pruning() {
@@ -1,5 +1,6 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 #include "getoperation.h"
+#include <vespa/document/base/globalid.h>
 #include <vespa/document/bucket/bucketidfactory.h>
 #include <vespa/document/fieldvalue/document.h>
 #include <vespa/storage/distributor/distributor_bucket_space.h>
@@ -53,7 +54,8 @@ GetOperation::GetOperation(const DistributorNodeContext& node_ctx,
                            const std::shared_ptr<BucketDatabase::ReadGuard> & read_guard,
                            std::shared_ptr<api::GetCommand> msg,
                            PersistenceOperationMetricSet& metric,
-                           api::InternalReadConsistency desired_read_consistency)
+                           api::InternalReadConsistency desired_read_consistency,
+                           bool symmetric_replica_selection)
     : Operation(),
       _node_ctx(node_ctx),
       _bucketSpace(bucketSpace),
@@ -65,6 +67,8 @@ GetOperation::GetOperation(const DistributorNodeContext& node_ctx,
       _operationTimer(node_ctx.clock()),
       _trace(_msg->getTrace().getLevel()),
       _desired_read_consistency(desired_read_consistency),
+      _replica_spread_seed(document::GlobalId::hash()(_msg->getDocumentId().getGlobalId())),
+      _symmetric_replica_selection(symmetric_replica_selection),
       _has_replica_inconsistency(false),
       _any_replicas_failed(false)
 {
@@ -87,16 +91,24 @@ GetOperation::copyIsOnLocalNode(const BucketCopy& copy) const
 int
 GetOperation::findBestUnsentTarget(const GroupVector& candidates) const
 {
+    const uint32_t n = candidates.size();
+    // With symmetric replica selection enabled, start the scan at an offset
+    // derived from the document's global id so reads towards in-sync buckets
+    // are spread across all candidate replicas instead of always going to the
+    // first replica in ideal state order. Local replicas are still preferred.
+    const uint32_t offset = (_symmetric_replica_selection && (n > 1))
+                            ? static_cast<uint32_t>(_replica_spread_seed % n) : 0;
     int best = -1;
-    for (uint32_t i = 0; i < candidates.size(); ++i) {
-        if (candidates[i].sent) {
+    for (uint32_t i = 0; i < n; ++i) {
+        const uint32_t idx = (i + offset) % n;
+        if (candidates[idx].sent) {
             continue;
         }
-        if (copyIsOnLocalNode(candidates[i].copy)) {
-            return i; // Can't get better match than this.
+        if (copyIsOnLocalNode(candidates[idx].copy)) {
+            return idx; // Can't get better match than this.
         }
         if (best == -1) {
-            best = i;
+            best = idx;
         }
     }
     return best;
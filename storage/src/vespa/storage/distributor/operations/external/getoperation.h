@@ -28,7 +28,8 @@ public:
                  const std::shared_ptr<BucketDatabase::ReadGuard>& read_guard,
                  std::shared_ptr<api::GetCommand> msg,
                  PersistenceOperationMetricSet& metric,
-                 api::InternalReadConsistency desired_read_consistency = api::InternalReadConsistency::Strong);
+                 api::InternalReadConsistency desired_read_consistency = api::InternalReadConsistency::Strong,
+                 bool symmetric_replica_selection = false);
 
     void onClose(DistributorStripeMessageSender& sender) override;
     void onStart(DistributorStripeMessageSender& sender) override;
@@ -105,6 +106,8 @@ private:
     DbReplicaState                      _replicas_in_db;
     vespalib::Trace                     _trace;
     api::InternalReadConsistency        _desired_read_consistency;
+    uint64_t                            _replica_spread_seed;
+    bool                                _symmetric_replica_selection;
     bool                                _has_replica_inconsistency;
     bool                                _any_replicas_failed;
 
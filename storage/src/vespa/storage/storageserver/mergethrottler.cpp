@@ -202,6 +202,7 @@ MergeThrottler::MergeThrottler(
       _rendezvous(RendezvousState::NONE),
       _throttle_until_time(),
       _backpressure_duration(std::chrono::seconds(30)),
+      _queue_starvation_aging_threshold(std::chrono::steady_clock::duration::zero()),
       _active_merge_memory_used_bytes(0),
       _max_merge_memory_usage_bytes(0), // 0 ==> unlimited
       _use_dynamic_throttling(false),
@@ -229,6 +230,9 @@ MergeThrottler::on_configure(const StorServerConfig& new_config)
     if (new_config.resourceExhaustionMergeBackPressureDurationSecs < 0.0) {
         throw config::InvalidConfigException("Merge back-pressure duration cannot be less than 0");
     }
+    if (new_config.mergeThrottlingQueueStarvationAgingSecs < 0.0) {
+        throw config::InvalidConfigException("Merge queue starvation aging duration cannot be less than 0");
+    }
     if (_use_dynamic_throttling) {
         auto min_win_sz = std::max(new_config.mergeThrottlingPolicy.minWindowSize, 1);
         auto max_win_sz = std::max(new_config.mergeThrottlingPolicy.maxWindowSize, 1);
@@ -250,6 +254,8 @@ MergeThrottler::on_configure(const StorServerConfig& new_config)
     _maxQueueSize = new_config.maxMergeQueueSize;
     _backpressure_duration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
             std::chrono::duration<double>(new_config.resourceExhaustionMergeBackPressureDurationSecs));
+    _queue_starvation_aging_threshold = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(new_config.mergeThrottlingQueueStarvationAgingSecs));
     if (new_config.mergeThrottlingMemoryLimit.maxUsageBytes > 0) {
         _max_merge_memory_usage_bytes = static_cast<size_t>(new_config.mergeThrottlingMemoryLimit.maxUsageBytes);
     } else if ((new_config.mergeThrottlingMemoryLimit.maxUsageBytes == 0) && (_hw_info.memory().sizeBytes() > 0)) {
@@ -402,27 +408,38 @@ MergeThrottler::removeActiveMerge(ActiveMergeMap::iterator mergeIter)
     update_active_merge_memory_usage_metric();
 }
 
-api::StorageMessage::SP
-MergeThrottler::getNextQueuedMerge()
+MergeThrottler::MergePriorityQueue::iterator
+MergeThrottler::next_queued_merge_candidate()
 {
-    if (_queue.empty()) {
-        return {};
+    assert(!_queue.empty());
+    auto iter = _queue.begin();
+    if (_queue_starvation_aging_threshold != std::chrono::steady_clock::duration::zero()) {
+        // The entry with the lowest sequence number is the oldest one in the
+        // queue. If it has waited past the aging threshold it is considered
+        // starved and gets serviced before any younger, higher priority merges.
+        auto oldest = iter;
+        for (auto it = _queue.begin(); it != _queue.end(); ++it) {
+            if (it->_sequence < oldest->_sequence) {
+                oldest = it;
+            }
+        }
+        const auto now = _component.getClock().getMonotonicTime();
+        if ((now - oldest->_enqueue_time) >= _queue_starvation_aging_threshold) {
+            iter = oldest;
+        }
     }
+    return iter;
+}
 
-    auto iter = _queue.begin();
+api::StorageMessage::SP
+MergeThrottler::dequeue_merge(MergePriorityQueue::iterator iter)
+{
     auto entry = *iter;
     entry._startTimer.stop(_metrics->averageQueueWaitingTime);
     _queue.erase(iter);
     return entry._msg;
 }
 
-const api::MergeBucketCommand&
-MergeThrottler::peek_merge_queue() const noexcept
-{
-    assert(!_queue.empty());
-    return dynamic_cast<const api::MergeBucketCommand&>(*_queue.begin()->_msg);
-}
-
 void
 MergeThrottler::enqueue_merge_for_later_processing(
         const api::StorageMessage::SP& msg,
@@ -435,7 +452,7 @@ MergeThrottler::enqueue_merge_for_later_processing(
         return;
     }
     const bool is_forwarded_merge = !mergeCmd.from_distributor();
-    _queue.emplace(msg, _queueSequence++, is_forwarded_merge);
+    _queue.emplace(msg, _queueSequence++, _component.getClock().getMonotonicTime(), is_forwarded_merge);
     _metrics->queueSize.set(static_cast<int64_t>(_queue.size()));
 }
 
@@ -557,15 +574,19 @@ MergeThrottler::attemptProcessNextQueuedMerge(MessageGuard& msgGuard)
     if (_queue.empty()) {
         return false;
     }
-    if ( ! (canProcessNewMerge() && accepting_merge_is_within_memory_limits(peek_merge_queue()))) {
+    // Evaluate both the processing and memory gates against the exact entry
+    // that will be dequeued; with starvation aging enabled this may be the
+    // starved oldest entry rather than the queue front.
+    auto candidate = next_queued_merge_candidate();
+    const auto& candidate_cmd = dynamic_cast<const api::MergeBucketCommand&>(*candidate->_msg);
+    if ( ! (canProcessNewMerge() && accepting_merge_is_within_memory_limits(candidate_cmd))) {
         // Should never reach a non-sending state when there are
         // no to-be-replied merges that can trigger a new processing
         assert(!_merges.empty());
         return false;
     }
 
-    // If we get here, there must be something to dequeue.
-    api::StorageMessage::SP msg = getNextQueuedMerge();
+    api::StorageMessage::SP msg = dequeue_merge(candidate);
     assert(msg);
     // In case of resends and whatnot, it's possible for a merge
     // command to be in the queue while another higher priority
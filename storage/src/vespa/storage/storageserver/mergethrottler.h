@@ -86,14 +86,17 @@ private:
         MessageType _msg;
         metrics::MetricTimer _startTimer;
         uint64_t _sequence;
+        std::chrono::steady_clock::time_point _enqueue_time;
         bool _is_forwarded_merge;
 
         StablePriorityOrderingWrapper(const MessageType& msg,
                                       uint64_t sequence,
+                                      std::chrono::steady_clock::time_point enqueue_time,
                                       bool is_forwarded_merge) noexcept
             : _msg(msg),
               _startTimer(),
               _sequence(sequence),
+              _enqueue_time(enqueue_time),
               _is_forwarded_merge(is_forwarded_merge)
         {
         }
@@ -182,6 +185,7 @@ private:
     RendezvousState                               _rendezvous;
     mutable std::chrono::steady_clock::time_point _throttle_until_time;
     std::chrono::steady_clock::duration           _backpressure_duration;
+    std::chrono::steady_clock::duration           _queue_starvation_aging_threshold;
     size_t                                        _active_merge_memory_used_bytes;
     size_t                                        _max_merge_memory_usage_bytes;
     bool                                          _use_dynamic_throttling;
@@ -349,11 +353,17 @@ private:
     void removeActiveMerge(ActiveMergeMap::iterator);
 
     /**
-     * Gets (and pops) the highest priority merge waiting in the queue,
-     * if one exists.
-     * @return Highest priority waiting merge or null SP if queue is empty
+     * Gets the queue entry that will be dequeued next. This is normally the
+     * highest priority merge, but if the (default off) starvation aging
+     * threshold is enabled and the oldest entry has waited past it, that
+     * starved entry is chosen instead. Queue must not be empty.
      */
-    api::StorageMessage::SP getNextQueuedMerge();
+    MergePriorityQueue::iterator next_queued_merge_candidate();
+
+    /**
+     * Pops the given queue entry and returns its merge message.
+     */
+    api::StorageMessage::SP dequeue_merge(MergePriorityQueue::iterator iter);
     void enqueue_merge_for_later_processing(const api::StorageMessage::SP& msg, MessageGuard& msgGuard);
 
     /**
@@ -370,7 +380,6 @@ private:
     [[nodiscard]] bool allow_merge_despite_full_window(const api::MergeBucketCommand& cmd) const noexcept;
     [[nodiscard]] bool accepting_merge_is_within_memory_limits(const api::MergeBucketCommand& cmd) const noexcept;
     [[nodiscard]] bool may_allow_into_queue(const api::MergeBucketCommand& cmd) const noexcept;
-    [[nodiscard]] const api::MergeBucketCommand& peek_merge_queue() const noexcept;
 
     void sendReply(const api::MergeBucketCommand& cmd,
                    const api::ReturnCode& result,
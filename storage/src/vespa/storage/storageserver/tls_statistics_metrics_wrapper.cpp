@@ -25,6 +25,10 @@ TlsStatisticsMetricsWrapper::TlsStatisticsMetricsWrapper(metrics::MetricSet* own
               "peer certificate credentials", this),
       tls_connections_broken("tls-connections-broken", {}, "Number of TLS "
               "connections broken due to failures during frame encoding or decoding", this),
+      tls_encoded_bytes("tls-encoded-bytes", {}, "Number of plaintext bytes "
+              "sealed into TLS records; approximates outbound symmetric crypto work", this),
+      tls_decoded_bytes("tls-decoded-bytes", {}, "Number of plaintext bytes "
+              "produced from TLS records; approximates inbound symmetric crypto work", this),
       failed_tls_config_reloads("failed-tls-config-reloads", {}, "Number of times "
               "background reloading of TLS config has failed", this),
       rpc_capability_checks_failed("rpc-capability-checks-failed", {},
@@ -59,6 +63,10 @@ void TlsStatisticsMetricsWrapper::update_metrics_with_snapshot_delta() {
                                     server_delta.invalid_peer_credentials);
     tls_connections_broken.set(client_delta.broken_tls_connections +
                                server_delta.broken_tls_connections);
+    tls_encoded_bytes.set(client_delta.tls_encoded_bytes +
+                          server_delta.tls_encoded_bytes);
+    tls_decoded_bytes.set(client_delta.tls_decoded_bytes +
+                          server_delta.tls_decoded_bytes);
 
     auto config_current = vespalib::net::tls::ConfigStatistics::get().snapshot();
     auto config_delta = config_current.subtract(last_config_stats_snapshot);
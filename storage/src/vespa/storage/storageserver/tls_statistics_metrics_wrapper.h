@@ -26,6 +26,8 @@ class TlsStatisticsMetricsWrapper : public metrics::MetricSet {
     metrics::LongCountMetric tls_handshakes_failed;
     metrics::LongCountMetric peer_authorization_failures;
     metrics::LongCountMetric tls_connections_broken;
+    metrics::LongCountMetric tls_encoded_bytes;
+    metrics::LongCountMetric tls_decoded_bytes;
 
     metrics::LongCountMetric failed_tls_config_reloads;
 
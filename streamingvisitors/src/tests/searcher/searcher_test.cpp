@@ -612,6 +612,21 @@ TEST("Test basic strchrfield searchers") {
     }
 }
 
+TEST("fast searcher screens words on their first byte with many terms") {
+    FUTF8StrChrFieldSearcher fs(0);
+    std::string field = "alpha bravo charlie delta echo alpaca bravo";
+    assertString(fs, StringList().add("alpha").add("bravo").add("candy").add("alpaca"), field,
+                 HitsList().add(Hits().add({0, 0}))
+                           .add(Hits().add({0, 1}).add({0, 6}))
+                           .add(Hits())
+                           .add(Hits().add({0, 5})));
+    fs.match_type(FieldSearcher::PREFIX);
+    assertString(fs, StringList().add("alp").add("brav").add("x"), field,
+                 HitsList().add(Hits().add({0, 0}).add({0, 5}))
+                           .add(Hits().add({0, 1}).add({0, 6}))
+                           .add(Hits()));
+}
+
 bool
 testUTF8SubStringFieldSearcher(StrChrFieldSearcher & fs)
 {
@@ -28,6 +28,7 @@
 #include <vespa/vespalib/text/stringtokenizer.h>
 #include <vespa/fnet/databuffer.h>
 #include <vespa/fastlib/text/normwordfolder.h>
+#include <algorithm>
 #include <optional>
 
 #include <vespa/log/log.h>
@@ -314,6 +315,7 @@ SearchVisitor::SearchVisitor(StorageComponent& component,
       _query(),
       _queryResult(std::make_unique<documentapi::QueryResultMessage>()),
       _fieldSearcherMap(),
+      _completedTermsPerSearcher(),
       _docTypeMapping(),
       _fieldSearchSpecMap(),
       _snippetModifierManager(),
@@ -535,6 +537,9 @@ SearchVisitor::init(const Parameters & params)
             // This depends on _fieldPathMap (from setupScratchDocument),
             // and IQueryEnvironment (from setupRankProcessors).
             prepare_field_searchers();
+
+            // Depends on the field searchers having their term lists assigned.
+            setupMatchTermination();
         } else {
             LOG(warning, "No query received");
         }
@@ -881,6 +886,34 @@ SearchVisitor::prepare_field_searchers()
                               *_fieldPathMap, _rankController.getRankProcessor()->get_query_env());
 }
 
+void
+SearchVisitor::setupMatchTermination()
+{
+    _completedTermsPerSearcher.clear();
+    if ( ! _query.valid() ||
+        (dynamic_cast<const search::streaming::AndQueryNode *>(&_query.getRoot()) == nullptr))
+    {
+        return;
+    }
+    const auto & root = static_cast<const search::streaming::QueryConnector &>(_query.getRoot());
+    _completedTermsPerSearcher.resize(_fieldSearcherMap.size());
+    for (size_t child(0); child < root.size(); ++child) {
+        const auto * term = dynamic_cast<const search::streaming::QueryTerm *>(root[child].get());
+        if (term == nullptr) {
+            continue;
+        }
+        // Register the term with the last searcher covering one of its
+        // fields; after that searcher has run no more hits can arrive.
+        for (size_t i(_fieldSearcherMap.size()); i-- > 0; ) {
+            const auto & qtl = _fieldSearcherMap[i]->query_terms();
+            if (std::find(qtl.begin(), qtl.end(), term) != qtl.end()) {
+                _completedTermsPerSearcher[i].push_back(term);
+                break;
+            }
+        }
+    }
+}
+
 void
 SearchVisitor::setupSnippetModifiers()
 {
@@ -1164,10 +1197,19 @@ SearchVisitor::group(const document::Document & doc, search::HitRank rank, bool
 bool
 SearchVisitor::match(const StorageDocument & doc)
 {
-    for (vsm::FieldSearcherContainer & fSearch : _fieldSearcherMap) {
-        fSearch->search(doc);
+    bool pruned(false);
+    for (size_t i(0), m(_fieldSearcherMap.size()); !pruned && (i < m); ++i) {
+        _fieldSearcherMap[i]->search(doc);
+        if ( ! _completedTermsPerSearcher.empty()) {
+            for (const auto * term : _completedTermsPerSearcher[i]) {
+                if ( ! term->evaluate()) {
+                    pruned = true;
+                    break;
+                }
+            }
+        }
     }
-    bool hit(_query.evaluate());
+    bool hit(!pruned && _query.evaluate());
     if (hit) {
         _hitCount++;
         LOG(spam, "Match in doc %d", doc.getDocId());
@@ -344,6 +344,14 @@ private:
      **/
     bool match(const vsm::StorageDocument & doc);
 
+    /**
+     * Set up early termination of field searching. For a query with an
+     * AND-like root, a document cannot match once a top-level term has
+     * been searched in all its fields without getting any hits, so
+     * match() can skip the remaining field searchers for that document.
+     **/
+    void setupMatchTermination();
+
     /**
      * Fill attribute vectors needed for aggregation and sorting with values from the scratch document.
      *
@@ -467,6 +475,8 @@ private:
     search::streaming::Query                _query;
     std::unique_ptr<documentapi::QueryResultMessage>    _queryResult;
     vsm::FieldIdTSearcherMap                _fieldSearcherMap;
+    // Per field searcher: conjunctive top-level terms whose last field is covered by that searcher.
+    std::vector<search::streaming::ConstQueryTermList> _completedTermsPerSearcher;
     vsm::SharedFieldPathMap                 _fieldPathMap;
     vsm::DocumentTypeMapping                _docTypeMapping;
     vsm::FieldSearchSpecMap                 _fieldSearchSpecMap;
@@ -25,6 +25,7 @@ class FieldSearcherBase
 {
 public:
     FieldSearcherBase & operator = (const FieldSearcherBase & org) = delete;
+    const search::streaming::QueryTermList & query_terms() const noexcept { return _qtl; }
 protected:
     FieldSearcherBase() noexcept;
     FieldSearcherBase(const FieldSearcherBase & org);
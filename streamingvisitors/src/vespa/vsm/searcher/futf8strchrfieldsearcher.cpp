@@ -25,6 +25,33 @@ FUTF8StrChrFieldSearcher::FUTF8StrChrFieldSearcher(FieldIdT fId)
 { }
 FUTF8StrChrFieldSearcher::~FUTF8StrChrFieldSearcher() = default;
 
+void
+FUTF8StrChrFieldSearcher::prepare(search::streaming::QueryTermList& qtl,
+                                  const SharedSearcherBuf& buf,
+                                  const vsm::FieldPathMapT& field_paths,
+                                  search::fef::IQueryEnvironment& query_env)
+{
+    UTF8StrChrFieldSearcher::prepare(qtl, buf, field_paths, query_env);
+    _termsPerFirstByte.clear();
+    if ((_qtl.size() <= 1) || (_qtl.size() > 64)) {
+        // A single term has no fan-out worth screening, and more than
+        // 64 terms do not fit in the mask.
+        return;
+    }
+    _termsPerFirstByte.resize(256, 0);
+    for (size_t i = 0; i < _qtl.size(); ++i) {
+        const char * term;
+        termsize_t tsz = _qtl[i]->term(term);
+        if (tsz == 0) {
+            for (uint64_t & mask : _termsPerFirstByte) {
+                mask |= (1ul << i);
+            }
+        } else {
+            _termsPerFirstByte[static_cast<byte>(term[0])] |= (1ul << i);
+        }
+    }
+}
+
 bool
 FUTF8StrChrFieldSearcher::ansiFold(const char * toFold, size_t sz, char * folded)
 {
@@ -166,6 +193,20 @@ size_t FUTF8StrChrFieldSearcher::match(const char *folded, size_t sz, QueryTerm
   return words;
 }
 
+inline void
+FUTF8StrChrFieldSearcher::matchWord(QueryTerm & qt, const char * word, termcount_t words)
+{
+  const char * term;
+  termsize_t tsz = qt.term(term);
+
+  const char *et=term+tsz;
+  const char *fnt;
+  for (fnt = word; (term < et) && (*term == *fnt); term++, fnt++);
+  if ((term == et) && (prefix() || qt.isPrefix() || !*fnt)) {
+    addHit(qt, words);
+  }
+}
+
 size_t FUTF8StrChrFieldSearcher::match(const char *folded, size_t sz, size_t mintsz, QueryTerm ** qtl, size_t qtlSize)
 {
   (void) mintsz;
@@ -175,16 +216,17 @@ size_t FUTF8StrChrFieldSearcher::match(const char *folded, size_t sz, size_t min
   while (!*n) n++;
   for( ; ; ) {
     if (n>=e) break;
-    for(QueryTerm ** it=qtl, ** mt=qtl+qtlSize; it != mt; it++) {
-      QueryTerm & qt = **it;
-      const char * term;
-      termsize_t tsz = qt.term(term);
-
-      const char *et=term+tsz;
-      const char *fnt;
-      for (fnt = n; (term < et) && (*term == *fnt); term++, fnt++);
-      if ((term == et) && (prefix() || qt.isPrefix() || !*fnt)) {
-        addHit(qt, words);
+    if (!_termsPerFirstByte.empty()) {
+      // Screen each word on its first byte and only verify the terms
+      // that can start with it.
+      uint64_t candidates = _termsPerFirstByte[static_cast<byte>(*n)];
+      while (candidates) {
+        matchWord(*qtl[Optimized::lsbIdx(candidates)], n, words);
+        candidates &= (candidates - 1);
+      }
+    } else {
+      for(QueryTerm ** it=qtl, ** mt=qtl+qtlSize; it != mt; it++) {
+        matchWord(**it, n, words);
       }
     }
     words++;
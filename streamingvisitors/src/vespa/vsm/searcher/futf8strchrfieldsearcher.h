@@ -11,6 +11,9 @@ public:
     std::unique_ptr<FieldSearcher> duplicate() const override;
     explicit FUTF8StrChrFieldSearcher(FieldIdT fId);
     ~FUTF8StrChrFieldSearcher() override;
+    void prepare(search::streaming::QueryTermList& qtl, const SharedSearcherBuf& buf,
+                 const vsm::FieldPathMapT& field_paths,
+                 search::fef::IQueryEnvironment& query_env) override;
     static bool ansiFold(const char * toFold, size_t sz, char * folded);
     static bool lfoldaa(const char * toFold, size_t sz, char * folded, size_t & unalignedStart);
     static bool lfoldua(const char * toFold, size_t sz, char * folded, size_t & alignedStart);
@@ -19,7 +22,14 @@ public:
     size_t matchTerms(const FieldRef&, size_t shortestTerm) override;
     virtual size_t match(const char *folded, size_t sz, search::streaming::QueryTerm & qt);
     size_t match(const char *folded, size_t sz, size_t mintsz, search::streaming::QueryTerm ** qtl, size_t qtlSize);
+    void matchWord(search::streaming::QueryTerm & qt, const char * word, termcount_t words);
     std::vector<char> _folded;
+    /**
+     * Bitmask, indexed by the first folded byte of a word, of the query
+     * terms that can possibly match a word starting with that byte.
+     * Empty when the terms do not fit in a single mask.
+     */
+    std::vector<uint64_t> _termsPerFirstByte;
 };
 
 }
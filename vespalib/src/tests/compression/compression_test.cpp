@@ -4,7 +4,10 @@
 #include <vespa/vespalib/testkit/test_master.hpp>
 #include <vespa/vespalib/stllike/string.h>
 #include <vespa/vespalib/util/compressor.h>
+#include <vespa/vespalib/util/zstdcompressor.h>
 #include <vespa/vespalib/data/databuffer.h>
+#include <vespa/vespalib/util/stringfmt.h>
+#include <zstd.h>
 #include <atomic>
 
 #include <vespa/log/log.h>
@@ -69,6 +72,57 @@ TEST("requiret that zstd compression/decompression works") {
     EXPECT_EQUAL(_G_compressableText, vespalib::string(decompress.data(), decompress.size()));
 }
 
+TEST("require that zstd compression with a raw dictionary round trips") {
+    ZStdCompressor compressor;
+    CompressionConfig cfg(CompressionConfig::Type::ZSTD);
+    ConstBufferRef dictionary(_G_compressableText.c_str(), 512);
+    vespalib::string input = _G_compressableText.substr(512);
+    std::vector<char> compressed(ZSTD_compressBound(input.size()));
+    size_t compressedLen = compressed.size();
+    EXPECT_TRUE(compressor.process_with_dictionary(cfg, dictionary, input.c_str(), input.size(),
+                                                   compressed.data(), compressedLen));
+    std::vector<char> output(input.size());
+    size_t outputLen = output.size();
+    EXPECT_TRUE(compressor.unprocess_with_dictionary(dictionary, compressed.data(), compressedLen,
+                                                     output.data(), outputLen));
+    EXPECT_EQUAL(input, vespalib::string(output.data(), outputLen));
+}
+
+TEST("require that a trained zstd dictionary helps small buffers") {
+    std::vector<vespalib::string> samples;
+    std::vector<ConstBufferRef> sampleRefs;
+    for (size_t i = 0; i < 2000; ++i) {
+        samples.push_back(vespalib::make_string("{\"id\":\"id:test:music::%zu\",\"title\":\"title %zu\","
+                                                "\"artist\":\"artist %zu\",\"year\":%zu,\"score\":%zu,"
+                                                "\"album\":\"album %zu\",\"duration\":%zu}",
+                                                i, i, i % 100, 1900 + (i % 100), i % 7, i % 50, 100 + (i % 200)));
+        sampleRefs.emplace_back(samples.back().c_str(), samples.back().size());
+    }
+    auto dictionary = ZStdCompressor::train_dictionary(4096, sampleRefs);
+    ASSERT_FALSE(dictionary.empty());
+
+    ZStdCompressor compressor;
+    CompressionConfig cfg(CompressionConfig::Type::ZSTD);
+    ConstBufferRef dictionaryRef(dictionary.data(), dictionary.size());
+    const vespalib::string &doc = samples[42];
+
+    std::vector<char> plain(ZSTD_compressBound(doc.size()));
+    size_t plainLen = plain.size();
+    EXPECT_TRUE(compressor.process(cfg, doc.c_str(), doc.size(), plain.data(), plainLen));
+
+    std::vector<char> withDict(ZSTD_compressBound(doc.size()));
+    size_t withDictLen = withDict.size();
+    EXPECT_TRUE(compressor.process_with_dictionary(cfg, dictionaryRef, doc.c_str(), doc.size(),
+                                                   withDict.data(), withDictLen));
+    EXPECT_LESS(withDictLen, plainLen);
+
+    std::vector<char> output(doc.size());
+    size_t outputLen = output.size();
+    EXPECT_TRUE(compressor.unprocess_with_dictionary(dictionaryRef, withDict.data(), withDictLen,
+                                                     output.data(), outputLen));
+    EXPECT_EQUAL(doc, vespalib::string(output.data(), outputLen));
+}
+
 TEST("require that CompressionConfig is Atomic") {
     EXPECT_EQUAL(8u, sizeof(CompressionConfig));
     EXPECT_TRUE(std::atomic<CompressionConfig>::is_always_lock_free);
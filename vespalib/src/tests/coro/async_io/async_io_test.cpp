@@ -16,6 +16,8 @@
 #include <vespa/vespalib/net/tls/tls_crypto_engine.h>
 #include <vespa/vespalib/net/tls/maybe_tls_crypto_engine.h>
 #include <vespa/vespalib/gtest/gtest.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 using namespace vespalib;
 using namespace vespalib::coro;
@@ -174,6 +176,41 @@ TEST(AsyncIoTest, maybe_tls_false_socket_io) {
     verify_socket_io(engine);
 }
 
+Work read_file_slice(AsyncIo &async, int fd, const vespalib::string &expect, int64_t offset) {
+    char tmp[64];
+    REQUIRE(expect.size() <= sizeof(tmp));
+    ssize_t res = co_await async.read_at(fd, tmp, expect.size(), offset);
+    EXPECT_EQ(res, ssize_t(expect.size()));
+    EXPECT_EQ(vespalib::string(tmp, expect.size()), expect);
+    co_return Done{};
+}
+
+void verify_file_io(AsyncIo::ImplTag prefer_impl) {
+    vespalib::string data = "async positional file io, one slice per coroutine";
+    const char *file_name = "async_io_test_read_at.tmp";
+    int fd = open(file_name, O_CREAT | O_RDWR | O_TRUNC, 0644);
+    REQUIRE(fd >= 0);
+    REQUIRE_EQ(write(fd, data.data(), data.size()), ssize_t(data.size()));
+    auto async = AsyncIo::create(prefer_impl);
+    fprintf(stderr, "verify_file_io: async impl: %s\n", impl_spec(async).c_str());
+    auto f1 = make_future(read_file_slice(async, fd, data.substr(0, 5), 0));
+    auto f2 = make_future(read_file_slice(async, fd, data.substr(6, 10), 6));
+    auto f3 = make_future(read_file_slice(async, fd, data.substr(data.size() - 9), data.size() - 9));
+    (void) f1.get();
+    (void) f2.get();
+    (void) f3.get();
+    close(fd);
+    unlink(file_name);
+}
+
+TEST(AsyncIoTest, positional_file_read) {
+    verify_file_io(AsyncIo::ImplTag::EPOLL);
+}
+
+TEST(AsyncIoTest, positional_file_read_with_io_uring_maybe) {
+    verify_file_io(AsyncIo::ImplTag::URING);
+}
+
 TEST(AsyncIoTest, raw_socket_io_with_io_uring_maybe) {
     NullCryptoEngine engine;
     verify_socket_io(engine, AsyncIo::ImplTag::URING);
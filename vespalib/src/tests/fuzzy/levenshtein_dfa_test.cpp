@@ -308,7 +308,7 @@ TEST_P(LevenshteinDfaTest, malformed_utf8_is_replaced_with_placeholder_char) {
 
 TEST_P(LevenshteinDfaTest, unsupported_max_edits_value_throws) {
     EXPECT_THROW((void)LevenshteinDfa::build("abc", 0, casing(), dfa_type()), std::invalid_argument);
-    EXPECT_THROW((void)LevenshteinDfa::build("abc", 3, casing(), dfa_type()), std::invalid_argument);
+    EXPECT_THROW((void)LevenshteinDfa::build("abc", 4, casing(), dfa_type()), std::invalid_argument);
 }
 
 struct LevenshteinDfaCasingTest : TestWithParam<LevenshteinDfa::DfaType> {
@@ -421,7 +421,7 @@ INSTANTIATE_TEST_SUITE_P(SupportedMaxEdits,
                                         LevenshteinDfa::DfaType::Table),
                                  Values(LevenshteinDfa::Matching::FullString,
                                         LevenshteinDfa::Matching::Prefix),
-                                 Values(1, 2)),
+                                 Values(1, 2, 3)),
                          LevenshteinDfaSuccessorTest::stringify_params);
 
 /**
@@ -284,6 +284,10 @@ TEST(TableDfaTest, minimal_boundary_will_never_exceed_word_end_with_max_edits_2)
     verify_word_end_boundary<2>();
 }
 
+TEST(TableDfaTest, minimal_boundary_will_never_exceed_word_end_with_max_edits_3) {
+    verify_word_end_boundary<3>();
+}
+
 template <uint8_t N>
 void verify_inline_tfa() {
     auto tfa = make_tfa<N>();
@@ -311,6 +315,10 @@ TEST(TableDfaTest, verify_inline_tfa_with_max_edits_2) {
     verify_inline_tfa<2>();
 }
 
+TEST(TableDfaTest, verify_inline_tfa_with_max_edits_3) {
+    verify_inline_tfa<3>();
+}
+
 template <uint8_t N>
 void dump_tfa_as_code() {
     auto tfa = make_tfa<N>();
@@ -352,6 +360,10 @@ TEST(TableDfaTest, dump_tfa_with_max_edits_2_as_code) {
     dump_tfa_as_code<2>();
 }
 
+TEST(TableDfaTest, dump_tfa_with_max_edits_3_as_code) {
+    dump_tfa_as_code<3>();
+}
+
 template <uint8_t N>
 void dump_tfa_graph() {
     auto repo = make_state_repo<N>();
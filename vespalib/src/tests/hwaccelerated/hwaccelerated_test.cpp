@@ -3,6 +3,7 @@
 #include <vespa/vespalib/testkit/test_kit.h>
 #include <vespa/vespalib/hwaccelerated/iaccelerated.h>
 #include <vespa/vespalib/hwaccelerated/generic.h>
+#include <algorithm>
 #include <vespa/log/log.h>
 LOG_SETUP("hwaccelerated_test");
 
@@ -47,4 +48,56 @@ TEST("test euclidean distance") {
     TEST_DO(verifyEuclideanDistance(hwaccelerated::IAccelerated::getAccelerator(), TEST_LENGTH));
 }
 
+void
+verifyEuclideanDistanceKernel(const hwaccelerated::IAccelerated & accel, size_t testLength) {
+    auto kernel = accel.squaredEuclideanDistanceKernel(testLength);
+    ASSERT_TRUE(kernel != nullptr);
+    srand(3);
+    std::vector<float> a = createAndFill<float>(testLength);
+    std::vector<float> b = createAndFill<float>(testLength);
+    double expected = accel.squaredEuclideanDistance(a.data(), b.data(), testLength);
+    double computed = kernel(a.data(), b.data());
+    EXPECT_APPROX(expected, computed, expected*0.0001);
+}
+
+TEST("test fixed size euclidean distance kernels") {
+    for (size_t sz : {128ul, 256ul, 384ul, 768ul, 1024ul}) {
+        TEST_DO(verifyEuclideanDistanceKernel(hwaccelerated::GenericAccelrator(), sz));
+        TEST_DO(verifyEuclideanDistanceKernel(hwaccelerated::IAccelerated::getAccelerator(), sz));
+    }
+    EXPECT_TRUE(hwaccelerated::GenericAccelrator().squaredEuclideanDistanceKernel(100) == nullptr);
+    EXPECT_TRUE(hwaccelerated::IAccelerated::getAccelerator().squaredEuclideanDistanceKernel(100) == nullptr);
+}
+
+std::vector<uint32_t> createSortedUnique(size_t sz, uint32_t maxValue) {
+    std::vector<uint32_t> v(sz);
+    for (size_t i(0); i < sz; i++) {
+        v[i] = rand() % maxValue;
+    }
+    std::sort(v.begin(), v.end());
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+    return v;
+}
+
+void verifyIntersectU32(const hwaccelerated::IAccelerated & accel, size_t aLength, size_t bLength) {
+    srand(7);
+    std::vector<uint32_t> a = createSortedUnique(aLength, 1000000);
+    std::vector<uint32_t> b = createSortedUnique(bLength, 1000000);
+    std::vector<uint32_t> expected;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    std::vector<uint32_t> dest(std::min(a.size(), b.size()));
+    size_t cnt = accel.intersectU32(a.data(), a.size(), b.data(), b.size(), dest.data());
+    dest.resize(cnt);
+    EXPECT_TRUE(dest == expected);
+}
+
+TEST("test intersect sorted u32 arrays") {
+    for (size_t aLength : {0ul, 1ul, 7ul, 1000ul, 30000ul}) {
+        for (size_t bLength : {0ul, 13ul, 1000ul, 100000ul}) {
+            TEST_DO(verifyIntersectU32(hwaccelerated::GenericAccelrator(), aLength, bLength));
+            TEST_DO(verifyIntersectU32(hwaccelerated::IAccelerated::getAccelerator(), aLength, bLength));
+        }
+    }
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
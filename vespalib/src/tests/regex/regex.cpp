@@ -18,6 +18,8 @@ TEST("require that prefix detection works") {
     EXPECT_EQUAL("fo", RegexpUtil::get_prefix("^foo*"));
     EXPECT_EQUAL("fo", RegexpUtil::get_prefix("^foo?"));
     EXPECT_EQUAL("foo", RegexpUtil::get_prefix("^foo+"));
+    // quantifier after a multi-byte UTF-8 character pops the whole character
+    EXPECT_EQUAL("clich", RegexpUtil::get_prefix("^clich\xc3\xa9*"));
 }
 
 TEST("require that prefix detection sometimes underestimates the prefix size") {
@@ -32,6 +34,83 @@ TEST("require that prefix detection sometimes underestimates the prefix size") {
     EXPECT_EQUAL("", RegexpUtil::get_prefix("^foo|^foobar"));
 }
 
+TEST("require that required substring detection works") {
+    EXPECT_EQUAL("", RegexpUtil::get_required_substring(""));
+    EXPECT_EQUAL("foo", RegexpUtil::get_required_substring("foo"));
+    EXPECT_EQUAL("foo", RegexpUtil::get_required_substring("^foo$"));
+    EXPECT_EQUAL("bar", RegexpUtil::get_required_substring("bar.foo"));
+    EXPECT_EQUAL("foobar", RegexpUtil::get_required_substring("foobar.foo"));
+    EXPECT_EQUAL("", RegexpUtil::get_required_substring("foo|bar"));
+    EXPECT_EQUAL("bar", RegexpUtil::get_required_substring("foo*bar"));
+    EXPECT_EQUAL("bar", RegexpUtil::get_required_substring("fo?bar"));
+    EXPECT_EQUAL("foo", RegexpUtil::get_required_substring("foo[0-9]ba"));
+    EXPECT_EQUAL("foo", RegexpUtil::get_required_substring("foo\\dba"));
+    EXPECT_EQUAL("foo", RegexpUtil::get_required_substring("foo(bar|baz)"));
+    EXPECT_EQUAL("barx", RegexpUtil::get_required_substring("fo(o|0)barx"));
+    EXPECT_EQUAL("foo", RegexpUtil::get_required_substring("(bar)?foo"));
+    EXPECT_EQUAL("foo", RegexpUtil::get_required_substring("fo{0,1}foo"));
+    // quantifier after a multi-byte UTF-8 character pops the whole character
+    EXPECT_EQUAL("clich", RegexpUtil::get_required_substring("clich\xc3\xa9*"));
+    // '(?'-style groups may change matching semantics; require nothing
+    EXPECT_EQUAL("", RegexpUtil::get_required_substring("(?i)foo"));
+    EXPECT_EQUAL("", RegexpUtil::get_required_substring("foobar(?:baz)"));
+}
+
+TEST("require that required substring detection sometimes underestimates the substring size") {
+    EXPECT_EQUAL("ab", RegexpUtil::get_required_substring("ab+c"));
+    EXPECT_EQUAL("foo", RegexpUtil::get_required_substring("foo\\.bar"));
+    EXPECT_EQUAL("", RegexpUtil::get_required_substring("(foo)"));
+    EXPECT_EQUAL("fo", RegexpUtil::get_required_substring("foo{1,2}"));
+    EXPECT_EQUAL("xy", RegexpUtil::get_required_substring("xy(foo)+"));
+}
+
+namespace {
+
+struct Literal {
+    bool ok;
+    vespalib::string literal;
+    bool anchored_start;
+    bool anchored_end;
+    explicit Literal(std::string_view re) : ok(), literal(), anchored_start(), anchored_end() {
+        ok = RegexpUtil::get_literal(re, literal, anchored_start, anchored_end);
+    }
+};
+
+}
+
+TEST("require that literal detection works") {
+    EXPECT_TRUE(Literal("").ok);
+    EXPECT_EQUAL("", Literal("").literal);
+    EXPECT_TRUE(Literal("foo").ok);
+    EXPECT_EQUAL("foo", Literal("foo").literal);
+    EXPECT_FALSE(Literal("foo").anchored_start);
+    EXPECT_FALSE(Literal("foo").anchored_end);
+    EXPECT_TRUE(Literal("^foo").anchored_start);
+    EXPECT_TRUE(Literal("foo$").anchored_end);
+    EXPECT_TRUE(Literal("^foo$").anchored_start);
+    EXPECT_TRUE(Literal("^foo$").anchored_end);
+    EXPECT_EQUAL("foo", Literal("^foo$").literal);
+    EXPECT_TRUE(Literal("fo\\.o").ok);
+    EXPECT_EQUAL("fo.o", Literal("fo\\.o").literal);
+    EXPECT_TRUE(Literal("foo\\$").ok);
+    EXPECT_EQUAL("foo$", Literal("foo\\$").literal);
+    EXPECT_FALSE(Literal("foo\\$").anchored_end);
+    EXPECT_TRUE(Literal("foo\\\\$").anchored_end);
+    EXPECT_EQUAL("foo\\", Literal("foo\\\\$").literal);
+    EXPECT_EQUAL("a|b", Literal(RegexpUtil::make_from_substring("a|b")).literal);
+    EXPECT_TRUE(Literal(RegexpUtil::make_from_suffix("x*$")).anchored_end);
+    EXPECT_EQUAL("x*$", Literal(RegexpUtil::make_from_suffix("x*$")).literal);
+    EXPECT_FALSE(Literal("fo.o").ok);
+    EXPECT_FALSE(Literal("foo*").ok);
+    EXPECT_FALSE(Literal("foo|bar").ok);
+    EXPECT_FALSE(Literal("(foo)").ok);
+    EXPECT_FALSE(Literal("foo[0-9]").ok);
+    EXPECT_FALSE(Literal("foo\\d").ok);
+    EXPECT_FALSE(Literal("fo^o").ok);
+    EXPECT_FALSE(Literal("fo$o").ok);
+    EXPECT_FALSE(Literal("foo\\").ok);
+}
+
 const std::string special("^|()[]{}.*?+\\$");
 
 struct ExprFixture {
@@ -182,6 +182,42 @@ TEST_F("require that bundle pool reuses bundles", SimpleThreadBundle::Pool(5)) {
     EXPECT_EQUAL(ptr, &bundle.bundle());
 }
 
+TEST_F("require that a lazy bundle runs single targets without obtaining a bundle", SimpleThreadBundle::Pool(5)) {
+    SimpleThreadBundle *ptr;
+    {
+        ptr = &f1.getBundle().bundle();
+    }
+    {
+        auto lazy = f1.getLazyBundle();
+        EXPECT_EQUAL(5u, lazy.size());
+        State state(1);
+        std::vector<Runnable*> targets = state.getTargets(1);
+        lazy.run(targets);
+        EXPECT_TRUE(state.check(Box<size_t>().add(1)));
+    }
+    // the pooled bundle was never taken
+    auto bundle = f1.getBundle();
+    EXPECT_EQUAL(ptr, &bundle.bundle());
+}
+
+TEST_F("require that a lazy bundle obtains and recycles a bundle when running multiple targets", SimpleThreadBundle::Pool(5)) {
+    SimpleThreadBundle *ptr;
+    {
+        ptr = &f1.getBundle().bundle();
+    }
+    {
+        auto lazy = f1.getLazyBundle();
+        State state(5);
+        std::vector<Runnable*> targets = state.getTargets(3);
+        lazy.run(targets);
+        lazy.run(targets);
+        EXPECT_TRUE(state.check(Box<size_t>().add(2).add(2).add(2).add(0).add(0)));
+    }
+    // the obtained bundle was put back when the lazy guard died
+    auto bundle = f1.getBundle();
+    EXPECT_EQUAL(ptr, &bundle.bundle());
+}
+
 TEST_MT_FF("require that bundle pool works with multiple threads", 32, SimpleThreadBundle::Pool(3),
            std::vector<SimpleThreadBundle*>(num_threads, 0))
 {
@@ -330,6 +330,43 @@ TEST("require that a stash only retains a single chunk when cleared") {
     EXPECT_EQUAL(sum({chunk_header_size()}), stash.count_used());    
 }
 
+TEST("require that reuse recycles chunk memory") {
+    Stash stash;
+    for (size_t i = 0; i < 100; ++i) {
+        stash.alloc(512);
+    }
+    size_t allocated = stash.get_memory_usage().allocatedBytes();
+    stash.reuse();
+    EXPECT_EQUAL(0u, stash.count_used());
+    EXPECT_EQUAL(allocated, stash.get_memory_usage().allocatedBytes());
+    for (size_t i = 0; i < 100; ++i) {
+        stash.alloc(512);
+    }
+    EXPECT_EQUAL(allocated, stash.get_memory_usage().allocatedBytes());
+}
+
+TEST("require that reuse recycles large memory blocks of the same size") {
+    size_t destructed = 0;
+    Stash stash;
+    Large &obj1 = stash.create<Large>(destructed);
+    stash.reuse();
+    EXPECT_EQUAL(1u, destructed);
+    Large &obj2 = stash.create<Large>(destructed);
+    EXPECT_EQUAL(&obj1, &obj2);
+    stash.reuse();
+    EXPECT_EQUAL(2u, destructed);
+}
+
+TEST("require that large memory blocks not reused in the next round are freed") {
+    Stash stash;
+    stash.alloc(10000);
+    size_t with_block = stash.get_memory_usage().allocatedBytes();
+    stash.reuse();
+    EXPECT_EQUAL(with_block, stash.get_memory_usage().allocatedBytes());
+    stash.reuse();
+    EXPECT_TRUE(stash.get_memory_usage().allocatedBytes() < with_block);
+}
+
 TEST("require that array constructor parameters are passed correctly") {
     Stash stash;
     {
@@ -471,4 +508,26 @@ TEST("require that uninitialized arrays can be created") {
     EXPECT_EQUAL(sum({chunk_header_size(), sizeof(float) * 64}), stash.count_used());
 }
 
+TEST("require that default-sized chunks are recycled through the thread-local pool") {
+    {
+        Stash tmp;
+        tmp.alloc(512);
+    } // chunk returned to the pool here
+    auto before = Stash::get_chunk_pool_stats();
+    {
+        Stash stash;
+        stash.alloc(512);
+        auto after = Stash::get_chunk_pool_stats();
+        EXPECT_EQUAL(before.hits + 1, after.hits);
+        EXPECT_EQUAL(before.misses, after.misses);
+    }
+    {
+        Stash custom(8192);
+        custom.alloc(512);
+        auto after = Stash::get_chunk_pool_stats();
+        EXPECT_EQUAL(before.hits + 1, after.hits);
+        EXPECT_EQUAL(before.misses + 1, after.misses);
+    }
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
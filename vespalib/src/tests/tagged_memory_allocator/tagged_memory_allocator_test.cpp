@@ -0,0 +1,86 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/vespalib/util/tagged_memory_allocator.h>
+#include <vespa/vespalib/gtest/gtest.h>
+
+using namespace vespalib::alloc;
+
+namespace {
+
+/*
+ * Deterministic backing allocator that hands out null buffers with the
+ * requested size and remembers what has been freed.
+ */
+class DummyAllocator : public MemoryAllocator {
+    mutable size_t _freed_bytes;
+public:
+    DummyAllocator() noexcept : _freed_bytes(0) { }
+    PtrAndSize alloc(size_t sz) const override { return PtrAndSize(nullptr, sz); }
+    void free(PtrAndSize alloc) const noexcept override { _freed_bytes += alloc.size(); }
+    size_t resize_inplace(PtrAndSize, size_t newSize) const override { return newSize; }
+    size_t freed_bytes() const noexcept { return _freed_bytes; }
+};
+
+}
+
+TEST(TaggedMemoryAllocatorTest, allocations_are_accounted_per_tag)
+{
+    DummyAllocator backing;
+    auto& registry = AllocationTagRegistry::instance();
+    auto allocator = registry.make_tagged_allocator("test/tag_a", &backing);
+
+    auto buf1 = allocator->alloc(100);
+    auto buf2 = allocator->alloc(200);
+    auto snapshot = registry.snapshot();
+    ASSERT_TRUE(snapshot.contains("test/tag_a"));
+    EXPECT_EQ(300u, snapshot["test/tag_a"].live_bytes);
+    EXPECT_EQ(300u, snapshot["test/tag_a"].peak_bytes);
+    EXPECT_EQ(2u, snapshot["test/tag_a"].alloc_count);
+
+    allocator->free(buf1);
+    snapshot = registry.snapshot();
+    EXPECT_EQ(200u, snapshot["test/tag_a"].live_bytes);
+    EXPECT_EQ(300u, snapshot["test/tag_a"].peak_bytes);
+    EXPECT_EQ(1u, snapshot["test/tag_a"].free_count);
+    EXPECT_EQ(100u, backing.freed_bytes());
+    allocator->free(buf2);
+}
+
+TEST(TaggedMemoryAllocatorTest, resize_inplace_adjusts_live_bytes)
+{
+    DummyAllocator backing;
+    auto& registry = AllocationTagRegistry::instance();
+    auto allocator = registry.make_tagged_allocator("test/tag_b", &backing);
+
+    auto buf = allocator->alloc(100);
+    EXPECT_EQ(250u, allocator->resize_inplace(buf, 250));
+    auto snapshot = registry.snapshot();
+    EXPECT_EQ(250u, snapshot["test/tag_b"].live_bytes);
+    EXPECT_EQ(250u, snapshot["test/tag_b"].peak_bytes);
+    EXPECT_EQ(350u, snapshot["test/tag_b"].total_alloc_bytes);
+    allocator->free(nullptr, 250);
+    snapshot = registry.snapshot();
+    EXPECT_EQ(0u, snapshot["test/tag_b"].live_bytes);
+}
+
+TEST(TaggedMemoryAllocatorTest, stats_are_shared_between_allocators_with_same_tag)
+{
+    DummyAllocator backing;
+    auto& registry = AllocationTagRegistry::instance();
+    auto allocator1 = registry.make_tagged_allocator("test/tag_c", &backing);
+    auto allocator2 = registry.make_tagged_allocator("test/tag_c", &backing);
+
+    auto buf1 = allocator1->alloc(100);
+    auto buf2 = allocator2->alloc(100);
+    auto snapshot = registry.snapshot();
+    EXPECT_EQ(200u, snapshot["test/tag_c"].live_bytes);
+    allocator1.reset();
+    // stats survive the allocators created with the tag
+    allocator2->free(buf1);
+    allocator2->free(buf2);
+    snapshot = registry.snapshot();
+    EXPECT_EQ(0u, snapshot["test/tag_c"].live_bytes);
+    EXPECT_EQ(200u, snapshot["test/tag_c"].peak_bytes);
+}
+
+GTEST_MAIN_RUN_ALL_TESTS()
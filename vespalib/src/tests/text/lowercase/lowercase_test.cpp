@@ -39,4 +39,19 @@ TEST("lowercase utf8 string to ucs4")
     EXPECT_EQUAL((uint32_t)'c', res[2]);
 }
 
+TEST("lowercase utf8 string with mixed ascii and multibyte characters")
+{
+    EXPECT_EQUAL(vespalib::string("abcdef"), LowerCase::convert(std::string_view("ABCdef")));
+    // Fast ASCII runs interleaved with multi-byte sequences must agree
+    // with per-character conversion ("\xc3\x86" is 'AE' ligature, its
+    // lowercase form is "\xc3\xa6").
+    EXPECT_EQUAL(vespalib::string("abc\xc3\xa6xyz"), LowerCase::convert(std::string_view("ABC\xc3\x86XYZ")));
+
+    auto res = LowerCase::convert_to_ucs4(std::string_view("A\xc3\x86z"));
+    EXPECT_EQUAL(3u, res.size());
+    EXPECT_EQUAL((uint32_t)'a', res[0]);
+    EXPECT_EQUAL(0xE6u, res[1]);
+    EXPECT_EQUAL((uint32_t)'z', res[2]);
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
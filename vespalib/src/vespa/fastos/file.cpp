@@ -207,6 +207,15 @@ FastOS_FileInterface::IsMemoryMapped() const
     return false;
 }
 
+void
+FastOS_FileInterface::memoryMapAdvise(int64_t position, uint64_t length, MemoryMapAdvice advice) const
+{
+    // Only subclases with support for memory mapping do something here.
+    (void) position;
+    (void) length;
+    (void) advice;
+}
+
 const char *
 FastOS_FileInterface::GetFileName() const
 {
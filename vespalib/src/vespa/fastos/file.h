@@ -442,6 +442,18 @@ public:
      */
     virtual bool IsMemoryMapped() const;
 
+    enum class MemoryMapAdvice {
+        WILLNEED,  // region will be consumed soon, start readahead
+        RANDOM     // region is probed randomly, avoid readahead
+    };
+
+    /**
+     * Advise the OS about the expected access pattern for a region of
+     * the memory mapped file content.  Ignored if the file is not
+     * mapped into memory.
+     */
+    virtual void memoryMapAdvise(int64_t position, uint64_t length, MemoryMapAdvice advice) const;
+
     /**
      * Will drop whatever is in the FS cache when called. Does not have effect in the future.
      **/
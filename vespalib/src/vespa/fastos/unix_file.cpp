@@ -8,6 +8,8 @@
 *****************************************************************************/
 
 #include "file.h"
+#include <algorithm>
+#include <cinttypes>
 #include <sstream>
 #include <cassert>
 #include <unistd.h>
@@ -239,6 +241,27 @@ void FastOS_UNIX_File::dropFromCache() const
 #endif
 }
 
+void
+FastOS_UNIX_File::memoryMapAdvise(int64_t position, uint64_t length, MemoryMapAdvice advice) const
+{
+    if ((_mmapbase == nullptr) || (length == 0) ||
+        (position < 0) || (static_cast<uint64_t>(position) + length > _mmaplen))
+    {
+        return;
+    }
+    // Align region at page boundaries
+    uint64_t pageMask = getpagesize() - 1;
+    uint64_t start = static_cast<uint64_t>(position) & ~pageMask;
+    uint64_t end = std::min((static_cast<uint64_t>(position) + length + pageMask) & ~pageMask,
+                            static_cast<uint64_t>(_mmaplen));
+    int nativeAdvice = (advice == MemoryMapAdvice::WILLNEED) ? POSIX_MADV_WILLNEED : POSIX_MADV_RANDOM;
+    int eCode = posix_madvise(static_cast<char *>(_mmapbase) + start, end - start, nativeAdvice);
+    if (eCode != 0) {
+        fprintf(stderr, "Failed: posix_madvise(%p, %" PRIu64 ", %d) = %d\n",
+                static_cast<char *>(_mmapbase) + start, end - start, nativeAdvice, eCode);
+    }
+}
+
 
 bool
 FastOS_UNIX_File::Close()
@@ -70,6 +70,7 @@ public:
     }
 
     bool IsMemoryMapped() const override { return _mmapbase != nullptr; }
+    void memoryMapAdvise(int64_t position, uint64_t length, MemoryMapAdvice advice) const override;
     bool SetPosition(int64_t desiredPosition) override;
     int64_t getPosition() const override;
     int64_t getSize() const override;
@@ -169,6 +169,14 @@ private:
      */
     void findPrevLeafNode() noexcept;
 
+    /*
+     * Prefetch the next leaf nodes below _path[0], called when a new
+     * current leaf node has been set up. Keeping a couple of leaf
+     * nodes in flight ahead of consumption hides the dependent node
+     * chases when iterating over large trees.
+     */
+    void prefetchUpcomingLeafNodes() noexcept;
+
 protected:
     /*
      * Report current position in tree.
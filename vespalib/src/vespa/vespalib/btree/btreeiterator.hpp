@@ -151,6 +151,24 @@ BTreeIteratorBase<KeyT, DataT, AggrT, INTERNAL_SLOTS, LEAF_SLOTS, PATH_SIZE>::en
 }
 
 
+template <typename KeyT, typename DataT, typename AggrT,
+          uint32_t INTERNAL_SLOTS, uint32_t LEAF_SLOTS, uint32_t PATH_SIZE>
+void
+BTreeIteratorBase<KeyT, DataT, AggrT, INTERNAL_SLOTS, LEAF_SLOTS, PATH_SIZE>::
+prefetchUpcomingLeafNodes() noexcept
+{
+    const PathElement &elem = _path[0];
+    const InternalNodeType *inode = elem.getNode();
+    uint32_t idx = elem.getIdx() + 1;
+    uint32_t limit = idx + 2;
+    if (limit > inode->validSlots()) {
+        limit = inode->validSlots();
+    }
+    for (; idx < limit; ++idx) {
+        __builtin_prefetch(static_cast<const void *>(_allocator->mapLeafRef(inode->getChild(idx))), 0);
+    }
+}
+
 template <typename KeyT, typename DataT, typename AggrT,
           uint32_t INTERNAL_SLOTS, uint32_t LEAF_SLOTS, uint32_t PATH_SIZE>
 void
@@ -172,6 +190,7 @@ findNextLeafNode() noexcept
                 node = inode->getChild(0);
             }
             _leaf.setNodeAndIdx(_allocator->mapLeafRef(node), 0u);
+            prefetchUpcomingLeafNodes();
             return;
         }
     }
@@ -229,6 +248,7 @@ BTreeIteratorBase<KeyT, DataT, AggrT, INTERNAL_SLOTS, LEAF_SLOTS, PATH_SIZE>::be
             node = inode->getChild(0);
         }
         _leaf.setNodeAndIdx(_allocator->mapLeafRef(node), 0u);
+        prefetchUpcomingLeafNodes();
     } else {
         _leaf.setNodeAndIdx(_leafRoot, 0u);
     }
@@ -268,6 +288,7 @@ BTreeIteratorBase<KeyT, DataT, AggrT, INTERNAL_SLOTS, LEAF_SLOTS, PATH_SIZE>::be
         assert(childRef.valid());
     }
     _leaf.setNodeAndIdx(_allocator->mapLeafRef(childRef), 0u);
+    prefetchUpcomingLeafNodes();
 }
 
 
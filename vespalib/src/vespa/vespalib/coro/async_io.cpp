@@ -7,6 +7,8 @@
 #include <vespa/vespalib/util/time.h>
 #include <vespa/config.h>
 
+#include <unistd.h>
+
 #include <thread>
 #include <atomic>
 #include <vector>
@@ -241,6 +243,16 @@ struct SelectorThread : AsyncIo {
         }
         co_return -ECANCELED;
     }
+    Lazy<ssize_t> read_at(int fd, char *buf, size_t len, int64_t offset) override {
+        bool inside = in_thread() ? true : co_await async_run();
+        if (inside) {
+            // epoll cannot wait for regular files; perform the read
+            // directly in the io thread instead.
+            ssize_t res = ::pread(fd, buf, len, offset);
+            co_return (res < 0) ? -errno : res;
+        }
+        co_return -ECANCELED;
+    }
     Lazy<bool> schedule() override {
         co_return co_await async_run();
     }
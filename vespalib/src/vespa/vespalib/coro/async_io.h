@@ -63,6 +63,12 @@ struct AsyncIo : std::enable_shared_from_this<AsyncIo> {
     virtual Lazy<ssize_t> write(SocketHandle &handle, const char *buf, size_t len) = 0;
     virtual Lazy<bool> schedule() = 0;
 
+    // positional read from an open file descriptor (pread
+    // semantics). Multiple coroutines may have reads against the same
+    // file in flight at the same time; with the io_uring
+    // implementation this is what builds up device queue depth.
+    virtual Lazy<ssize_t> read_at(int fd, char *buf, size_t len, int64_t offset) = 0;
+
 protected:
     // may only be created via subclass
     AsyncIo();
@@ -176,6 +176,12 @@ DataBuffer::stealBuffer() &&
     return std::move(_buffer);
 }
 
+void
+DataBuffer::reset()
+{
+    _datapt = _freept = _bufstart + padbefore(_alignment, _bufstart);
+}
+
 bool
 DataBuffer::referencesExternalData() const {
     return (_externalBuf == _bufstart) && (getBufSize() > 0);
@@ -165,6 +165,12 @@ public:
      **/
     void clear() { _datapt = _freept = _bufstart; }
 
+    /**
+     * Clear this buffer, restoring the configured alignment of the
+     * data start as set up at construction time.
+     **/
+    void reset();
+
 
     /**
      * Shrink this buffer. The given value is the new wanted size of
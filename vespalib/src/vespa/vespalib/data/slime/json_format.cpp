@@ -6,8 +6,10 @@
 #include "slime.h"
 #include <vespa/vespalib/data/memory_input.h>
 #include <vespa/vespalib/locale/c.h>
+#include <charconv>
 #include <cmath>
 #include <cinttypes>
+#include <cstring>
 #include <sstream>
 #include <cassert>
 
@@ -86,7 +88,9 @@ struct JsonEncoder : public ArrayTraverser,
         }
     }
     void encodeLONG(int64_t value) {
-        out.printf("%" PRId64, value);
+        char tmp[32];
+        auto res = std::to_chars(tmp, tmp + sizeof(tmp), value);
+        out.write(tmp, (res.ptr - tmp));
     }
     void encodeDOUBLE(double value) {
         if (std::isnan(value) || std::isinf(value)) {
@@ -95,35 +99,43 @@ struct JsonEncoder : public ArrayTraverser,
             out.printf("%g", value);
         }
     }
+    static bool needs_escape(uint8_t c) noexcept {
+        return (c <= 0x1f) || (c == '"') || (c == '\\');
+    }
     void encodeSTRING(const Memory &memory) {
         const char *hex = "0123456789ABCDEF";
-        char *p = out.reserve(memory.size * 6 + 2);
-        size_t len = 2;
+        char *start = out.reserve(memory.size * 6 + 2);
+        char *p = start;
         *p++ = '"';
         const char *pos = memory.data;
         const char *end = memory.data + memory.size;
-        for (; pos < end; ++pos) {
-            uint8_t c = *pos;
-            switch(c) {
-            case '"':  *p++ = '\\'; *p++ = '"';  len += 2; break;
-            case '\\': *p++ = '\\'; *p++ = '\\'; len += 2; break;
-            case '\b': *p++ = '\\'; *p++ = 'b';  len += 2; break;
-            case '\f': *p++ = '\\'; *p++ = 'f';  len += 2; break;
-            case '\n': *p++ = '\\'; *p++ = 'n';  len += 2; break;
-            case '\r': *p++ = '\\'; *p++ = 'r';  len += 2; break;
-            case '\t': *p++ = '\\'; *p++ = 't';  len += 2; break;
-            default:
-                if (c > 0x1f) {
-                    *p++ = c; ++len;
-                } else { // requires escaping according to RFC 4627
+        while (pos < end) {
+            // bulk-copy the run of characters that need no escaping
+            const char *run = pos;
+            while ((pos < end) && !needs_escape(*pos)) {
+                ++pos;
+            }
+            size_t run_len = (pos - run);
+            memcpy(p, run, run_len);
+            p += run_len;
+            if (pos < end) {
+                uint8_t c = *pos++;
+                switch(c) {
+                case '"':  *p++ = '\\'; *p++ = '"';  break;
+                case '\\': *p++ = '\\'; *p++ = '\\'; break;
+                case '\b': *p++ = '\\'; *p++ = 'b';  break;
+                case '\f': *p++ = '\\'; *p++ = 'f';  break;
+                case '\n': *p++ = '\\'; *p++ = 'n';  break;
+                case '\r': *p++ = '\\'; *p++ = 'r';  break;
+                case '\t': *p++ = '\\'; *p++ = 't';  break;
+                default: // requires escaping according to RFC 4627
                     *p++ = '\\'; *p++ = 'u'; *p++ = '0'; *p++ = '0';
                     *p++ = hex[(c >> 4) & 0xf]; *p++ = hex[c & 0xf];
-                    len += 6;
                 }
             }
         }
-        *p = '"';
-        out.commit(len);
+        *p++ = '"';
+        out.commit(p - start);
     }
     void encodeDATA(const Memory &memory) {
         const char *hex = "0123456789ABCDEF";
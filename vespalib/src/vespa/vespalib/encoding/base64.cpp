@@ -115,7 +115,6 @@ Base64::encode(const char *inBuffer, int inLen, char *outBuffer, int outBufLen)
 int
 Base64::decode(const char* inBuffer, int inLen, char* outBuffer, int outLen)
 {
-    // Read char by char to better support skipping of illegal character.
     int readbytes = 0;
     int num_valid_chars = 0;
     const char* thischar = inBuffer;
@@ -123,6 +122,27 @@ Base64::decode(const char* inBuffer, int inLen, char* outBuffer, int outLen)
     int curOut = 0;
     char tmp = 0;
 
+    // Fast path: decode whole quads of ordinary base64 characters in one
+    // step. Any character needing special handling (whitespace, padding,
+    // terminating '\0' or illegal bytes) has a negative table value and
+    // drops us to the careful per-character loop below for the remainder.
+    while ((readbytes + 4 <= inLen) && (curOut + 3 <= outLen)) {
+        signed char c0 = base64Backwards[ (unsigned char) thischar[0] ];
+        signed char c1 = base64Backwards[ (unsigned char) thischar[1] ];
+        signed char c2 = base64Backwards[ (unsigned char) thischar[2] ];
+        signed char c3 = base64Backwards[ (unsigned char) thischar[3] ];
+        if ((c0 | c1 | c2 | c3) < 0) {
+            break;
+        }
+        outBuffer[curOut    ] = (c0 << 2) | ((c1 >> 4) & 0x03);
+        outBuffer[curOut + 1] = ((c1 & 0x0f) << 4) | ((c2 >> 2) & 0x0f);
+        outBuffer[curOut + 2] = ((c2 & 0x03) << 6) | c3;
+        curOut += 3;
+        thischar += 4;
+        readbytes += 4;
+    }
+
+    // Read char by char to better support skipping of illegal character.
     while( (readbytes++ < inLen) && (*thischar != '\0') && (*thischar != '=')) {
         curchar = base64Backwards[ (unsigned int)(*thischar++) ];
 
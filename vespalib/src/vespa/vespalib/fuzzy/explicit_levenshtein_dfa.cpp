@@ -5,7 +5,9 @@ namespace vespalib::fuzzy {
 
 template class ExplicitLevenshteinDfaImpl<1>;
 template class ExplicitLevenshteinDfaImpl<2>;
+template class ExplicitLevenshteinDfaImpl<3>;
 template class ExplicitLevenshteinDfaBuilder<FixedMaxEditDistanceTraits<1>>;
 template class ExplicitLevenshteinDfaBuilder<FixedMaxEditDistanceTraits<2>>;
+template class ExplicitLevenshteinDfaBuilder<FixedMaxEditDistanceTraits<3>>;
 
 }
@@ -31,5 +31,6 @@ void ImplicitLevenshteinDfa<Traits>::precompute_utf8_target_with_offsets() {
 
 template class ImplicitLevenshteinDfa<FixedMaxEditDistanceTraits<1>>;
 template class ImplicitLevenshteinDfa<FixedMaxEditDistanceTraits<2>>;
+template class ImplicitLevenshteinDfa<FixedMaxEditDistanceTraits<3>>;
 
 }
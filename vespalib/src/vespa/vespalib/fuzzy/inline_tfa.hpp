@@ -89,3 +89,405 @@ template <> struct InlineTfa<2> {
     };
 };
 // end of auto-generated code for N = 2
+// start of auto-generated code for N = 3
+template <> struct InlineTfa<3> {
+    static constexpr Transition table[197][128] = {
+        {{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0}},
+        {{0,2},{0,2},{0,2},{0,2},{0,2},{0,2},{0,2},{0,2},{0,3},{0,3},{0,3},{0,3},{0,3},{0,3},{0,3},{0,3},{0,4},{0,4},{0,4},{0,4},{0,4},{0,4},{0,4},{0,4},{0,4},{0,4},{0,4},{0,4},{0,4},{0,4},{0,4},{0,4},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{0,5},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1},{1,1}},
+        {{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,7},{0,7},{0,7},{0,7},{0,7},{0,7},{0,7},{0,7},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{0,9},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2},{1,2}},
+        {{0,6},{0,6},{0,6},{0,6},{0,13},{0,13},{0,13},{0,13},{0,7},{0,7},{0,7},{0,7},{0,14},{0,14},{0,14},{0,14},{0,8},{0,8},{0,8},{0,8},{0,15},{0,15},{0,15},{0,15},{0,8},{0,8},{0,8},{0,8},{0,15},{0,15},{0,15},{0,15},{0,9},{0,9},{0,9},{0,9},{0,16},{0,16},{0,16},{0,16},{0,9},{0,9},{0,9},{0,9},{0,16},{0,16},{0,16},{0,16},{0,9},{0,9},{0,9},{0,9},{0,16},{0,16},{0,16},{0,16},{0,9},{0,9},{0,9},{0,9},{0,16},{0,16},{0,16},{0,16},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,12},{1,12},{1,12},{1,12},{1,19},{1,19},{1,19},{1,19},{1,12},{1,12},{1,12},{1,12},{1,19},{1,19},{1,19},{1,19},{1,2},{1,2},{1,2},{1,2},{1,3},{1,3},{1,3},{1,3},{1,2},{1,2},{1,2},{1,2},{1,3},{1,3},{1,3},{1,3},{1,2},{1,2},{1,2},{1,2},{1,3},{1,3},{1,3},{1,3},{1,2},{1,2},{1,2},{1,2},{1,3},{1,3},{1,3},{1,3}},
+        {{0,7},{0,7},{0,7},{0,7},{0,14},{0,14},{0,14},{0,14},{0,20},{0,20},{0,20},{0,20},{0,20},{0,20},{0,20},{0,20},{0,8},{0,8},{0,8},{0,8},{0,15},{0,15},{0,15},{0,15},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,9},{0,9},{0,9},{0,9},{0,16},{0,16},{0,16},{0,16},{0,22},{0,22},{0,22},{0,22},{0,22},{0,22},{0,22},{0,22},{0,9},{0,9},{0,9},{0,9},{0,16},{0,16},{0,16},{0,16},{0,22},{0,22},{0,22},{0,22},{0,22},{0,22},{0,22},{0,22},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,12},{1,12},{1,12},{1,12},{1,19},{1,19},{1,19},{1,19},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,2},{1,2},{1,2},{1,2},{1,3},{1,3},{1,3},{1,3},{1,4},{1,4},{1,4},{1,4},{1,4},{1,4},{1,4},{1,4},{1,2},{1,2},{1,2},{1,2},{1,3},{1,3},{1,3},{1,3},{1,4},{1,4},{1,4},{1,4},{1,4},{1,4},{1,4},{1,4}},
+        {{0,8},{0,8},{0,8},{0,8},{0,15},{0,15},{0,15},{0,15},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,9},{0,9},{0,9},{0,9},{0,16},{0,16},{0,16},{0,16},{0,22},{0,22},{0,22},{0,22},{0,22},{0,22},{0,22},{0,22},{0,26},{0,26},{0,26},{0,26},{0,26},{0,26},{0,26},{0,26},{0,26},{0,26},{0,26},{0,26},{0,26},{0,26},{0,26},{0,26},{1,12},{1,12},{1,12},{1,12},{1,19},{1,19},{1,19},{1,19},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,2},{1,2},{1,2},{1,2},{1,3},{1,3},{1,3},{1,3},{1,4},{1,4},{1,4},{1,4},{1,4},{1,4},{1,4},{1,4},{1,5},{1,5},{1,5},{1,5},{1,5},{1,5},{1,5},{1,5},{1,5},{1,5},{1,5},{1,5},{1,5},{1,5},{1,5},{1,5}},
+        {{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,32},{0,32},{0,32},{0,32},{0,32},{0,32},{0,32},{0,32},{0,33},{0,33},{0,33},{0,33},{0,33},{0,33},{0,33},{0,33},{0,33},{0,33},{0,33},{0,33},{0,33},{0,33},{0,33},{0,33},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,38},{1,38},{1,38},{1,38},{1,38},{1,38},{1,38},{1,38},{1,6},{1,6},{1,6},{1,6},{1,6},{1,6},{1,6},{1,6},{1,6},{1,6},{1,6},{1,6},{1,6},{1,6},{1,6},{1,6}},
+        {{0,28},{0,28},{0,28},{0,28},{0,39},{0,39},{0,39},{0,39},{0,29},{0,29},{0,29},{0,29},{0,40},{0,40},{0,40},{0,40},{0,30},{0,30},{0,30},{0,30},{0,41},{0,41},{0,41},{0,41},{0,30},{0,30},{0,30},{0,30},{0,41},{0,41},{0,41},{0,41},{0,31},{0,31},{0,31},{0,31},{0,42},{0,42},{0,42},{0,42},{0,32},{0,32},{0,32},{0,32},{0,43},{0,43},{0,43},{0,43},{0,33},{0,33},{0,33},{0,33},{0,44},{0,44},{0,44},{0,44},{0,33},{0,33},{0,33},{0,33},{0,44},{0,44},{0,44},{0,44},{1,34},{1,34},{1,34},{1,34},{1,45},{1,45},{1,45},{1,45},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,36},{1,36},{1,36},{1,36},{1,47},{1,47},{1,47},{1,47},{1,36},{1,36},{1,36},{1,36},{1,47},{1,47},{1,47},{1,47},{1,37},{1,37},{1,37},{1,37},{1,48},{1,48},{1,48},{1,48},{1,38},{1,38},{1,38},{1,38},{1,49},{1,49},{1,49},{1,49},{1,6},{1,6},{1,6},{1,6},{1,7},{1,7},{1,7},{1,7},{1,6},{1,6},{1,6},{1,6},{1,7},{1,7},{1,7},{1,7}},
+        {{0,29},{0,29},{0,29},{0,29},{0,40},{0,40},{0,40},{0,40},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,30},{0,30},{0,30},{0,30},{0,41},{0,41},{0,41},{0,41},{0,51},{0,51},{0,51},{0,51},{0,51},{0,51},{0,51},{0,51},{0,32},{0,32},{0,32},{0,32},{0,43},{0,43},{0,43},{0,43},{0,52},{0,52},{0,52},{0,52},{0,52},{0,52},{0,52},{0,52},{0,33},{0,33},{0,33},{0,33},{0,44},{0,44},{0,44},{0,44},{0,53},{0,53},{0,53},{0,53},{0,53},{0,53},{0,53},{0,53},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,36},{1,36},{1,36},{1,36},{1,47},{1,47},{1,47},{1,47},{1,55},{1,55},{1,55},{1,55},{1,55},{1,55},{1,55},{1,55},{1,38},{1,38},{1,38},{1,38},{1,49},{1,49},{1,49},{1,49},{1,56},{1,56},{1,56},{1,56},{1,56},{1,56},{1,56},{1,56},{1,6},{1,6},{1,6},{1,6},{1,7},{1,7},{1,7},{1,7},{1,8},{1,8},{1,8},{1,8},{1,8},{1,8},{1,8},{1,8}},
+        {{0,33},{0,33},{0,33},{0,33},{0,44},{0,44},{0,44},{0,44},{0,53},{0,53},{0,53},{0,53},{0,53},{0,53},{0,53},{0,53},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,33},{0,33},{0,33},{0,33},{0,44},{0,44},{0,44},{0,44},{0,53},{0,53},{0,53},{0,53},{0,53},{0,53},{0,53},{0,53},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{0,57},{1,6},{1,6},{1,6},{1,6},{1,7},{1,7},{1,7},{1,7},{1,8},{1,8},{1,8},{1,8},{1,8},{1,8},{1,8},{1,8},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,6},{1,6},{1,6},{1,6},{1,7},{1,7},{1,7},{1,7},{1,8},{1,8},{1,8},{1,8},{1,8},{1,8},{1,8},{1,8},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9},{1,9}},
+        {{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10}},
+        {{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,37},{0,48},{0,48},{0,48},{0,48},{0,48},{0,48},{0,48},{0,48},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,49},{0,49},{0,49},{0,49},{0,49},{0,49},{0,49},{0,49},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,7},{0,7},{0,7},{0,7},{0,7},{0,7},{0,7},{0,7},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,7},{0,7},{0,7},{0,7},{0,7},{0,7},{0,7},{0,7},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11}},
+        {{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,38},{0,49},{0,49},{0,49},{0,49},{0,49},{0,49},{0,49},{0,49},{0,56},{0,56},{0,56},{0,56},{0,56},{0,56},{0,56},{0,56},{0,56},{0,56},{0,56},{0,56},{0,56},{0,56},{0,56},{0,56},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,6},{0,7},{0,7},{0,7},{0,7},{0,7},{0,7},{0,7},{0,7},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{0,8},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,10},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,11},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12},{1,12}},
+        {{0,28},{0,28},{0,58},{0,58},{0,28},{0,28},{0,58},{0,58},{0,29},{0,29},{0,59},{0,59},{0,29},{0,29},{0,59},{0,59},{0,30},{0,30},{0,60},{0,60},{0,30},{0,30},{0,60},{0,60},{0,30},{0,30},{0,60},{0,60},{0,30},{0,30},{0,60},{0,60},{0,31},{0,31},{0,61},{0,61},{0,31},{0,31},{0,61},{0,61},{0,32},{0,32},{0,62},{0,62},{0,32},{0,32},{0,62},{0,62},{0,33},{0,33},{0,63},{0,63},{0,33},{0,33},{0,63},{0,63},{0,33},{0,33},{0,63},{0,63},{0,33},{0,33},{0,63},{0,63},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,35},{1,35},{1,65},{1,65},{1,35},{1,35},{1,65},{1,65},{1,36},{1,36},{1,66},{1,66},{1,36},{1,36},{1,66},{1,66},{1,36},{1,36},{1,66},{1,66},{1,36},{1,36},{1,66},{1,66},{1,37},{1,37},{1,67},{1,67},{1,37},{1,37},{1,67},{1,67},{1,38},{1,38},{1,68},{1,68},{1,38},{1,38},{1,68},{1,68},{1,6},{1,6},{1,13},{1,13},{1,6},{1,6},{1,13},{1,13},{1,6},{1,6},{1,13},{1,13},{1,6},{1,6},{1,13},{1,13}},
+        {{0,28},{0,28},{0,58},{0,58},{0,39},{0,39},{0,69},{0,69},{0,29},{0,29},{0,59},{0,59},{0,40},{0,40},{0,70},{0,70},{0,30},{0,30},{0,60},{0,60},{0,41},{0,41},{0,71},{0,71},{0,30},{0,30},{0,60},{0,60},{0,41},{0,41},{0,71},{0,71},{0,31},{0,31},{0,61},{0,61},{0,42},{0,42},{0,72},{0,72},{0,32},{0,32},{0,62},{0,62},{0,43},{0,43},{0,73},{0,73},{0,33},{0,33},{0,63},{0,63},{0,44},{0,44},{0,74},{0,74},{0,33},{0,33},{0,63},{0,63},{0,44},{0,44},{0,74},{0,74},{1,34},{1,34},{1,64},{1,64},{1,45},{1,45},{1,75},{1,75},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,36},{1,36},{1,66},{1,66},{1,47},{1,47},{1,77},{1,77},{1,36},{1,36},{1,66},{1,66},{1,47},{1,47},{1,77},{1,77},{1,37},{1,37},{1,67},{1,67},{1,48},{1,48},{1,78},{1,78},{1,38},{1,38},{1,68},{1,68},{1,49},{1,49},{1,79},{1,79},{1,6},{1,6},{1,13},{1,13},{1,7},{1,7},{1,14},{1,14},{1,6},{1,6},{1,13},{1,13},{1,7},{1,7},{1,14},{1,14}},
+        {{0,29},{0,29},{0,59},{0,59},{0,40},{0,40},{0,70},{0,70},{0,50},{0,50},{0,80},{0,80},{0,50},{0,50},{0,80},{0,80},{0,30},{0,30},{0,60},{0,60},{0,41},{0,41},{0,71},{0,71},{0,51},{0,51},{0,81},{0,81},{0,51},{0,51},{0,81},{0,81},{0,32},{0,32},{0,62},{0,62},{0,43},{0,43},{0,73},{0,73},{0,52},{0,52},{0,82},{0,82},{0,52},{0,52},{0,82},{0,82},{0,33},{0,33},{0,63},{0,63},{0,44},{0,44},{0,74},{0,74},{0,53},{0,53},{0,83},{0,83},{0,53},{0,53},{0,83},{0,83},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,54},{1,54},{1,84},{1,84},{1,54},{1,54},{1,84},{1,84},{1,36},{1,36},{1,66},{1,66},{1,47},{1,47},{1,77},{1,77},{1,55},{1,55},{1,85},{1,85},{1,55},{1,55},{1,85},{1,85},{1,38},{1,38},{1,68},{1,68},{1,49},{1,49},{1,79},{1,79},{1,56},{1,56},{1,86},{1,86},{1,56},{1,56},{1,86},{1,86},{1,6},{1,6},{1,13},{1,13},{1,7},{1,7},{1,14},{1,14},{1,8},{1,8},{1,15},{1,15},{1,8},{1,8},{1,15},{1,15}},
+        {{0,33},{0,33},{0,63},{0,63},{0,44},{0,44},{0,74},{0,74},{0,53},{0,53},{0,83},{0,83},{0,53},{0,53},{0,83},{0,83},{0,57},{0,57},{0,87},{0,87},{0,57},{0,57},{0,87},{0,87},{0,57},{0,57},{0,87},{0,87},{0,57},{0,57},{0,87},{0,87},{0,33},{0,33},{0,63},{0,63},{0,44},{0,44},{0,74},{0,74},{0,53},{0,53},{0,83},{0,83},{0,53},{0,53},{0,83},{0,83},{0,57},{0,57},{0,87},{0,87},{0,57},{0,57},{0,87},{0,87},{0,57},{0,57},{0,87},{0,87},{0,57},{0,57},{0,87},{0,87},{1,6},{1,6},{1,13},{1,13},{1,7},{1,7},{1,14},{1,14},{1,8},{1,8},{1,15},{1,15},{1,8},{1,8},{1,15},{1,15},{1,9},{1,9},{1,16},{1,16},{1,9},{1,9},{1,16},{1,16},{1,9},{1,9},{1,16},{1,16},{1,9},{1,9},{1,16},{1,16},{1,6},{1,6},{1,13},{1,13},{1,7},{1,7},{1,14},{1,14},{1,8},{1,8},{1,15},{1,15},{1,8},{1,8},{1,15},{1,15},{1,9},{1,9},{1,16},{1,16},{1,9},{1,9},{1,16},{1,16},{1,9},{1,9},{1,16},{1,16},{1,9},{1,9},{1,16},{1,16}},
+        {{0,37},{0,37},{0,37},{0,37},{0,67},{0,67},{0,67},{0,67},{0,37},{0,37},{0,37},{0,37},{0,67},{0,67},{0,67},{0,67},{0,38},{0,38},{0,38},{0,38},{0,68},{0,68},{0,68},{0,68},{0,38},{0,38},{0,38},{0,38},{0,68},{0,68},{0,68},{0,68},{0,6},{0,6},{0,6},{0,6},{0,13},{0,13},{0,13},{0,13},{0,6},{0,6},{0,6},{0,6},{0,13},{0,13},{0,13},{0,13},{0,6},{0,6},{0,6},{0,6},{0,13},{0,13},{0,13},{0,13},{0,6},{0,6},{0,6},{0,6},{0,13},{0,13},{0,13},{0,13},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17}},
+        {{0,37},{0,37},{0,37},{0,37},{0,67},{0,67},{0,67},{0,67},{0,48},{0,48},{0,48},{0,48},{0,78},{0,78},{0,78},{0,78},{0,38},{0,38},{0,38},{0,38},{0,68},{0,68},{0,68},{0,68},{0,49},{0,49},{0,49},{0,49},{0,79},{0,79},{0,79},{0,79},{0,6},{0,6},{0,6},{0,6},{0,13},{0,13},{0,13},{0,13},{0,7},{0,7},{0,7},{0,7},{0,14},{0,14},{0,14},{0,14},{0,6},{0,6},{0,6},{0,6},{0,13},{0,13},{0,13},{0,13},{0,7},{0,7},{0,7},{0,7},{0,14},{0,14},{0,14},{0,14},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18}},
+        {{0,38},{0,38},{0,38},{0,38},{0,68},{0,68},{0,68},{0,68},{0,49},{0,49},{0,49},{0,49},{0,79},{0,79},{0,79},{0,79},{0,56},{0,56},{0,56},{0,56},{0,86},{0,86},{0,86},{0,86},{0,56},{0,56},{0,56},{0,56},{0,86},{0,86},{0,86},{0,86},{0,6},{0,6},{0,6},{0,6},{0,13},{0,13},{0,13},{0,13},{0,7},{0,7},{0,7},{0,7},{0,14},{0,14},{0,14},{0,14},{0,8},{0,8},{0,8},{0,8},{0,15},{0,15},{0,15},{0,15},{0,8},{0,8},{0,8},{0,8},{0,15},{0,15},{0,15},{0,15},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,12},{1,12},{1,12},{1,12},{1,19},{1,19},{1,19},{1,19},{1,12},{1,12},{1,12},{1,12},{1,19},{1,19},{1,19},{1,19},{1,10},{1,10},{1,10},{1,10},{1,17},{1,17},{1,17},{1,17},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,12},{1,12},{1,12},{1,12},{1,19},{1,19},{1,19},{1,19},{1,12},{1,12},{1,12},{1,12},{1,19},{1,19},{1,19},{1,19}},
+        {{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,41},{0,41},{0,71},{0,71},{0,89},{0,89},{0,89},{0,89},{0,41},{0,41},{0,71},{0,71},{0,89},{0,89},{0,89},{0,89},{0,43},{0,43},{0,73},{0,73},{0,90},{0,90},{0,90},{0,90},{0,43},{0,43},{0,73},{0,73},{0,90},{0,90},{0,90},{0,90},{0,44},{0,44},{0,74},{0,74},{0,91},{0,91},{0,91},{0,91},{0,44},{0,44},{0,74},{0,74},{0,91},{0,91},{0,91},{0,91},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,47},{1,47},{1,77},{1,77},{1,93},{1,93},{1,93},{1,93},{1,47},{1,47},{1,77},{1,77},{1,93},{1,93},{1,93},{1,93},{1,49},{1,49},{1,79},{1,79},{1,94},{1,94},{1,94},{1,94},{1,49},{1,49},{1,79},{1,79},{1,94},{1,94},{1,94},{1,94},{1,7},{1,7},{1,14},{1,14},{1,20},{1,20},{1,20},{1,20},{1,7},{1,7},{1,14},{1,14},{1,20},{1,20},{1,20},{1,20}},
+        {{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,50},{0,50},{0,80},{0,80},{0,95},{0,95},{0,95},{0,95},{0,41},{0,41},{0,71},{0,71},{0,89},{0,89},{0,89},{0,89},{0,51},{0,51},{0,81},{0,81},{0,96},{0,96},{0,96},{0,96},{0,43},{0,43},{0,73},{0,73},{0,90},{0,90},{0,90},{0,90},{0,52},{0,52},{0,82},{0,82},{0,97},{0,97},{0,97},{0,97},{0,44},{0,44},{0,74},{0,74},{0,91},{0,91},{0,91},{0,91},{0,53},{0,53},{0,83},{0,83},{0,98},{0,98},{0,98},{0,98},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,54},{1,54},{1,84},{1,84},{1,99},{1,99},{1,99},{1,99},{1,47},{1,47},{1,77},{1,77},{1,93},{1,93},{1,93},{1,93},{1,55},{1,55},{1,85},{1,85},{1,100},{1,100},{1,100},{1,100},{1,49},{1,49},{1,79},{1,79},{1,94},{1,94},{1,94},{1,94},{1,56},{1,56},{1,86},{1,86},{1,101},{1,101},{1,101},{1,101},{1,7},{1,7},{1,14},{1,14},{1,20},{1,20},{1,20},{1,20},{1,8},{1,8},{1,15},{1,15},{1,21},{1,21},{1,21},{1,21}},
+        {{0,44},{0,44},{0,74},{0,74},{0,91},{0,91},{0,91},{0,91},{0,53},{0,53},{0,83},{0,83},{0,98},{0,98},{0,98},{0,98},{0,57},{0,57},{0,87},{0,87},{0,102},{0,102},{0,102},{0,102},{0,57},{0,57},{0,87},{0,87},{0,102},{0,102},{0,102},{0,102},{0,44},{0,44},{0,74},{0,74},{0,91},{0,91},{0,91},{0,91},{0,53},{0,53},{0,83},{0,83},{0,98},{0,98},{0,98},{0,98},{0,57},{0,57},{0,87},{0,87},{0,102},{0,102},{0,102},{0,102},{0,57},{0,57},{0,87},{0,87},{0,102},{0,102},{0,102},{0,102},{1,7},{1,7},{1,14},{1,14},{1,20},{1,20},{1,20},{1,20},{1,8},{1,8},{1,15},{1,15},{1,21},{1,21},{1,21},{1,21},{1,9},{1,9},{1,16},{1,16},{1,22},{1,22},{1,22},{1,22},{1,9},{1,9},{1,16},{1,16},{1,22},{1,22},{1,22},{1,22},{1,7},{1,7},{1,14},{1,14},{1,20},{1,20},{1,20},{1,20},{1,8},{1,8},{1,15},{1,15},{1,21},{1,21},{1,21},{1,21},{1,9},{1,9},{1,16},{1,16},{1,22},{1,22},{1,22},{1,22},{1,9},{1,9},{1,16},{1,16},{1,22},{1,22},{1,22},{1,22}},
+        {{0,49},{0,49},{0,49},{0,49},{0,79},{0,79},{0,79},{0,79},{0,94},{0,94},{0,94},{0,94},{0,94},{0,94},{0,94},{0,94},{0,49},{0,49},{0,49},{0,49},{0,79},{0,79},{0,79},{0,79},{0,94},{0,94},{0,94},{0,94},{0,94},{0,94},{0,94},{0,94},{0,7},{0,7},{0,7},{0,7},{0,14},{0,14},{0,14},{0,14},{0,20},{0,20},{0,20},{0,20},{0,20},{0,20},{0,20},{0,20},{0,7},{0,7},{0,7},{0,7},{0,14},{0,14},{0,14},{0,14},{0,20},{0,20},{0,20},{0,20},{0,20},{0,20},{0,20},{0,20},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23}},
+        {{0,49},{0,49},{0,49},{0,49},{0,79},{0,79},{0,79},{0,79},{0,94},{0,94},{0,94},{0,94},{0,94},{0,94},{0,94},{0,94},{0,56},{0,56},{0,56},{0,56},{0,86},{0,86},{0,86},{0,86},{0,101},{0,101},{0,101},{0,101},{0,101},{0,101},{0,101},{0,101},{0,7},{0,7},{0,7},{0,7},{0,14},{0,14},{0,14},{0,14},{0,20},{0,20},{0,20},{0,20},{0,20},{0,20},{0,20},{0,20},{0,8},{0,8},{0,8},{0,8},{0,15},{0,15},{0,15},{0,15},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,12},{1,12},{1,12},{1,12},{1,19},{1,19},{1,19},{1,19},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,11},{1,11},{1,11},{1,11},{1,18},{1,18},{1,18},{1,18},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,23},{1,12},{1,12},{1,12},{1,12},{1,19},{1,19},{1,19},{1,19},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24}},
+        {{0,51},{0,51},{0,81},{0,81},{0,96},{0,96},{0,96},{0,96},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,51},{0,51},{0,81},{0,81},{0,96},{0,96},{0,96},{0,96},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,53},{0,53},{0,83},{0,83},{0,98},{0,98},{0,98},{0,98},{0,104},{0,104},{0,104},{0,104},{0,104},{0,104},{0,104},{0,104},{0,53},{0,53},{0,83},{0,83},{0,98},{0,98},{0,98},{0,98},{0,104},{0,104},{0,104},{0,104},{0,104},{0,104},{0,104},{0,104},{1,55},{1,55},{1,85},{1,85},{1,100},{1,100},{1,100},{1,100},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,55},{1,55},{1,85},{1,85},{1,100},{1,100},{1,100},{1,100},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,8},{1,8},{1,15},{1,15},{1,21},{1,21},{1,21},{1,21},{1,25},{1,25},{1,25},{1,25},{1,25},{1,25},{1,25},{1,25},{1,8},{1,8},{1,15},{1,15},{1,21},{1,21},{1,21},{1,21},{1,25},{1,25},{1,25},{1,25},{1,25},{1,25},{1,25},{1,25}},
+        {{0,53},{0,53},{0,83},{0,83},{0,98},{0,98},{0,98},{0,98},{0,104},{0,104},{0,104},{0,104},{0,104},{0,104},{0,104},{0,104},{0,57},{0,57},{0,87},{0,87},{0,102},{0,102},{0,102},{0,102},{0,106},{0,106},{0,106},{0,106},{0,106},{0,106},{0,106},{0,106},{0,53},{0,53},{0,83},{0,83},{0,98},{0,98},{0,98},{0,98},{0,104},{0,104},{0,104},{0,104},{0,104},{0,104},{0,104},{0,104},{0,57},{0,57},{0,87},{0,87},{0,102},{0,102},{0,102},{0,102},{0,106},{0,106},{0,106},{0,106},{0,106},{0,106},{0,106},{0,106},{1,8},{1,8},{1,15},{1,15},{1,21},{1,21},{1,21},{1,21},{1,25},{1,25},{1,25},{1,25},{1,25},{1,25},{1,25},{1,25},{1,9},{1,9},{1,16},{1,16},{1,22},{1,22},{1,22},{1,22},{1,26},{1,26},{1,26},{1,26},{1,26},{1,26},{1,26},{1,26},{1,8},{1,8},{1,15},{1,15},{1,21},{1,21},{1,21},{1,21},{1,25},{1,25},{1,25},{1,25},{1,25},{1,25},{1,25},{1,25},{1,9},{1,9},{1,16},{1,16},{1,22},{1,22},{1,22},{1,22},{1,26},{1,26},{1,26},{1,26},{1,26},{1,26},{1,26},{1,26}},
+        {{0,8},{0,8},{0,8},{0,8},{0,15},{0,15},{0,15},{0,15},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,8},{0,8},{0,8},{0,8},{0,15},{0,15},{0,15},{0,15},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,21},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{0,25},{1,12},{1,12},{1,12},{1,12},{1,19},{1,19},{1,19},{1,19},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,12},{1,12},{1,12},{1,12},{1,19},{1,19},{1,19},{1,19},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,24},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27},{1,27}},
+        {{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,108},{3,108},{3,108},{3,108},{3,108},{3,108},{3,108},{3,108},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,109},{2,109},{2,109},{2,109},{2,109},{2,109},{2,109},{2,109},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,110},{2,110},{2,110},{2,110},{2,110},{2,110},{2,110},{2,110},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,112},{1,112},{1,112},{1,112},{1,112},{1,112},{1,112},{1,112},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,113},{1,113},{1,113},{1,113},{1,113},{1,113},{1,113},{1,113},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,28},{1,28},{1,28},{1,28},{1,28},{1,28},{1,28},{1,28}},
+        {{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{4,107},{4,107},{4,107},{4,107},{4,108},{4,108},{4,108},{4,108},{3,107},{3,107},{3,107},{3,107},{3,109},{3,109},{3,109},{3,109},{3,108},{3,108},{3,108},{3,108},{3,110},{3,110},{3,110},{3,110},{2,107},{2,107},{2,107},{2,107},{2,111},{2,111},{2,111},{2,111},{2,109},{2,109},{2,109},{2,109},{2,112},{2,112},{2,112},{2,112},{2,108},{2,108},{2,108},{2,108},{2,113},{2,113},{2,113},{2,113},{2,110},{2,110},{2,110},{2,110},{2,28},{2,28},{2,28},{2,28},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,111},{1,111},{1,111},{1,111},{1,115},{1,115},{1,115},{1,115},{1,109},{1,109},{1,109},{1,109},{1,116},{1,116},{1,116},{1,116},{1,112},{1,112},{1,112},{1,112},{1,117},{1,117},{1,117},{1,117},{1,108},{1,108},{1,108},{1,108},{1,118},{1,118},{1,118},{1,118},{1,113},{1,113},{1,113},{1,113},{1,119},{1,119},{1,119},{1,119},{1,110},{1,110},{1,110},{1,110},{1,120},{1,120},{1,120},{1,120},{1,28},{1,28},{1,28},{1,28},{1,29},{1,29},{1,29},{1,29}},
+        {{3,108},{3,108},{3,108},{3,108},{3,110},{3,110},{3,110},{3,110},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{3,108},{3,108},{3,108},{3,108},{3,110},{3,110},{3,110},{3,110},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{2,110},{2,110},{2,110},{2,110},{2,28},{2,28},{2,28},{2,28},{2,31},{2,31},{2,31},{2,31},{2,31},{2,31},{2,31},{2,31},{2,110},{2,110},{2,110},{2,110},{2,28},{2,28},{2,28},{2,28},{2,31},{2,31},{2,31},{2,31},{2,31},{2,31},{2,31},{2,31},{1,112},{1,112},{1,112},{1,112},{1,117},{1,117},{1,117},{1,117},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,112},{1,112},{1,112},{1,112},{1,117},{1,117},{1,117},{1,117},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,28},{1,28},{1,28},{1,28},{1,29},{1,29},{1,29},{1,29},{1,30},{1,30},{1,30},{1,30},{1,30},{1,30},{1,30},{1,30},{1,28},{1,28},{1,28},{1,28},{1,29},{1,29},{1,29},{1,29},{1,30},{1,30},{1,30},{1,30},{1,30},{1,30},{1,30},{1,30}},
+        {{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,110},{2,110},{2,110},{2,110},{2,110},{2,110},{2,110},{2,110},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,110},{2,110},{2,110},{2,110},{2,110},{2,110},{2,110},{2,110},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{3,121},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,28},{1,28},{1,28},{1,28},{1,28},{1,28},{1,28},{1,28},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,28},{1,28},{1,28},{1,28},{1,28},{1,28},{1,28},{1,28},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31},{1,31}},
+        {{2,108},{2,108},{2,108},{2,108},{2,113},{2,113},{2,113},{2,113},{2,110},{2,110},{2,110},{2,110},{2,28},{2,28},{2,28},{2,28},{3,121},{3,121},{3,121},{3,121},{3,34},{3,34},{3,34},{3,34},{3,121},{3,121},{3,121},{3,121},{3,34},{3,34},{3,34},{3,34},{2,108},{2,108},{2,108},{2,108},{2,113},{2,113},{2,113},{2,113},{2,110},{2,110},{2,110},{2,110},{2,28},{2,28},{2,28},{2,28},{3,121},{3,121},{3,121},{3,121},{3,34},{3,34},{3,34},{3,34},{3,121},{3,121},{3,121},{3,121},{3,34},{3,34},{3,34},{3,34},{1,110},{1,110},{1,110},{1,110},{1,120},{1,120},{1,120},{1,120},{1,28},{1,28},{1,28},{1,28},{1,29},{1,29},{1,29},{1,29},{1,31},{1,31},{1,31},{1,31},{1,32},{1,32},{1,32},{1,32},{1,31},{1,31},{1,31},{1,31},{1,32},{1,32},{1,32},{1,32},{1,110},{1,110},{1,110},{1,110},{1,120},{1,120},{1,120},{1,120},{1,28},{1,28},{1,28},{1,28},{1,29},{1,29},{1,29},{1,29},{1,31},{1,31},{1,31},{1,31},{1,32},{1,32},{1,32},{1,32},{1,31},{1,31},{1,31},{1,31},{1,32},{1,32},{1,32},{1,32}},
+        {{2,110},{2,110},{2,110},{2,110},{2,28},{2,28},{2,28},{2,28},{2,31},{2,31},{2,31},{2,31},{2,31},{2,31},{2,31},{2,31},{3,121},{3,121},{3,121},{3,121},{3,34},{3,34},{3,34},{3,34},{3,37},{3,37},{3,37},{3,37},{3,37},{3,37},{3,37},{3,37},{2,110},{2,110},{2,110},{2,110},{2,28},{2,28},{2,28},{2,28},{2,31},{2,31},{2,31},{2,31},{2,31},{2,31},{2,31},{2,31},{3,121},{3,121},{3,121},{3,121},{3,34},{3,34},{3,34},{3,34},{3,37},{3,37},{3,37},{3,37},{3,37},{3,37},{3,37},{3,37},{1,28},{1,28},{1,28},{1,28},{1,29},{1,29},{1,29},{1,29},{1,30},{1,30},{1,30},{1,30},{1,30},{1,30},{1,30},{1,30},{1,31},{1,31},{1,31},{1,31},{1,32},{1,32},{1,32},{1,32},{1,33},{1,33},{1,33},{1,33},{1,33},{1,33},{1,33},{1,33},{1,28},{1,28},{1,28},{1,28},{1,29},{1,29},{1,29},{1,29},{1,30},{1,30},{1,30},{1,30},{1,30},{1,30},{1,30},{1,30},{1,31},{1,31},{1,31},{1,31},{1,32},{1,32},{1,32},{1,32},{1,33},{1,33},{1,33},{1,33},{1,33},{1,33},{1,33},{1,33}},
+        {{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34}},
+        {{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,118},{0,118},{0,118},{0,118},{0,118},{0,118},{0,118},{0,118},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,113},{0,119},{0,119},{0,119},{0,119},{0,119},{0,119},{0,119},{0,119},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,120},{0,120},{0,120},{0,120},{0,120},{0,120},{0,120},{0,120},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35}},
+        {{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{0,30},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36},{1,36}},
+        {{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37}},
+        {{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,120},{0,120},{0,120},{0,120},{0,120},{0,120},{0,120},{0,120},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,28},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,29},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,32},{0,32},{0,32},{0,32},{0,32},{0,32},{0,32},{0,32},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,31},{0,32},{0,32},{0,32},{0,32},{0,32},{0,32},{0,32},{0,32},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,34},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,35},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,38},{1,38},{1,38},{1,38},{1,38},{1,38},{1,38},{1,38},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,37},{1,38},{1,38},{1,38},{1,38},{1,38},{1,38},{1,38},{1,38}},
+        {{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{4,107},{4,107},{4,109},{4,109},{4,107},{4,107},{4,109},{4,109},{3,107},{3,107},{3,111},{3,111},{3,107},{3,107},{3,111},{3,111},{3,108},{3,108},{3,113},{3,113},{3,108},{3,108},{3,113},{3,113},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{2,109},{2,109},{2,116},{2,116},{2,109},{2,109},{2,116},{2,116},{2,108},{2,108},{2,118},{2,118},{2,108},{2,108},{2,118},{2,118},{2,110},{2,110},{2,120},{2,120},{2,110},{2,110},{2,120},{2,120},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,111},{1,111},{1,125},{1,125},{1,111},{1,111},{1,125},{1,125},{1,109},{1,109},{1,126},{1,126},{1,109},{1,109},{1,126},{1,126},{1,112},{1,112},{1,127},{1,127},{1,112},{1,112},{1,127},{1,127},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128},{1,113},{1,113},{1,129},{1,129},{1,113},{1,113},{1,129},{1,129},{1,110},{1,110},{1,130},{1,130},{1,110},{1,110},{1,130},{1,130},{1,28},{1,28},{1,39},{1,39},{1,28},{1,28},{1,39},{1,39}},
+        {{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{4,107},{4,107},{4,109},{4,109},{4,108},{4,108},{4,110},{4,110},{3,107},{3,107},{3,111},{3,111},{3,109},{3,109},{3,112},{3,112},{3,108},{3,108},{3,113},{3,113},{3,110},{3,110},{3,28},{3,28},{2,107},{2,107},{2,114},{2,114},{2,111},{2,111},{2,115},{2,115},{2,109},{2,109},{2,116},{2,116},{2,112},{2,112},{2,117},{2,117},{2,108},{2,108},{2,118},{2,118},{2,113},{2,113},{2,119},{2,119},{2,110},{2,110},{2,120},{2,120},{2,28},{2,28},{2,29},{2,29},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,111},{1,111},{1,125},{1,125},{1,115},{1,115},{1,132},{1,132},{1,109},{1,109},{1,126},{1,126},{1,116},{1,116},{1,133},{1,133},{1,112},{1,112},{1,127},{1,127},{1,117},{1,117},{1,134},{1,134},{1,108},{1,108},{1,128},{1,128},{1,118},{1,118},{1,135},{1,135},{1,113},{1,113},{1,129},{1,129},{1,119},{1,119},{1,136},{1,136},{1,110},{1,110},{1,130},{1,130},{1,120},{1,120},{1,137},{1,137},{1,28},{1,28},{1,39},{1,39},{1,29},{1,29},{1,40},{1,40}},
+        {{3,108},{3,108},{3,113},{3,113},{3,110},{3,110},{3,28},{3,28},{4,121},{4,121},{4,34},{4,34},{4,121},{4,121},{4,34},{4,34},{3,108},{3,108},{3,113},{3,113},{3,110},{3,110},{3,28},{3,28},{4,121},{4,121},{4,34},{4,34},{4,121},{4,121},{4,34},{4,34},{2,110},{2,110},{2,120},{2,120},{2,28},{2,28},{2,29},{2,29},{2,31},{2,31},{2,32},{2,32},{2,31},{2,31},{2,32},{2,32},{2,110},{2,110},{2,120},{2,120},{2,28},{2,28},{2,29},{2,29},{2,31},{2,31},{2,32},{2,32},{2,31},{2,31},{2,32},{2,32},{1,112},{1,112},{1,127},{1,127},{1,117},{1,117},{1,134},{1,134},{1,122},{1,122},{1,138},{1,138},{1,122},{1,122},{1,138},{1,138},{1,112},{1,112},{1,127},{1,127},{1,117},{1,117},{1,134},{1,134},{1,122},{1,122},{1,138},{1,138},{1,122},{1,122},{1,138},{1,138},{1,28},{1,28},{1,39},{1,39},{1,29},{1,29},{1,40},{1,40},{1,30},{1,30},{1,41},{1,41},{1,30},{1,30},{1,41},{1,41},{1,28},{1,28},{1,39},{1,39},{1,29},{1,29},{1,40},{1,40},{1,30},{1,30},{1,41},{1,41},{1,30},{1,30},{1,41},{1,41}},
+        {{2,108},{2,108},{2,118},{2,118},{2,108},{2,108},{2,118},{2,118},{2,110},{2,110},{2,120},{2,120},{2,110},{2,110},{2,120},{2,120},{3,121},{3,121},{3,123},{3,123},{3,121},{3,121},{3,123},{3,123},{3,121},{3,121},{3,123},{3,123},{3,121},{3,121},{3,123},{3,123},{2,108},{2,108},{2,118},{2,118},{2,108},{2,108},{2,118},{2,118},{2,110},{2,110},{2,120},{2,120},{2,110},{2,110},{2,120},{2,120},{3,121},{3,121},{3,123},{3,123},{3,121},{3,121},{3,123},{3,123},{3,121},{3,121},{3,123},{3,123},{3,121},{3,121},{3,123},{3,123},{1,110},{1,110},{1,130},{1,130},{1,110},{1,110},{1,130},{1,130},{1,28},{1,28},{1,39},{1,39},{1,28},{1,28},{1,39},{1,39},{1,31},{1,31},{1,42},{1,42},{1,31},{1,31},{1,42},{1,42},{1,31},{1,31},{1,42},{1,42},{1,31},{1,31},{1,42},{1,42},{1,110},{1,110},{1,130},{1,130},{1,110},{1,110},{1,130},{1,130},{1,28},{1,28},{1,39},{1,39},{1,28},{1,28},{1,39},{1,39},{1,31},{1,31},{1,42},{1,42},{1,31},{1,31},{1,42},{1,42},{1,31},{1,31},{1,42},{1,42},{1,31},{1,31},{1,42},{1,42}},
+        {{2,108},{2,108},{2,118},{2,118},{2,113},{2,113},{2,119},{2,119},{2,110},{2,110},{2,120},{2,120},{2,28},{2,28},{2,29},{2,29},{3,121},{3,121},{3,123},{3,123},{3,34},{3,34},{3,35},{3,35},{3,121},{3,121},{3,123},{3,123},{3,34},{3,34},{3,35},{3,35},{2,108},{2,108},{2,118},{2,118},{2,113},{2,113},{2,119},{2,119},{2,110},{2,110},{2,120},{2,120},{2,28},{2,28},{2,29},{2,29},{3,121},{3,121},{3,123},{3,123},{3,34},{3,34},{3,35},{3,35},{3,121},{3,121},{3,123},{3,123},{3,34},{3,34},{3,35},{3,35},{1,110},{1,110},{1,130},{1,130},{1,120},{1,120},{1,137},{1,137},{1,28},{1,28},{1,39},{1,39},{1,29},{1,29},{1,40},{1,40},{1,31},{1,31},{1,42},{1,42},{1,32},{1,32},{1,43},{1,43},{1,31},{1,31},{1,42},{1,42},{1,32},{1,32},{1,43},{1,43},{1,110},{1,110},{1,130},{1,130},{1,120},{1,120},{1,137},{1,137},{1,28},{1,28},{1,39},{1,39},{1,29},{1,29},{1,40},{1,40},{1,31},{1,31},{1,42},{1,42},{1,32},{1,32},{1,43},{1,43},{1,31},{1,31},{1,42},{1,42},{1,32},{1,32},{1,43},{1,43}},
+        {{2,110},{2,110},{2,120},{2,120},{2,28},{2,28},{2,29},{2,29},{2,31},{2,31},{2,32},{2,32},{2,31},{2,31},{2,32},{2,32},{3,121},{3,121},{3,123},{3,123},{3,34},{3,34},{3,35},{3,35},{3,37},{3,37},{3,38},{3,38},{3,37},{3,37},{3,38},{3,38},{2,110},{2,110},{2,120},{2,120},{2,28},{2,28},{2,29},{2,29},{2,31},{2,31},{2,32},{2,32},{2,31},{2,31},{2,32},{2,32},{3,121},{3,121},{3,123},{3,123},{3,34},{3,34},{3,35},{3,35},{3,37},{3,37},{3,38},{3,38},{3,37},{3,37},{3,38},{3,38},{1,28},{1,28},{1,39},{1,39},{1,29},{1,29},{1,40},{1,40},{1,30},{1,30},{1,41},{1,41},{1,30},{1,30},{1,41},{1,41},{1,31},{1,31},{1,42},{1,42},{1,32},{1,32},{1,43},{1,43},{1,33},{1,33},{1,44},{1,44},{1,33},{1,33},{1,44},{1,44},{1,28},{1,28},{1,39},{1,39},{1,29},{1,29},{1,40},{1,40},{1,30},{1,30},{1,41},{1,41},{1,30},{1,30},{1,41},{1,41},{1,31},{1,31},{1,42},{1,42},{1,32},{1,32},{1,43},{1,43},{1,33},{1,33},{1,44},{1,44},{1,33},{1,33},{1,44},{1,44}},
+        {{0,108},{0,108},{0,108},{0,108},{0,128},{0,128},{0,128},{0,128},{0,108},{0,108},{0,108},{0,108},{0,128},{0,128},{0,128},{0,128},{0,113},{0,113},{0,113},{0,113},{0,129},{0,129},{0,129},{0,129},{0,113},{0,113},{0,113},{0,113},{0,129},{0,129},{0,129},{0,129},{0,110},{0,110},{0,110},{0,110},{0,130},{0,130},{0,130},{0,130},{0,110},{0,110},{0,110},{0,110},{0,130},{0,130},{0,130},{0,130},{0,28},{0,28},{0,28},{0,28},{0,39},{0,39},{0,39},{0,39},{0,28},{0,28},{0,28},{0,28},{0,39},{0,39},{0,39},{0,39},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,34},{1,34},{1,34},{1,34},{1,45},{1,45},{1,45},{1,45},{1,34},{1,34},{1,34},{1,34},{1,45},{1,45},{1,45},{1,45},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,34},{1,34},{1,34},{1,34},{1,45},{1,45},{1,45},{1,45},{1,34},{1,34},{1,34},{1,34},{1,45},{1,45},{1,45},{1,45}},
+        {{0,108},{0,108},{0,108},{0,108},{0,128},{0,128},{0,128},{0,128},{0,118},{0,118},{0,118},{0,118},{0,135},{0,135},{0,135},{0,135},{0,113},{0,113},{0,113},{0,113},{0,129},{0,129},{0,129},{0,129},{0,119},{0,119},{0,119},{0,119},{0,136},{0,136},{0,136},{0,136},{0,110},{0,110},{0,110},{0,110},{0,130},{0,130},{0,130},{0,130},{0,120},{0,120},{0,120},{0,120},{0,137},{0,137},{0,137},{0,137},{0,28},{0,28},{0,28},{0,28},{0,39},{0,39},{0,39},{0,39},{0,29},{0,29},{0,29},{0,29},{0,40},{0,40},{0,40},{0,40},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,123},{1,123},{1,123},{1,123},{1,140},{1,140},{1,140},{1,140},{1,34},{1,34},{1,34},{1,34},{1,45},{1,45},{1,45},{1,45},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,123},{1,123},{1,123},{1,123},{1,140},{1,140},{1,140},{1,140},{1,34},{1,34},{1,34},{1,34},{1,45},{1,45},{1,45},{1,45},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46}},
+        {{0,28},{0,28},{0,28},{0,28},{0,39},{0,39},{0,39},{0,39},{0,29},{0,29},{0,29},{0,29},{0,40},{0,40},{0,40},{0,40},{0,30},{0,30},{0,30},{0,30},{0,41},{0,41},{0,41},{0,41},{0,30},{0,30},{0,30},{0,30},{0,41},{0,41},{0,41},{0,41},{0,28},{0,28},{0,28},{0,28},{0,39},{0,39},{0,39},{0,39},{0,29},{0,29},{0,29},{0,29},{0,40},{0,40},{0,40},{0,40},{0,30},{0,30},{0,30},{0,30},{0,41},{0,41},{0,41},{0,41},{0,30},{0,30},{0,30},{0,30},{0,41},{0,41},{0,41},{0,41},{1,34},{1,34},{1,34},{1,34},{1,45},{1,45},{1,45},{1,45},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,36},{1,36},{1,36},{1,36},{1,47},{1,47},{1,47},{1,47},{1,36},{1,36},{1,36},{1,36},{1,47},{1,47},{1,47},{1,47},{1,34},{1,34},{1,34},{1,34},{1,45},{1,45},{1,45},{1,45},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,36},{1,36},{1,36},{1,36},{1,47},{1,47},{1,47},{1,47},{1,36},{1,36},{1,36},{1,36},{1,47},{1,47},{1,47},{1,47}},
+        {{0,110},{0,110},{0,110},{0,110},{0,130},{0,130},{0,130},{0,130},{0,110},{0,110},{0,110},{0,110},{0,130},{0,130},{0,130},{0,130},{0,28},{0,28},{0,28},{0,28},{0,39},{0,39},{0,39},{0,39},{0,28},{0,28},{0,28},{0,28},{0,39},{0,39},{0,39},{0,39},{0,31},{0,31},{0,31},{0,31},{0,42},{0,42},{0,42},{0,42},{0,31},{0,31},{0,31},{0,31},{0,42},{0,42},{0,42},{0,42},{0,31},{0,31},{0,31},{0,31},{0,42},{0,42},{0,42},{0,42},{0,31},{0,31},{0,31},{0,31},{0,42},{0,42},{0,42},{0,42},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,34},{1,34},{1,34},{1,34},{1,45},{1,45},{1,45},{1,45},{1,34},{1,34},{1,34},{1,34},{1,45},{1,45},{1,45},{1,45},{1,37},{1,37},{1,37},{1,37},{1,48},{1,48},{1,48},{1,48},{1,37},{1,37},{1,37},{1,37},{1,48},{1,48},{1,48},{1,48},{1,37},{1,37},{1,37},{1,37},{1,48},{1,48},{1,48},{1,48},{1,37},{1,37},{1,37},{1,37},{1,48},{1,48},{1,48},{1,48}},
+        {{0,110},{0,110},{0,110},{0,110},{0,130},{0,130},{0,130},{0,130},{0,120},{0,120},{0,120},{0,120},{0,137},{0,137},{0,137},{0,137},{0,28},{0,28},{0,28},{0,28},{0,39},{0,39},{0,39},{0,39},{0,29},{0,29},{0,29},{0,29},{0,40},{0,40},{0,40},{0,40},{0,31},{0,31},{0,31},{0,31},{0,42},{0,42},{0,42},{0,42},{0,32},{0,32},{0,32},{0,32},{0,43},{0,43},{0,43},{0,43},{0,31},{0,31},{0,31},{0,31},{0,42},{0,42},{0,42},{0,42},{0,32},{0,32},{0,32},{0,32},{0,43},{0,43},{0,43},{0,43},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,123},{1,123},{1,123},{1,123},{1,140},{1,140},{1,140},{1,140},{1,34},{1,34},{1,34},{1,34},{1,45},{1,45},{1,45},{1,45},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,37},{1,37},{1,37},{1,37},{1,48},{1,48},{1,48},{1,48},{1,38},{1,38},{1,38},{1,38},{1,49},{1,49},{1,49},{1,49},{1,37},{1,37},{1,37},{1,37},{1,48},{1,48},{1,48},{1,48},{1,38},{1,38},{1,38},{1,38},{1,49},{1,49},{1,49},{1,49}},
+        {{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{3,110},{3,110},{3,28},{3,28},{3,31},{3,31},{3,31},{3,31},{3,110},{3,110},{3,28},{3,28},{3,31},{3,31},{3,31},{3,31},{2,112},{2,112},{2,117},{2,117},{2,122},{2,122},{2,122},{2,122},{2,112},{2,112},{2,117},{2,117},{2,122},{2,122},{2,122},{2,122},{2,28},{2,28},{2,29},{2,29},{2,30},{2,30},{2,30},{2,30},{2,28},{2,28},{2,29},{2,29},{2,30},{2,30},{2,30},{2,30},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,117},{1,117},{1,134},{1,134},{1,142},{1,142},{1,142},{1,142},{1,117},{1,117},{1,134},{1,134},{1,142},{1,142},{1,142},{1,142},{1,119},{1,119},{1,136},{1,136},{1,143},{1,143},{1,143},{1,143},{1,119},{1,119},{1,136},{1,136},{1,143},{1,143},{1,143},{1,143},{1,29},{1,29},{1,40},{1,40},{1,50},{1,50},{1,50},{1,50},{1,29},{1,29},{1,40},{1,40},{1,50},{1,50},{1,50},{1,50}},
+        {{3,110},{3,110},{3,28},{3,28},{3,31},{3,31},{3,31},{3,31},{4,121},{4,121},{4,34},{4,34},{4,37},{4,37},{4,37},{4,37},{3,110},{3,110},{3,28},{3,28},{3,31},{3,31},{3,31},{3,31},{4,121},{4,121},{4,34},{4,34},{4,37},{4,37},{4,37},{4,37},{2,28},{2,28},{2,29},{2,29},{2,30},{2,30},{2,30},{2,30},{2,31},{2,31},{2,32},{2,32},{2,33},{2,33},{2,33},{2,33},{2,28},{2,28},{2,29},{2,29},{2,30},{2,30},{2,30},{2,30},{2,31},{2,31},{2,32},{2,32},{2,33},{2,33},{2,33},{2,33},{1,117},{1,117},{1,134},{1,134},{1,142},{1,142},{1,142},{1,142},{1,122},{1,122},{1,138},{1,138},{1,144},{1,144},{1,144},{1,144},{1,117},{1,117},{1,134},{1,134},{1,142},{1,142},{1,142},{1,142},{1,122},{1,122},{1,138},{1,138},{1,144},{1,144},{1,144},{1,144},{1,29},{1,29},{1,40},{1,40},{1,50},{1,50},{1,50},{1,50},{1,30},{1,30},{1,41},{1,41},{1,51},{1,51},{1,51},{1,51},{1,29},{1,29},{1,40},{1,40},{1,50},{1,50},{1,50},{1,50},{1,30},{1,30},{1,41},{1,41},{1,51},{1,51},{1,51},{1,51}},
+        {{2,28},{2,28},{2,29},{2,29},{2,30},{2,30},{2,30},{2,30},{2,28},{2,28},{2,29},{2,29},{2,30},{2,30},{2,30},{2,30},{3,34},{3,34},{3,35},{3,35},{3,36},{3,36},{3,36},{3,36},{3,34},{3,34},{3,35},{3,35},{3,36},{3,36},{3,36},{3,36},{2,28},{2,28},{2,29},{2,29},{2,30},{2,30},{2,30},{2,30},{2,28},{2,28},{2,29},{2,29},{2,30},{2,30},{2,30},{2,30},{3,34},{3,34},{3,35},{3,35},{3,36},{3,36},{3,36},{3,36},{3,34},{3,34},{3,35},{3,35},{3,36},{3,36},{3,36},{3,36},{1,29},{1,29},{1,40},{1,40},{1,50},{1,50},{1,50},{1,50},{1,29},{1,29},{1,40},{1,40},{1,50},{1,50},{1,50},{1,50},{1,32},{1,32},{1,43},{1,43},{1,52},{1,52},{1,52},{1,52},{1,32},{1,32},{1,43},{1,43},{1,52},{1,52},{1,52},{1,52},{1,29},{1,29},{1,40},{1,40},{1,50},{1,50},{1,50},{1,50},{1,29},{1,29},{1,40},{1,40},{1,50},{1,50},{1,50},{1,50},{1,32},{1,32},{1,43},{1,43},{1,52},{1,52},{1,52},{1,52},{1,32},{1,32},{1,43},{1,43},{1,52},{1,52},{1,52},{1,52}},
+        {{2,28},{2,28},{2,29},{2,29},{2,30},{2,30},{2,30},{2,30},{2,31},{2,31},{2,32},{2,32},{2,33},{2,33},{2,33},{2,33},{3,34},{3,34},{3,35},{3,35},{3,36},{3,36},{3,36},{3,36},{3,37},{3,37},{3,38},{3,38},{3,6},{3,6},{3,6},{3,6},{2,28},{2,28},{2,29},{2,29},{2,30},{2,30},{2,30},{2,30},{2,31},{2,31},{2,32},{2,32},{2,33},{2,33},{2,33},{2,33},{3,34},{3,34},{3,35},{3,35},{3,36},{3,36},{3,36},{3,36},{3,37},{3,37},{3,38},{3,38},{3,6},{3,6},{3,6},{3,6},{1,29},{1,29},{1,40},{1,40},{1,50},{1,50},{1,50},{1,50},{1,30},{1,30},{1,41},{1,41},{1,51},{1,51},{1,51},{1,51},{1,32},{1,32},{1,43},{1,43},{1,52},{1,52},{1,52},{1,52},{1,33},{1,33},{1,44},{1,44},{1,53},{1,53},{1,53},{1,53},{1,29},{1,29},{1,40},{1,40},{1,50},{1,50},{1,50},{1,50},{1,30},{1,30},{1,41},{1,41},{1,51},{1,51},{1,51},{1,51},{1,32},{1,32},{1,43},{1,43},{1,52},{1,52},{1,52},{1,52},{1,33},{1,33},{1,44},{1,44},{1,53},{1,53},{1,53},{1,53}},
+        {{0,119},{0,119},{0,119},{0,119},{0,136},{0,136},{0,136},{0,136},{0,143},{0,143},{0,143},{0,143},{0,143},{0,143},{0,143},{0,143},{0,119},{0,119},{0,119},{0,119},{0,136},{0,136},{0,136},{0,136},{0,143},{0,143},{0,143},{0,143},{0,143},{0,143},{0,143},{0,143},{0,29},{0,29},{0,29},{0,29},{0,40},{0,40},{0,40},{0,40},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,29},{0,29},{0,29},{0,29},{0,40},{0,40},{0,40},{0,40},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54}},
+        {{0,29},{0,29},{0,29},{0,29},{0,40},{0,40},{0,40},{0,40},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,30},{0,30},{0,30},{0,30},{0,41},{0,41},{0,41},{0,41},{0,51},{0,51},{0,51},{0,51},{0,51},{0,51},{0,51},{0,51},{0,29},{0,29},{0,29},{0,29},{0,40},{0,40},{0,40},{0,40},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,30},{0,30},{0,30},{0,30},{0,41},{0,41},{0,41},{0,41},{0,51},{0,51},{0,51},{0,51},{0,51},{0,51},{0,51},{0,51},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,36},{1,36},{1,36},{1,36},{1,47},{1,47},{1,47},{1,47},{1,55},{1,55},{1,55},{1,55},{1,55},{1,55},{1,55},{1,55},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,36},{1,36},{1,36},{1,36},{1,47},{1,47},{1,47},{1,47},{1,55},{1,55},{1,55},{1,55},{1,55},{1,55},{1,55},{1,55}},
+        {{0,29},{0,29},{0,29},{0,29},{0,40},{0,40},{0,40},{0,40},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,29},{0,29},{0,29},{0,29},{0,40},{0,40},{0,40},{0,40},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,50},{0,32},{0,32},{0,32},{0,32},{0,43},{0,43},{0,43},{0,43},{0,52},{0,52},{0,52},{0,52},{0,52},{0,52},{0,52},{0,52},{0,32},{0,32},{0,32},{0,32},{0,43},{0,43},{0,43},{0,43},{0,52},{0,52},{0,52},{0,52},{0,52},{0,52},{0,52},{0,52},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,35},{1,35},{1,35},{1,35},{1,46},{1,46},{1,46},{1,46},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,54},{1,38},{1,38},{1,38},{1,38},{1,49},{1,49},{1,49},{1,49},{1,56},{1,56},{1,56},{1,56},{1,56},{1,56},{1,56},{1,56},{1,38},{1,38},{1,38},{1,38},{1,49},{1,49},{1,49},{1,49},{1,56},{1,56},{1,56},{1,56},{1,56},{1,56},{1,56},{1,56}},
+        {{3,37},{3,37},{3,38},{3,38},{3,6},{3,6},{3,6},{3,6},{4,10},{4,10},{4,10},{4,10},{4,10},{4,10},{4,10},{4,10},{3,37},{3,37},{3,38},{3,38},{3,6},{3,6},{3,6},{3,6},{4,10},{4,10},{4,10},{4,10},{4,10},{4,10},{4,10},{4,10},{3,37},{3,37},{3,38},{3,38},{3,6},{3,6},{3,6},{3,6},{4,10},{4,10},{4,10},{4,10},{4,10},{4,10},{4,10},{4,10},{3,37},{3,37},{3,38},{3,38},{3,6},{3,6},{3,6},{3,6},{4,10},{4,10},{4,10},{4,10},{4,10},{4,10},{4,10},{4,10},{1,33},{1,33},{1,44},{1,44},{1,53},{1,53},{1,53},{1,53},{1,57},{1,57},{1,57},{1,57},{1,57},{1,57},{1,57},{1,57},{1,33},{1,33},{1,44},{1,44},{1,53},{1,53},{1,53},{1,53},{1,57},{1,57},{1,57},{1,57},{1,57},{1,57},{1,57},{1,57},{1,33},{1,33},{1,44},{1,44},{1,53},{1,53},{1,53},{1,53},{1,57},{1,57},{1,57},{1,57},{1,57},{1,57},{1,57},{1,57},{1,33},{1,33},{1,44},{1,44},{1,53},{1,53},{1,53},{1,53},{1,57},{1,57},{1,57},{1,57},{1,57},{1,57},{1,57},{1,57}},
+        {{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,108},{3,118},{3,108},{3,118},{3,108},{3,118},{3,108},{3,118},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,109},{2,126},{2,109},{2,126},{2,109},{2,126},{2,109},{2,126},{2,108},{2,128},{2,108},{2,128},{2,108},{2,128},{2,108},{2,128},{2,110},{2,130},{2,110},{2,130},{2,110},{2,130},{2,110},{2,130},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,112},{1,148},{1,112},{1,148},{1,112},{1,148},{1,112},{1,148},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,113},{1,150},{1,113},{1,150},{1,113},{1,150},{1,113},{1,150},{1,110},{1,151},{1,110},{1,151},{1,110},{1,151},{1,110},{1,151},{1,28},{1,58},{1,28},{1,58},{1,28},{1,58},{1,28},{1,58}},
+        {{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{4,107},{4,111},{4,107},{4,111},{4,108},{4,113},{4,108},{4,113},{3,107},{3,114},{3,107},{3,114},{3,109},{3,116},{3,109},{3,116},{3,108},{3,118},{3,108},{3,118},{3,110},{3,120},{3,110},{3,120},{2,107},{2,124},{2,107},{2,124},{2,111},{2,125},{2,111},{2,125},{2,109},{2,126},{2,109},{2,126},{2,112},{2,127},{2,112},{2,127},{2,108},{2,128},{2,108},{2,128},{2,113},{2,129},{2,113},{2,129},{2,110},{2,130},{2,110},{2,130},{2,28},{2,39},{2,28},{2,39},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,111},{1,146},{1,111},{1,146},{1,115},{1,153},{1,115},{1,153},{1,109},{1,147},{1,109},{1,147},{1,116},{1,154},{1,116},{1,154},{1,112},{1,148},{1,112},{1,148},{1,117},{1,155},{1,117},{1,155},{1,108},{1,149},{1,108},{1,149},{1,118},{1,156},{1,118},{1,156},{1,113},{1,150},{1,113},{1,150},{1,119},{1,157},{1,119},{1,157},{1,110},{1,151},{1,110},{1,151},{1,120},{1,158},{1,120},{1,158},{1,28},{1,58},{1,28},{1,58},{1,29},{1,59},{1,29},{1,59}},
+        {{3,108},{3,118},{3,108},{3,118},{3,110},{3,120},{3,110},{3,120},{4,121},{4,123},{4,121},{4,123},{4,121},{4,123},{4,121},{4,123},{3,108},{3,118},{3,108},{3,118},{3,110},{3,120},{3,110},{3,120},{4,121},{4,123},{4,121},{4,123},{4,121},{4,123},{4,121},{4,123},{2,110},{2,130},{2,110},{2,130},{2,28},{2,39},{2,28},{2,39},{2,31},{2,42},{2,31},{2,42},{2,31},{2,42},{2,31},{2,42},{2,110},{2,130},{2,110},{2,130},{2,28},{2,39},{2,28},{2,39},{2,31},{2,42},{2,31},{2,42},{2,31},{2,42},{2,31},{2,42},{1,112},{1,148},{1,112},{1,148},{1,117},{1,155},{1,117},{1,155},{1,122},{1,159},{1,122},{1,159},{1,122},{1,159},{1,122},{1,159},{1,112},{1,148},{1,112},{1,148},{1,117},{1,155},{1,117},{1,155},{1,122},{1,159},{1,122},{1,159},{1,122},{1,159},{1,122},{1,159},{1,28},{1,58},{1,28},{1,58},{1,29},{1,59},{1,29},{1,59},{1,30},{1,60},{1,30},{1,60},{1,30},{1,60},{1,30},{1,60},{1,28},{1,58},{1,28},{1,58},{1,29},{1,59},{1,29},{1,59},{1,30},{1,60},{1,30},{1,60},{1,30},{1,60},{1,30},{1,60}},
+        {{2,108},{2,128},{2,108},{2,128},{2,108},{2,128},{2,108},{2,128},{2,110},{2,130},{2,110},{2,130},{2,110},{2,130},{2,110},{2,130},{3,121},{3,139},{3,121},{3,139},{3,121},{3,139},{3,121},{3,139},{3,121},{3,139},{3,121},{3,139},{3,121},{3,139},{3,121},{3,139},{2,108},{2,128},{2,108},{2,128},{2,108},{2,128},{2,108},{2,128},{2,110},{2,130},{2,110},{2,130},{2,110},{2,130},{2,110},{2,130},{3,121},{3,139},{3,121},{3,139},{3,121},{3,139},{3,121},{3,139},{3,121},{3,139},{3,121},{3,139},{3,121},{3,139},{3,121},{3,139},{1,110},{1,151},{1,110},{1,151},{1,110},{1,151},{1,110},{1,151},{1,28},{1,58},{1,28},{1,58},{1,28},{1,58},{1,28},{1,58},{1,31},{1,61},{1,31},{1,61},{1,31},{1,61},{1,31},{1,61},{1,31},{1,61},{1,31},{1,61},{1,31},{1,61},{1,31},{1,61},{1,110},{1,151},{1,110},{1,151},{1,110},{1,151},{1,110},{1,151},{1,28},{1,58},{1,28},{1,58},{1,28},{1,58},{1,28},{1,58},{1,31},{1,61},{1,31},{1,61},{1,31},{1,61},{1,31},{1,61},{1,31},{1,61},{1,31},{1,61},{1,31},{1,61},{1,31},{1,61}},
+        {{2,108},{2,128},{2,108},{2,128},{2,113},{2,129},{2,113},{2,129},{2,110},{2,130},{2,110},{2,130},{2,28},{2,39},{2,28},{2,39},{3,121},{3,139},{3,121},{3,139},{3,34},{3,45},{3,34},{3,45},{3,121},{3,139},{3,121},{3,139},{3,34},{3,45},{3,34},{3,45},{2,108},{2,128},{2,108},{2,128},{2,113},{2,129},{2,113},{2,129},{2,110},{2,130},{2,110},{2,130},{2,28},{2,39},{2,28},{2,39},{3,121},{3,139},{3,121},{3,139},{3,34},{3,45},{3,34},{3,45},{3,121},{3,139},{3,121},{3,139},{3,34},{3,45},{3,34},{3,45},{1,110},{1,151},{1,110},{1,151},{1,120},{1,158},{1,120},{1,158},{1,28},{1,58},{1,28},{1,58},{1,29},{1,59},{1,29},{1,59},{1,31},{1,61},{1,31},{1,61},{1,32},{1,62},{1,32},{1,62},{1,31},{1,61},{1,31},{1,61},{1,32},{1,62},{1,32},{1,62},{1,110},{1,151},{1,110},{1,151},{1,120},{1,158},{1,120},{1,158},{1,28},{1,58},{1,28},{1,58},{1,29},{1,59},{1,29},{1,59},{1,31},{1,61},{1,31},{1,61},{1,32},{1,62},{1,32},{1,62},{1,31},{1,61},{1,31},{1,61},{1,32},{1,62},{1,32},{1,62}},
+        {{2,110},{2,130},{2,110},{2,130},{2,28},{2,39},{2,28},{2,39},{2,31},{2,42},{2,31},{2,42},{2,31},{2,42},{2,31},{2,42},{3,121},{3,139},{3,121},{3,139},{3,34},{3,45},{3,34},{3,45},{3,37},{3,48},{3,37},{3,48},{3,37},{3,48},{3,37},{3,48},{2,110},{2,130},{2,110},{2,130},{2,28},{2,39},{2,28},{2,39},{2,31},{2,42},{2,31},{2,42},{2,31},{2,42},{2,31},{2,42},{3,121},{3,139},{3,121},{3,139},{3,34},{3,45},{3,34},{3,45},{3,37},{3,48},{3,37},{3,48},{3,37},{3,48},{3,37},{3,48},{1,28},{1,58},{1,28},{1,58},{1,29},{1,59},{1,29},{1,59},{1,30},{1,60},{1,30},{1,60},{1,30},{1,60},{1,30},{1,60},{1,31},{1,61},{1,31},{1,61},{1,32},{1,62},{1,32},{1,62},{1,33},{1,63},{1,33},{1,63},{1,33},{1,63},{1,33},{1,63},{1,28},{1,58},{1,28},{1,58},{1,29},{1,59},{1,29},{1,59},{1,30},{1,60},{1,30},{1,60},{1,30},{1,60},{1,30},{1,60},{1,31},{1,61},{1,31},{1,61},{1,32},{1,62},{1,32},{1,62},{1,33},{1,63},{1,33},{1,63},{1,33},{1,63},{1,33},{1,63}},
+        {{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,113},{0,113},{0,150},{0,150},{0,113},{0,113},{0,150},{0,150},{0,113},{0,113},{0,150},{0,150},{0,113},{0,113},{0,150},{0,150},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,28},{0,28},{0,58},{0,58},{0,28},{0,28},{0,58},{0,58},{0,28},{0,28},{0,58},{0,58},{0,28},{0,28},{0,58},{0,58},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64}},
+        {{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,118},{0,118},{0,156},{0,156},{0,118},{0,118},{0,156},{0,156},{0,113},{0,113},{0,150},{0,150},{0,113},{0,113},{0,150},{0,150},{0,119},{0,119},{0,157},{0,157},{0,119},{0,119},{0,157},{0,157},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,120},{0,120},{0,158},{0,158},{0,120},{0,120},{0,158},{0,158},{0,28},{0,28},{0,58},{0,58},{0,28},{0,28},{0,58},{0,58},{0,29},{0,29},{0,59},{0,59},{0,29},{0,29},{0,59},{0,59},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,123},{1,123},{1,161},{1,161},{1,123},{1,123},{1,161},{1,161},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,35},{1,35},{1,65},{1,65},{1,35},{1,35},{1,65},{1,65},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,123},{1,123},{1,161},{1,161},{1,123},{1,123},{1,161},{1,161},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,35},{1,35},{1,65},{1,65},{1,35},{1,35},{1,65},{1,65}},
+        {{0,28},{0,28},{0,58},{0,58},{0,28},{0,28},{0,58},{0,58},{0,29},{0,29},{0,59},{0,59},{0,29},{0,29},{0,59},{0,59},{0,30},{0,30},{0,60},{0,60},{0,30},{0,30},{0,60},{0,60},{0,30},{0,30},{0,60},{0,60},{0,30},{0,30},{0,60},{0,60},{0,28},{0,28},{0,58},{0,58},{0,28},{0,28},{0,58},{0,58},{0,29},{0,29},{0,59},{0,59},{0,29},{0,29},{0,59},{0,59},{0,30},{0,30},{0,60},{0,60},{0,30},{0,30},{0,60},{0,60},{0,30},{0,30},{0,60},{0,60},{0,30},{0,30},{0,60},{0,60},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,35},{1,35},{1,65},{1,65},{1,35},{1,35},{1,65},{1,65},{1,36},{1,36},{1,66},{1,66},{1,36},{1,36},{1,66},{1,66},{1,36},{1,36},{1,66},{1,66},{1,36},{1,36},{1,66},{1,66},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,35},{1,35},{1,65},{1,65},{1,35},{1,35},{1,65},{1,65},{1,36},{1,36},{1,66},{1,66},{1,36},{1,36},{1,66},{1,66},{1,36},{1,36},{1,66},{1,66},{1,36},{1,36},{1,66},{1,66}},
+        {{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,28},{0,28},{0,58},{0,58},{0,28},{0,28},{0,58},{0,58},{0,28},{0,28},{0,58},{0,58},{0,28},{0,28},{0,58},{0,58},{0,31},{0,31},{0,61},{0,61},{0,31},{0,31},{0,61},{0,61},{0,31},{0,31},{0,61},{0,61},{0,31},{0,31},{0,61},{0,61},{0,31},{0,31},{0,61},{0,61},{0,31},{0,31},{0,61},{0,61},{0,31},{0,31},{0,61},{0,61},{0,31},{0,31},{0,61},{0,61},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,37},{1,37},{1,67},{1,67},{1,37},{1,37},{1,67},{1,67},{1,37},{1,37},{1,67},{1,67},{1,37},{1,37},{1,67},{1,67},{1,37},{1,37},{1,67},{1,67},{1,37},{1,37},{1,67},{1,67},{1,37},{1,37},{1,67},{1,67},{1,37},{1,37},{1,67},{1,67}},
+        {{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,120},{0,120},{0,158},{0,158},{0,120},{0,120},{0,158},{0,158},{0,28},{0,28},{0,58},{0,58},{0,28},{0,28},{0,58},{0,58},{0,29},{0,29},{0,59},{0,59},{0,29},{0,29},{0,59},{0,59},{0,31},{0,31},{0,61},{0,61},{0,31},{0,31},{0,61},{0,61},{0,32},{0,32},{0,62},{0,62},{0,32},{0,32},{0,62},{0,62},{0,31},{0,31},{0,61},{0,61},{0,31},{0,31},{0,61},{0,61},{0,32},{0,32},{0,62},{0,62},{0,32},{0,32},{0,62},{0,62},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,123},{1,123},{1,161},{1,161},{1,123},{1,123},{1,161},{1,161},{1,34},{1,34},{1,64},{1,64},{1,34},{1,34},{1,64},{1,64},{1,35},{1,35},{1,65},{1,65},{1,35},{1,35},{1,65},{1,65},{1,37},{1,37},{1,67},{1,67},{1,37},{1,37},{1,67},{1,67},{1,38},{1,38},{1,68},{1,68},{1,38},{1,38},{1,68},{1,68},{1,37},{1,37},{1,67},{1,67},{1,37},{1,37},{1,67},{1,67},{1,38},{1,38},{1,68},{1,68},{1,38},{1,38},{1,68},{1,68}},
+        {{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{4,107},{4,111},{4,109},{4,112},{4,107},{4,111},{4,109},{4,112},{3,107},{3,114},{3,111},{3,115},{3,107},{3,114},{3,111},{3,115},{3,108},{3,118},{3,113},{3,119},{3,108},{3,118},{3,113},{3,119},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{2,109},{2,126},{2,116},{2,133},{2,109},{2,126},{2,116},{2,133},{2,108},{2,128},{2,118},{2,135},{2,108},{2,128},{2,118},{2,135},{2,110},{2,130},{2,120},{2,137},{2,110},{2,130},{2,120},{2,137},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,111},{1,146},{1,125},{1,163},{1,111},{1,146},{1,125},{1,163},{1,109},{1,147},{1,126},{1,164},{1,109},{1,147},{1,126},{1,164},{1,112},{1,148},{1,127},{1,165},{1,112},{1,148},{1,127},{1,165},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166},{1,113},{1,150},{1,129},{1,167},{1,113},{1,150},{1,129},{1,167},{1,110},{1,151},{1,130},{1,168},{1,110},{1,151},{1,130},{1,168},{1,28},{1,58},{1,39},{1,69},{1,28},{1,58},{1,39},{1,69}},
+        {{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{4,107},{4,111},{4,109},{4,112},{4,108},{4,113},{4,110},{4,28},{3,107},{3,114},{3,111},{3,115},{3,109},{3,116},{3,112},{3,117},{3,108},{3,118},{3,113},{3,119},{3,110},{3,120},{3,28},{3,29},{2,107},{2,124},{2,114},{2,131},{2,111},{2,125},{2,115},{2,132},{2,109},{2,126},{2,116},{2,133},{2,112},{2,127},{2,117},{2,134},{2,108},{2,128},{2,118},{2,135},{2,113},{2,129},{2,119},{2,136},{2,110},{2,130},{2,120},{2,137},{2,28},{2,39},{2,29},{2,40},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,111},{1,146},{1,125},{1,163},{1,115},{1,153},{1,132},{1,170},{1,109},{1,147},{1,126},{1,164},{1,116},{1,154},{1,133},{1,171},{1,112},{1,148},{1,127},{1,165},{1,117},{1,155},{1,134},{1,172},{1,108},{1,149},{1,128},{1,166},{1,118},{1,156},{1,135},{1,173},{1,113},{1,150},{1,129},{1,167},{1,119},{1,157},{1,136},{1,174},{1,110},{1,151},{1,130},{1,168},{1,120},{1,158},{1,137},{1,175},{1,28},{1,58},{1,39},{1,69},{1,29},{1,59},{1,40},{1,70}},
+        {{3,108},{3,118},{3,113},{3,119},{3,110},{3,120},{3,28},{3,29},{4,121},{4,123},{4,34},{4,35},{4,121},{4,123},{4,34},{4,35},{3,108},{3,118},{3,113},{3,119},{3,110},{3,120},{3,28},{3,29},{4,121},{4,123},{4,34},{4,35},{4,121},{4,123},{4,34},{4,35},{2,110},{2,130},{2,120},{2,137},{2,28},{2,39},{2,29},{2,40},{2,31},{2,42},{2,32},{2,43},{2,31},{2,42},{2,32},{2,43},{2,110},{2,130},{2,120},{2,137},{2,28},{2,39},{2,29},{2,40},{2,31},{2,42},{2,32},{2,43},{2,31},{2,42},{2,32},{2,43},{1,112},{1,148},{1,127},{1,165},{1,117},{1,155},{1,134},{1,172},{1,122},{1,159},{1,138},{1,176},{1,122},{1,159},{1,138},{1,176},{1,112},{1,148},{1,127},{1,165},{1,117},{1,155},{1,134},{1,172},{1,122},{1,159},{1,138},{1,176},{1,122},{1,159},{1,138},{1,176},{1,28},{1,58},{1,39},{1,69},{1,29},{1,59},{1,40},{1,70},{1,30},{1,60},{1,41},{1,71},{1,30},{1,60},{1,41},{1,71},{1,28},{1,58},{1,39},{1,69},{1,29},{1,59},{1,40},{1,70},{1,30},{1,60},{1,41},{1,71},{1,30},{1,60},{1,41},{1,71}},
+        {{2,108},{2,128},{2,118},{2,135},{2,108},{2,128},{2,118},{2,135},{2,110},{2,130},{2,120},{2,137},{2,110},{2,130},{2,120},{2,137},{3,121},{3,139},{3,123},{3,140},{3,121},{3,139},{3,123},{3,140},{3,121},{3,139},{3,123},{3,140},{3,121},{3,139},{3,123},{3,140},{2,108},{2,128},{2,118},{2,135},{2,108},{2,128},{2,118},{2,135},{2,110},{2,130},{2,120},{2,137},{2,110},{2,130},{2,120},{2,137},{3,121},{3,139},{3,123},{3,140},{3,121},{3,139},{3,123},{3,140},{3,121},{3,139},{3,123},{3,140},{3,121},{3,139},{3,123},{3,140},{1,110},{1,151},{1,130},{1,168},{1,110},{1,151},{1,130},{1,168},{1,28},{1,58},{1,39},{1,69},{1,28},{1,58},{1,39},{1,69},{1,31},{1,61},{1,42},{1,72},{1,31},{1,61},{1,42},{1,72},{1,31},{1,61},{1,42},{1,72},{1,31},{1,61},{1,42},{1,72},{1,110},{1,151},{1,130},{1,168},{1,110},{1,151},{1,130},{1,168},{1,28},{1,58},{1,39},{1,69},{1,28},{1,58},{1,39},{1,69},{1,31},{1,61},{1,42},{1,72},{1,31},{1,61},{1,42},{1,72},{1,31},{1,61},{1,42},{1,72},{1,31},{1,61},{1,42},{1,72}},
+        {{2,108},{2,128},{2,118},{2,135},{2,113},{2,129},{2,119},{2,136},{2,110},{2,130},{2,120},{2,137},{2,28},{2,39},{2,29},{2,40},{3,121},{3,139},{3,123},{3,140},{3,34},{3,45},{3,35},{3,46},{3,121},{3,139},{3,123},{3,140},{3,34},{3,45},{3,35},{3,46},{2,108},{2,128},{2,118},{2,135},{2,113},{2,129},{2,119},{2,136},{2,110},{2,130},{2,120},{2,137},{2,28},{2,39},{2,29},{2,40},{3,121},{3,139},{3,123},{3,140},{3,34},{3,45},{3,35},{3,46},{3,121},{3,139},{3,123},{3,140},{3,34},{3,45},{3,35},{3,46},{1,110},{1,151},{1,130},{1,168},{1,120},{1,158},{1,137},{1,175},{1,28},{1,58},{1,39},{1,69},{1,29},{1,59},{1,40},{1,70},{1,31},{1,61},{1,42},{1,72},{1,32},{1,62},{1,43},{1,73},{1,31},{1,61},{1,42},{1,72},{1,32},{1,62},{1,43},{1,73},{1,110},{1,151},{1,130},{1,168},{1,120},{1,158},{1,137},{1,175},{1,28},{1,58},{1,39},{1,69},{1,29},{1,59},{1,40},{1,70},{1,31},{1,61},{1,42},{1,72},{1,32},{1,62},{1,43},{1,73},{1,31},{1,61},{1,42},{1,72},{1,32},{1,62},{1,43},{1,73}},
+        {{2,110},{2,130},{2,120},{2,137},{2,28},{2,39},{2,29},{2,40},{2,31},{2,42},{2,32},{2,43},{2,31},{2,42},{2,32},{2,43},{3,121},{3,139},{3,123},{3,140},{3,34},{3,45},{3,35},{3,46},{3,37},{3,48},{3,38},{3,49},{3,37},{3,48},{3,38},{3,49},{2,110},{2,130},{2,120},{2,137},{2,28},{2,39},{2,29},{2,40},{2,31},{2,42},{2,32},{2,43},{2,31},{2,42},{2,32},{2,43},{3,121},{3,139},{3,123},{3,140},{3,34},{3,45},{3,35},{3,46},{3,37},{3,48},{3,38},{3,49},{3,37},{3,48},{3,38},{3,49},{1,28},{1,58},{1,39},{1,69},{1,29},{1,59},{1,40},{1,70},{1,30},{1,60},{1,41},{1,71},{1,30},{1,60},{1,41},{1,71},{1,31},{1,61},{1,42},{1,72},{1,32},{1,62},{1,43},{1,73},{1,33},{1,63},{1,44},{1,74},{1,33},{1,63},{1,44},{1,74},{1,28},{1,58},{1,39},{1,69},{1,29},{1,59},{1,40},{1,70},{1,30},{1,60},{1,41},{1,71},{1,30},{1,60},{1,41},{1,71},{1,31},{1,61},{1,42},{1,72},{1,32},{1,62},{1,43},{1,73},{1,33},{1,63},{1,44},{1,74},{1,33},{1,63},{1,44},{1,74}},
+        {{0,108},{0,108},{0,149},{0,149},{0,128},{0,128},{0,166},{0,166},{0,108},{0,108},{0,149},{0,149},{0,128},{0,128},{0,166},{0,166},{0,113},{0,113},{0,150},{0,150},{0,129},{0,129},{0,167},{0,167},{0,113},{0,113},{0,150},{0,150},{0,129},{0,129},{0,167},{0,167},{0,110},{0,110},{0,151},{0,151},{0,130},{0,130},{0,168},{0,168},{0,110},{0,110},{0,151},{0,151},{0,130},{0,130},{0,168},{0,168},{0,28},{0,28},{0,58},{0,58},{0,39},{0,39},{0,69},{0,69},{0,28},{0,28},{0,58},{0,58},{0,39},{0,39},{0,69},{0,69},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,34},{1,34},{1,64},{1,64},{1,45},{1,45},{1,75},{1,75},{1,34},{1,34},{1,64},{1,64},{1,45},{1,45},{1,75},{1,75},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,34},{1,34},{1,64},{1,64},{1,45},{1,45},{1,75},{1,75},{1,34},{1,34},{1,64},{1,64},{1,45},{1,45},{1,75},{1,75}},
+        {{0,108},{0,108},{0,149},{0,149},{0,128},{0,128},{0,166},{0,166},{0,118},{0,118},{0,156},{0,156},{0,135},{0,135},{0,173},{0,173},{0,113},{0,113},{0,150},{0,150},{0,129},{0,129},{0,167},{0,167},{0,119},{0,119},{0,157},{0,157},{0,136},{0,136},{0,174},{0,174},{0,110},{0,110},{0,151},{0,151},{0,130},{0,130},{0,168},{0,168},{0,120},{0,120},{0,158},{0,158},{0,137},{0,137},{0,175},{0,175},{0,28},{0,28},{0,58},{0,58},{0,39},{0,39},{0,69},{0,69},{0,29},{0,29},{0,59},{0,59},{0,40},{0,40},{0,70},{0,70},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,123},{1,123},{1,161},{1,161},{1,140},{1,140},{1,178},{1,178},{1,34},{1,34},{1,64},{1,64},{1,45},{1,45},{1,75},{1,75},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,123},{1,123},{1,161},{1,161},{1,140},{1,140},{1,178},{1,178},{1,34},{1,34},{1,64},{1,64},{1,45},{1,45},{1,75},{1,75},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76}},
+        {{0,28},{0,28},{0,58},{0,58},{0,39},{0,39},{0,69},{0,69},{0,29},{0,29},{0,59},{0,59},{0,40},{0,40},{0,70},{0,70},{0,30},{0,30},{0,60},{0,60},{0,41},{0,41},{0,71},{0,71},{0,30},{0,30},{0,60},{0,60},{0,41},{0,41},{0,71},{0,71},{0,28},{0,28},{0,58},{0,58},{0,39},{0,39},{0,69},{0,69},{0,29},{0,29},{0,59},{0,59},{0,40},{0,40},{0,70},{0,70},{0,30},{0,30},{0,60},{0,60},{0,41},{0,41},{0,71},{0,71},{0,30},{0,30},{0,60},{0,60},{0,41},{0,41},{0,71},{0,71},{1,34},{1,34},{1,64},{1,64},{1,45},{1,45},{1,75},{1,75},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,36},{1,36},{1,66},{1,66},{1,47},{1,47},{1,77},{1,77},{1,36},{1,36},{1,66},{1,66},{1,47},{1,47},{1,77},{1,77},{1,34},{1,34},{1,64},{1,64},{1,45},{1,45},{1,75},{1,75},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,36},{1,36},{1,66},{1,66},{1,47},{1,47},{1,77},{1,77},{1,36},{1,36},{1,66},{1,66},{1,47},{1,47},{1,77},{1,77}},
+        {{0,110},{0,110},{0,151},{0,151},{0,130},{0,130},{0,168},{0,168},{0,110},{0,110},{0,151},{0,151},{0,130},{0,130},{0,168},{0,168},{0,28},{0,28},{0,58},{0,58},{0,39},{0,39},{0,69},{0,69},{0,28},{0,28},{0,58},{0,58},{0,39},{0,39},{0,69},{0,69},{0,31},{0,31},{0,61},{0,61},{0,42},{0,42},{0,72},{0,72},{0,31},{0,31},{0,61},{0,61},{0,42},{0,42},{0,72},{0,72},{0,31},{0,31},{0,61},{0,61},{0,42},{0,42},{0,72},{0,72},{0,31},{0,31},{0,61},{0,61},{0,42},{0,42},{0,72},{0,72},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,34},{1,34},{1,64},{1,64},{1,45},{1,45},{1,75},{1,75},{1,34},{1,34},{1,64},{1,64},{1,45},{1,45},{1,75},{1,75},{1,37},{1,37},{1,67},{1,67},{1,48},{1,48},{1,78},{1,78},{1,37},{1,37},{1,67},{1,67},{1,48},{1,48},{1,78},{1,78},{1,37},{1,37},{1,67},{1,67},{1,48},{1,48},{1,78},{1,78},{1,37},{1,37},{1,67},{1,67},{1,48},{1,48},{1,78},{1,78}},
+        {{0,110},{0,110},{0,151},{0,151},{0,130},{0,130},{0,168},{0,168},{0,120},{0,120},{0,158},{0,158},{0,137},{0,137},{0,175},{0,175},{0,28},{0,28},{0,58},{0,58},{0,39},{0,39},{0,69},{0,69},{0,29},{0,29},{0,59},{0,59},{0,40},{0,40},{0,70},{0,70},{0,31},{0,31},{0,61},{0,61},{0,42},{0,42},{0,72},{0,72},{0,32},{0,32},{0,62},{0,62},{0,43},{0,43},{0,73},{0,73},{0,31},{0,31},{0,61},{0,61},{0,42},{0,42},{0,72},{0,72},{0,32},{0,32},{0,62},{0,62},{0,43},{0,43},{0,73},{0,73},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,123},{1,123},{1,161},{1,161},{1,140},{1,140},{1,178},{1,178},{1,34},{1,34},{1,64},{1,64},{1,45},{1,45},{1,75},{1,75},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,37},{1,37},{1,67},{1,67},{1,48},{1,48},{1,78},{1,78},{1,38},{1,38},{1,68},{1,68},{1,49},{1,49},{1,79},{1,79},{1,37},{1,37},{1,67},{1,67},{1,48},{1,48},{1,78},{1,78},{1,38},{1,38},{1,68},{1,68},{1,49},{1,49},{1,79},{1,79}},
+        {{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{3,110},{3,120},{3,28},{3,29},{3,31},{3,32},{3,31},{3,32},{3,110},{3,120},{3,28},{3,29},{3,31},{3,32},{3,31},{3,32},{2,112},{2,127},{2,117},{2,134},{2,122},{2,138},{2,122},{2,138},{2,112},{2,127},{2,117},{2,134},{2,122},{2,138},{2,122},{2,138},{2,28},{2,39},{2,29},{2,40},{2,30},{2,41},{2,30},{2,41},{2,28},{2,39},{2,29},{2,40},{2,30},{2,41},{2,30},{2,41},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,117},{1,155},{1,134},{1,172},{1,142},{1,180},{1,142},{1,180},{1,117},{1,155},{1,134},{1,172},{1,142},{1,180},{1,142},{1,180},{1,119},{1,157},{1,136},{1,174},{1,143},{1,181},{1,143},{1,181},{1,119},{1,157},{1,136},{1,174},{1,143},{1,181},{1,143},{1,181},{1,29},{1,59},{1,40},{1,70},{1,50},{1,80},{1,50},{1,80},{1,29},{1,59},{1,40},{1,70},{1,50},{1,80},{1,50},{1,80}},
+        {{3,110},{3,120},{3,28},{3,29},{3,31},{3,32},{3,31},{3,32},{4,121},{4,123},{4,34},{4,35},{4,37},{4,38},{4,37},{4,38},{3,110},{3,120},{3,28},{3,29},{3,31},{3,32},{3,31},{3,32},{4,121},{4,123},{4,34},{4,35},{4,37},{4,38},{4,37},{4,38},{2,28},{2,39},{2,29},{2,40},{2,30},{2,41},{2,30},{2,41},{2,31},{2,42},{2,32},{2,43},{2,33},{2,44},{2,33},{2,44},{2,28},{2,39},{2,29},{2,40},{2,30},{2,41},{2,30},{2,41},{2,31},{2,42},{2,32},{2,43},{2,33},{2,44},{2,33},{2,44},{1,117},{1,155},{1,134},{1,172},{1,142},{1,180},{1,142},{1,180},{1,122},{1,159},{1,138},{1,176},{1,144},{1,182},{1,144},{1,182},{1,117},{1,155},{1,134},{1,172},{1,142},{1,180},{1,142},{1,180},{1,122},{1,159},{1,138},{1,176},{1,144},{1,182},{1,144},{1,182},{1,29},{1,59},{1,40},{1,70},{1,50},{1,80},{1,50},{1,80},{1,30},{1,60},{1,41},{1,71},{1,51},{1,81},{1,51},{1,81},{1,29},{1,59},{1,40},{1,70},{1,50},{1,80},{1,50},{1,80},{1,30},{1,60},{1,41},{1,71},{1,51},{1,81},{1,51},{1,81}},
+        {{2,28},{2,39},{2,29},{2,40},{2,30},{2,41},{2,30},{2,41},{2,28},{2,39},{2,29},{2,40},{2,30},{2,41},{2,30},{2,41},{3,34},{3,45},{3,35},{3,46},{3,36},{3,47},{3,36},{3,47},{3,34},{3,45},{3,35},{3,46},{3,36},{3,47},{3,36},{3,47},{2,28},{2,39},{2,29},{2,40},{2,30},{2,41},{2,30},{2,41},{2,28},{2,39},{2,29},{2,40},{2,30},{2,41},{2,30},{2,41},{3,34},{3,45},{3,35},{3,46},{3,36},{3,47},{3,36},{3,47},{3,34},{3,45},{3,35},{3,46},{3,36},{3,47},{3,36},{3,47},{1,29},{1,59},{1,40},{1,70},{1,50},{1,80},{1,50},{1,80},{1,29},{1,59},{1,40},{1,70},{1,50},{1,80},{1,50},{1,80},{1,32},{1,62},{1,43},{1,73},{1,52},{1,82},{1,52},{1,82},{1,32},{1,62},{1,43},{1,73},{1,52},{1,82},{1,52},{1,82},{1,29},{1,59},{1,40},{1,70},{1,50},{1,80},{1,50},{1,80},{1,29},{1,59},{1,40},{1,70},{1,50},{1,80},{1,50},{1,80},{1,32},{1,62},{1,43},{1,73},{1,52},{1,82},{1,52},{1,82},{1,32},{1,62},{1,43},{1,73},{1,52},{1,82},{1,52},{1,82}},
+        {{2,28},{2,39},{2,29},{2,40},{2,30},{2,41},{2,30},{2,41},{2,31},{2,42},{2,32},{2,43},{2,33},{2,44},{2,33},{2,44},{3,34},{3,45},{3,35},{3,46},{3,36},{3,47},{3,36},{3,47},{3,37},{3,48},{3,38},{3,49},{3,6},{3,7},{3,6},{3,7},{2,28},{2,39},{2,29},{2,40},{2,30},{2,41},{2,30},{2,41},{2,31},{2,42},{2,32},{2,43},{2,33},{2,44},{2,33},{2,44},{3,34},{3,45},{3,35},{3,46},{3,36},{3,47},{3,36},{3,47},{3,37},{3,48},{3,38},{3,49},{3,6},{3,7},{3,6},{3,7},{1,29},{1,59},{1,40},{1,70},{1,50},{1,80},{1,50},{1,80},{1,30},{1,60},{1,41},{1,71},{1,51},{1,81},{1,51},{1,81},{1,32},{1,62},{1,43},{1,73},{1,52},{1,82},{1,52},{1,82},{1,33},{1,63},{1,44},{1,74},{1,53},{1,83},{1,53},{1,83},{1,29},{1,59},{1,40},{1,70},{1,50},{1,80},{1,50},{1,80},{1,30},{1,60},{1,41},{1,71},{1,51},{1,81},{1,51},{1,81},{1,32},{1,62},{1,43},{1,73},{1,52},{1,82},{1,52},{1,82},{1,33},{1,63},{1,44},{1,74},{1,53},{1,83},{1,53},{1,83}},
+        {{0,119},{0,119},{0,157},{0,157},{0,136},{0,136},{0,174},{0,174},{0,143},{0,143},{0,181},{0,181},{0,143},{0,143},{0,181},{0,181},{0,119},{0,119},{0,157},{0,157},{0,136},{0,136},{0,174},{0,174},{0,143},{0,143},{0,181},{0,181},{0,143},{0,143},{0,181},{0,181},{0,29},{0,29},{0,59},{0,59},{0,40},{0,40},{0,70},{0,70},{0,50},{0,50},{0,80},{0,80},{0,50},{0,50},{0,80},{0,80},{0,29},{0,29},{0,59},{0,59},{0,40},{0,40},{0,70},{0,70},{0,50},{0,50},{0,80},{0,80},{0,50},{0,50},{0,80},{0,80},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,54},{1,54},{1,84},{1,84},{1,54},{1,54},{1,84},{1,84},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,54},{1,54},{1,84},{1,84},{1,54},{1,54},{1,84},{1,84},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,54},{1,54},{1,84},{1,84},{1,54},{1,54},{1,84},{1,84},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,54},{1,54},{1,84},{1,84},{1,54},{1,54},{1,84},{1,84}},
+        {{0,29},{0,29},{0,59},{0,59},{0,40},{0,40},{0,70},{0,70},{0,50},{0,50},{0,80},{0,80},{0,50},{0,50},{0,80},{0,80},{0,30},{0,30},{0,60},{0,60},{0,41},{0,41},{0,71},{0,71},{0,51},{0,51},{0,81},{0,81},{0,51},{0,51},{0,81},{0,81},{0,29},{0,29},{0,59},{0,59},{0,40},{0,40},{0,70},{0,70},{0,50},{0,50},{0,80},{0,80},{0,50},{0,50},{0,80},{0,80},{0,30},{0,30},{0,60},{0,60},{0,41},{0,41},{0,71},{0,71},{0,51},{0,51},{0,81},{0,81},{0,51},{0,51},{0,81},{0,81},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,54},{1,54},{1,84},{1,84},{1,54},{1,54},{1,84},{1,84},{1,36},{1,36},{1,66},{1,66},{1,47},{1,47},{1,77},{1,77},{1,55},{1,55},{1,85},{1,85},{1,55},{1,55},{1,85},{1,85},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,54},{1,54},{1,84},{1,84},{1,54},{1,54},{1,84},{1,84},{1,36},{1,36},{1,66},{1,66},{1,47},{1,47},{1,77},{1,77},{1,55},{1,55},{1,85},{1,85},{1,55},{1,55},{1,85},{1,85}},
+        {{0,29},{0,29},{0,59},{0,59},{0,40},{0,40},{0,70},{0,70},{0,50},{0,50},{0,80},{0,80},{0,50},{0,50},{0,80},{0,80},{0,29},{0,29},{0,59},{0,59},{0,40},{0,40},{0,70},{0,70},{0,50},{0,50},{0,80},{0,80},{0,50},{0,50},{0,80},{0,80},{0,32},{0,32},{0,62},{0,62},{0,43},{0,43},{0,73},{0,73},{0,52},{0,52},{0,82},{0,82},{0,52},{0,52},{0,82},{0,82},{0,32},{0,32},{0,62},{0,62},{0,43},{0,43},{0,73},{0,73},{0,52},{0,52},{0,82},{0,82},{0,52},{0,52},{0,82},{0,82},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,54},{1,54},{1,84},{1,84},{1,54},{1,54},{1,84},{1,84},{1,35},{1,35},{1,65},{1,65},{1,46},{1,46},{1,76},{1,76},{1,54},{1,54},{1,84},{1,84},{1,54},{1,54},{1,84},{1,84},{1,38},{1,38},{1,68},{1,68},{1,49},{1,49},{1,79},{1,79},{1,56},{1,56},{1,86},{1,86},{1,56},{1,56},{1,86},{1,86},{1,38},{1,38},{1,68},{1,68},{1,49},{1,49},{1,79},{1,79},{1,56},{1,56},{1,86},{1,86},{1,56},{1,56},{1,86},{1,86}},
+        {{3,37},{3,48},{3,38},{3,49},{3,6},{3,7},{3,6},{3,7},{4,10},{4,11},{4,10},{4,11},{4,10},{4,11},{4,10},{4,11},{3,37},{3,48},{3,38},{3,49},{3,6},{3,7},{3,6},{3,7},{4,10},{4,11},{4,10},{4,11},{4,10},{4,11},{4,10},{4,11},{3,37},{3,48},{3,38},{3,49},{3,6},{3,7},{3,6},{3,7},{4,10},{4,11},{4,10},{4,11},{4,10},{4,11},{4,10},{4,11},{3,37},{3,48},{3,38},{3,49},{3,6},{3,7},{3,6},{3,7},{4,10},{4,11},{4,10},{4,11},{4,10},{4,11},{4,10},{4,11},{1,33},{1,63},{1,44},{1,74},{1,53},{1,83},{1,53},{1,83},{1,57},{1,87},{1,57},{1,87},{1,57},{1,87},{1,57},{1,87},{1,33},{1,63},{1,44},{1,74},{1,53},{1,83},{1,53},{1,83},{1,57},{1,87},{1,57},{1,87},{1,57},{1,87},{1,57},{1,87},{1,33},{1,63},{1,44},{1,74},{1,53},{1,83},{1,53},{1,83},{1,57},{1,87},{1,57},{1,87},{1,57},{1,87},{1,57},{1,87},{1,33},{1,63},{1,44},{1,74},{1,53},{1,83},{1,53},{1,83},{1,57},{1,87},{1,57},{1,87},{1,57},{1,87},{1,57},{1,87}},
+        {{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{4,110},{4,28},{4,31},{4,31},{4,110},{4,28},{4,31},{4,31},{3,112},{3,117},{3,122},{3,122},{3,112},{3,117},{3,122},{3,122},{3,28},{3,29},{3,30},{3,30},{3,28},{3,29},{3,30},{3,30},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{2,117},{2,134},{2,142},{2,142},{2,117},{2,134},{2,142},{2,142},{2,119},{2,136},{2,143},{2,143},{2,119},{2,136},{2,143},{2,143},{2,29},{2,40},{2,50},{2,50},{2,29},{2,40},{2,50},{2,50},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,132},{1,170},{1,184},{1,184},{1,132},{1,170},{1,184},{1,184},{1,133},{1,171},{1,185},{1,185},{1,133},{1,171},{1,185},{1,185},{1,134},{1,172},{1,186},{1,186},{1,134},{1,172},{1,186},{1,186},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187},{1,136},{1,174},{1,188},{1,188},{1,136},{1,174},{1,188},{1,188},{1,137},{1,175},{1,189},{1,189},{1,137},{1,175},{1,189},{1,189},{1,40},{1,70},{1,88},{1,88},{1,40},{1,70},{1,88},{1,88}},
+        {{3,28},{3,29},{3,30},{3,30},{3,28},{3,29},{3,30},{3,30},{4,34},{4,35},{4,36},{4,36},{4,34},{4,35},{4,36},{4,36},{3,28},{3,29},{3,30},{3,30},{3,28},{3,29},{3,30},{3,30},{4,34},{4,35},{4,36},{4,36},{4,34},{4,35},{4,36},{4,36},{2,29},{2,40},{2,50},{2,50},{2,29},{2,40},{2,50},{2,50},{2,32},{2,43},{2,52},{2,52},{2,32},{2,43},{2,52},{2,52},{2,29},{2,40},{2,50},{2,50},{2,29},{2,40},{2,50},{2,50},{2,32},{2,43},{2,52},{2,52},{2,32},{2,43},{2,52},{2,52},{1,134},{1,172},{1,186},{1,186},{1,134},{1,172},{1,186},{1,186},{1,138},{1,176},{1,190},{1,190},{1,138},{1,176},{1,190},{1,190},{1,134},{1,172},{1,186},{1,186},{1,134},{1,172},{1,186},{1,186},{1,138},{1,176},{1,190},{1,190},{1,138},{1,176},{1,190},{1,190},{1,40},{1,70},{1,88},{1,88},{1,40},{1,70},{1,88},{1,88},{1,41},{1,71},{1,89},{1,89},{1,41},{1,71},{1,89},{1,89},{1,40},{1,70},{1,88},{1,88},{1,40},{1,70},{1,88},{1,88},{1,41},{1,71},{1,89},{1,89},{1,41},{1,71},{1,89},{1,89}},
+        {{2,119},{2,136},{2,143},{2,143},{2,119},{2,136},{2,143},{2,143},{2,29},{2,40},{2,50},{2,50},{2,29},{2,40},{2,50},{2,50},{3,35},{3,46},{3,54},{3,54},{3,35},{3,46},{3,54},{3,54},{3,35},{3,46},{3,54},{3,54},{3,35},{3,46},{3,54},{3,54},{2,119},{2,136},{2,143},{2,143},{2,119},{2,136},{2,143},{2,143},{2,29},{2,40},{2,50},{2,50},{2,29},{2,40},{2,50},{2,50},{3,35},{3,46},{3,54},{3,54},{3,35},{3,46},{3,54},{3,54},{3,35},{3,46},{3,54},{3,54},{3,35},{3,46},{3,54},{3,54},{1,137},{1,175},{1,189},{1,189},{1,137},{1,175},{1,189},{1,189},{1,40},{1,70},{1,88},{1,88},{1,40},{1,70},{1,88},{1,88},{1,43},{1,73},{1,90},{1,90},{1,43},{1,73},{1,90},{1,90},{1,43},{1,73},{1,90},{1,90},{1,43},{1,73},{1,90},{1,90},{1,137},{1,175},{1,189},{1,189},{1,137},{1,175},{1,189},{1,189},{1,40},{1,70},{1,88},{1,88},{1,40},{1,70},{1,88},{1,88},{1,43},{1,73},{1,90},{1,90},{1,43},{1,73},{1,90},{1,90},{1,43},{1,73},{1,90},{1,90},{1,43},{1,73},{1,90},{1,90}},
+        {{2,29},{2,40},{2,50},{2,50},{2,29},{2,40},{2,50},{2,50},{2,32},{2,43},{2,52},{2,52},{2,32},{2,43},{2,52},{2,52},{3,35},{3,46},{3,54},{3,54},{3,35},{3,46},{3,54},{3,54},{3,38},{3,49},{3,56},{3,56},{3,38},{3,49},{3,56},{3,56},{2,29},{2,40},{2,50},{2,50},{2,29},{2,40},{2,50},{2,50},{2,32},{2,43},{2,52},{2,52},{2,32},{2,43},{2,52},{2,52},{3,35},{3,46},{3,54},{3,54},{3,35},{3,46},{3,54},{3,54},{3,38},{3,49},{3,56},{3,56},{3,38},{3,49},{3,56},{3,56},{1,40},{1,70},{1,88},{1,88},{1,40},{1,70},{1,88},{1,88},{1,41},{1,71},{1,89},{1,89},{1,41},{1,71},{1,89},{1,89},{1,43},{1,73},{1,90},{1,90},{1,43},{1,73},{1,90},{1,90},{1,44},{1,74},{1,91},{1,91},{1,44},{1,74},{1,91},{1,91},{1,40},{1,70},{1,88},{1,88},{1,40},{1,70},{1,88},{1,88},{1,41},{1,71},{1,89},{1,89},{1,41},{1,71},{1,89},{1,89},{1,43},{1,73},{1,90},{1,90},{1,43},{1,73},{1,90},{1,90},{1,44},{1,74},{1,91},{1,91},{1,44},{1,74},{1,91},{1,91}},
+        {{0,135},{0,135},{0,173},{0,173},{0,187},{0,187},{0,187},{0,187},{0,135},{0,135},{0,173},{0,173},{0,187},{0,187},{0,187},{0,187},{0,136},{0,136},{0,174},{0,174},{0,188},{0,188},{0,188},{0,188},{0,136},{0,136},{0,174},{0,174},{0,188},{0,188},{0,188},{0,188},{0,137},{0,137},{0,175},{0,175},{0,189},{0,189},{0,189},{0,189},{0,137},{0,137},{0,175},{0,175},{0,189},{0,189},{0,189},{0,189},{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92}},
+        {{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,41},{0,41},{0,71},{0,71},{0,89},{0,89},{0,89},{0,89},{0,41},{0,41},{0,71},{0,71},{0,89},{0,89},{0,89},{0,89},{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,41},{0,41},{0,71},{0,71},{0,89},{0,89},{0,89},{0,89},{0,41},{0,41},{0,71},{0,71},{0,89},{0,89},{0,89},{0,89},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,47},{1,47},{1,77},{1,77},{1,93},{1,93},{1,93},{1,93},{1,47},{1,47},{1,77},{1,77},{1,93},{1,93},{1,93},{1,93},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,47},{1,47},{1,77},{1,77},{1,93},{1,93},{1,93},{1,93},{1,47},{1,47},{1,77},{1,77},{1,93},{1,93},{1,93},{1,93}},
+        {{0,137},{0,137},{0,175},{0,175},{0,189},{0,189},{0,189},{0,189},{0,137},{0,137},{0,175},{0,175},{0,189},{0,189},{0,189},{0,189},{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,43},{0,43},{0,73},{0,73},{0,90},{0,90},{0,90},{0,90},{0,43},{0,43},{0,73},{0,73},{0,90},{0,90},{0,90},{0,90},{0,43},{0,43},{0,73},{0,73},{0,90},{0,90},{0,90},{0,90},{0,43},{0,43},{0,73},{0,73},{0,90},{0,90},{0,90},{0,90},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,49},{1,49},{1,79},{1,79},{1,94},{1,94},{1,94},{1,94},{1,49},{1,49},{1,79},{1,79},{1,94},{1,94},{1,94},{1,94},{1,49},{1,49},{1,79},{1,79},{1,94},{1,94},{1,94},{1,94},{1,49},{1,49},{1,79},{1,79},{1,94},{1,94},{1,94},{1,94}},
+        {{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{3,28},{3,29},{3,30},{3,30},{3,31},{3,32},{3,33},{3,33},{3,28},{3,29},{3,30},{3,30},{3,31},{3,32},{3,33},{3,33},{2,117},{2,134},{2,142},{2,142},{2,122},{2,138},{2,144},{2,144},{2,117},{2,134},{2,142},{2,142},{2,122},{2,138},{2,144},{2,144},{2,29},{2,40},{2,50},{2,50},{2,30},{2,41},{2,51},{2,51},{2,29},{2,40},{2,50},{2,50},{2,30},{2,41},{2,51},{2,51},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,134},{1,172},{1,186},{1,186},{1,142},{1,180},{1,193},{1,193},{1,134},{1,172},{1,186},{1,186},{1,142},{1,180},{1,193},{1,193},{1,136},{1,174},{1,188},{1,188},{1,143},{1,181},{1,194},{1,194},{1,136},{1,174},{1,188},{1,188},{1,143},{1,181},{1,194},{1,194},{1,40},{1,70},{1,88},{1,88},{1,50},{1,80},{1,95},{1,95},{1,40},{1,70},{1,88},{1,88},{1,50},{1,80},{1,95},{1,95}},
+        {{3,28},{3,29},{3,30},{3,30},{3,31},{3,32},{3,33},{3,33},{4,34},{4,35},{4,36},{4,36},{4,37},{4,38},{4,6},{4,6},{3,28},{3,29},{3,30},{3,30},{3,31},{3,32},{3,33},{3,33},{4,34},{4,35},{4,36},{4,36},{4,37},{4,38},{4,6},{4,6},{2,29},{2,40},{2,50},{2,50},{2,30},{2,41},{2,51},{2,51},{2,32},{2,43},{2,52},{2,52},{2,33},{2,44},{2,53},{2,53},{2,29},{2,40},{2,50},{2,50},{2,30},{2,41},{2,51},{2,51},{2,32},{2,43},{2,52},{2,52},{2,33},{2,44},{2,53},{2,53},{1,134},{1,172},{1,186},{1,186},{1,142},{1,180},{1,193},{1,193},{1,138},{1,176},{1,190},{1,190},{1,144},{1,182},{1,195},{1,195},{1,134},{1,172},{1,186},{1,186},{1,142},{1,180},{1,193},{1,193},{1,138},{1,176},{1,190},{1,190},{1,144},{1,182},{1,195},{1,195},{1,40},{1,70},{1,88},{1,88},{1,50},{1,80},{1,95},{1,95},{1,41},{1,71},{1,89},{1,89},{1,51},{1,81},{1,96},{1,96},{1,40},{1,70},{1,88},{1,88},{1,50},{1,80},{1,95},{1,95},{1,41},{1,71},{1,89},{1,89},{1,51},{1,81},{1,96},{1,96}},
+        {{2,29},{2,40},{2,50},{2,50},{2,30},{2,41},{2,51},{2,51},{2,29},{2,40},{2,50},{2,50},{2,30},{2,41},{2,51},{2,51},{3,35},{3,46},{3,54},{3,54},{3,36},{3,47},{3,55},{3,55},{3,35},{3,46},{3,54},{3,54},{3,36},{3,47},{3,55},{3,55},{2,29},{2,40},{2,50},{2,50},{2,30},{2,41},{2,51},{2,51},{2,29},{2,40},{2,50},{2,50},{2,30},{2,41},{2,51},{2,51},{3,35},{3,46},{3,54},{3,54},{3,36},{3,47},{3,55},{3,55},{3,35},{3,46},{3,54},{3,54},{3,36},{3,47},{3,55},{3,55},{1,40},{1,70},{1,88},{1,88},{1,50},{1,80},{1,95},{1,95},{1,40},{1,70},{1,88},{1,88},{1,50},{1,80},{1,95},{1,95},{1,43},{1,73},{1,90},{1,90},{1,52},{1,82},{1,97},{1,97},{1,43},{1,73},{1,90},{1,90},{1,52},{1,82},{1,97},{1,97},{1,40},{1,70},{1,88},{1,88},{1,50},{1,80},{1,95},{1,95},{1,40},{1,70},{1,88},{1,88},{1,50},{1,80},{1,95},{1,95},{1,43},{1,73},{1,90},{1,90},{1,52},{1,82},{1,97},{1,97},{1,43},{1,73},{1,90},{1,90},{1,52},{1,82},{1,97},{1,97}},
+        {{2,29},{2,40},{2,50},{2,50},{2,30},{2,41},{2,51},{2,51},{2,32},{2,43},{2,52},{2,52},{2,33},{2,44},{2,53},{2,53},{3,35},{3,46},{3,54},{3,54},{3,36},{3,47},{3,55},{3,55},{3,38},{3,49},{3,56},{3,56},{3,6},{3,7},{3,8},{3,8},{2,29},{2,40},{2,50},{2,50},{2,30},{2,41},{2,51},{2,51},{2,32},{2,43},{2,52},{2,52},{2,33},{2,44},{2,53},{2,53},{3,35},{3,46},{3,54},{3,54},{3,36},{3,47},{3,55},{3,55},{3,38},{3,49},{3,56},{3,56},{3,6},{3,7},{3,8},{3,8},{1,40},{1,70},{1,88},{1,88},{1,50},{1,80},{1,95},{1,95},{1,41},{1,71},{1,89},{1,89},{1,51},{1,81},{1,96},{1,96},{1,43},{1,73},{1,90},{1,90},{1,52},{1,82},{1,97},{1,97},{1,44},{1,74},{1,91},{1,91},{1,53},{1,83},{1,98},{1,98},{1,40},{1,70},{1,88},{1,88},{1,50},{1,80},{1,95},{1,95},{1,41},{1,71},{1,89},{1,89},{1,51},{1,81},{1,96},{1,96},{1,43},{1,73},{1,90},{1,90},{1,52},{1,82},{1,97},{1,97},{1,44},{1,74},{1,91},{1,91},{1,53},{1,83},{1,98},{1,98}},
+        {{0,136},{0,136},{0,174},{0,174},{0,188},{0,188},{0,188},{0,188},{0,143},{0,143},{0,181},{0,181},{0,194},{0,194},{0,194},{0,194},{0,136},{0,136},{0,174},{0,174},{0,188},{0,188},{0,188},{0,188},{0,143},{0,143},{0,181},{0,181},{0,194},{0,194},{0,194},{0,194},{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,50},{0,50},{0,80},{0,80},{0,95},{0,95},{0,95},{0,95},{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,50},{0,50},{0,80},{0,80},{0,95},{0,95},{0,95},{0,95},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,54},{1,54},{1,84},{1,84},{1,99},{1,99},{1,99},{1,99},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,54},{1,54},{1,84},{1,84},{1,99},{1,99},{1,99},{1,99},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,54},{1,54},{1,84},{1,84},{1,99},{1,99},{1,99},{1,99},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,54},{1,54},{1,84},{1,84},{1,99},{1,99},{1,99},{1,99}},
+        {{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,50},{0,50},{0,80},{0,80},{0,95},{0,95},{0,95},{0,95},{0,41},{0,41},{0,71},{0,71},{0,89},{0,89},{0,89},{0,89},{0,51},{0,51},{0,81},{0,81},{0,96},{0,96},{0,96},{0,96},{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,50},{0,50},{0,80},{0,80},{0,95},{0,95},{0,95},{0,95},{0,41},{0,41},{0,71},{0,71},{0,89},{0,89},{0,89},{0,89},{0,51},{0,51},{0,81},{0,81},{0,96},{0,96},{0,96},{0,96},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,54},{1,54},{1,84},{1,84},{1,99},{1,99},{1,99},{1,99},{1,47},{1,47},{1,77},{1,77},{1,93},{1,93},{1,93},{1,93},{1,55},{1,55},{1,85},{1,85},{1,100},{1,100},{1,100},{1,100},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,54},{1,54},{1,84},{1,84},{1,99},{1,99},{1,99},{1,99},{1,47},{1,47},{1,77},{1,77},{1,93},{1,93},{1,93},{1,93},{1,55},{1,55},{1,85},{1,85},{1,100},{1,100},{1,100},{1,100}},
+        {{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,50},{0,50},{0,80},{0,80},{0,95},{0,95},{0,95},{0,95},{0,40},{0,40},{0,70},{0,70},{0,88},{0,88},{0,88},{0,88},{0,50},{0,50},{0,80},{0,80},{0,95},{0,95},{0,95},{0,95},{0,43},{0,43},{0,73},{0,73},{0,90},{0,90},{0,90},{0,90},{0,52},{0,52},{0,82},{0,82},{0,97},{0,97},{0,97},{0,97},{0,43},{0,43},{0,73},{0,73},{0,90},{0,90},{0,90},{0,90},{0,52},{0,52},{0,82},{0,82},{0,97},{0,97},{0,97},{0,97},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,54},{1,54},{1,84},{1,84},{1,99},{1,99},{1,99},{1,99},{1,46},{1,46},{1,76},{1,76},{1,92},{1,92},{1,92},{1,92},{1,54},{1,54},{1,84},{1,84},{1,99},{1,99},{1,99},{1,99},{1,49},{1,49},{1,79},{1,79},{1,94},{1,94},{1,94},{1,94},{1,56},{1,56},{1,86},{1,86},{1,101},{1,101},{1,101},{1,101},{1,49},{1,49},{1,79},{1,79},{1,94},{1,94},{1,94},{1,94},{1,56},{1,56},{1,86},{1,86},{1,101},{1,101},{1,101},{1,101}},
+        {{3,38},{3,49},{3,56},{3,56},{3,6},{3,7},{3,8},{3,8},{4,10},{4,11},{4,12},{4,12},{4,10},{4,11},{4,12},{4,12},{3,38},{3,49},{3,56},{3,56},{3,6},{3,7},{3,8},{3,8},{4,10},{4,11},{4,12},{4,12},{4,10},{4,11},{4,12},{4,12},{3,38},{3,49},{3,56},{3,56},{3,6},{3,7},{3,8},{3,8},{4,10},{4,11},{4,12},{4,12},{4,10},{4,11},{4,12},{4,12},{3,38},{3,49},{3,56},{3,56},{3,6},{3,7},{3,8},{3,8},{4,10},{4,11},{4,12},{4,12},{4,10},{4,11},{4,12},{4,12},{1,44},{1,74},{1,91},{1,91},{1,53},{1,83},{1,98},{1,98},{1,57},{1,87},{1,102},{1,102},{1,57},{1,87},{1,102},{1,102},{1,44},{1,74},{1,91},{1,91},{1,53},{1,83},{1,98},{1,98},{1,57},{1,87},{1,102},{1,102},{1,57},{1,87},{1,102},{1,102},{1,44},{1,74},{1,91},{1,91},{1,53},{1,83},{1,98},{1,98},{1,57},{1,87},{1,102},{1,102},{1,57},{1,87},{1,102},{1,102},{1,44},{1,74},{1,91},{1,91},{1,53},{1,83},{1,98},{1,98},{1,57},{1,87},{1,102},{1,102},{1,57},{1,87},{1,102},{1,102}},
+        {{4,37},{4,38},{4,6},{4,6},{5,10},{5,10},{5,10},{5,10},{4,37},{4,38},{4,6},{4,6},{5,10},{5,10},{5,10},{5,10},{4,37},{4,38},{4,6},{4,6},{5,10},{5,10},{5,10},{5,10},{4,37},{4,38},{4,6},{4,6},{5,10},{5,10},{5,10},{5,10},{2,33},{2,44},{2,53},{2,53},{2,57},{2,57},{2,57},{2,57},{2,33},{2,44},{2,53},{2,53},{2,57},{2,57},{2,57},{2,57},{2,33},{2,44},{2,53},{2,53},{2,57},{2,57},{2,57},{2,57},{2,33},{2,44},{2,53},{2,53},{2,57},{2,57},{2,57},{2,57},{1,144},{1,182},{1,195},{1,195},{1,196},{1,196},{1,196},{1,196},{1,144},{1,182},{1,195},{1,195},{1,196},{1,196},{1,196},{1,196},{1,144},{1,182},{1,195},{1,195},{1,196},{1,196},{1,196},{1,196},{1,144},{1,182},{1,195},{1,195},{1,196},{1,196},{1,196},{1,196},{1,51},{1,81},{1,96},{1,96},{1,103},{1,103},{1,103},{1,103},{1,51},{1,81},{1,96},{1,96},{1,103},{1,103},{1,103},{1,103},{1,51},{1,81},{1,96},{1,96},{1,103},{1,103},{1,103},{1,103},{1,51},{1,81},{1,96},{1,96},{1,103},{1,103},{1,103},{1,103}},
+        {{2,33},{2,44},{2,53},{2,53},{2,57},{2,57},{2,57},{2,57},{2,33},{2,44},{2,53},{2,53},{2,57},{2,57},{2,57},{2,57},{3,6},{3,7},{3,8},{3,8},{3,9},{3,9},{3,9},{3,9},{3,6},{3,7},{3,8},{3,8},{3,9},{3,9},{3,9},{3,9},{2,33},{2,44},{2,53},{2,53},{2,57},{2,57},{2,57},{2,57},{2,33},{2,44},{2,53},{2,53},{2,57},{2,57},{2,57},{2,57},{3,6},{3,7},{3,8},{3,8},{3,9},{3,9},{3,9},{3,9},{3,6},{3,7},{3,8},{3,8},{3,9},{3,9},{3,9},{3,9},{1,51},{1,81},{1,96},{1,96},{1,103},{1,103},{1,103},{1,103},{1,51},{1,81},{1,96},{1,96},{1,103},{1,103},{1,103},{1,103},{1,53},{1,83},{1,98},{1,98},{1,104},{1,104},{1,104},{1,104},{1,53},{1,83},{1,98},{1,98},{1,104},{1,104},{1,104},{1,104},{1,51},{1,81},{1,96},{1,96},{1,103},{1,103},{1,103},{1,103},{1,51},{1,81},{1,96},{1,96},{1,103},{1,103},{1,103},{1,103},{1,53},{1,83},{1,98},{1,98},{1,104},{1,104},{1,104},{1,104},{1,53},{1,83},{1,98},{1,98},{1,104},{1,104},{1,104},{1,104}},
+        {{0,51},{0,51},{0,81},{0,81},{0,96},{0,96},{0,96},{0,96},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,51},{0,51},{0,81},{0,81},{0,96},{0,96},{0,96},{0,96},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,51},{0,51},{0,81},{0,81},{0,96},{0,96},{0,96},{0,96},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,51},{0,51},{0,81},{0,81},{0,96},{0,96},{0,96},{0,96},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{0,103},{1,55},{1,55},{1,85},{1,85},{1,100},{1,100},{1,100},{1,100},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,55},{1,55},{1,85},{1,85},{1,100},{1,100},{1,100},{1,100},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,55},{1,55},{1,85},{1,85},{1,100},{1,100},{1,100},{1,100},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,55},{1,55},{1,85},{1,85},{1,100},{1,100},{1,100},{1,100},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105},{1,105}},
+        {{3,6},{3,7},{3,8},{3,8},{3,9},{3,9},{3,9},{3,9},{4,10},{4,11},{4,12},{4,12},{4,2},{4,2},{4,2},{4,2},{3,6},{3,7},{3,8},{3,8},{3,9},{3,9},{3,9},{3,9},{4,10},{4,11},{4,12},{4,12},{4,2},{4,2},{4,2},{4,2},{3,6},{3,7},{3,8},{3,8},{3,9},{3,9},{3,9},{3,9},{4,10},{4,11},{4,12},{4,12},{4,2},{4,2},{4,2},{4,2},{3,6},{3,7},{3,8},{3,8},{3,9},{3,9},{3,9},{3,9},{4,10},{4,11},{4,12},{4,12},{4,2},{4,2},{4,2},{4,2},{1,53},{1,83},{1,98},{1,98},{1,104},{1,104},{1,104},{1,104},{1,57},{1,87},{1,102},{1,102},{1,106},{1,106},{1,106},{1,106},{1,53},{1,83},{1,98},{1,98},{1,104},{1,104},{1,104},{1,104},{1,57},{1,87},{1,102},{1,102},{1,106},{1,106},{1,106},{1,106},{1,53},{1,83},{1,98},{1,98},{1,104},{1,104},{1,104},{1,104},{1,57},{1,87},{1,102},{1,102},{1,106},{1,106},{1,106},{1,106},{1,53},{1,83},{1,98},{1,98},{1,104},{1,104},{1,104},{1,104},{1,57},{1,87},{1,102},{1,102},{1,106},{1,106},{1,106},{1,106}},
+        {{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107}},
+        {{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108}},
+        {{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109}},
+        {{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{2,108},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110},{1,110}},
+        {{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111}},
+        {{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,108},{3,108},{3,108},{3,108},{3,108},{3,108},{3,108},{3,108},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,107},{3,108},{3,108},{3,108},{3,108},{3,108},{3,108},{3,108},{3,108},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,112},{1,112},{1,112},{1,112},{1,112},{1,112},{1,112},{1,112},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,109},{1,112},{1,112},{1,112},{1,112},{1,112},{1,112},{1,112},{1,112}},
+        {{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{4,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,109},{2,109},{2,109},{2,109},{2,109},{2,109},{2,109},{2,109},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,107},{2,109},{2,109},{2,109},{2,109},{2,109},{2,109},{2,109},{2,109},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,107},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,111},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,113},{1,113},{1,113},{1,113},{1,113},{1,113},{1,113},{1,113},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,108},{1,113},{1,113},{1,113},{1,113},{1,113},{1,113},{1,113},{1,113}},
+        {{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114}},
+        {{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{4,107},{4,107},{4,107},{4,107},{4,108},{4,108},{4,108},{4,108},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{4,107},{4,107},{4,107},{4,107},{4,108},{4,108},{4,108},{4,108},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{4,107},{4,107},{4,107},{4,107},{4,108},{4,108},{4,108},{4,108},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{4,107},{4,107},{4,107},{4,107},{4,108},{4,108},{4,108},{4,108},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,111},{1,111},{1,111},{1,111},{1,115},{1,115},{1,115},{1,115},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,111},{1,111},{1,111},{1,111},{1,115},{1,115},{1,115},{1,115},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,111},{1,111},{1,111},{1,111},{1,115},{1,115},{1,115},{1,115},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,111},{1,111},{1,111},{1,111},{1,115},{1,115},{1,115},{1,115}},
+        {{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{3,107},{3,107},{3,107},{3,107},{3,109},{3,109},{3,109},{3,109},{3,107},{3,107},{3,107},{3,107},{3,109},{3,109},{3,109},{3,109},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{3,107},{3,107},{3,107},{3,107},{3,109},{3,109},{3,109},{3,109},{3,107},{3,107},{3,107},{3,107},{3,109},{3,109},{3,109},{3,109},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,109},{1,109},{1,109},{1,109},{1,116},{1,116},{1,116},{1,116},{1,109},{1,109},{1,109},{1,109},{1,116},{1,116},{1,116},{1,116},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,109},{1,109},{1,109},{1,109},{1,116},{1,116},{1,116},{1,116},{1,109},{1,109},{1,109},{1,109},{1,116},{1,116},{1,116},{1,116}},
+        {{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{4,107},{4,107},{4,107},{4,107},{4,108},{4,108},{4,108},{4,108},{3,107},{3,107},{3,107},{3,107},{3,109},{3,109},{3,109},{3,109},{3,108},{3,108},{3,108},{3,108},{3,110},{3,110},{3,110},{3,110},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{4,107},{4,107},{4,107},{4,107},{4,108},{4,108},{4,108},{4,108},{3,107},{3,107},{3,107},{3,107},{3,109},{3,109},{3,109},{3,109},{3,108},{3,108},{3,108},{3,108},{3,110},{3,110},{3,110},{3,110},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,111},{1,111},{1,111},{1,111},{1,115},{1,115},{1,115},{1,115},{1,109},{1,109},{1,109},{1,109},{1,116},{1,116},{1,116},{1,116},{1,112},{1,112},{1,112},{1,112},{1,117},{1,117},{1,117},{1,117},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,111},{1,111},{1,111},{1,111},{1,115},{1,115},{1,115},{1,115},{1,109},{1,109},{1,109},{1,109},{1,116},{1,116},{1,116},{1,116},{1,112},{1,112},{1,112},{1,112},{1,117},{1,117},{1,117},{1,117}},
+        {{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{2,107},{2,107},{2,107},{2,107},{2,111},{2,111},{2,111},{2,111},{2,107},{2,107},{2,107},{2,107},{2,111},{2,111},{2,111},{2,111},{2,107},{2,107},{2,107},{2,107},{2,111},{2,111},{2,111},{2,111},{2,107},{2,107},{2,107},{2,107},{2,111},{2,111},{2,111},{2,111},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,108},{1,108},{1,108},{1,108},{1,118},{1,118},{1,118},{1,118},{1,108},{1,108},{1,108},{1,108},{1,118},{1,118},{1,118},{1,118},{1,108},{1,108},{1,108},{1,108},{1,118},{1,118},{1,118},{1,118},{1,108},{1,108},{1,108},{1,108},{1,118},{1,118},{1,118},{1,118}},
+        {{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{4,107},{4,107},{4,107},{4,107},{4,108},{4,108},{4,108},{4,108},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{4,107},{4,107},{4,107},{4,107},{4,108},{4,108},{4,108},{4,108},{2,107},{2,107},{2,107},{2,107},{2,111},{2,111},{2,111},{2,111},{2,109},{2,109},{2,109},{2,109},{2,112},{2,112},{2,112},{2,112},{2,107},{2,107},{2,107},{2,107},{2,111},{2,111},{2,111},{2,111},{2,109},{2,109},{2,109},{2,109},{2,112},{2,112},{2,112},{2,112},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,111},{1,111},{1,111},{1,111},{1,115},{1,115},{1,115},{1,115},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,111},{1,111},{1,111},{1,111},{1,115},{1,115},{1,115},{1,115},{1,108},{1,108},{1,108},{1,108},{1,118},{1,118},{1,118},{1,118},{1,113},{1,113},{1,113},{1,113},{1,119},{1,119},{1,119},{1,119},{1,108},{1,108},{1,108},{1,108},{1,118},{1,118},{1,118},{1,118},{1,113},{1,113},{1,113},{1,113},{1,119},{1,119},{1,119},{1,119}},
+        {{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{0,0},{0,0},{0,0},{0,0},{5,107},{5,107},{5,107},{5,107},{3,107},{3,107},{3,107},{3,107},{3,109},{3,109},{3,109},{3,109},{3,107},{3,107},{3,107},{3,107},{3,109},{3,109},{3,109},{3,109},{2,107},{2,107},{2,107},{2,107},{2,111},{2,111},{2,111},{2,111},{2,107},{2,107},{2,107},{2,107},{2,111},{2,111},{2,111},{2,111},{2,108},{2,108},{2,108},{2,108},{2,113},{2,113},{2,113},{2,113},{2,108},{2,108},{2,108},{2,108},{2,113},{2,113},{2,113},{2,113},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,107},{1,107},{1,107},{1,107},{1,114},{1,114},{1,114},{1,114},{1,109},{1,109},{1,109},{1,109},{1,116},{1,116},{1,116},{1,116},{1,109},{1,109},{1,109},{1,109},{1,116},{1,116},{1,116},{1,116},{1,108},{1,108},{1,108},{1,108},{1,118},{1,118},{1,118},{1,118},{1,108},{1,108},{1,108},{1,108},{1,118},{1,118},{1,118},{1,118},{1,110},{1,110},{1,110},{1,110},{1,120},{1,120},{1,120},{1,120},{1,110},{1,110},{1,110},{1,110},{1,120},{1,120},{1,120},{1,120}},
+        {{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121}},
+        {{3,108},{3,108},{3,108},{3,108},{3,110},{3,110},{3,110},{3,110},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{3,108},{3,108},{3,108},{3,108},{3,110},{3,110},{3,110},{3,110},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{3,108},{3,108},{3,108},{3,108},{3,110},{3,110},{3,110},{3,110},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{3,108},{3,108},{3,108},{3,108},{3,110},{3,110},{3,110},{3,110},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{4,121},{1,112},{1,112},{1,112},{1,112},{1,117},{1,117},{1,117},{1,117},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,112},{1,112},{1,112},{1,112},{1,117},{1,117},{1,117},{1,117},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,112},{1,112},{1,112},{1,112},{1,117},{1,117},{1,117},{1,117},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,112},{1,112},{1,112},{1,112},{1,117},{1,117},{1,117},{1,117},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122},{1,122}},
+        {{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,118},{0,118},{0,118},{0,118},{0,118},{0,118},{0,118},{0,118},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,108},{0,118},{0,118},{0,118},{0,118},{0,118},{0,118},{0,118},{0,118},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,120},{0,120},{0,120},{0,120},{0,120},{0,120},{0,120},{0,120},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,110},{0,120},{0,120},{0,120},{0,120},{0,120},{0,120},{0,120},{0,120},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,121},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123},{1,123}},
+        {{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124}},
+        {{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{4,107},{4,107},{4,109},{4,109},{4,107},{4,107},{4,109},{4,109},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{4,107},{4,107},{4,109},{4,109},{4,107},{4,107},{4,109},{4,109},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{4,107},{4,107},{4,109},{4,109},{4,107},{4,107},{4,109},{4,109},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{4,107},{4,107},{4,109},{4,109},{4,107},{4,107},{4,109},{4,109},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,111},{1,111},{1,125},{1,125},{1,111},{1,111},{1,125},{1,125},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,111},{1,111},{1,125},{1,125},{1,111},{1,111},{1,125},{1,125},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,111},{1,111},{1,125},{1,125},{1,111},{1,111},{1,125},{1,125},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,111},{1,111},{1,125},{1,125},{1,111},{1,111},{1,125},{1,125}},
+        {{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{3,107},{3,107},{3,111},{3,111},{3,107},{3,107},{3,111},{3,111},{3,107},{3,107},{3,111},{3,111},{3,107},{3,107},{3,111},{3,111},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{3,107},{3,107},{3,111},{3,111},{3,107},{3,107},{3,111},{3,111},{3,107},{3,107},{3,111},{3,111},{3,107},{3,107},{3,111},{3,111},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,109},{1,109},{1,126},{1,126},{1,109},{1,109},{1,126},{1,126},{1,109},{1,109},{1,126},{1,126},{1,109},{1,109},{1,126},{1,126},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,109},{1,109},{1,126},{1,126},{1,109},{1,109},{1,126},{1,126},{1,109},{1,109},{1,126},{1,126},{1,109},{1,109},{1,126},{1,126}},
+        {{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{4,107},{4,107},{4,109},{4,109},{4,107},{4,107},{4,109},{4,109},{3,107},{3,107},{3,111},{3,111},{3,107},{3,107},{3,111},{3,111},{3,108},{3,108},{3,113},{3,113},{3,108},{3,108},{3,113},{3,113},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{4,107},{4,107},{4,109},{4,109},{4,107},{4,107},{4,109},{4,109},{3,107},{3,107},{3,111},{3,111},{3,107},{3,107},{3,111},{3,111},{3,108},{3,108},{3,113},{3,113},{3,108},{3,108},{3,113},{3,113},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,111},{1,111},{1,125},{1,125},{1,111},{1,111},{1,125},{1,125},{1,109},{1,109},{1,126},{1,126},{1,109},{1,109},{1,126},{1,126},{1,112},{1,112},{1,127},{1,127},{1,112},{1,112},{1,127},{1,127},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,111},{1,111},{1,125},{1,125},{1,111},{1,111},{1,125},{1,125},{1,109},{1,109},{1,126},{1,126},{1,109},{1,109},{1,126},{1,126},{1,112},{1,112},{1,127},{1,127},{1,112},{1,112},{1,127},{1,127}},
+        {{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128}},
+        {{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{4,107},{4,107},{4,109},{4,109},{4,107},{4,107},{4,109},{4,109},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{4,107},{4,107},{4,109},{4,109},{4,107},{4,107},{4,109},{4,109},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{2,109},{2,109},{2,116},{2,116},{2,109},{2,109},{2,116},{2,116},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{2,109},{2,109},{2,116},{2,116},{2,109},{2,109},{2,116},{2,116},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,111},{1,111},{1,125},{1,125},{1,111},{1,111},{1,125},{1,125},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,111},{1,111},{1,125},{1,125},{1,111},{1,111},{1,125},{1,125},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128},{1,113},{1,113},{1,129},{1,129},{1,113},{1,113},{1,129},{1,129},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128},{1,113},{1,113},{1,129},{1,129},{1,113},{1,113},{1,129},{1,129}},
+        {{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{0,0},{0,0},{6,107},{6,107},{3,107},{3,107},{3,111},{3,111},{3,107},{3,107},{3,111},{3,111},{3,107},{3,107},{3,111},{3,111},{3,107},{3,107},{3,111},{3,111},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{2,107},{2,107},{2,114},{2,114},{2,108},{2,108},{2,118},{2,118},{2,108},{2,108},{2,118},{2,118},{2,108},{2,108},{2,118},{2,118},{2,108},{2,108},{2,118},{2,118},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,107},{1,107},{1,124},{1,124},{1,109},{1,109},{1,126},{1,126},{1,109},{1,109},{1,126},{1,126},{1,109},{1,109},{1,126},{1,126},{1,109},{1,109},{1,126},{1,126},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128},{1,108},{1,108},{1,128},{1,128},{1,110},{1,110},{1,130},{1,130},{1,110},{1,110},{1,130},{1,130},{1,110},{1,110},{1,130},{1,130},{1,110},{1,110},{1,130},{1,130}},
+        {{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131}},
+        {{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{4,107},{4,107},{4,109},{4,109},{4,108},{4,108},{4,110},{4,110},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{4,107},{4,107},{4,109},{4,109},{4,108},{4,108},{4,110},{4,110},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{4,107},{4,107},{4,109},{4,109},{4,108},{4,108},{4,110},{4,110},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{4,107},{4,107},{4,109},{4,109},{4,108},{4,108},{4,110},{4,110},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,111},{1,111},{1,125},{1,125},{1,115},{1,115},{1,132},{1,132},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,111},{1,111},{1,125},{1,125},{1,115},{1,115},{1,132},{1,132},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,111},{1,111},{1,125},{1,125},{1,115},{1,115},{1,132},{1,132},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,111},{1,111},{1,125},{1,125},{1,115},{1,115},{1,132},{1,132}},
+        {{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{3,107},{3,107},{3,111},{3,111},{3,109},{3,109},{3,112},{3,112},{3,107},{3,107},{3,111},{3,111},{3,109},{3,109},{3,112},{3,112},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{3,107},{3,107},{3,111},{3,111},{3,109},{3,109},{3,112},{3,112},{3,107},{3,107},{3,111},{3,111},{3,109},{3,109},{3,112},{3,112},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,109},{1,109},{1,126},{1,126},{1,116},{1,116},{1,133},{1,133},{1,109},{1,109},{1,126},{1,126},{1,116},{1,116},{1,133},{1,133},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,109},{1,109},{1,126},{1,126},{1,116},{1,116},{1,133},{1,133},{1,109},{1,109},{1,126},{1,126},{1,116},{1,116},{1,133},{1,133}},
+        {{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{4,107},{4,107},{4,109},{4,109},{4,108},{4,108},{4,110},{4,110},{3,107},{3,107},{3,111},{3,111},{3,109},{3,109},{3,112},{3,112},{3,108},{3,108},{3,113},{3,113},{3,110},{3,110},{3,28},{3,28},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{4,107},{4,107},{4,109},{4,109},{4,108},{4,108},{4,110},{4,110},{3,107},{3,107},{3,111},{3,111},{3,109},{3,109},{3,112},{3,112},{3,108},{3,108},{3,113},{3,113},{3,110},{3,110},{3,28},{3,28},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,111},{1,111},{1,125},{1,125},{1,115},{1,115},{1,132},{1,132},{1,109},{1,109},{1,126},{1,126},{1,116},{1,116},{1,133},{1,133},{1,112},{1,112},{1,127},{1,127},{1,117},{1,117},{1,134},{1,134},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,111},{1,111},{1,125},{1,125},{1,115},{1,115},{1,132},{1,132},{1,109},{1,109},{1,126},{1,126},{1,116},{1,116},{1,133},{1,133},{1,112},{1,112},{1,127},{1,127},{1,117},{1,117},{1,134},{1,134}},
+        {{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{2,107},{2,107},{2,114},{2,114},{2,111},{2,111},{2,115},{2,115},{2,107},{2,107},{2,114},{2,114},{2,111},{2,111},{2,115},{2,115},{2,107},{2,107},{2,114},{2,114},{2,111},{2,111},{2,115},{2,115},{2,107},{2,107},{2,114},{2,114},{2,111},{2,111},{2,115},{2,115},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,108},{1,108},{1,128},{1,128},{1,118},{1,118},{1,135},{1,135},{1,108},{1,108},{1,128},{1,128},{1,118},{1,118},{1,135},{1,135},{1,108},{1,108},{1,128},{1,128},{1,118},{1,118},{1,135},{1,135},{1,108},{1,108},{1,128},{1,128},{1,118},{1,118},{1,135},{1,135}},
+        {{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{4,107},{4,107},{4,109},{4,109},{4,108},{4,108},{4,110},{4,110},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{4,107},{4,107},{4,109},{4,109},{4,108},{4,108},{4,110},{4,110},{2,107},{2,107},{2,114},{2,114},{2,111},{2,111},{2,115},{2,115},{2,109},{2,109},{2,116},{2,116},{2,112},{2,112},{2,117},{2,117},{2,107},{2,107},{2,114},{2,114},{2,111},{2,111},{2,115},{2,115},{2,109},{2,109},{2,116},{2,116},{2,112},{2,112},{2,117},{2,117},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,111},{1,111},{1,125},{1,125},{1,115},{1,115},{1,132},{1,132},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,111},{1,111},{1,125},{1,125},{1,115},{1,115},{1,132},{1,132},{1,108},{1,108},{1,128},{1,128},{1,118},{1,118},{1,135},{1,135},{1,113},{1,113},{1,129},{1,129},{1,119},{1,119},{1,136},{1,136},{1,108},{1,108},{1,128},{1,128},{1,118},{1,118},{1,135},{1,135},{1,113},{1,113},{1,129},{1,129},{1,119},{1,119},{1,136},{1,136}},
+        {{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{0,0},{0,0},{6,107},{6,107},{5,107},{5,107},{5,108},{5,108},{3,107},{3,107},{3,111},{3,111},{3,109},{3,109},{3,112},{3,112},{3,107},{3,107},{3,111},{3,111},{3,109},{3,109},{3,112},{3,112},{2,107},{2,107},{2,114},{2,114},{2,111},{2,111},{2,115},{2,115},{2,107},{2,107},{2,114},{2,114},{2,111},{2,111},{2,115},{2,115},{2,108},{2,108},{2,118},{2,118},{2,113},{2,113},{2,119},{2,119},{2,108},{2,108},{2,118},{2,118},{2,113},{2,113},{2,119},{2,119},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,107},{1,107},{1,124},{1,124},{1,114},{1,114},{1,131},{1,131},{1,109},{1,109},{1,126},{1,126},{1,116},{1,116},{1,133},{1,133},{1,109},{1,109},{1,126},{1,126},{1,116},{1,116},{1,133},{1,133},{1,108},{1,108},{1,128},{1,128},{1,118},{1,118},{1,135},{1,135},{1,108},{1,108},{1,128},{1,128},{1,118},{1,118},{1,135},{1,135},{1,110},{1,110},{1,130},{1,130},{1,120},{1,120},{1,137},{1,137},{1,110},{1,110},{1,130},{1,130},{1,120},{1,120},{1,137},{1,137}},
+        {{3,108},{3,108},{3,113},{3,113},{3,110},{3,110},{3,28},{3,28},{4,121},{4,121},{4,34},{4,34},{4,121},{4,121},{4,34},{4,34},{3,108},{3,108},{3,113},{3,113},{3,110},{3,110},{3,28},{3,28},{4,121},{4,121},{4,34},{4,34},{4,121},{4,121},{4,34},{4,34},{3,108},{3,108},{3,113},{3,113},{3,110},{3,110},{3,28},{3,28},{4,121},{4,121},{4,34},{4,34},{4,121},{4,121},{4,34},{4,34},{3,108},{3,108},{3,113},{3,113},{3,110},{3,110},{3,28},{3,28},{4,121},{4,121},{4,34},{4,34},{4,121},{4,121},{4,34},{4,34},{1,112},{1,112},{1,127},{1,127},{1,117},{1,117},{1,134},{1,134},{1,122},{1,122},{1,138},{1,138},{1,122},{1,122},{1,138},{1,138},{1,112},{1,112},{1,127},{1,127},{1,117},{1,117},{1,134},{1,134},{1,122},{1,122},{1,138},{1,138},{1,122},{1,122},{1,138},{1,138},{1,112},{1,112},{1,127},{1,127},{1,117},{1,117},{1,134},{1,134},{1,122},{1,122},{1,138},{1,138},{1,122},{1,122},{1,138},{1,138},{1,112},{1,112},{1,127},{1,127},{1,117},{1,117},{1,134},{1,134},{1,122},{1,122},{1,138},{1,138},{1,122},{1,122},{1,138},{1,138}},
+        {{0,108},{0,108},{0,108},{0,108},{0,128},{0,128},{0,128},{0,128},{0,108},{0,108},{0,108},{0,108},{0,128},{0,128},{0,128},{0,128},{0,108},{0,108},{0,108},{0,108},{0,128},{0,128},{0,128},{0,128},{0,108},{0,108},{0,108},{0,108},{0,128},{0,128},{0,128},{0,128},{0,110},{0,110},{0,110},{0,110},{0,130},{0,130},{0,130},{0,130},{0,110},{0,110},{0,110},{0,110},{0,130},{0,130},{0,130},{0,130},{0,110},{0,110},{0,110},{0,110},{0,130},{0,130},{0,130},{0,130},{0,110},{0,110},{0,110},{0,110},{0,130},{0,130},{0,130},{0,130},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139}},
+        {{0,108},{0,108},{0,108},{0,108},{0,128},{0,128},{0,128},{0,128},{0,118},{0,118},{0,118},{0,118},{0,135},{0,135},{0,135},{0,135},{0,108},{0,108},{0,108},{0,108},{0,128},{0,128},{0,128},{0,128},{0,118},{0,118},{0,118},{0,118},{0,135},{0,135},{0,135},{0,135},{0,110},{0,110},{0,110},{0,110},{0,130},{0,130},{0,130},{0,130},{0,120},{0,120},{0,120},{0,120},{0,137},{0,137},{0,137},{0,137},{0,110},{0,110},{0,110},{0,110},{0,130},{0,130},{0,130},{0,130},{0,120},{0,120},{0,120},{0,120},{0,137},{0,137},{0,137},{0,137},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,123},{1,123},{1,123},{1,123},{1,140},{1,140},{1,140},{1,140},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,123},{1,123},{1,123},{1,123},{1,140},{1,140},{1,140},{1,140},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,123},{1,123},{1,123},{1,123},{1,140},{1,140},{1,140},{1,140},{1,121},{1,121},{1,121},{1,121},{1,139},{1,139},{1,139},{1,139},{1,123},{1,123},{1,123},{1,123},{1,140},{1,140},{1,140},{1,140}},
+        {{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141}},
+        {{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{3,110},{3,110},{3,28},{3,28},{3,31},{3,31},{3,31},{3,31},{3,110},{3,110},{3,28},{3,28},{3,31},{3,31},{3,31},{3,31},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{3,110},{3,110},{3,28},{3,28},{3,31},{3,31},{3,31},{3,31},{3,110},{3,110},{3,28},{3,28},{3,31},{3,31},{3,31},{3,31},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,117},{1,117},{1,134},{1,134},{1,142},{1,142},{1,142},{1,142},{1,117},{1,117},{1,134},{1,134},{1,142},{1,142},{1,142},{1,142},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,117},{1,117},{1,134},{1,134},{1,142},{1,142},{1,142},{1,142},{1,117},{1,117},{1,134},{1,134},{1,142},{1,142},{1,142},{1,142}},
+        {{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{4,108},{4,108},{4,110},{4,110},{5,121},{5,121},{5,121},{5,121},{2,112},{2,112},{2,117},{2,117},{2,122},{2,122},{2,122},{2,122},{2,112},{2,112},{2,117},{2,117},{2,122},{2,122},{2,122},{2,122},{2,112},{2,112},{2,117},{2,117},{2,122},{2,122},{2,122},{2,122},{2,112},{2,112},{2,117},{2,117},{2,122},{2,122},{2,122},{2,122},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,115},{1,115},{1,132},{1,132},{1,141},{1,141},{1,141},{1,141},{1,119},{1,119},{1,136},{1,136},{1,143},{1,143},{1,143},{1,143},{1,119},{1,119},{1,136},{1,136},{1,143},{1,143},{1,143},{1,143},{1,119},{1,119},{1,136},{1,136},{1,143},{1,143},{1,143},{1,143},{1,119},{1,119},{1,136},{1,136},{1,143},{1,143},{1,143},{1,143}},
+        {{3,110},{3,110},{3,28},{3,28},{3,31},{3,31},{3,31},{3,31},{4,121},{4,121},{4,34},{4,34},{4,37},{4,37},{4,37},{4,37},{3,110},{3,110},{3,28},{3,28},{3,31},{3,31},{3,31},{3,31},{4,121},{4,121},{4,34},{4,34},{4,37},{4,37},{4,37},{4,37},{3,110},{3,110},{3,28},{3,28},{3,31},{3,31},{3,31},{3,31},{4,121},{4,121},{4,34},{4,34},{4,37},{4,37},{4,37},{4,37},{3,110},{3,110},{3,28},{3,28},{3,31},{3,31},{3,31},{3,31},{4,121},{4,121},{4,34},{4,34},{4,37},{4,37},{4,37},{4,37},{1,117},{1,117},{1,134},{1,134},{1,142},{1,142},{1,142},{1,142},{1,122},{1,122},{1,138},{1,138},{1,144},{1,144},{1,144},{1,144},{1,117},{1,117},{1,134},{1,134},{1,142},{1,142},{1,142},{1,142},{1,122},{1,122},{1,138},{1,138},{1,144},{1,144},{1,144},{1,144},{1,117},{1,117},{1,134},{1,134},{1,142},{1,142},{1,142},{1,142},{1,122},{1,122},{1,138},{1,138},{1,144},{1,144},{1,144},{1,144},{1,117},{1,117},{1,134},{1,134},{1,142},{1,142},{1,142},{1,142},{1,122},{1,122},{1,138},{1,138},{1,144},{1,144},{1,144},{1,144}},
+        {{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145}},
+        {{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146}},
+        {{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147}},
+        {{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,108},{3,118},{3,108},{3,118},{3,108},{3,118},{3,108},{3,118},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,108},{3,118},{3,108},{3,118},{3,108},{3,118},{3,108},{3,118},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,112},{1,148},{1,112},{1,148},{1,112},{1,148},{1,112},{1,148},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,112},{1,148},{1,112},{1,148},{1,112},{1,148},{1,112},{1,148}},
+        {{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149}},
+        {{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{4,107},{4,111},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,109},{2,126},{2,109},{2,126},{2,109},{2,126},{2,109},{2,126},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,109},{2,126},{2,109},{2,126},{2,109},{2,126},{2,109},{2,126},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,111},{1,146},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,113},{1,150},{1,113},{1,150},{1,113},{1,150},{1,113},{1,150},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,113},{1,150},{1,113},{1,150},{1,113},{1,150},{1,113},{1,150}},
+        {{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{0,0},{7,107},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{3,107},{3,114},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,107},{2,124},{2,108},{2,128},{2,108},{2,128},{2,108},{2,128},{2,108},{2,128},{2,108},{2,128},{2,108},{2,128},{2,108},{2,128},{2,108},{2,128},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,107},{1,145},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,109},{1,147},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,108},{1,149},{1,110},{1,151},{1,110},{1,151},{1,110},{1,151},{1,110},{1,151},{1,110},{1,151},{1,110},{1,151},{1,110},{1,151},{1,110},{1,151}},
+        {{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152}},
+        {{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{4,107},{4,111},{4,107},{4,111},{4,108},{4,113},{4,108},{4,113},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{4,107},{4,111},{4,107},{4,111},{4,108},{4,113},{4,108},{4,113},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{4,107},{4,111},{4,107},{4,111},{4,108},{4,113},{4,108},{4,113},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{4,107},{4,111},{4,107},{4,111},{4,108},{4,113},{4,108},{4,113},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,111},{1,146},{1,111},{1,146},{1,115},{1,153},{1,115},{1,153},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,111},{1,146},{1,111},{1,146},{1,115},{1,153},{1,115},{1,153},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,111},{1,146},{1,111},{1,146},{1,115},{1,153},{1,115},{1,153},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,111},{1,146},{1,111},{1,146},{1,115},{1,153},{1,115},{1,153}},
+        {{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{3,107},{3,114},{3,107},{3,114},{3,109},{3,116},{3,109},{3,116},{3,107},{3,114},{3,107},{3,114},{3,109},{3,116},{3,109},{3,116},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{3,107},{3,114},{3,107},{3,114},{3,109},{3,116},{3,109},{3,116},{3,107},{3,114},{3,107},{3,114},{3,109},{3,116},{3,109},{3,116},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,109},{1,147},{1,109},{1,147},{1,116},{1,154},{1,116},{1,154},{1,109},{1,147},{1,109},{1,147},{1,116},{1,154},{1,116},{1,154},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,109},{1,147},{1,109},{1,147},{1,116},{1,154},{1,116},{1,154},{1,109},{1,147},{1,109},{1,147},{1,116},{1,154},{1,116},{1,154}},
+        {{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{4,107},{4,111},{4,107},{4,111},{4,108},{4,113},{4,108},{4,113},{3,107},{3,114},{3,107},{3,114},{3,109},{3,116},{3,109},{3,116},{3,108},{3,118},{3,108},{3,118},{3,110},{3,120},{3,110},{3,120},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{4,107},{4,111},{4,107},{4,111},{4,108},{4,113},{4,108},{4,113},{3,107},{3,114},{3,107},{3,114},{3,109},{3,116},{3,109},{3,116},{3,108},{3,118},{3,108},{3,118},{3,110},{3,120},{3,110},{3,120},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,111},{1,146},{1,111},{1,146},{1,115},{1,153},{1,115},{1,153},{1,109},{1,147},{1,109},{1,147},{1,116},{1,154},{1,116},{1,154},{1,112},{1,148},{1,112},{1,148},{1,117},{1,155},{1,117},{1,155},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,111},{1,146},{1,111},{1,146},{1,115},{1,153},{1,115},{1,153},{1,109},{1,147},{1,109},{1,147},{1,116},{1,154},{1,116},{1,154},{1,112},{1,148},{1,112},{1,148},{1,117},{1,155},{1,117},{1,155}},
+        {{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{2,107},{2,124},{2,107},{2,124},{2,111},{2,125},{2,111},{2,125},{2,107},{2,124},{2,107},{2,124},{2,111},{2,125},{2,111},{2,125},{2,107},{2,124},{2,107},{2,124},{2,111},{2,125},{2,111},{2,125},{2,107},{2,124},{2,107},{2,124},{2,111},{2,125},{2,111},{2,125},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,108},{1,149},{1,108},{1,149},{1,118},{1,156},{1,118},{1,156},{1,108},{1,149},{1,108},{1,149},{1,118},{1,156},{1,118},{1,156},{1,108},{1,149},{1,108},{1,149},{1,118},{1,156},{1,118},{1,156},{1,108},{1,149},{1,108},{1,149},{1,118},{1,156},{1,118},{1,156}},
+        {{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{4,107},{4,111},{4,107},{4,111},{4,108},{4,113},{4,108},{4,113},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{4,107},{4,111},{4,107},{4,111},{4,108},{4,113},{4,108},{4,113},{2,107},{2,124},{2,107},{2,124},{2,111},{2,125},{2,111},{2,125},{2,109},{2,126},{2,109},{2,126},{2,112},{2,127},{2,112},{2,127},{2,107},{2,124},{2,107},{2,124},{2,111},{2,125},{2,111},{2,125},{2,109},{2,126},{2,109},{2,126},{2,112},{2,127},{2,112},{2,127},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,111},{1,146},{1,111},{1,146},{1,115},{1,153},{1,115},{1,153},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,111},{1,146},{1,111},{1,146},{1,115},{1,153},{1,115},{1,153},{1,108},{1,149},{1,108},{1,149},{1,118},{1,156},{1,118},{1,156},{1,113},{1,150},{1,113},{1,150},{1,119},{1,157},{1,119},{1,157},{1,108},{1,149},{1,108},{1,149},{1,118},{1,156},{1,118},{1,156},{1,113},{1,150},{1,113},{1,150},{1,119},{1,157},{1,119},{1,157}},
+        {{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{0,0},{7,107},{0,0},{7,107},{5,107},{5,109},{5,107},{5,109},{3,107},{3,114},{3,107},{3,114},{3,109},{3,116},{3,109},{3,116},{3,107},{3,114},{3,107},{3,114},{3,109},{3,116},{3,109},{3,116},{2,107},{2,124},{2,107},{2,124},{2,111},{2,125},{2,111},{2,125},{2,107},{2,124},{2,107},{2,124},{2,111},{2,125},{2,111},{2,125},{2,108},{2,128},{2,108},{2,128},{2,113},{2,129},{2,113},{2,129},{2,108},{2,128},{2,108},{2,128},{2,113},{2,129},{2,113},{2,129},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,107},{1,145},{1,107},{1,145},{1,114},{1,152},{1,114},{1,152},{1,109},{1,147},{1,109},{1,147},{1,116},{1,154},{1,116},{1,154},{1,109},{1,147},{1,109},{1,147},{1,116},{1,154},{1,116},{1,154},{1,108},{1,149},{1,108},{1,149},{1,118},{1,156},{1,118},{1,156},{1,108},{1,149},{1,108},{1,149},{1,118},{1,156},{1,118},{1,156},{1,110},{1,151},{1,110},{1,151},{1,120},{1,158},{1,120},{1,158},{1,110},{1,151},{1,110},{1,151},{1,120},{1,158},{1,120},{1,158}},
+        {{3,108},{3,118},{3,108},{3,118},{3,110},{3,120},{3,110},{3,120},{4,121},{4,123},{4,121},{4,123},{4,121},{4,123},{4,121},{4,123},{3,108},{3,118},{3,108},{3,118},{3,110},{3,120},{3,110},{3,120},{4,121},{4,123},{4,121},{4,123},{4,121},{4,123},{4,121},{4,123},{3,108},{3,118},{3,108},{3,118},{3,110},{3,120},{3,110},{3,120},{4,121},{4,123},{4,121},{4,123},{4,121},{4,123},{4,121},{4,123},{3,108},{3,118},{3,108},{3,118},{3,110},{3,120},{3,110},{3,120},{4,121},{4,123},{4,121},{4,123},{4,121},{4,123},{4,121},{4,123},{1,112},{1,148},{1,112},{1,148},{1,117},{1,155},{1,117},{1,155},{1,122},{1,159},{1,122},{1,159},{1,122},{1,159},{1,122},{1,159},{1,112},{1,148},{1,112},{1,148},{1,117},{1,155},{1,117},{1,155},{1,122},{1,159},{1,122},{1,159},{1,122},{1,159},{1,122},{1,159},{1,112},{1,148},{1,112},{1,148},{1,117},{1,155},{1,117},{1,155},{1,122},{1,159},{1,122},{1,159},{1,122},{1,159},{1,122},{1,159},{1,112},{1,148},{1,112},{1,148},{1,117},{1,155},{1,117},{1,155},{1,122},{1,159},{1,122},{1,159},{1,122},{1,159},{1,122},{1,159}},
+        {{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160}},
+        {{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,118},{0,118},{0,156},{0,156},{0,118},{0,118},{0,156},{0,156},{0,108},{0,108},{0,149},{0,149},{0,108},{0,108},{0,149},{0,149},{0,118},{0,118},{0,156},{0,156},{0,118},{0,118},{0,156},{0,156},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,120},{0,120},{0,158},{0,158},{0,120},{0,120},{0,158},{0,158},{0,110},{0,110},{0,151},{0,151},{0,110},{0,110},{0,151},{0,151},{0,120},{0,120},{0,158},{0,158},{0,120},{0,120},{0,158},{0,158},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,123},{1,123},{1,161},{1,161},{1,123},{1,123},{1,161},{1,161},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,123},{1,123},{1,161},{1,161},{1,123},{1,123},{1,161},{1,161},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,123},{1,123},{1,161},{1,161},{1,123},{1,123},{1,161},{1,161},{1,121},{1,121},{1,160},{1,160},{1,121},{1,121},{1,160},{1,160},{1,123},{1,123},{1,161},{1,161},{1,123},{1,123},{1,161},{1,161}},
+        {{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162}},
+        {{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{4,107},{4,111},{4,109},{4,112},{4,107},{4,111},{4,109},{4,112},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{4,107},{4,111},{4,109},{4,112},{4,107},{4,111},{4,109},{4,112},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{4,107},{4,111},{4,109},{4,112},{4,107},{4,111},{4,109},{4,112},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{4,107},{4,111},{4,109},{4,112},{4,107},{4,111},{4,109},{4,112},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,111},{1,146},{1,125},{1,163},{1,111},{1,146},{1,125},{1,163},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,111},{1,146},{1,125},{1,163},{1,111},{1,146},{1,125},{1,163},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,111},{1,146},{1,125},{1,163},{1,111},{1,146},{1,125},{1,163},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,111},{1,146},{1,125},{1,163},{1,111},{1,146},{1,125},{1,163}},
+        {{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{3,107},{3,114},{3,111},{3,115},{3,107},{3,114},{3,111},{3,115},{3,107},{3,114},{3,111},{3,115},{3,107},{3,114},{3,111},{3,115},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{3,107},{3,114},{3,111},{3,115},{3,107},{3,114},{3,111},{3,115},{3,107},{3,114},{3,111},{3,115},{3,107},{3,114},{3,111},{3,115},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,109},{1,147},{1,126},{1,164},{1,109},{1,147},{1,126},{1,164},{1,109},{1,147},{1,126},{1,164},{1,109},{1,147},{1,126},{1,164},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,109},{1,147},{1,126},{1,164},{1,109},{1,147},{1,126},{1,164},{1,109},{1,147},{1,126},{1,164},{1,109},{1,147},{1,126},{1,164}},
+        {{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{4,107},{4,111},{4,109},{4,112},{4,107},{4,111},{4,109},{4,112},{3,107},{3,114},{3,111},{3,115},{3,107},{3,114},{3,111},{3,115},{3,108},{3,118},{3,113},{3,119},{3,108},{3,118},{3,113},{3,119},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{4,107},{4,111},{4,109},{4,112},{4,107},{4,111},{4,109},{4,112},{3,107},{3,114},{3,111},{3,115},{3,107},{3,114},{3,111},{3,115},{3,108},{3,118},{3,113},{3,119},{3,108},{3,118},{3,113},{3,119},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,111},{1,146},{1,125},{1,163},{1,111},{1,146},{1,125},{1,163},{1,109},{1,147},{1,126},{1,164},{1,109},{1,147},{1,126},{1,164},{1,112},{1,148},{1,127},{1,165},{1,112},{1,148},{1,127},{1,165},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,111},{1,146},{1,125},{1,163},{1,111},{1,146},{1,125},{1,163},{1,109},{1,147},{1,126},{1,164},{1,109},{1,147},{1,126},{1,164},{1,112},{1,148},{1,127},{1,165},{1,112},{1,148},{1,127},{1,165}},
+        {{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166}},
+        {{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{4,107},{4,111},{4,109},{4,112},{4,107},{4,111},{4,109},{4,112},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{4,107},{4,111},{4,109},{4,112},{4,107},{4,111},{4,109},{4,112},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{2,109},{2,126},{2,116},{2,133},{2,109},{2,126},{2,116},{2,133},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{2,109},{2,126},{2,116},{2,133},{2,109},{2,126},{2,116},{2,133},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,111},{1,146},{1,125},{1,163},{1,111},{1,146},{1,125},{1,163},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,111},{1,146},{1,125},{1,163},{1,111},{1,146},{1,125},{1,163},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166},{1,113},{1,150},{1,129},{1,167},{1,113},{1,150},{1,129},{1,167},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166},{1,113},{1,150},{1,129},{1,167},{1,113},{1,150},{1,129},{1,167}},
+        {{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{0,0},{7,107},{6,107},{6,108},{3,107},{3,114},{3,111},{3,115},{3,107},{3,114},{3,111},{3,115},{3,107},{3,114},{3,111},{3,115},{3,107},{3,114},{3,111},{3,115},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{2,107},{2,124},{2,114},{2,131},{2,108},{2,128},{2,118},{2,135},{2,108},{2,128},{2,118},{2,135},{2,108},{2,128},{2,118},{2,135},{2,108},{2,128},{2,118},{2,135},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,107},{1,145},{1,124},{1,162},{1,109},{1,147},{1,126},{1,164},{1,109},{1,147},{1,126},{1,164},{1,109},{1,147},{1,126},{1,164},{1,109},{1,147},{1,126},{1,164},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166},{1,108},{1,149},{1,128},{1,166},{1,110},{1,151},{1,130},{1,168},{1,110},{1,151},{1,130},{1,168},{1,110},{1,151},{1,130},{1,168},{1,110},{1,151},{1,130},{1,168}},
+        {{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169}},
+        {{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{4,107},{4,111},{4,109},{4,112},{4,108},{4,113},{4,110},{4,28},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{4,107},{4,111},{4,109},{4,112},{4,108},{4,113},{4,110},{4,28},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{4,107},{4,111},{4,109},{4,112},{4,108},{4,113},{4,110},{4,28},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{4,107},{4,111},{4,109},{4,112},{4,108},{4,113},{4,110},{4,28},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,111},{1,146},{1,125},{1,163},{1,115},{1,153},{1,132},{1,170},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,111},{1,146},{1,125},{1,163},{1,115},{1,153},{1,132},{1,170},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,111},{1,146},{1,125},{1,163},{1,115},{1,153},{1,132},{1,170},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,111},{1,146},{1,125},{1,163},{1,115},{1,153},{1,132},{1,170}},
+        {{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{3,107},{3,114},{3,111},{3,115},{3,109},{3,116},{3,112},{3,117},{3,107},{3,114},{3,111},{3,115},{3,109},{3,116},{3,112},{3,117},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{3,107},{3,114},{3,111},{3,115},{3,109},{3,116},{3,112},{3,117},{3,107},{3,114},{3,111},{3,115},{3,109},{3,116},{3,112},{3,117},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,109},{1,147},{1,126},{1,164},{1,116},{1,154},{1,133},{1,171},{1,109},{1,147},{1,126},{1,164},{1,116},{1,154},{1,133},{1,171},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,109},{1,147},{1,126},{1,164},{1,116},{1,154},{1,133},{1,171},{1,109},{1,147},{1,126},{1,164},{1,116},{1,154},{1,133},{1,171}},
+        {{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{4,107},{4,111},{4,109},{4,112},{4,108},{4,113},{4,110},{4,28},{3,107},{3,114},{3,111},{3,115},{3,109},{3,116},{3,112},{3,117},{3,108},{3,118},{3,113},{3,119},{3,110},{3,120},{3,28},{3,29},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{4,107},{4,111},{4,109},{4,112},{4,108},{4,113},{4,110},{4,28},{3,107},{3,114},{3,111},{3,115},{3,109},{3,116},{3,112},{3,117},{3,108},{3,118},{3,113},{3,119},{3,110},{3,120},{3,28},{3,29},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,111},{1,146},{1,125},{1,163},{1,115},{1,153},{1,132},{1,170},{1,109},{1,147},{1,126},{1,164},{1,116},{1,154},{1,133},{1,171},{1,112},{1,148},{1,127},{1,165},{1,117},{1,155},{1,134},{1,172},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,111},{1,146},{1,125},{1,163},{1,115},{1,153},{1,132},{1,170},{1,109},{1,147},{1,126},{1,164},{1,116},{1,154},{1,133},{1,171},{1,112},{1,148},{1,127},{1,165},{1,117},{1,155},{1,134},{1,172}},
+        {{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{2,107},{2,124},{2,114},{2,131},{2,111},{2,125},{2,115},{2,132},{2,107},{2,124},{2,114},{2,131},{2,111},{2,125},{2,115},{2,132},{2,107},{2,124},{2,114},{2,131},{2,111},{2,125},{2,115},{2,132},{2,107},{2,124},{2,114},{2,131},{2,111},{2,125},{2,115},{2,132},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,108},{1,149},{1,128},{1,166},{1,118},{1,156},{1,135},{1,173},{1,108},{1,149},{1,128},{1,166},{1,118},{1,156},{1,135},{1,173},{1,108},{1,149},{1,128},{1,166},{1,118},{1,156},{1,135},{1,173},{1,108},{1,149},{1,128},{1,166},{1,118},{1,156},{1,135},{1,173}},
+        {{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{4,107},{4,111},{4,109},{4,112},{4,108},{4,113},{4,110},{4,28},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{4,107},{4,111},{4,109},{4,112},{4,108},{4,113},{4,110},{4,28},{2,107},{2,124},{2,114},{2,131},{2,111},{2,125},{2,115},{2,132},{2,109},{2,126},{2,116},{2,133},{2,112},{2,127},{2,117},{2,134},{2,107},{2,124},{2,114},{2,131},{2,111},{2,125},{2,115},{2,132},{2,109},{2,126},{2,116},{2,133},{2,112},{2,127},{2,117},{2,134},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,111},{1,146},{1,125},{1,163},{1,115},{1,153},{1,132},{1,170},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,111},{1,146},{1,125},{1,163},{1,115},{1,153},{1,132},{1,170},{1,108},{1,149},{1,128},{1,166},{1,118},{1,156},{1,135},{1,173},{1,113},{1,150},{1,129},{1,167},{1,119},{1,157},{1,136},{1,174},{1,108},{1,149},{1,128},{1,166},{1,118},{1,156},{1,135},{1,173},{1,113},{1,150},{1,129},{1,167},{1,119},{1,157},{1,136},{1,174}},
+        {{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{0,0},{7,107},{6,107},{6,108},{5,107},{5,109},{5,108},{5,110},{3,107},{3,114},{3,111},{3,115},{3,109},{3,116},{3,112},{3,117},{3,107},{3,114},{3,111},{3,115},{3,109},{3,116},{3,112},{3,117},{2,107},{2,124},{2,114},{2,131},{2,111},{2,125},{2,115},{2,132},{2,107},{2,124},{2,114},{2,131},{2,111},{2,125},{2,115},{2,132},{2,108},{2,128},{2,118},{2,135},{2,113},{2,129},{2,119},{2,136},{2,108},{2,128},{2,118},{2,135},{2,113},{2,129},{2,119},{2,136},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,107},{1,145},{1,124},{1,162},{1,114},{1,152},{1,131},{1,169},{1,109},{1,147},{1,126},{1,164},{1,116},{1,154},{1,133},{1,171},{1,109},{1,147},{1,126},{1,164},{1,116},{1,154},{1,133},{1,171},{1,108},{1,149},{1,128},{1,166},{1,118},{1,156},{1,135},{1,173},{1,108},{1,149},{1,128},{1,166},{1,118},{1,156},{1,135},{1,173},{1,110},{1,151},{1,130},{1,168},{1,120},{1,158},{1,137},{1,175},{1,110},{1,151},{1,130},{1,168},{1,120},{1,158},{1,137},{1,175}},
+        {{3,108},{3,118},{3,113},{3,119},{3,110},{3,120},{3,28},{3,29},{4,121},{4,123},{4,34},{4,35},{4,121},{4,123},{4,34},{4,35},{3,108},{3,118},{3,113},{3,119},{3,110},{3,120},{3,28},{3,29},{4,121},{4,123},{4,34},{4,35},{4,121},{4,123},{4,34},{4,35},{3,108},{3,118},{3,113},{3,119},{3,110},{3,120},{3,28},{3,29},{4,121},{4,123},{4,34},{4,35},{4,121},{4,123},{4,34},{4,35},{3,108},{3,118},{3,113},{3,119},{3,110},{3,120},{3,28},{3,29},{4,121},{4,123},{4,34},{4,35},{4,121},{4,123},{4,34},{4,35},{1,112},{1,148},{1,127},{1,165},{1,117},{1,155},{1,134},{1,172},{1,122},{1,159},{1,138},{1,176},{1,122},{1,159},{1,138},{1,176},{1,112},{1,148},{1,127},{1,165},{1,117},{1,155},{1,134},{1,172},{1,122},{1,159},{1,138},{1,176},{1,122},{1,159},{1,138},{1,176},{1,112},{1,148},{1,127},{1,165},{1,117},{1,155},{1,134},{1,172},{1,122},{1,159},{1,138},{1,176},{1,122},{1,159},{1,138},{1,176},{1,112},{1,148},{1,127},{1,165},{1,117},{1,155},{1,134},{1,172},{1,122},{1,159},{1,138},{1,176},{1,122},{1,159},{1,138},{1,176}},
+        {{0,108},{0,108},{0,149},{0,149},{0,128},{0,128},{0,166},{0,166},{0,108},{0,108},{0,149},{0,149},{0,128},{0,128},{0,166},{0,166},{0,108},{0,108},{0,149},{0,149},{0,128},{0,128},{0,166},{0,166},{0,108},{0,108},{0,149},{0,149},{0,128},{0,128},{0,166},{0,166},{0,110},{0,110},{0,151},{0,151},{0,130},{0,130},{0,168},{0,168},{0,110},{0,110},{0,151},{0,151},{0,130},{0,130},{0,168},{0,168},{0,110},{0,110},{0,151},{0,151},{0,130},{0,130},{0,168},{0,168},{0,110},{0,110},{0,151},{0,151},{0,130},{0,130},{0,168},{0,168},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177}},
+        {{0,108},{0,108},{0,149},{0,149},{0,128},{0,128},{0,166},{0,166},{0,118},{0,118},{0,156},{0,156},{0,135},{0,135},{0,173},{0,173},{0,108},{0,108},{0,149},{0,149},{0,128},{0,128},{0,166},{0,166},{0,118},{0,118},{0,156},{0,156},{0,135},{0,135},{0,173},{0,173},{0,110},{0,110},{0,151},{0,151},{0,130},{0,130},{0,168},{0,168},{0,120},{0,120},{0,158},{0,158},{0,137},{0,137},{0,175},{0,175},{0,110},{0,110},{0,151},{0,151},{0,130},{0,130},{0,168},{0,168},{0,120},{0,120},{0,158},{0,158},{0,137},{0,137},{0,175},{0,175},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,123},{1,123},{1,161},{1,161},{1,140},{1,140},{1,178},{1,178},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,123},{1,123},{1,161},{1,161},{1,140},{1,140},{1,178},{1,178},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,123},{1,123},{1,161},{1,161},{1,140},{1,140},{1,178},{1,178},{1,121},{1,121},{1,160},{1,160},{1,139},{1,139},{1,177},{1,177},{1,123},{1,123},{1,161},{1,161},{1,140},{1,140},{1,178},{1,178}},
+        {{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179}},
+        {{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{3,110},{3,120},{3,28},{3,29},{3,31},{3,32},{3,31},{3,32},{3,110},{3,120},{3,28},{3,29},{3,31},{3,32},{3,31},{3,32},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{3,110},{3,120},{3,28},{3,29},{3,31},{3,32},{3,31},{3,32},{3,110},{3,120},{3,28},{3,29},{3,31},{3,32},{3,31},{3,32},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,117},{1,155},{1,134},{1,172},{1,142},{1,180},{1,142},{1,180},{1,117},{1,155},{1,134},{1,172},{1,142},{1,180},{1,142},{1,180},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,117},{1,155},{1,134},{1,172},{1,142},{1,180},{1,142},{1,180},{1,117},{1,155},{1,134},{1,172},{1,142},{1,180},{1,142},{1,180}},
+        {{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{4,108},{4,113},{4,110},{4,28},{5,121},{5,34},{5,121},{5,34},{2,112},{2,127},{2,117},{2,134},{2,122},{2,138},{2,122},{2,138},{2,112},{2,127},{2,117},{2,134},{2,122},{2,138},{2,122},{2,138},{2,112},{2,127},{2,117},{2,134},{2,122},{2,138},{2,122},{2,138},{2,112},{2,127},{2,117},{2,134},{2,122},{2,138},{2,122},{2,138},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,115},{1,153},{1,132},{1,170},{1,141},{1,179},{1,141},{1,179},{1,119},{1,157},{1,136},{1,174},{1,143},{1,181},{1,143},{1,181},{1,119},{1,157},{1,136},{1,174},{1,143},{1,181},{1,143},{1,181},{1,119},{1,157},{1,136},{1,174},{1,143},{1,181},{1,143},{1,181},{1,119},{1,157},{1,136},{1,174},{1,143},{1,181},{1,143},{1,181}},
+        {{3,110},{3,120},{3,28},{3,29},{3,31},{3,32},{3,31},{3,32},{4,121},{4,123},{4,34},{4,35},{4,37},{4,38},{4,37},{4,38},{3,110},{3,120},{3,28},{3,29},{3,31},{3,32},{3,31},{3,32},{4,121},{4,123},{4,34},{4,35},{4,37},{4,38},{4,37},{4,38},{3,110},{3,120},{3,28},{3,29},{3,31},{3,32},{3,31},{3,32},{4,121},{4,123},{4,34},{4,35},{4,37},{4,38},{4,37},{4,38},{3,110},{3,120},{3,28},{3,29},{3,31},{3,32},{3,31},{3,32},{4,121},{4,123},{4,34},{4,35},{4,37},{4,38},{4,37},{4,38},{1,117},{1,155},{1,134},{1,172},{1,142},{1,180},{1,142},{1,180},{1,122},{1,159},{1,138},{1,176},{1,144},{1,182},{1,144},{1,182},{1,117},{1,155},{1,134},{1,172},{1,142},{1,180},{1,142},{1,180},{1,122},{1,159},{1,138},{1,176},{1,144},{1,182},{1,144},{1,182},{1,117},{1,155},{1,134},{1,172},{1,142},{1,180},{1,142},{1,180},{1,122},{1,159},{1,138},{1,176},{1,144},{1,182},{1,144},{1,182},{1,117},{1,155},{1,134},{1,172},{1,142},{1,180},{1,142},{1,180},{1,122},{1,159},{1,138},{1,176},{1,144},{1,182},{1,144},{1,182}},
+        {{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183}},
+        {{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{4,110},{4,28},{4,31},{4,31},{4,110},{4,28},{4,31},{4,31},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{4,110},{4,28},{4,31},{4,31},{4,110},{4,28},{4,31},{4,31},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{4,110},{4,28},{4,31},{4,31},{4,110},{4,28},{4,31},{4,31},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{4,110},{4,28},{4,31},{4,31},{4,110},{4,28},{4,31},{4,31},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,132},{1,170},{1,184},{1,184},{1,132},{1,170},{1,184},{1,184},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,132},{1,170},{1,184},{1,184},{1,132},{1,170},{1,184},{1,184},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,132},{1,170},{1,184},{1,184},{1,132},{1,170},{1,184},{1,184},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,132},{1,170},{1,184},{1,184},{1,132},{1,170},{1,184},{1,184}},
+        {{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{3,112},{3,117},{3,122},{3,122},{3,112},{3,117},{3,122},{3,122},{3,112},{3,117},{3,122},{3,122},{3,112},{3,117},{3,122},{3,122},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{3,112},{3,117},{3,122},{3,122},{3,112},{3,117},{3,122},{3,122},{3,112},{3,117},{3,122},{3,122},{3,112},{3,117},{3,122},{3,122},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,133},{1,171},{1,185},{1,185},{1,133},{1,171},{1,185},{1,185},{1,133},{1,171},{1,185},{1,185},{1,133},{1,171},{1,185},{1,185},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,133},{1,171},{1,185},{1,185},{1,133},{1,171},{1,185},{1,185},{1,133},{1,171},{1,185},{1,185},{1,133},{1,171},{1,185},{1,185}},
+        {{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{4,110},{4,28},{4,31},{4,31},{4,110},{4,28},{4,31},{4,31},{3,112},{3,117},{3,122},{3,122},{3,112},{3,117},{3,122},{3,122},{3,28},{3,29},{3,30},{3,30},{3,28},{3,29},{3,30},{3,30},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{4,110},{4,28},{4,31},{4,31},{4,110},{4,28},{4,31},{4,31},{3,112},{3,117},{3,122},{3,122},{3,112},{3,117},{3,122},{3,122},{3,28},{3,29},{3,30},{3,30},{3,28},{3,29},{3,30},{3,30},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,132},{1,170},{1,184},{1,184},{1,132},{1,170},{1,184},{1,184},{1,133},{1,171},{1,185},{1,185},{1,133},{1,171},{1,185},{1,185},{1,134},{1,172},{1,186},{1,186},{1,134},{1,172},{1,186},{1,186},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,132},{1,170},{1,184},{1,184},{1,132},{1,170},{1,184},{1,184},{1,133},{1,171},{1,185},{1,185},{1,133},{1,171},{1,185},{1,185},{1,134},{1,172},{1,186},{1,186},{1,134},{1,172},{1,186},{1,186}},
+        {{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187}},
+        {{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{4,110},{4,28},{4,31},{4,31},{4,110},{4,28},{4,31},{4,31},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{4,110},{4,28},{4,31},{4,31},{4,110},{4,28},{4,31},{4,31},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{2,117},{2,134},{2,142},{2,142},{2,117},{2,134},{2,142},{2,142},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{2,117},{2,134},{2,142},{2,142},{2,117},{2,134},{2,142},{2,142},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,132},{1,170},{1,184},{1,184},{1,132},{1,170},{1,184},{1,184},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,132},{1,170},{1,184},{1,184},{1,132},{1,170},{1,184},{1,184},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187},{1,136},{1,174},{1,188},{1,188},{1,136},{1,174},{1,188},{1,188},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187},{1,136},{1,174},{1,188},{1,188},{1,136},{1,174},{1,188},{1,188}},
+        {{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{5,108},{5,110},{6,121},{6,121},{3,112},{3,117},{3,122},{3,122},{3,112},{3,117},{3,122},{3,122},{3,112},{3,117},{3,122},{3,122},{3,112},{3,117},{3,122},{3,122},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{2,115},{2,132},{2,141},{2,141},{2,119},{2,136},{2,143},{2,143},{2,119},{2,136},{2,143},{2,143},{2,119},{2,136},{2,143},{2,143},{2,119},{2,136},{2,143},{2,143},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,131},{1,169},{1,183},{1,183},{1,133},{1,171},{1,185},{1,185},{1,133},{1,171},{1,185},{1,185},{1,133},{1,171},{1,185},{1,185},{1,133},{1,171},{1,185},{1,185},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187},{1,135},{1,173},{1,187},{1,187},{1,137},{1,175},{1,189},{1,189},{1,137},{1,175},{1,189},{1,189},{1,137},{1,175},{1,189},{1,189},{1,137},{1,175},{1,189},{1,189}},
+        {{3,28},{3,29},{3,30},{3,30},{3,28},{3,29},{3,30},{3,30},{4,34},{4,35},{4,36},{4,36},{4,34},{4,35},{4,36},{4,36},{3,28},{3,29},{3,30},{3,30},{3,28},{3,29},{3,30},{3,30},{4,34},{4,35},{4,36},{4,36},{4,34},{4,35},{4,36},{4,36},{3,28},{3,29},{3,30},{3,30},{3,28},{3,29},{3,30},{3,30},{4,34},{4,35},{4,36},{4,36},{4,34},{4,35},{4,36},{4,36},{3,28},{3,29},{3,30},{3,30},{3,28},{3,29},{3,30},{3,30},{4,34},{4,35},{4,36},{4,36},{4,34},{4,35},{4,36},{4,36},{1,134},{1,172},{1,186},{1,186},{1,134},{1,172},{1,186},{1,186},{1,138},{1,176},{1,190},{1,190},{1,138},{1,176},{1,190},{1,190},{1,134},{1,172},{1,186},{1,186},{1,134},{1,172},{1,186},{1,186},{1,138},{1,176},{1,190},{1,190},{1,138},{1,176},{1,190},{1,190},{1,134},{1,172},{1,186},{1,186},{1,134},{1,172},{1,186},{1,186},{1,138},{1,176},{1,190},{1,190},{1,138},{1,176},{1,190},{1,190},{1,134},{1,172},{1,186},{1,186},{1,134},{1,172},{1,186},{1,186},{1,138},{1,176},{1,190},{1,190},{1,138},{1,176},{1,190},{1,190}},
+        {{0,135},{0,135},{0,173},{0,173},{0,187},{0,187},{0,187},{0,187},{0,135},{0,135},{0,173},{0,173},{0,187},{0,187},{0,187},{0,187},{0,135},{0,135},{0,173},{0,173},{0,187},{0,187},{0,187},{0,187},{0,135},{0,135},{0,173},{0,173},{0,187},{0,187},{0,187},{0,187},{0,137},{0,137},{0,175},{0,175},{0,189},{0,189},{0,189},{0,189},{0,137},{0,137},{0,175},{0,175},{0,189},{0,189},{0,189},{0,189},{0,137},{0,137},{0,175},{0,175},{0,189},{0,189},{0,189},{0,189},{0,137},{0,137},{0,175},{0,175},{0,189},{0,189},{0,189},{0,189},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191},{1,140},{1,140},{1,178},{1,178},{1,191},{1,191},{1,191},{1,191}},
+        {{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192}},
+        {{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{3,28},{3,29},{3,30},{3,30},{3,31},{3,32},{3,33},{3,33},{3,28},{3,29},{3,30},{3,30},{3,31},{3,32},{3,33},{3,33},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{3,28},{3,29},{3,30},{3,30},{3,31},{3,32},{3,33},{3,33},{3,28},{3,29},{3,30},{3,30},{3,31},{3,32},{3,33},{3,33},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,134},{1,172},{1,186},{1,186},{1,142},{1,180},{1,193},{1,193},{1,134},{1,172},{1,186},{1,186},{1,142},{1,180},{1,193},{1,193},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,134},{1,172},{1,186},{1,186},{1,142},{1,180},{1,193},{1,193},{1,134},{1,172},{1,186},{1,186},{1,142},{1,180},{1,193},{1,193}},
+        {{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{4,110},{4,28},{4,31},{4,31},{5,121},{5,34},{5,37},{5,37},{2,117},{2,134},{2,142},{2,142},{2,122},{2,138},{2,144},{2,144},{2,117},{2,134},{2,142},{2,142},{2,122},{2,138},{2,144},{2,144},{2,117},{2,134},{2,142},{2,142},{2,122},{2,138},{2,144},{2,144},{2,117},{2,134},{2,142},{2,142},{2,122},{2,138},{2,144},{2,144},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,132},{1,170},{1,184},{1,184},{1,141},{1,179},{1,192},{1,192},{1,136},{1,174},{1,188},{1,188},{1,143},{1,181},{1,194},{1,194},{1,136},{1,174},{1,188},{1,188},{1,143},{1,181},{1,194},{1,194},{1,136},{1,174},{1,188},{1,188},{1,143},{1,181},{1,194},{1,194},{1,136},{1,174},{1,188},{1,188},{1,143},{1,181},{1,194},{1,194}},
+        {{3,28},{3,29},{3,30},{3,30},{3,31},{3,32},{3,33},{3,33},{4,34},{4,35},{4,36},{4,36},{4,37},{4,38},{4,6},{4,6},{3,28},{3,29},{3,30},{3,30},{3,31},{3,32},{3,33},{3,33},{4,34},{4,35},{4,36},{4,36},{4,37},{4,38},{4,6},{4,6},{3,28},{3,29},{3,30},{3,30},{3,31},{3,32},{3,33},{3,33},{4,34},{4,35},{4,36},{4,36},{4,37},{4,38},{4,6},{4,6},{3,28},{3,29},{3,30},{3,30},{3,31},{3,32},{3,33},{3,33},{4,34},{4,35},{4,36},{4,36},{4,37},{4,38},{4,6},{4,6},{1,134},{1,172},{1,186},{1,186},{1,142},{1,180},{1,193},{1,193},{1,138},{1,176},{1,190},{1,190},{1,144},{1,182},{1,195},{1,195},{1,134},{1,172},{1,186},{1,186},{1,142},{1,180},{1,193},{1,193},{1,138},{1,176},{1,190},{1,190},{1,144},{1,182},{1,195},{1,195},{1,134},{1,172},{1,186},{1,186},{1,142},{1,180},{1,193},{1,193},{1,138},{1,176},{1,190},{1,190},{1,144},{1,182},{1,195},{1,195},{1,134},{1,172},{1,186},{1,186},{1,142},{1,180},{1,193},{1,193},{1,138},{1,176},{1,190},{1,190},{1,144},{1,182},{1,195},{1,195}},
+        {{4,37},{4,38},{4,6},{4,6},{5,10},{5,10},{5,10},{5,10},{4,37},{4,38},{4,6},{4,6},{5,10},{5,10},{5,10},{5,10},{4,37},{4,38},{4,6},{4,6},{5,10},{5,10},{5,10},{5,10},{4,37},{4,38},{4,6},{4,6},{5,10},{5,10},{5,10},{5,10},{4,37},{4,38},{4,6},{4,6},{5,10},{5,10},{5,10},{5,10},{4,37},{4,38},{4,6},{4,6},{5,10},{5,10},{5,10},{5,10},{4,37},{4,38},{4,6},{4,6},{5,10},{5,10},{5,10},{5,10},{4,37},{4,38},{4,6},{4,6},{5,10},{5,10},{5,10},{5,10},{1,144},{1,182},{1,195},{1,195},{1,196},{1,196},{1,196},{1,196},{1,144},{1,182},{1,195},{1,195},{1,196},{1,196},{1,196},{1,196},{1,144},{1,182},{1,195},{1,195},{1,196},{1,196},{1,196},{1,196},{1,144},{1,182},{1,195},{1,195},{1,196},{1,196},{1,196},{1,196},{1,144},{1,182},{1,195},{1,195},{1,196},{1,196},{1,196},{1,196},{1,144},{1,182},{1,195},{1,195},{1,196},{1,196},{1,196},{1,196},{1,144},{1,182},{1,195},{1,195},{1,196},{1,196},{1,196},{1,196},{1,144},{1,182},{1,195},{1,195},{1,196},{1,196},{1,196},{1,196}}
+    };
+    static constexpr uint8_t edits[197][7] = {
+        {4,4,4,4,4,4,4},
+        {0,1,2,3,4,4,4},
+        {1,1,2,3,4,4,4},
+        {1,1,2,3,3,4,4},
+        {1,1,2,2,3,4,4},
+        {1,1,1,2,3,4,4},
+        {2,2,2,3,4,4,4},
+        {2,2,2,3,3,4,4},
+        {2,2,2,2,3,4,4},
+        {2,2,1,2,3,4,4},
+        {1,2,3,4,4,4,4},
+        {1,2,3,3,4,4,4},
+        {1,2,2,3,4,4,4},
+        {2,2,2,3,4,3,4},
+        {2,2,2,3,3,3,4},
+        {2,2,2,2,3,3,4},
+        {2,2,1,2,3,3,4},
+        {1,2,3,4,3,4,4},
+        {1,2,3,3,3,4,4},
+        {1,2,2,3,3,4,4},
+        {2,2,2,3,2,3,4},
+        {2,2,2,2,2,3,4},
+        {2,2,1,2,2,3,4},
+        {1,2,3,2,3,4,4},
+        {1,2,2,2,3,4,4},
+        {2,2,2,1,2,3,4},
+        {2,2,1,1,2,3,4},
+        {1,2,1,2,3,4,4},
+        {3,3,3,3,4,4,4},
+        {3,3,3,3,3,4,4},
+        {3,3,3,2,3,4,4},
+        {3,3,2,3,4,4,4},
+        {3,3,2,3,3,4,4},
+        {3,3,2,2,3,4,4},
+        {2,3,3,4,4,4,4},
+        {2,3,3,3,4,4,4},
+        {2,3,2,3,4,4,4},
+        {2,2,3,4,4,4,4},
+        {2,2,3,3,4,4,4},
+        {3,3,3,3,4,3,4},
+        {3,3,3,3,3,3,4},
+        {3,3,3,2,3,3,4},
+        {3,3,2,3,4,3,4},
+        {3,3,2,3,3,3,4},
+        {3,3,2,2,3,3,4},
+        {2,3,3,4,3,4,4},
+        {2,3,3,3,3,4,4},
+        {2,3,2,3,3,4,4},
+        {2,2,3,4,3,4,4},
+        {2,2,3,3,3,4,4},
+        {3,3,3,3,2,3,4},
+        {3,3,3,2,2,3,4},
+        {3,3,2,3,2,3,4},
+        {3,3,2,2,2,3,4},
+        {2,3,3,2,3,4,4},
+        {2,3,2,2,3,4,4},
+        {2,2,3,2,3,4,4},
+        {3,3,2,1,2,3,4},
+        {3,3,3,3,4,4,3},
+        {3,3,3,3,3,4,3},
+        {3,3,3,2,3,4,3},
+        {3,3,2,3,4,4,3},
+        {3,3,2,3,3,4,3},
+        {3,3,2,2,3,4,3},
+        {2,3,3,4,4,3,4},
+        {2,3,3,3,4,3,4},
+        {2,3,2,3,4,3,4},
+        {2,2,3,4,4,3,4},
+        {2,2,3,3,4,3,4},
+        {3,3,3,3,4,3,3},
+        {3,3,3,3,3,3,3},
+        {3,3,3,2,3,3,3},
+        {3,3,2,3,4,3,3},
+        {3,3,2,3,3,3,3},
+        {3,3,2,2,3,3,3},
+        {2,3,3,4,3,3,4},
+        {2,3,3,3,3,3,4},
+        {2,3,2,3,3,3,4},
+        {2,2,3,4,3,3,4},
+        {2,2,3,3,3,3,4},
+        {3,3,3,3,2,3,3},
+        {3,3,3,2,2,3,3},
+        {3,3,2,3,2,3,3},
+        {3,3,2,2,2,3,3},
+        {2,3,3,2,3,3,4},
+        {2,3,2,2,3,3,4},
+        {2,2,3,2,3,3,4},
+        {3,3,2,1,2,3,3},
+        {3,3,3,3,3,2,3},
+        {3,3,3,2,3,2,3},
+        {3,3,2,3,3,2,3},
+        {3,3,2,2,3,2,3},
+        {2,3,3,3,2,3,4},
+        {2,3,2,3,2,3,4},
+        {2,2,3,3,2,3,4},
+        {3,3,3,3,2,2,3},
+        {3,3,3,2,2,2,3},
+        {3,3,2,3,2,2,3},
+        {3,3,2,2,2,2,3},
+        {2,3,3,2,2,3,4},
+        {2,3,2,2,2,3,4},
+        {2,2,3,2,2,3,4},
+        {3,3,2,1,2,2,3},
+        {3,3,3,2,1,2,3},
+        {3,3,2,2,1,2,3},
+        {2,3,2,1,2,3,4},
+        {3,3,2,1,1,2,3},
+        {3,4,4,4,4,4,4},
+        {3,3,4,4,4,4,4},
+        {3,4,3,4,4,4,4},
+        {3,3,3,4,4,4,4},
+        {3,4,4,3,4,4,4},
+        {3,4,3,3,4,4,4},
+        {3,3,4,3,4,4,4},
+        {3,4,4,4,3,4,4},
+        {3,4,4,3,3,4,4},
+        {3,4,3,4,3,4,4},
+        {3,4,3,3,3,4,4},
+        {3,3,4,4,3,4,4},
+        {3,3,4,3,3,4,4},
+        {3,3,3,4,3,4,4},
+        {2,3,4,4,4,4,4},
+        {3,4,3,2,3,4,4},
+        {2,3,4,3,4,4,4},
+        {3,4,4,4,4,3,4},
+        {3,4,4,3,4,3,4},
+        {3,4,3,4,4,3,4},
+        {3,4,3,3,4,3,4},
+        {3,3,4,4,4,3,4},
+        {3,3,4,3,4,3,4},
+        {3,3,3,4,4,3,4},
+        {3,4,4,4,3,3,4},
+        {3,4,4,3,3,3,4},
+        {3,4,3,4,3,3,4},
+        {3,4,3,3,3,3,4},
+        {3,3,4,4,3,3,4},
+        {3,3,4,3,3,3,4},
+        {3,3,3,4,3,3,4},
+        {3,4,3,2,3,3,4},
+        {2,3,4,4,3,4,4},
+        {2,3,4,3,3,4,4},
+        {3,4,4,3,2,3,4},
+        {3,4,3,3,2,3,4},
+        {3,3,4,3,2,3,4},
+        {3,4,3,2,2,3,4},
+        {3,4,4,4,4,4,3},
+        {3,4,4,3,4,4,3},
+        {3,4,3,4,4,4,3},
+        {3,4,3,3,4,4,3},
+        {3,3,4,4,4,4,3},
+        {3,3,4,3,4,4,3},
+        {3,3,3,4,4,4,3},
+        {3,4,4,4,3,4,3},
+        {3,4,4,3,3,4,3},
+        {3,4,3,4,3,4,3},
+        {3,4,3,3,3,4,3},
+        {3,3,4,4,3,4,3},
+        {3,3,4,3,3,4,3},
+        {3,3,3,4,3,4,3},
+        {3,4,3,2,3,4,3},
+        {2,3,4,4,4,3,4},
+        {2,3,4,3,4,3,4},
+        {3,4,4,4,4,3,3},
+        {3,4,4,3,4,3,3},
+        {3,4,3,4,4,3,3},
+        {3,4,3,3,4,3,3},
+        {3,3,4,4,4,3,3},
+        {3,3,4,3,4,3,3},
+        {3,3,3,4,4,3,3},
+        {3,4,4,4,3,3,3},
+        {3,4,4,3,3,3,3},
+        {3,4,3,4,3,3,3},
+        {3,4,3,3,3,3,3},
+        {3,3,4,4,3,3,3},
+        {3,3,4,3,3,3,3},
+        {3,3,3,4,3,3,3},
+        {3,4,3,2,3,3,3},
+        {2,3,4,4,3,3,4},
+        {2,3,4,3,3,3,4},
+        {3,4,4,3,2,3,3},
+        {3,4,3,3,2,3,3},
+        {3,3,4,3,2,3,3},
+        {3,4,3,2,2,3,3},
+        {3,4,4,4,3,2,3},
+        {3,4,4,3,3,2,3},
+        {3,4,3,4,3,2,3},
+        {3,4,3,3,3,2,3},
+        {3,3,4,4,3,2,3},
+        {3,3,4,3,3,2,3},
+        {3,3,3,4,3,2,3},
+        {3,4,3,2,3,2,3},
+        {2,3,4,3,2,3,4},
+        {3,4,4,3,2,2,3},
+        {3,4,3,3,2,2,3},
+        {3,3,4,3,2,2,3},
+        {3,4,3,2,2,2,3},
+        {3,4,3,2,1,2,3}
+    };
+};
+// end of auto-generated code for N = 3
@@ -43,8 +43,8 @@ void LevenshteinDfa::dump_as_graphviz(std::ostream& out) const {
 
 LevenshteinDfa LevenshteinDfa::build(std::string_view target_string, uint8_t max_edits,
                                      Casing casing, DfaType dfa_type, Matching matching) {
-    if (max_edits != 1 && max_edits != 2) {
-        throw std::invalid_argument(make_string("Levenshtein DFA max_edits must be in {1, 2}, was %u", max_edits));
+    if (max_edits < 1 || max_edits > 3) {
+        throw std::invalid_argument(make_string("Levenshtein DFA max_edits must be in {1, 2, 3}, was %u", max_edits));
     }
     const bool is_cased    = (casing == Casing::Cased);
     const bool is_prefix   = (matching == Matching::Prefix);
@@ -53,20 +53,26 @@ LevenshteinDfa LevenshteinDfa::build(std::string_view target_string, uint8_t max
     if (dfa_type == DfaType::Implicit) {
         if (max_edits == 1) {
             return LevenshteinDfa(std::make_unique<ImplicitLevenshteinDfa<FixedMaxEditDistanceTraits<1>>>(std::move(target_string_u32), is_cased, is_prefix));
-        } else { // max_edits == 2
+        } else if (max_edits == 2) {
             return LevenshteinDfa(std::make_unique<ImplicitLevenshteinDfa<FixedMaxEditDistanceTraits<2>>>(std::move(target_string_u32), is_cased, is_prefix));
+        } else { // max_edits == 3
+            return LevenshteinDfa(std::make_unique<ImplicitLevenshteinDfa<FixedMaxEditDistanceTraits<3>>>(std::move(target_string_u32), is_cased, is_prefix));
         }
     } else if(dfa_type == DfaType::Explicit) {
         if (max_edits == 1) {
             return ExplicitLevenshteinDfaBuilder<FixedMaxEditDistanceTraits<1>>(std::move(target_string_u32), is_cased, is_prefix).build_dfa();
-        } else { // max_edits == 2
+        } else if (max_edits == 2) {
             return ExplicitLevenshteinDfaBuilder<FixedMaxEditDistanceTraits<2>>(std::move(target_string_u32), is_cased, is_prefix).build_dfa();
+        } else { // max_edits == 3
+            return ExplicitLevenshteinDfaBuilder<FixedMaxEditDistanceTraits<3>>(std::move(target_string_u32), is_cased, is_prefix).build_dfa();
         }
     } else { // DfaType::Table
         if (max_edits == 1) {
             return LevenshteinDfa(std::make_unique<TableDfa<1>>(std::move(target_string_u32), is_cased, is_prefix));
-        } else { // max_edits == 2
+        } else if (max_edits == 2) {
             return LevenshteinDfa(std::make_unique<TableDfa<2>>(std::move(target_string_u32), is_cased, is_prefix));
+        } else { // max_edits == 3
+            return LevenshteinDfa(std::make_unique<TableDfa<3>>(std::move(target_string_u32), is_cased, is_prefix));
         }
     }
 }
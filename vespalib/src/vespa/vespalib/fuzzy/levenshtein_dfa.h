@@ -296,7 +296,7 @@ public:
      * Builds and returns a Levenshtein DFA that matches all strings within `max_edits`
      * edits of `target_string`. The type of DFA returned is specified by dfa_type.
      *
-     * `max_edits` must be in {1, 2}. Throws std::invalid_argument if outside range.
+     * `max_edits` must be in {1, 2, 3}. Throws std::invalid_argument if outside range.
      *
      * `target_string` must not contain any null UTF-8 chars.
      */
@@ -6,5 +6,6 @@ namespace vespalib::fuzzy {
 
 template class TableDfa<1>;
 template class TableDfa<2>;
+template class TableDfa<3>;
 
 }
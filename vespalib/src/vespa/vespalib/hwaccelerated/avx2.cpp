@@ -2,6 +2,8 @@
 
 #include "avx2.h"
 #include "avxprivate.hpp"
+#include <algorithm>
+#include <immintrin.h>
 
 namespace vespalib::hwaccelerated {
 
@@ -25,6 +27,18 @@ Avx2Accelrator::squaredEuclideanDistance(const double * a, const double * b, siz
     return avx::euclideanDistanceSelectAlignment<double, 32>(a, b, sz);
 }
 
+IAccelerated::EuclideanDistanceKernelF32
+Avx2Accelrator::squaredEuclideanDistanceKernel(size_t sz) const noexcept {
+    switch (sz) {
+        case 128:  return avx::fixedEuclideanDistance<float, 32, 128>;
+        case 256:  return avx::fixedEuclideanDistance<float, 32, 256>;
+        case 384:  return avx::fixedEuclideanDistance<float, 32, 384>;
+        case 768:  return avx::fixedEuclideanDistance<float, 32, 768>;
+        case 1024: return avx::fixedEuclideanDistance<float, 32, 1024>;
+        default:   return nullptr;
+    }
+}
+
 void
 Avx2Accelrator::and128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept {
     helper::andChunks<32u, 4u>(offset, src, dest);
@@ -46,4 +60,45 @@ Avx2Accelrator::dotProduct(const int8_t * a, const int8_t * b, size_t sz) const
     return helper::multiplyAdd(a, b, sz);
 }
 
+size_t
+Avx2Accelrator::intersectU32(const uint32_t * a, size_t a_sz, const uint32_t * b, size_t b_sz, uint32_t * dest) const noexcept
+{
+    if (a_sz > b_sz) {
+        std::swap(a, b);
+        std::swap(a_sz, b_sz);
+    }
+    if (b_sz >= 8 * a_sz) {
+        // skewed sizes are handled better by galloping than by brute force
+        return GenericAccelrator::intersectU32(a, a_sz, b, b_sz, dest);
+    }
+    size_t cnt(0);
+    size_t i(0);
+    size_t j(0);
+    while ((i < a_sz) && ((j + 8) <= b_sz)) {
+        uint32_t cur = a[i];
+        __m256i va = _mm256_set1_epi32(cur);
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + j));
+        int found = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(va, vb)));
+        if (found != 0) {
+            dest[cnt++] = cur;
+        }
+        uint32_t window_max = b[j + 7];
+        if (cur <= window_max) {
+            i++;
+        }
+        if (cur >= window_max) {
+            j += 8;
+        }
+    }
+    while ((i < a_sz) && (j < b_sz)) {
+        uint32_t lo = a[i];
+        uint32_t hi = b[j];
+        dest[cnt] = lo;
+        cnt += (lo == hi);
+        i += (lo <= hi);
+        j += (hi <= lo);
+    }
+    return cnt;
+}
+
 }
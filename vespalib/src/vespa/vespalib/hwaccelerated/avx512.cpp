@@ -35,6 +35,18 @@ Avx512Accelrator::squaredEuclideanDistance(const double * a, const double * b, s
     return avx::euclideanDistanceSelectAlignment<double, 64>(a, b, sz);
 }
 
+IAccelerated::EuclideanDistanceKernelF32
+Avx512Accelrator::squaredEuclideanDistanceKernel(size_t sz) const noexcept {
+    switch (sz) {
+        case 128:  return avx::fixedEuclideanDistance<float, 64, 128>;
+        case 256:  return avx::fixedEuclideanDistance<float, 64, 256>;
+        case 384:  return avx::fixedEuclideanDistance<float, 64, 384>;
+        case 768:  return avx::fixedEuclideanDistance<float, 64, 768>;
+        case 1024: return avx::fixedEuclideanDistance<float, 64, 1024>;
+        default:   return nullptr;
+    }
+}
+
 void
 Avx512Accelrator::and128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept {
     helper::andChunks<64, 2>(offset, src, dest);
@@ -114,6 +114,13 @@ euclideanDistanceT(const T * af, const T * bf, size_t sz) noexcept
     return sum + sumT<T, V>(partial[0]);
 }
 
+template <typename T, unsigned VLEN, size_t SZ>
+double fixedEuclideanDistance(const T * af, const T * bf) noexcept
+{
+    // compile-time size lets the chunk loop be fully unrolled
+    return euclideanDistanceT<T, VLEN, 1, 1>(af, bf, SZ);
+}
+
 template <typename T, unsigned VLEN>
 double euclideanDistanceSelectAlignment(const T * af, const T * bf, size_t sz) noexcept
 {
@@ -2,6 +2,7 @@
 
 #include "generic.h"
 #include "private_helpers.hpp"
+#include <algorithm>
 #include <cblas.h>
 
 namespace vespalib::hwaccelerated {
@@ -177,6 +178,29 @@ GenericAccelrator::squaredEuclideanDistance(const double * a, const double * b,
     return squaredEuclideanDistanceT<double, 2>(a, b, sz);
 }
 
+namespace {
+
+template <typename T, size_t SZ>
+double
+fixedSquaredEuclideanDistance(const T * a, const T * b) noexcept
+{
+    return squaredEuclideanDistanceT<T, 2>(a, b, SZ);
+}
+
+}
+
+IAccelerated::EuclideanDistanceKernelF32
+GenericAccelrator::squaredEuclideanDistanceKernel(size_t sz) const noexcept {
+    switch (sz) {
+        case 128:  return fixedSquaredEuclideanDistance<float, 128>;
+        case 256:  return fixedSquaredEuclideanDistance<float, 256>;
+        case 384:  return fixedSquaredEuclideanDistance<float, 384>;
+        case 768:  return fixedSquaredEuclideanDistance<float, 768>;
+        case 1024: return fixedSquaredEuclideanDistance<float, 1024>;
+        default:   return nullptr;
+    }
+}
+
 void
 GenericAccelrator::and128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept {
     helper::andChunks<16, 8>(offset, src, dest);
@@ -187,4 +211,45 @@ GenericAccelrator::or128(size_t offset, const std::vector<std::pair<const void *
     helper::orChunks<16, 8>(offset, src, dest);
 }
 
+size_t
+GenericAccelrator::intersectU32(const uint32_t * a, size_t a_sz, const uint32_t * b, size_t b_sz, uint32_t * dest) const noexcept
+{
+    if (a_sz > b_sz) {
+        std::swap(a, b);
+        std::swap(a_sz, b_sz);
+    }
+    size_t cnt(0);
+    if (b_sz >= 8 * a_sz) {
+        // skewed sizes; gallop through the large array
+        const uint32_t * b_cur = b;
+        const uint32_t * b_end = b + b_sz;
+        for (size_t i(0); (i < a_sz) && (b_cur != b_end); i++) {
+            uint32_t want = a[i];
+            size_t step = 1;
+            const uint32_t * probe = b_cur;
+            while (((probe + step) < b_end) && (probe[step] <= want)) {
+                probe += step;
+                step <<= 1;
+            }
+            b_cur = std::lower_bound(probe, std::min(probe + step, b_end), want);
+            if ((b_cur != b_end) && (*b_cur == want)) {
+                dest[cnt++] = want;
+                ++b_cur;
+            }
+        }
+    } else {
+        size_t i(0);
+        size_t j(0);
+        while ((i < a_sz) && (j < b_sz)) {
+            uint32_t lo = a[i];
+            uint32_t hi = b[j];
+            dest[cnt] = lo;
+            cnt += (lo == hi);
+            i += (lo <= hi);
+            j += (hi <= lo);
+        }
+    }
+    return cnt;
+}
+
 }
@@ -27,8 +27,10 @@ public:
     double squaredEuclideanDistance(const int8_t * a, const int8_t * b, size_t sz) const noexcept override;
     double squaredEuclideanDistance(const float * a, const float * b, size_t sz) const noexcept override;
     double squaredEuclideanDistance(const double * a, const double * b, size_t sz) const noexcept override;
+    EuclideanDistanceKernelF32 squaredEuclideanDistanceKernel(size_t sz) const noexcept override;
     void and128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept override;
     void or128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept override;
+    size_t intersectU32(const uint32_t * a, size_t a_sz, const uint32_t * b, size_t b_sz, uint32_t * dest) const noexcept override;
 };
 
 }
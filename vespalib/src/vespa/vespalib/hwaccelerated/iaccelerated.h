@@ -32,10 +32,21 @@ public:
     virtual double squaredEuclideanDistance(const int8_t * a, const int8_t * b, size_t sz) const noexcept = 0;
     virtual double squaredEuclideanDistance(const float * a, const float * b, size_t sz) const noexcept = 0;
     virtual double squaredEuclideanDistance(const double * a, const double * b, size_t sz) const noexcept = 0;
+    // Distance kernel with the vector size baked in at compile time,
+    // fully unrolled for common fixed dimensions with no size checks
+    // in the loop body. Returns nullptr when no specialized kernel
+    // exists for the given size.
+    using EuclideanDistanceKernelF32 = double (*)(const float * a, const float * b);
+    virtual EuclideanDistanceKernelF32 squaredEuclideanDistanceKernel(size_t sz) const noexcept = 0;
     // AND 128 bytes from multiple, optionally inverted sources
     virtual void and128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept = 0;
     // OR 128 bytes from multiple, optionally inverted sources
     virtual void or128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept = 0;
+    // Intersect two sorted arrays of unique 32-bit values (e.g. docid
+    // lists), writing the common elements to dest and returning their
+    // count. dest must not overlap the input arrays and must have room
+    // for min(a_sz, b_sz) elements.
+    virtual size_t intersectU32(const uint32_t * a, size_t a_sz, const uint32_t * b, size_t b_sz, uint32_t * dest) const noexcept = 0;
 
     static const IAccelerated & getAccelerator() __attribute__((noinline));
 };
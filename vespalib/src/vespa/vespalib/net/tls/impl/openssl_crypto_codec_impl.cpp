@@ -407,6 +407,7 @@ EncodeResult OpenSslCryptoCodecImpl::encode(const char* plaintext, size_t plaint
             return encode_failed();
         }
         bytes_consumed = static_cast<size_t>(consumed);
+        ConnectionStatistics::get(_mode == Mode::Server).add_encoded_bytes(bytes_consumed);
     }
     const int produced = BIO_pending(_output_bio);
     return encoded_bytes(bytes_consumed, static_cast<size_t>(produced));
@@ -445,6 +446,7 @@ DecodeResult OpenSslCryptoCodecImpl::drain_and_produce_plaintext_from_ssl(
     const int produced = ::SSL_read(_ssl.get(), plaintext, static_cast<int>(plaintext_size));
     if (produced > 0) {
         // At least 1 frame decoded successfully.
+        ConnectionStatistics::get(_mode == Mode::Server).add_decoded_bytes(static_cast<size_t>(produced));
         return decoded_frames_with_plaintext_bytes(static_cast<size_t>(produced));
     } else {
         return remap_ssl_read_failure_to_decode_result(produced);
@@ -31,6 +31,12 @@ struct ConnectionStatistics {
     std::atomic<uint64_t> invalid_peer_credentials = 0;
     // Number of connections broken due to errors during TLS encoding or decoding
     std::atomic<uint64_t> broken_tls_connections   = 0;
+    // Number of plaintext bytes sealed into TLS records by encode.
+    // Together with the decoded counter this approximates the amount
+    // of symmetric crypto work performed.
+    std::atomic<uint64_t> tls_encoded_bytes        = 0;
+    // Number of plaintext bytes produced from TLS records by decode.
+    std::atomic<uint64_t> tls_decoded_bytes        = 0;
 
     void inc_insecure_connections() noexcept {
         insecure_connections.fetch_add(1, std::memory_order_relaxed);
@@ -47,6 +53,12 @@ struct ConnectionStatistics {
     void inc_broken_tls_connections() noexcept {
         broken_tls_connections.fetch_add(1, std::memory_order_relaxed);
     }
+    void add_encoded_bytes(uint64_t n) noexcept {
+        tls_encoded_bytes.fetch_add(n, std::memory_order_relaxed);
+    }
+    void add_decoded_bytes(uint64_t n) noexcept {
+        tls_decoded_bytes.fetch_add(n, std::memory_order_relaxed);
+    }
 
     struct Snapshot {
         uint64_t insecure_connections     = 0;
@@ -54,6 +66,8 @@ struct ConnectionStatistics {
         uint64_t failed_tls_handshakes    = 0;
         uint64_t invalid_peer_credentials = 0;
         uint64_t broken_tls_connections   = 0;
+        uint64_t tls_encoded_bytes        = 0;
+        uint64_t tls_decoded_bytes        = 0;
 
         [[nodiscard]] Snapshot subtract(const Snapshot& rhs) const noexcept;
     };
@@ -9,13 +9,32 @@ vespalib::string
 LowerCase::convert(std::string_view input)
 {
     vespalib::string output;
-    Utf8Reader r(input);
+    output.reserve(input.size());
     Utf8Writer w(output);
-
-    while (r.hasMore()) {
-        uint32_t lower = r.getChar();
-        uint32_t upper = convert(lower);
-        w.putChar(upper);
+    size_t pos = 0;
+    while (pos < input.size()) {
+        if (static_cast<unsigned char>(input[pos]) < 0x80) [[likely]] {
+            // Fast path: copy the longest run of ASCII bytes verbatim and
+            // lowercase it in place. Both the classification scan and the
+            // transform are plain byte loops the compiler can vectorize;
+            // only non-ASCII sequences take the full decode/encode path.
+            size_t end = pos + 1;
+            while ((end < input.size()) && (static_cast<unsigned char>(input[end]) < 0x80)) {
+                ++end;
+            }
+            size_t out_pos = output.size();
+            output.append(input.data() + pos, end - pos);
+            char *buf = &output[out_pos];
+            for (size_t i = 0; i < (end - pos); ++i) {
+                char c = buf[i];
+                buf[i] = ((c >= 'A') && (c <= 'Z')) ? char(c + ('a' - 'A')) : c;
+            }
+            pos = end;
+        } else {
+            Utf8Reader r(input.data() + pos, input.size() - pos);
+            w.putChar(convert(r.getChar()));
+            pos += r.getPos();
+        }
     }
     return output;
 }
@@ -25,9 +44,17 @@ LowerCase::convert_to_ucs4(std::string_view input)
 {
     std::vector<uint32_t> result;
     result.reserve(input.size());
-    Utf8Reader reader(input.data());
-    while (reader.hasMore()) {
-        result.emplace_back(convert(reader.getChar()));
+    size_t pos = 0;
+    while (pos < input.size()) {
+        unsigned char c = input[pos];
+        if (c < 0x80) [[likely]] {
+            result.emplace_back(lowercase_0_block[c]);
+            ++pos;
+        } else {
+            Utf8Reader r(input.data() + pos, input.size() - pos);
+            result.emplace_back(convert(r.getChar()));
+            pos += r.getPos();
+        }
     }
     return result;
 }
@@ -4,6 +4,10 @@
 #include "memory_allocator.h"
 #include "round_up_to_page_size.h"
 #include <sys/mman.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 #include <vespa/vespalib/util/stringfmt.h>
 #include <vespa/vespalib/util/exceptions.h>
 #include <vespa/vespalib/util/backtrace.h>
@@ -27,6 +31,13 @@ namespace {
 std::atomic<bool> _G_hasHugePageFailureJustHappened(false);
 bool _G_SilenceCoreOnOOM(false);
 int  _G_HugeFlags = 0;
+bool _G_MMapInterleave = false;
+#ifdef __linux__
+std::atomic<bool> _G_hasInterleaveFailureJustHappened(false);
+constexpr size_t INTERLEAVE_NODEMASK_WORDS = 16;
+unsigned long _G_InterleaveNodeMask[INTERLEAVE_NODEMASK_WORDS];
+unsigned long _G_InterleaveMaxNode = 0;
+#endif
 size_t _G_MMapLogLimit = std::numeric_limits<size_t>::max();
 size_t _G_MMapNoCoreLimit = std::numeric_limits<size_t>::max();
 std::mutex _G_lock;
@@ -64,10 +75,58 @@ readOptionalEnvironmentVar(const char * name, size_t defaultValue) {
     return defaultValue;
 }
 
+#ifdef __linux__
+
+#ifndef MPOL_INTERLEAVE
+#define MPOL_INTERLEAVE 3
+#endif
+#ifndef MPOL_F_MEMS_ALLOWED
+#define MPOL_F_MEMS_ALLOWED (1 << 2)
+#endif
+
+/*
+ * Query the set of memory nodes the process is allowed to use.
+ * Interleaving only makes sense when more than one node is available.
+ */
+bool detectInterleaveNodes()
+{
+    constexpr unsigned long maskBits = INTERLEAVE_NODEMASK_WORDS * sizeof(unsigned long) * 8;
+    long res = syscall(SYS_get_mempolicy, nullptr, _G_InterleaveNodeMask, maskBits,
+                       nullptr, MPOL_F_MEMS_ALLOWED);
+    if (res != 0) {
+        return false;
+    }
+    size_t numNodes = 0;
+    for (size_t word = 0; word < INTERLEAVE_NODEMASK_WORDS; ++word) {
+        unsigned long bits = _G_InterleaveNodeMask[word];
+        numNodes += __builtin_popcountl(bits);
+        if (bits != 0) {
+            _G_InterleaveMaxNode = word * sizeof(unsigned long) * 8 + (8 * sizeof(unsigned long) - __builtin_clzl(bits));
+        }
+    }
+    return numNodes > 1;
+}
+
+void interleaveMapping(void * buf, size_t sz)
+{
+    long res = syscall(SYS_mbind, buf, sz, MPOL_INTERLEAVE, _G_InterleaveNodeMask, _G_InterleaveMaxNode, 0);
+    if (res != 0) {
+        if ( ! load_relaxed(_G_hasInterleaveFailureJustHappened)) {
+            store_relaxed(_G_hasInterleaveFailureJustHappened, true);
+            LOG(warning, "Failed mbind(%p, %ld, MPOL_INTERLEAVE) errno(%d). Mapping stays on local node.", buf, sz, errno);
+        }
+    } else {
+        store_relaxed(_G_hasInterleaveFailureJustHappened, false);
+    }
+}
+
+#endif
+
 void initializeEnvironment()
 {
 #ifdef __linux__
     _G_HugeFlags = (getenv("VESPA_USE_HUGEPAGES") != nullptr) ? MAP_HUGETLB : 0;
+    _G_MMapInterleave = (getenv("VESPA_MMAP_INTERLEAVE") != nullptr) && detectInterleaveNodes();
 #else
     _G_HugeFlags = 0;
 #endif
@@ -371,6 +430,9 @@ MMapAllocator::salloc(size_t sz, void * wantedAddress)
         if (madvise(buf, sz, MADV_HUGEPAGE) != 0) {
             // Just an advise, not everyone will listen...
         }
+        if (_G_MMapInterleave) {
+            interleaveMapping(buf, sz);
+        }
         if (sz >= _G_MMapNoCoreLimit) {
             if (madvise(buf, sz, MADV_DONTDUMP) != 0) {
                 LOG(warning, "Failed madvise(%p, %ld, MADV_DONTDUMP) = '%s'", buf, sz, FastOS_FileInterface::getLastErrorString().c_str());
@@ -115,6 +115,17 @@ public:
         node.total_time += elapsed;
         _state.pop_back();
     }
+    void track_count(TaskId task) override {
+        auto &edges = _state.empty() ? _roots : _nodes[_state.back().node].children;
+        auto [pos, was_new] = edges.insert(std::make_pair(task, _nodes.size()));
+        NodeId node = pos->second; // extending _nodes might invalidate lookup result
+        if (was_new) {
+            assert(node == _nodes.size());
+            _nodes.emplace_back(task);
+        }
+        assert(node < _nodes.size());
+        ++_nodes[node].count;
+    }
     void report(slime::Cursor &obj, ReportContext &ctx) const override {
         obj.setString("profiler", "tree");
         obj.setLong("depth", ctx.get_max_depth());
@@ -198,6 +209,12 @@ public:
             _state.back().overlap += elapsed;
         }
     }
+    void track_count(TaskId task) override {
+        if (task >= _nodes.size()) {
+            _nodes.resize(task + 1);
+        }
+        ++_nodes[task].count;
+    }
     void report(slime::Cursor &obj, ReportContext &ctx) const override {
         obj.setString("profiler", "flat");
         obj.setLong("topn", _topn);
@@ -30,6 +30,7 @@ public:
         virtual ~Impl() = default;
         virtual void track_start(TaskId task) = 0;
         virtual void track_complete() = 0;
+        virtual void track_count(TaskId task) = 0;
         virtual void report(slime::Cursor &obj, ReportContext &ctx) const = 0;
     };
     using NameMapper = std::function<vespalib::string(const vespalib::string &)>;
@@ -56,6 +57,14 @@ public:
             _impl->track_complete();
         }
     }
+    // Counts an instantaneous event without sampling the clock. The
+    // event is reported as a sub-task of the currently executing task
+    // with a count but no measured time.
+    void count(TaskId task) {
+        if (_level < _max_depth) {
+            _impl->track_count(task);
+        }
+    }
     void report(slime::Cursor &obj, const NameMapper &name_mapper =
                 [](const vespalib::string &name) noexcept { return name; }) const;
 };
@@ -99,10 +99,10 @@ GenerationHandler::update_oldest_used_generation()
 GenerationHandler::GenerationHandler()
     : _generation(0),
       _oldest_used_generation(0),
-      _last(nullptr),
       _first(nullptr),
       _free(nullptr),
-      _numHolds(0u)
+      _numHolds(0u),
+      _last(nullptr)
 {
     _last = _first = new GenerationHold;
     ++_numHolds;
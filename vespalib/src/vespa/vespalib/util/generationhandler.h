@@ -22,8 +22,11 @@ public:
      * This must be type stable memory, and cannot be freed before the
      * GenerationHandler is freed (i.e. when external methods ensure that
      * no readers are still active).
+     *
+     * Aligned to a cache line to keep the reader-bumped ref count from
+     * false sharing with neighboring heap objects (e.g. other holds).
      */
-    class GenerationHold
+    class alignas(64) GenerationHold
     {
         // least significant bit is invalid flag
         std::atomic<uint32_t> _refCount;
@@ -85,10 +88,13 @@ public:
 private:
     std::atomic<generation_t>     _generation;
     std::atomic<generation_t>     _oldest_used_generation;
-    std::atomic<GenerationHold *> _last;      // Points to "current generation" entry
     GenerationHold               *_first;     // Points to "firstUsedGeneration" entry
     GenerationHold               *_free;      // List of free entries
     uint32_t                      _numHolds;  // Number of allocated generation hold entries
+    // Read by all reader threads on every takeGuard(); kept on its own
+    // cache line so writer updates to the fields above do not
+    // invalidate it.
+    alignas(64) std::atomic<GenerationHold *> _last; // Points to "current generation" entry
 
     void set_generation(generation_t generation) noexcept { _generation.store(generation, std::memory_order_relaxed); }
 
@@ -10,6 +10,24 @@ using vespalib::alloc::Alloc;
 
 namespace vespalib::compression {
 
+namespace {
+
+// The extState entry points require caller-provided scratch state, and
+// allocating it anew dominates the cost for small inputs. Keep one lazily
+// allocated state per thread instead, mirroring the thread-local contexts
+// in zstdcompressor.cpp.
+thread_local Alloc _tlFastState;
+thread_local Alloc _tlHCState;
+
+void * get_state(Alloc & state, size_t wantSize) {
+    if (state.size() < wantSize) {
+        state = Alloc::alloc(wantSize);
+    }
+    return state.get();
+}
+
+}
+
 size_t LZ4Compressor::adjustProcessLen(uint16_t, size_t len)   const { return LZ4_compressBound(len); }
 
 bool
@@ -20,11 +38,11 @@ LZ4Compressor::process(CompressionConfig config, const void * inputV, size_t inp
     int sz(-1);
     int maxOutputLen = LZ4_compressBound(inputLen);
     if (config.compressionLevel > 6) {
-        Alloc state = Alloc::alloc(LZ4_sizeofStateHC());
-        sz = LZ4_compress_HC_extStateHC(state.get(), input, output, inputLen, maxOutputLen, config.compressionLevel);
+        void * state = get_state(_tlHCState, LZ4_sizeofStateHC());
+        sz = LZ4_compress_HC_extStateHC(state, input, output, inputLen, maxOutputLen, config.compressionLevel);
     } else {
-        Alloc state = Alloc::alloc(LZ4_sizeofState());
-        sz = LZ4_compress_fast_extState(state.get(), input, output, inputLen, maxOutputLen, 1);
+        void * state = get_state(_tlFastState, LZ4_sizeofState());
+        sz = LZ4_compress_fast_extState(state, input, output, inputLen, maxOutputLen, 1);
     }
     assert(sz != 0);
     outputLenV = sz;
@@ -6,6 +6,7 @@
 #include <vespa/vespalib/util/stringfmt.h>
 
 #include <vespa/vespalib/util/exceptions.h>
+#include <cctype>
 #include <vespa/log/log.h>
 
 LOG_SETUP(".vespalib.util.regexp");
@@ -27,6 +28,17 @@ bool maybe_none(char c) {
 const vespalib::string special("^|()[]{}.*?+\\$");
 bool is_special(char c) { return special.find(c) != special.npos; }
 
+// pop the last character from a literal run, including all bytes of a
+// multi-byte UTF-8 sequence
+void pop_utf8_char(vespalib::string &run) {
+    while (!run.empty() && ((static_cast<unsigned char>(run[run.size() - 1]) & 0xc0) == 0x80)) {
+        run.resize(run.size() - 1);
+    }
+    if (!run.empty()) {
+        run.resize(run.size() - 1);
+    }
+}
+
 vespalib::string escape(std::string_view str) {
     vespalib::string result;
     for (char c: str) {
@@ -51,12 +63,147 @@ RegexpUtil::get_prefix(std::string_view re)
             prefix.push_back(*pos);
         }
         if ((pos < end) && maybe_none(*pos) && !prefix.empty()) {
-            prefix.resize(prefix.size() - 1); // pop_back
+            pop_utf8_char(prefix);
         }
     }
     return prefix;
 }
 
+vespalib::string
+RegexpUtil::get_required_substring(std::string_view re)
+{
+    vespalib::string best;
+    vespalib::string run;
+    const char *pos = re.data();
+    const char *end = re.data() + re.size();
+    auto flush = [&run, &best]() {
+        if (run.size() > best.size()) {
+            best = run;
+        }
+        run.clear();
+    };
+    while (pos < end) {
+        char c = *pos;
+        if (!is_special(c)) {
+            run.push_back(c);
+            ++pos;
+            continue;
+        }
+        if (c == '|') {
+            // no single substring is required by all alternatives
+            return {};
+        }
+        if (maybe_none(c)) {
+            // the preceding literal may occur zero times
+            pop_utf8_char(run);
+            if (c == '{') {
+                while ((pos < end) && (*pos != '}')) {
+                    ++pos;
+                }
+            }
+            ++pos;
+            flush();
+            continue;
+        }
+        if (c == '\\') {
+            pos += 2; // the escaped char may be a class shorthand
+            flush();
+            continue;
+        }
+        if (c == '[') {
+            ++pos;
+            if ((pos < end) && (*pos == '^')) {
+                ++pos;
+            }
+            if ((pos < end) && (*pos == ']')) {
+                ++pos; // leading ']' is a literal member
+            }
+            while ((pos < end) && (*pos != ']')) {
+                if (*pos == '\\') {
+                    ++pos;
+                }
+                ++pos;
+            }
+            ++pos;
+            flush();
+            continue;
+        }
+        if (c == '(') {
+            if (((pos + 1) < end) && (pos[1] == '?')) {
+                // '(?' introduces inline flags (e.g. '(?i)') that can change
+                // how the rest of the pattern matches; no literal extracted
+                // here can be trusted, so require nothing at all
+                return {};
+            }
+            // require nothing from groups; they may be optional
+            size_t depth = 1;
+            ++pos;
+            while ((pos < end) && (depth > 0)) {
+                if (*pos == '\\') {
+                    ++pos;
+                } else if (*pos == '(') {
+                    ++depth;
+                } else if (*pos == ')') {
+                    --depth;
+                }
+                ++pos;
+            }
+            flush();
+            continue;
+        }
+        // '^', '$', '.', '+' and stray closing brackets end the run
+        // without invalidating it
+        ++pos;
+        flush();
+    }
+    flush();
+    return best;
+}
+
+bool
+RegexpUtil::get_literal(std::string_view re, vespalib::string &literal,
+                        bool &anchored_start, bool &anchored_end)
+{
+    literal.clear();
+    anchored_start = false;
+    anchored_end = false;
+    const char *pos = re.data();
+    const char *end = re.data() + re.size();
+    if ((pos < end) && (*pos == '^')) {
+        anchored_start = true;
+        ++pos;
+    }
+    if ((pos < end) && (end[-1] == '$')) {
+        // a trailing '\$' is a literal member, not an anchor
+        size_t backslashes = 0;
+        for (const char *p = end - 2; (p >= pos) && (*p == '\\'); --p) {
+            ++backslashes;
+        }
+        if ((backslashes % 2) == 0) {
+            anchored_end = true;
+            --end;
+        }
+    }
+    while (pos < end) {
+        char c = *pos;
+        if (c == '\\') {
+            if ((pos + 1) >= end) {
+                return false;
+            }
+            c = *++pos;
+            if (isalnum(static_cast<unsigned char>(c))) {
+                // class shorthand or back reference
+                return false;
+            }
+        } else if (is_special(c)) {
+            return false;
+        }
+        literal.push_back(c);
+        ++pos;
+    }
+    return true;
+}
+
 vespalib::string
 RegexpUtil::make_from_suffix(std::string_view suffix)
 {
@@ -23,6 +23,40 @@ public:
      **/
     static vespalib::string get_prefix(std::string_view re);
 
+    /**
+     * Look at the given regular expression and identify the longest
+     * literal substring that must be present for a string to match
+     * it, regardless of anchoring. This can be used to cheaply reject
+     * candidate strings before running the full regular expression
+     * engine. Note that this function is simple and conservative; it
+     * requires nothing from groups, character classes or alternated
+     * expressions and might underestimate the actual size of the
+     * required substring.
+     *
+     * @param re Regular expression.
+     * @return substring that must be present in matching strings
+     **/
+    static vespalib::string get_required_substring(std::string_view re);
+
+    /**
+     * Check if the given regular expression is a pure literal,
+     * containing nothing but plain and escaped characters with
+     * optional leading '^' and trailing '$' anchors. Such expressions
+     * (for example those produced by make_from_suffix and
+     * make_from_substring) can be matched with plain string
+     * comparison without involving the regular expression engine. On
+     * success the unescaped literal and the anchoring is stored in
+     * the output parameters.
+     *
+     * @param re Regular expression.
+     * @param literal where to store the unescaped literal
+     * @param anchored_start set to whether the literal is anchored at the start
+     * @param anchored_end set to whether the literal is anchored at the end
+     * @return whether the expression is a pure literal
+     **/
+    static bool get_literal(std::string_view re, vespalib::string &literal,
+                            bool &anchored_start, bool &anchored_end);
+
     /**
      * Make a regexp matching strings with the given suffix.
      *
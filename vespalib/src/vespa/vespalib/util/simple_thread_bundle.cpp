@@ -98,6 +98,32 @@ SimpleThreadBundle::Pool::release(SimpleThreadBundle::UP bundle)
     bundle.release();
 }
 
+SimpleThreadBundle::Pool::LazyGuard::~LazyGuard()
+{
+    if (_bundle) {
+        _pool.release(std::move(_bundle));
+    }
+}
+
+void
+SimpleThreadBundle::Pool::LazyGuard::run(Runnable* const* targets, size_t cnt)
+{
+    if (cnt > size()) {
+        throw IllegalArgumentException("too many targets");
+    }
+    if (cnt == 0) {
+        return;
+    }
+    if (cnt == 1) {
+        targets[0]->run();
+        return;
+    }
+    if (!_bundle) {
+        _bundle = _pool.obtain();
+    }
+    _bundle->run(targets, cnt);
+}
+
 //-----------------------------------------------------------------------------
 
 SimpleThreadBundle::SimpleThreadBundle(size_t size_in, Runnable::init_fun_t init_fun, Strategy strategy)
@@ -114,10 +114,32 @@ public:
             SimpleThreadBundle::UP  _bundle;
             Pool                   &_pool;
         };
+        /**
+         * Guard that only obtains a bundle from the pool when asked to
+         * run more than one target in parallel. Single-target runs are
+         * performed directly in the calling thread, so cheap requests
+         * bypass both the pool lock and the bundle reservation
+         * completely. An obtained bundle is kept until the guard dies.
+         **/
+        class LazyGuard : public ThreadBundle {
+        public:
+            explicit LazyGuard(Pool & pool) noexcept : _bundle(), _pool(pool) {}
+            LazyGuard(const LazyGuard &) = delete;
+            LazyGuard & operator =(const LazyGuard &) = delete;
+            ~LazyGuard() override;
+            size_t size() const override { return _pool.getBundleSize(); }
+            using ThreadBundle::run;
+            void run(Runnable* const* targets, size_t cnt) override;
+        private:
+            SimpleThreadBundle::UP  _bundle;
+            Pool                   &_pool;
+        };
         Pool(size_t bundleSize, init_fun_t init_fun);
         explicit Pool(size_t bundleSize) : Pool(bundleSize, Runnable::default_init_function) {}
         ~Pool();
         Guard getBundle() { return Guard(*this); }
+        LazyGuard getLazyBundle() { return LazyGuard(*this); }
+        size_t getBundleSize() const { return _bundleSize; }
         //TODO Make private
         SimpleThreadBundle::UP obtain();
         void release(SimpleThreadBundle::UP bundle);
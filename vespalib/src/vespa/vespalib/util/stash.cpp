@@ -2,29 +2,79 @@
 
 #include "stash.h"
 #include <algorithm>
+#include <atomic>
 
 namespace vespalib {
 namespace stash {
 
 namespace {
 
-Chunk *free_chunks(Chunk *chunk, Chunk *until = nullptr) {
+// Per-thread pool of default-sized chunks, letting short-lived stashes
+// (one per query in the match and docsum paths) recycle chunk memory
+// across requests instead of paying a malloc/free round-trip each
+// time. Only chunks of the default size are pooled; stashes with
+// custom chunk sizes fall through to malloc. Pooled chunks are plain
+// malloc'd memory, so it does not matter which thread a chunk is
+// returned from.
+constexpr size_t POOLED_CHUNK_SIZE = 4096;
+constexpr size_t MAX_POOLED_CHUNKS = 256; // at most 1 MiB cached per thread
+
+std::atomic<size_t> pool_hits(0);
+std::atomic<size_t> pool_misses(0);
+
+struct ChunkPool {
+    Chunk  *head = nullptr;
+    size_t  count = 0;
+    ~ChunkPool() {
+        while (head != nullptr) {
+            void *mem = head;
+            head = head->next;
+            free(mem);
+        }
+    }
+};
+
+thread_local ChunkPool chunk_pool;
+
+void *alloc_chunk_mem(size_t chunk_size) {
+    if ((chunk_size == POOLED_CHUNK_SIZE) && (chunk_pool.head != nullptr)) {
+        Chunk *chunk = chunk_pool.head;
+        chunk_pool.head = chunk->next;
+        --chunk_pool.count;
+        pool_hits.fetch_add(1, std::memory_order_relaxed);
+        return chunk;
+    }
+    pool_misses.fetch_add(1, std::memory_order_relaxed);
+    return malloc(chunk_size);
+}
+
+void free_chunk_mem(Chunk *chunk, size_t chunk_size) {
+    if ((chunk_size == POOLED_CHUNK_SIZE) && (chunk_pool.count < MAX_POOLED_CHUNKS)) {
+        chunk->next = chunk_pool.head;
+        chunk_pool.head = chunk;
+        ++chunk_pool.count;
+    } else {
+        free(chunk);
+    }
+}
+
+Chunk *free_chunks(Chunk *chunk, size_t chunk_size, Chunk *until = nullptr) {
     while (chunk != until) {
-        void *mem = chunk;
+        Chunk *mem = chunk;
         chunk = chunk->next;
-        free(mem);
+        free_chunk_mem(mem, chunk_size);
     }
     return until;
 }
 
-Chunk *keep_one(Chunk *chunk) {
+Chunk *keep_one(Chunk *chunk, size_t chunk_size) {
     if (chunk != nullptr) {
         Chunk *next = chunk->next;
         while (next != nullptr) {
-            void *mem = chunk;
+            Chunk *mem = chunk;
             chunk = next;
             next = chunk->next;
-            free(mem);
+            free_chunk_mem(mem, chunk_size);
         }
         chunk->clear();
         return chunk;
@@ -45,15 +95,42 @@ Cleanup *run_cleanup(Cleanup *cleanup, Cleanup *until = nullptr) {
 
 } // namespace vespalib::stash
 
+Stash::ChunkPoolStats
+Stash::get_chunk_pool_stats() noexcept
+{
+    return {stash::pool_hits.load(std::memory_order_relaxed),
+            stash::pool_misses.load(std::memory_order_relaxed)};
+}
+
 char *
 Stash::do_alloc(size_t size)
 {
     if (is_small(size)) {
-        void *chunk_mem = malloc(_chunk_size);
-        _chunks = new (chunk_mem) stash::Chunk(_chunks);
+        if (_free_chunks != nullptr) {
+            stash::Chunk *chunk = _free_chunks;
+            _free_chunks = chunk->next;
+            chunk->next = _chunks;
+            _chunks = chunk;
+        } else {
+            void *chunk_mem = stash::alloc_chunk_mem(_chunk_size);
+            _chunks = new (chunk_mem) stash::Chunk(_chunks);
+        }
         return _chunks->alloc(size, _chunk_size);
     } else {
         size_t allocate = sizeof(stash::DeleteMemory) + size;
+        stash::Cleanup *prev = nullptr;
+        for (stash::Cleanup *block = _free_blocks; block != nullptr; prev = block, block = block->next) {
+            if (block->allocated() == allocate) {
+                if (prev != nullptr) {
+                    prev->next = block->next;
+                } else {
+                    _free_blocks = block->next;
+                }
+                block->next = _cleanup;
+                _cleanup = block;
+                return (reinterpret_cast<char*>(block) + sizeof(stash::DeleteMemory));
+            }
+        }
         char *mem = static_cast<char*>(malloc(allocate));
         _cleanup = new (mem) stash::DeleteMemory(allocate, _cleanup);
         return (mem + sizeof(stash::DeleteMemory));
@@ -63,6 +140,8 @@ Stash::do_alloc(size_t size)
 Stash::Stash(size_t chunk_size) noexcept
     : _chunks(nullptr),
       _cleanup(nullptr),
+      _free_chunks(nullptr),
+      _free_blocks(nullptr),
       _chunk_size(std::max(size_t(128), chunk_size))
 {
 }
@@ -70,43 +149,82 @@ Stash::Stash(size_t chunk_size) noexcept
 Stash::Stash(Stash &&rhs) noexcept
     : _chunks(rhs._chunks),
       _cleanup(rhs._cleanup),
+      _free_chunks(rhs._free_chunks),
+      _free_blocks(rhs._free_blocks),
       _chunk_size(rhs._chunk_size)
 {
     rhs._chunks = nullptr;
     rhs._cleanup = nullptr;
+    rhs._free_chunks = nullptr;
+    rhs._free_blocks = nullptr;
 }
 
 Stash &
 Stash::operator=(Stash &&rhs) noexcept
 {
     stash::run_cleanup(_cleanup);
-    stash::free_chunks(_chunks);
+    stash::free_chunks(_chunks, _chunk_size);
+    stash::run_cleanup(_free_blocks);
+    stash::free_chunks(_free_chunks, _chunk_size);
     _chunks = rhs._chunks;
     _cleanup = rhs._cleanup;
+    _free_chunks = rhs._free_chunks;
+    _free_blocks = rhs._free_blocks;
     _chunk_size = rhs._chunk_size;
     rhs._chunks = nullptr;
     rhs._cleanup = nullptr;
+    rhs._free_chunks = nullptr;
+    rhs._free_blocks = nullptr;
     return *this;
 }
 
 Stash::~Stash()
 {
     stash::run_cleanup(_cleanup);
-    stash::free_chunks(_chunks);
+    stash::free_chunks(_chunks, _chunk_size);
+    stash::run_cleanup(_free_blocks);
+    stash::free_chunks(_free_chunks, _chunk_size);
 }
 
 void
 Stash::clear()
 {
     _cleanup = stash::run_cleanup(_cleanup);
-    _chunks = stash::keep_one(_chunks);
+    _chunks = stash::keep_one(_chunks, _chunk_size);
+}
+
+void
+Stash::reuse()
+{
+    // blocks that found no takers since the last round are freed here
+    _free_blocks = stash::run_cleanup(_free_blocks);
+    stash::Cleanup *cleanup = _cleanup;
+    while (cleanup != nullptr) {
+        stash::Cleanup *next = cleanup->next;
+        if (cleanup->allocated() > 0) {
+            // raw memory block; keep it around for later re-use
+            cleanup->next = _free_blocks;
+            _free_blocks = cleanup;
+        } else {
+            cleanup->cleanup();
+        }
+        cleanup = next;
+    }
+    _cleanup = nullptr;
+    while (_chunks != nullptr) {
+        stash::Chunk *chunk = _chunks;
+        _chunks = chunk->next;
+        chunk->clear();
+        chunk->next = _free_chunks;
+        _free_chunks = chunk;
+    }
 }
 
 void
 Stash::revert(const Mark &mark)
 {
     _cleanup = stash::run_cleanup(_cleanup, mark._cleanup);
-    _chunks = stash::free_chunks(_chunks, mark._chunk);
+    _chunks = stash::free_chunks(_chunks, _chunk_size, mark._chunk);
     if (_chunks != nullptr) {
         _chunks->used = mark._used;
     }
@@ -136,6 +254,12 @@ Stash::get_memory_usage() const
         allocated += extra;
         used += extra;
     }
+    for (stash::Chunk *chunk = _free_chunks; chunk != nullptr; chunk = chunk->next) {
+        allocated += _chunk_size;
+    }
+    for (auto block = _free_blocks; block; block = block->next) {
+        allocated += block->allocated();
+    }
     return {allocated, used, 0, 0};
 }
 
@@ -12,7 +12,7 @@ namespace vespalib {
 namespace stash {
 
 struct Cleanup {
-    Cleanup * const next;
+    Cleanup *next;
     explicit Cleanup(Cleanup *next_in) noexcept : next(next_in) {}
     virtual void cleanup() = 0;
     virtual size_t allocated() const noexcept { return 0; }
@@ -86,6 +86,8 @@ class Stash
 private:
     stash::Chunk   *_chunks;
     stash::Cleanup *_cleanup;
+    stash::Chunk   *_free_chunks;
+    stash::Cleanup *_free_blocks;
     size_t          _chunk_size;
 
     char *do_alloc(size_t size);
@@ -130,6 +132,18 @@ public:
         Mark() noexcept : Mark(nullptr, nullptr) {}
     };
 
+    /**
+     * Statistics for the per-thread pool of default-sized chunks,
+     * aggregated across all threads. A high miss count relative to
+     * hits indicates stashes with non-default chunk sizes or pool
+     * overflow due to many concurrently live stashes.
+     **/
+    struct ChunkPoolStats {
+        size_t hits;   // chunk allocations served from a thread-local pool
+        size_t misses; // chunk allocations that went to malloc
+    };
+    static ChunkPoolStats get_chunk_pool_stats() noexcept;
+
     using UP = std::unique_ptr<Stash>;
     explicit Stash(size_t chunk_size) noexcept ;
     Stash() noexcept : Stash(4096) {}
@@ -142,6 +156,18 @@ public:
 
     void clear();
 
+    /**
+     * Destructs all objects currently owned by this stash while
+     * keeping the underlying memory around for re-use. Chunks are
+     * recycled directly and memory blocks allocated outside the
+     * chunks are handed out again for later allocations of the exact
+     * same size, making repeated evaluations with stable allocation
+     * patterns (e.g. tensor intermediates of fixed shape) avoid
+     * malloc round-trips. Blocks that are not re-used before the next
+     * call to this function are freed.
+     **/
+    void reuse();
+
     Mark mark() const noexcept { return Mark(_cleanup, _chunks); }
     void revert(const Mark &mark);
 
@@ -0,0 +1,137 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "tagged_memory_allocator.h"
+#include <cassert>
+
+namespace vespalib::alloc {
+
+void
+AllocationTagStats::note_alloc(size_t sz) noexcept
+{
+    _alloc_count.fetch_add(1, std::memory_order_relaxed);
+    _total_alloc_bytes.fetch_add(sz, std::memory_order_relaxed);
+    size_t live = _live_bytes.fetch_add(sz, std::memory_order_relaxed) + sz;
+    size_t peak = _peak_bytes.load(std::memory_order_relaxed);
+    while ((live > peak) && !_peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void
+AllocationTagStats::note_free(size_t sz) noexcept
+{
+    _free_count.fetch_add(1, std::memory_order_relaxed);
+    _live_bytes.fetch_sub(sz, std::memory_order_relaxed);
+}
+
+void
+AllocationTagStats::note_resize(size_t old_sz, size_t new_sz) noexcept
+{
+    if (new_sz >= old_sz) {
+        size_t grow = new_sz - old_sz;
+        _total_alloc_bytes.fetch_add(grow, std::memory_order_relaxed);
+        size_t live = _live_bytes.fetch_add(grow, std::memory_order_relaxed) + grow;
+        size_t peak = _peak_bytes.load(std::memory_order_relaxed);
+        while ((live > peak) && !_peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    } else {
+        _live_bytes.fetch_sub(old_sz - new_sz, std::memory_order_relaxed);
+    }
+}
+
+TaggedMemoryAllocator::TaggedMemoryAllocator(std::shared_ptr<AllocationTagStats> stats,
+                                             const MemoryAllocator* backing) noexcept
+    : _stats(std::move(stats)),
+      _owned_backing(),
+      _backing(backing)
+{
+}
+
+TaggedMemoryAllocator::TaggedMemoryAllocator(std::shared_ptr<AllocationTagStats> stats,
+                                             std::unique_ptr<MemoryAllocator> backing) noexcept
+    : _stats(std::move(stats)),
+      _owned_backing(std::move(backing)),
+      _backing(_owned_backing.get())
+{
+}
+
+TaggedMemoryAllocator::~TaggedMemoryAllocator() = default;
+
+PtrAndSize
+TaggedMemoryAllocator::alloc(size_t sz) const
+{
+    PtrAndSize result = _backing->alloc(sz);
+    _stats->note_alloc(result.size());
+    return result;
+}
+
+void
+TaggedMemoryAllocator::free(PtrAndSize alloc) const noexcept
+{
+    _stats->note_free(alloc.size());
+    _backing->free(alloc);
+}
+
+size_t
+TaggedMemoryAllocator::resize_inplace(PtrAndSize current, size_t newSize) const
+{
+    size_t result = _backing->resize_inplace(current, newSize);
+    if (result > 0) {
+        _stats->note_resize(current.size(), result);
+    }
+    return result;
+}
+
+AllocationTagRegistry::AllocationTagRegistry()
+    : _lock(),
+      _tags()
+{
+}
+
+AllocationTagRegistry::~AllocationTagRegistry() = default;
+
+std::shared_ptr<AllocationTagStats>
+AllocationTagRegistry::get_stats(const vespalib::string& tag)
+{
+    std::lock_guard guard(_lock);
+    auto itr = _tags.find(tag);
+    if (itr == _tags.end()) {
+        itr = _tags.insert(std::make_pair(tag, std::make_shared<AllocationTagStats>())).first;
+    }
+    return itr->second;
+}
+
+std::unique_ptr<MemoryAllocator>
+AllocationTagRegistry::make_tagged_allocator(const vespalib::string& tag, const MemoryAllocator* backing)
+{
+    assert(backing != nullptr);
+    return std::make_unique<TaggedMemoryAllocator>(get_stats(tag), backing);
+}
+
+std::unique_ptr<MemoryAllocator>
+AllocationTagRegistry::make_tagged_allocator(const vespalib::string& tag, std::unique_ptr<MemoryAllocator> backing)
+{
+    assert(backing);
+    return std::make_unique<TaggedMemoryAllocator>(get_stats(tag), std::move(backing));
+}
+
+std::map<vespalib::string, AllocationTagSnapshot>
+AllocationTagRegistry::snapshot() const
+{
+    std::map<vespalib::string, AllocationTagSnapshot> result;
+    std::lock_guard guard(_lock);
+    for (const auto& tag : _tags) {
+        const auto& stats = *tag.second;
+        result[tag.first] = AllocationTagSnapshot{stats.live_bytes(), stats.peak_bytes(), stats.alloc_count(),
+                                                  stats.free_count(), stats.total_alloc_bytes()};
+    }
+    return result;
+}
+
+AllocationTagRegistry&
+AllocationTagRegistry::instance()
+{
+    static AllocationTagRegistry registry;
+    return registry;
+}
+
+}
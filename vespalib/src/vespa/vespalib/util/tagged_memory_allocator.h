@@ -0,0 +1,97 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include "memory_allocator.h"
+#include <vespa/vespalib/stllike/string.h>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace vespalib::alloc {
+
+/*
+ * Statistics tracked for a single allocation tag. Updated with relaxed
+ * atomics by all tagged allocators sharing the tag.
+ */
+class AllocationTagStats {
+    std::atomic<size_t> _live_bytes;
+    std::atomic<size_t> _peak_bytes;
+    std::atomic<size_t> _alloc_count;
+    std::atomic<size_t> _free_count;
+    std::atomic<size_t> _total_alloc_bytes;
+public:
+    AllocationTagStats() noexcept
+        : _live_bytes(0),
+          _peak_bytes(0),
+          _alloc_count(0),
+          _free_count(0),
+          _total_alloc_bytes(0)
+    { }
+    void note_alloc(size_t sz) noexcept;
+    void note_free(size_t sz) noexcept;
+    void note_resize(size_t old_sz, size_t new_sz) noexcept;
+    size_t live_bytes() const noexcept { return _live_bytes.load(std::memory_order_relaxed); }
+    size_t peak_bytes() const noexcept { return _peak_bytes.load(std::memory_order_relaxed); }
+    size_t alloc_count() const noexcept { return _alloc_count.load(std::memory_order_relaxed); }
+    size_t free_count() const noexcept { return _free_count.load(std::memory_order_relaxed); }
+    size_t total_alloc_bytes() const noexcept { return _total_alloc_bytes.load(std::memory_order_relaxed); }
+};
+
+/*
+ * Plain value snapshot of the statistics for an allocation tag.
+ */
+struct AllocationTagSnapshot {
+    size_t live_bytes;
+    size_t peak_bytes;
+    size_t alloc_count;
+    size_t free_count;
+    size_t total_alloc_bytes;
+};
+
+/*
+ * Memory allocator proxy accounting all allocations to an allocation
+ * tag before forwarding them to the backing allocator. The backing
+ * allocator can be owned (e.g. an mmap file allocator) or a pointer to
+ * one of the global allocators.
+ */
+class TaggedMemoryAllocator : public MemoryAllocator {
+    std::shared_ptr<AllocationTagStats> _stats;
+    std::unique_ptr<MemoryAllocator>    _owned_backing;
+    const MemoryAllocator*              _backing;
+public:
+    TaggedMemoryAllocator(std::shared_ptr<AllocationTagStats> stats, const MemoryAllocator* backing) noexcept;
+    TaggedMemoryAllocator(std::shared_ptr<AllocationTagStats> stats, std::unique_ptr<MemoryAllocator> backing) noexcept;
+    ~TaggedMemoryAllocator() override;
+    PtrAndSize alloc(size_t sz) const override;
+    void free(PtrAndSize alloc) const noexcept override;
+    size_t resize_inplace(PtrAndSize current, size_t newSize) const override;
+};
+
+/*
+ * Registry of allocation tags, handing out tagged allocator proxies to
+ * components and snapshots of the per-tag statistics to reporting. The
+ * statistics for a tag are shared between all allocators created with
+ * that tag and outlive the allocators themselves.
+ */
+class AllocationTagRegistry {
+    mutable std::mutex _lock;
+    std::map<vespalib::string, std::shared_ptr<AllocationTagStats>> _tags;
+
+    AllocationTagRegistry();
+    ~AllocationTagRegistry();
+    AllocationTagRegistry(const AllocationTagRegistry &) = delete;
+    AllocationTagRegistry& operator=(const AllocationTagRegistry &) = delete;
+    std::shared_ptr<AllocationTagStats> get_stats(const vespalib::string& tag);
+public:
+    // wraps one of the global allocators (backing must outlive the result)
+    std::unique_ptr<MemoryAllocator> make_tagged_allocator(const vespalib::string& tag, const MemoryAllocator* backing);
+    // wraps and takes over ownership of a component specific allocator
+    std::unique_ptr<MemoryAllocator> make_tagged_allocator(const vespalib::string& tag, std::unique_ptr<MemoryAllocator> backing);
+    std::map<vespalib::string, AllocationTagSnapshot> snapshot() const;
+
+    static AllocationTagRegistry& instance();
+};
+
+}
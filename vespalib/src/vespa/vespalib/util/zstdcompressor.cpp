@@ -3,7 +3,9 @@
 #include "zstdcompressor.h"
 #include <vespa/vespalib/util/alloc.h>
 #include <zstd.h>
+#include <zdict.h>
 #include <cassert>
+#include <cstring>
 
 using vespalib::alloc::Alloc;
 
@@ -60,4 +62,58 @@ ZStdCompressor::unprocess(const void * inputV, size_t inputLen, void * outputV,
     return ! ZSTD_isError(sz);
 }
 
+bool
+ZStdCompressor::process_with_dictionary(CompressionConfig config, ConstBufferRef dictionary,
+                                        const void * inputV, size_t inputLen, void * outputV, size_t & outputLenV)
+{
+    size_t maxOutputLen = ZSTD_compressBound(inputLen);
+    if ( ! _tlCompressState) {
+        _tlCompressState = std::make_unique<CompressContext>();
+    }
+    size_t sz = ZSTD_compress_usingDict(_tlCompressState->get(), outputV, maxOutputLen, inputV, inputLen,
+                                        dictionary.data(), dictionary.size(), config.compressionLevel);
+    assert( ! ZSTD_isError(sz) );
+    outputLenV = sz;
+    return ! ZSTD_isError(sz);
+}
+
+bool
+ZStdCompressor::unprocess_with_dictionary(ConstBufferRef dictionary,
+                                          const void * inputV, size_t inputLen, void * outputV, size_t & outputLenV)
+{
+    if ( ! _tlDecompressState) {
+        _tlDecompressState = std::make_unique<DecompressContext>();
+    }
+    size_t sz = ZSTD_decompress_usingDict(_tlDecompressState->get(), outputV, outputLenV, inputV, inputLen,
+                                          dictionary.data(), dictionary.size());
+    assert( ! ZSTD_isError(sz) );
+    outputLenV = sz;
+    return ! ZSTD_isError(sz);
+}
+
+std::vector<char>
+ZStdCompressor::train_dictionary(size_t maxSize, const std::vector<ConstBufferRef> &samples)
+{
+    size_t blobSize = 0;
+    for (const auto &sample : samples) {
+        blobSize += sample.size();
+    }
+    std::vector<char> blob;
+    blob.reserve(blobSize);
+    std::vector<size_t> sampleSizes;
+    sampleSizes.reserve(samples.size());
+    for (const auto &sample : samples) {
+        blob.insert(blob.end(), sample.c_str(), sample.c_str() + sample.size());
+        sampleSizes.push_back(sample.size());
+    }
+    std::vector<char> dictionary(maxSize);
+    size_t sz = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(),
+                                      blob.data(), sampleSizes.data(), sampleSizes.size());
+    if (ZDICT_isError(sz)) {
+        return {};
+    }
+    dictionary.resize(sz);
+    return dictionary;
+}
+
 }
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "compressor.h"
+#include <vector>
 
 namespace vespalib::compression {
 
@@ -11,6 +12,25 @@ public:
     bool process(CompressionConfig config, const void * input, size_t inputLen, void * output, size_t & outputLen) override;
     bool unprocess(const void * input, size_t inputLen, void * output, size_t & outputLen) override;
     size_t adjustProcessLen(uint16_t options, size_t len)   const override;
+
+    /**
+     * Compress using a shared dictionary trained on representative
+     * samples. Improves ratio considerably for small buffers. The
+     * same dictionary must be presented when decompressing.
+     */
+    bool process_with_dictionary(CompressionConfig config, ConstBufferRef dictionary,
+                                 const void * input, size_t inputLen, void * output, size_t & outputLen);
+    bool unprocess_with_dictionary(ConstBufferRef dictionary,
+                                   const void * input, size_t inputLen, void * output, size_t & outputLen);
+
+    /**
+     * Train a dictionary from sample buffers.
+     * @param maxSize the maximum size of the produced dictionary.
+     * @param samples representative uncompressed buffers.
+     * @return the serialized dictionary, empty if training failed
+     *         (e.g. too few samples).
+     */
+    static std::vector<char> train_dictionary(size_t maxSize, const std::vector<ConstBufferRef> &samples);
 };
 
 }